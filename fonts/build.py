@@ -0,0 +1,235 @@
+#!/usr/bin/env python3
+"""Generate the font headers of include/ and the font packs listed in
+manifest.txt.
+
+Builds fontconvert, then converts the entries of the manifest in parallel,
+one fontconvert process per entry. Headers (.h) are written into include/.
+Font packs (.bin) are written into fonts/: the entries of the same pack are
+converted with -b and put together behind a FontPackHeader (see
+src/fontpack.h), in the order of the manifest.
+
+An output is only regenerated when one of its inputs changed: the font
+files, the entries of the manifest, the source of fontconvert and, for
+subsets, the characters charset.py finds. The first line of every header,
+and the id of every pack, records the digest of these inputs.
+
+Usage:
+  ./build.py [-j JOBS] [--force] [OUTPUT...]
+
+Generates the given outputs only, if any, and all of them otherwise.
+"""
+
+import argparse
+import concurrent.futures
+import hashlib
+import os
+import re
+import struct
+import subprocess
+import sys
+import time
+
+import charset
+
+FONTS = os.path.dirname(os.path.abspath(__file__))
+INCLUDE = os.path.join(FONTS, "../include")
+MANIFEST = os.path.join(FONTS, "manifest.txt")
+CONVERTER = os.path.join(FONTS, "fontconvert")
+CONVERTER_SOURCE = os.path.join(FONTS, "fontconvert.c")
+
+STAMP = "// Generated by fonts/build.py from manifest.txt, inputs %s\n"
+
+# FontPackHeader of src/fontpack.h: magic, version, number of fonts, size
+# and id
+PACK_HEADER = struct.Struct("<4sHHI16s")
+PACK_MAGIC = b"GFXP"
+PACK_VERSION = 2
+
+
+class Entry:
+    """A line of the manifest"""
+
+    def __init__(self, line, fields):
+        if len(fields) < 5:
+            raise ValueError("manifest.txt:%d: expected output, font, size, "
+                             "first and last" % line)
+        self.line = line
+        self.output, self.font, self.size, self.first, self.last = fields[:5]
+        self.options = fields[5:]
+
+    def symbol(self):
+        """Name fontconvert gives the font, as charset.py knows it"""
+        name = re.sub(r"[^0-9A-Za-z]", "_", os.path.splitext(self.font)[0])
+        return "%s%spt%db" % (name, self.size,
+                              8 if int(self.last) > 127 else 7)
+
+    def arguments(self, chars):
+        """fontconvert arguments, with `chars` in place of "@charset" and
+        the font file relative to fonts/"""
+        options = [chars if option == "@charset" else option
+                   for option in self.options]
+        return options + [self.font, self.size, self.first, self.last]
+
+    def digest(self, chars, converter):
+        """Digest of the inputs of the header"""
+        h = hashlib.sha256()
+        h.update(converter)
+        with open(os.path.join(FONTS, self.font), "rb") as f:
+            h.update(f.read())
+        h.update("\0".join(self.arguments(chars)).encode())
+        return h.hexdigest()[:16]
+
+
+class Output:
+    """A header, converted from one entry, or a pack, from several"""
+
+    def __init__(self, name):
+        self.name = name
+        self.entries = []
+        self.pack = name.endswith(".bin")
+        self.path = os.path.join(FONTS if self.pack else INCLUDE, name)
+
+    def stamp(self, digests):
+        """Stamp of the output made of entries of the given digests"""
+        if self.pack:
+            h = hashlib.sha256("\0".join(digests).encode())
+            return h.hexdigest()[:16].encode()
+        return STAMP % digests[0]
+
+    def current_stamp(self):
+        try:
+            if self.pack:
+                with open(self.path, "rb") as f:
+                    header = f.read(PACK_HEADER.size)
+                return PACK_HEADER.unpack(header)[4]
+            with open(self.path, encoding="utf-8") as f:
+                return f.readline()
+        except (FileNotFoundError, struct.error):
+            return None
+
+    def write(self, stamp, results):
+        """Writes the output from the results of fontconvert, in the order
+        of the entries"""
+        if self.pack:
+            size = PACK_HEADER.size + sum(len(result) for result in results)
+            data = PACK_HEADER.pack(PACK_MAGIC, PACK_VERSION, len(results),
+                                    size, stamp) + b"".join(results)
+        else:
+            data = stamp.encode() + results[0]
+        with open(self.path + ".tmp", "wb") as f:
+            f.write(data)
+        os.replace(self.path + ".tmp", self.path)
+
+
+def read_manifest():
+    outputs = {}
+    with open(MANIFEST, encoding="utf-8") as f:
+        for number, line in enumerate(f, 1):
+            fields = line.split("#", 1)[0].split()
+            if not fields:
+                continue
+            entry = Entry(number, fields)
+            output = outputs.setdefault(entry.output, Output(entry.output))
+            if output.pack != ("-b" in entry.options):
+                raise ValueError("manifest.txt:%d: packs (.bin), and only "
+                                 "them, are converted with -b" % number)
+            if output.entries and not output.pack:
+                raise ValueError("manifest.txt:%d: %s is already listed" %
+                                 (number, entry.output))
+            output.entries.append(entry)
+    return list(outputs.values())
+
+
+def subset_chars(entry, fonts, reasons):
+    """Characters of the subset of `entry`, if it has one"""
+    if "@charset" not in entry.options:
+        return None
+    chars = fonts.get(entry.symbol(), set())
+    if chars is None:
+        raise ValueError("%s draws %s: it cannot be subset" %
+                         (entry.symbol(), reasons[entry.symbol()]))
+    if not chars:
+        raise ValueError("%s is not drawn" % entry.symbol())
+    return "".join(sorted(chars))
+
+
+def convert(entry, chars):
+    """Runs fontconvert for `entry`. Returns its output and messages."""
+    start = time.monotonic()
+    result = subprocess.run([CONVERTER] + entry.arguments(chars), cwd=FONTS,
+                            capture_output=True)
+    messages = result.stderr.decode(errors="replace")
+    if result.returncode != 0:
+        raise RuntimeError("%s (manifest.txt:%d): fontconvert failed\n%s" %
+                           (entry.output, entry.line, messages))
+    return result.stdout, "%s: %s converted in %.2f s\n%s" % (
+        entry.output, entry.symbol(), time.monotonic() - start, messages)
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description="Generate the font headers and packs listed in "
+        "manifest.txt")
+    parser.add_argument("-j", "--jobs", type=int, default=os.cpu_count(),
+                        help="conversions run in parallel (default: cores)")
+    parser.add_argument("--force", action="store_true",
+                        help="convert even the outputs that are up to date")
+    parser.add_argument("outputs", nargs="*",
+                        help="outputs to generate (default: all)")
+    args = parser.parse_args()
+
+    subprocess.run(["make", "-s", "-C", FONTS, "fontconvert"], check=True)
+    with open(CONVERTER_SOURCE, "rb") as f:
+        converter = f.read()
+    with open(charset.DEFAULT_SOURCE, encoding="utf-8") as f:
+        fonts, reasons = charset.scan(f.read())
+
+    try:
+        outputs = read_manifest()
+    except ValueError as error:
+        sys.exit(error)
+    unknown = set(args.outputs) - set(output.name for output in outputs)
+    if unknown:
+        sys.exit("Not in manifest.txt: %s" % " ".join(sorted(unknown)))
+
+    jobs = []
+    current = 0
+    for output in outputs:
+        if args.outputs and output.name not in args.outputs:
+            continue
+        try:
+            chars = [subset_chars(entry, fonts, reasons)
+                     for entry in output.entries]
+        except ValueError as error:
+            sys.exit("%s: %s" % (output.name, error))
+        stamp = output.stamp([entry.digest(c, converter)
+                              for entry, c in zip(output.entries, chars)])
+        if not args.force and output.current_stamp() == stamp:
+            current += 1
+        else:
+            jobs.append((output, chars, stamp))
+
+    failed = False
+    with concurrent.futures.ThreadPoolExecutor(max(args.jobs, 1)) as pool:
+        futures = [[pool.submit(convert, entry, c)
+                    for entry, c in zip(output.entries, chars)]
+                   for output, chars, _ in jobs]
+        for (output, _, stamp), conversions in zip(jobs, futures):
+            results = []
+            for future in conversions:
+                try:
+                    result, messages = future.result()
+                    results.append(result)
+                    sys.stdout.write(messages)
+                except RuntimeError as error:
+                    sys.stderr.write("%s\n" % error)
+                    failed = True
+            if len(results) == len(conversions):
+                output.write(stamp, results)
+    print("%d generated, %d up to date" % (len(jobs), current))
+    if failed:
+        sys.exit(1)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,145 @@
+#!/usr/bin/env python3
+"""Find the characters the firmware draws with each font.
+
+Scans src/screens.cpp for the texts drawn with each font: string literals,
+and the possible output of the printf formats that fill the drawn buffers.
+A font that also draws texts only known at run time (a setting, a payload
+field) needs all its characters and cannot be subset.
+
+Usage:
+  ./charset.py [screens.cpp]          list the fonts and their characters
+  ./charset.py [screens.cpp] FONT     print the characters of FONT, for
+                                      `fontconvert -c`
+
+The second form fails if FONT draws texts only known at run time. Example:
+  ./fontconvert -z -k -c "$(./charset.py IBMPlexSans_SemiBold40pt8b)" \\
+      IBMPlexSans-SemiBold.ttf 40 32 191
+
+build.py does this for the entries of manifest.txt with "-c @charset".
+"""
+
+import collections
+import os
+import re
+import sys
+
+DEFAULT_SOURCE = os.path.join(os.path.dirname(os.path.abspath(__file__)),
+                              "../src/screens.cpp")
+
+# Calls that select a font, fill a buffer or draw a text, in source order
+CALLS = re.compile(
+    r"setFreeFont\(\s*&(?P<font>\w+)\s*\)"
+    r"|sn?printf\(\s*\w+\s*,(?:\s*sizeof\(\s*\w+\s*\)\s*,)?"
+    r"\s*(?P<format>\"(?:[^\"\\]|\\.)*\")"
+    r"|drawCentreString\(\s*(?P<centred>.*?)\s*,\s*kCenterX"
+    r"|drawField\(\s*[^,]+,\s*&(?P<fieldFont>\w+)\s*,\s*(?P<field>[^,]+),",
+    re.S)
+
+CONVERSION = re.compile(
+    r"%(?P<flags>[-+ #0]*)(?P<width>\d*)(?:\.\d+)?(?:hh|h|ll|l|L|z|j|t)?"
+    r"(?P<type>[diouxXeEfFgGaAcsp%])")
+
+DIGITS = "0123456789"
+# What each conversion can print, besides the flags and the padding
+CONVERSION_CHARS = {
+    "d": DIGITS + "-", "i": DIGITS + "-", "u": DIGITS, "o": "01234567",
+    "x": DIGITS + "abcdef", "X": DIGITS + "ABCDEF", "%": "%",
+    "f": DIGITS + "-.nafi", "F": DIGITS + "-.NAFI",
+    "e": DIGITS + "-.+enafi", "E": DIGITS + "-.+ENAFI",
+    "g": DIGITS + "-.+enafi", "G": DIGITS + "-.+ENAFI",
+    "a": DIGITS + "abcdef-.+xpni", "A": DIGITS + "ABCDEF-.+XPNI",
+}
+
+
+def literal(token):
+    """Value of a C string literal, or None if `token` is not one"""
+    if not (token.startswith('"') and token.endswith('"')):
+        return None
+    return token[1:-1].encode().decode("unicode_escape").encode(
+        "latin-1").decode()
+
+
+def format_chars(fmt):
+    """Characters a printf format can print, or None if it prints strings"""
+    chars = set()
+    for part in re.split(r"(%[^a-zA-Z%]*(?:hh|h|ll|l|L|z|j|t)?[a-zA-Z%])",
+                         fmt):
+        match = CONVERSION.fullmatch(part)
+        if not part.startswith("%"):
+            chars.update(part)
+        elif match is None or match["type"] in "csp":
+            return None
+        else:
+            chars.update(CONVERSION_CHARS[match["type"]])
+            chars.update(c for c in match["flags"] if c in "+ ")
+            if match["width"] and "-" not in match["flags"]:
+                chars.add("0" if "0" in match["flags"] else " ")
+            elif match["width"]:
+                chars.add(" ")
+    return chars
+
+
+def scan(source):
+    """Maps each font to the set of its characters, or to None if it draws
+    texts only known at run time, and to the reason why"""
+    text = re.sub(r"//[^\n]*|/\*.*?\*/", "", source, flags=re.S)
+    fonts = collections.OrderedDict()
+    reasons = {}
+    font = None
+    buffer_chars = None
+
+    def add(font, expression):
+        if fonts.get(font, set()) is None:
+            return
+        chars = fonts.setdefault(font, set())
+        for part in expression.split("+"):
+            part = part.strip()
+            value = literal(part)
+            if value is not None:
+                chars.update(value)
+            elif re.fullmatch(r"\w+\.c_str\(\)|text", part) and buffer_chars:
+                chars.update(buffer_chars)
+            else:
+                fonts[font] = None
+                reasons[font] = part
+                return
+
+    for call in CALLS.finditer(text):
+        if call["font"]:
+            font = call["font"]
+        elif call["format"]:
+            buffer_chars = format_chars(literal(call["format"]))
+        elif call["centred"]:
+            add(font, call["centred"])
+        else:
+            add(call["fieldFont"], call["field"])
+    return fonts, reasons
+
+
+def main():
+    args = sys.argv[1:]
+    path = DEFAULT_SOURCE
+    if args and os.path.exists(args[0]):
+        path = args.pop(0)
+    with open(path, encoding="utf-8") as f:
+        fonts, reasons = scan(f.read())
+
+    if args:
+        chars = fonts.get(args[0], set())
+        if chars is None:
+            sys.exit("%s draws %s: all characters needed" %
+                     (args[0], reasons[args[0]]))
+        if not chars:
+            sys.exit("%s is not drawn in %s" % (args[0], path))
+        print("".join(sorted(chars)))
+        return
+
+    for font, chars in fonts.items():
+        if chars is None:
+            print("%-32s all (draws %s)" % (font, reasons[font]))
+        else:
+            print("%-32s %s" % (font, "".join(sorted(chars))))
+
+
+if __name__ == "__main__":
+    main()
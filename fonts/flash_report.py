@@ -0,0 +1,55 @@
+#!/usr/bin/env python3
+"""Report the flash used by the fonts linked into the firmware.
+
+Lists every font symbol (bitmaps, glyph tables and font structures) found
+in the firmware ELF file, the number of copies of it and the bytes that
+would be saved if it was defined only once.
+
+Usage:
+  ./flash_report.py [firmware.elf] [nm]
+
+Defaults to the PlatformIO build of the m5stack-core-esp32 environment and
+to the Xtensa nm installed by PlatformIO.
+"""
+
+import collections
+import os
+import subprocess
+import sys
+
+DEFAULT_ELF = os.path.join(os.path.dirname(os.path.abspath(__file__)),
+                           "../.pio/build/m5stack-core-esp32/firmware.elf")
+DEFAULT_NM = os.path.expanduser(
+    "~/.platformio/packages/toolchain-xtensa-esp32/bin/xtensa-esp32-elf-nm")
+
+
+def font_symbols(elf, nm):
+    out = subprocess.run([nm, "--print-size", "--size-sort", "--demangle", elf],
+                         check=True, capture_output=True, text=True).stdout
+    for line in out.splitlines():
+        fields = line.split()
+        if len(fields) == 4 and fields[3].startswith("IBMPlex"):
+            yield fields[3], int(fields[1], 16)
+
+
+def main():
+    elf = sys.argv[1] if len(sys.argv) > 1 else DEFAULT_ELF
+    nm = sys.argv[2] if len(sys.argv) > 2 else DEFAULT_NM
+
+    copies = collections.defaultdict(list)
+    for name, size in font_symbols(elf, nm):
+        copies[name].append(size)
+
+    total = wasted = 0
+    print("%-40s %6s %8s %8s" % ("symbol", "copies", "bytes", "wasted"))
+    for name in sorted(copies):
+        sizes = copies[name]
+        total += sum(sizes)
+        wasted += sum(sizes) - sizes[0]
+        print("%-40s %6d %8d %8d" % (name, len(sizes), sum(sizes),
+                                     sum(sizes) - sizes[0]))
+    print("%-40s %6s %8d %8d" % ("total", "", total, wasted))
+
+
+if __name__ == "__main__":
+    main()
@@ -8,6 +8,44 @@ fonts to be used with the Adafruit_GFX Arduino library.
 For UNIX-like systems.  Outputs to stdout; redirect to header file, e.g.:
   ./fontconvert ~/Library/Fonts/FreeSans.ttf 18 > FreeSans18pt7b.h
 
+Options:
+  -s  also emit the glyphs as horizontal spans (see src/fontdata.h), for
+      renderers filling whole runs of pixels instead of testing each bit
+  -z  emit the glyph bitmaps compressed row by row instead of raw (see
+      src/fontdata.h); such fonts can only be drawn by the firmware's own
+      renderers, not by Adafruit_GFX or TFT_eSPI.  The sizes are reported
+      on stderr
+  -c CHARS
+      emit only the glyphs of the characters in CHARS (UTF-8), plus the
+      font's "missing glyph", with a sorted table of code point ranges (see
+      GFXsubset in src/fontdata.h).  The first..last range still sets the
+      name and the ascent, so the text does not move when the subset
+      changes.  fonts/charset.py finds the characters the firmware draws
+  -r RANGES
+      same as -c, with the characters given as a comma separated list of
+      code points and ranges, in decimal, hexadecimal (0x...) or as U+...,
+      e.g. -r 0x20-0xFF,U+2070-U+2079,U+2192,U+26A1.  -c and -r add up.
+      Characters missing from the font are dropped, with a warning
+  -k  also emit the kerning pairs among the converted glyphs (see
+      GFXkerning in src/fontdata.h), read from the pair adjustments of the
+      font's GPOS table
+  -m  emit the metrics of the first..last range instead of the font (see
+      GFXmetrics in src/fontdata.h), as constant expressions in a header of
+      their own, e.g. FreeSans18pt7bMetrics.h.  The other options do not
+      apply
+  -a BITS
+      emit anti-aliased glyphs, with 2 or 4 bits per pixel (see GFXgreys in
+      src/fontdata.h), instead of monochrome ones.  The font is named after
+      the bits, e.g. FreeSans18pt7b_4bpp.  Such fonts can only be drawn by
+      the firmware's own renderers.  Exclusive with -s and -z
+  -b  emit the font as a binary record of a font pack instead of a header
+      (see FontPackFont in src/fontpack.h), with the tables the other
+      options select.  fonts/build.py puts the records together into a
+      pack, flashed into a data partition and loaded at run time
+
+Code points are looked up in the font's Unicode character map, so any
+character of the font can be converted; the first 256 are Latin-1.
+
 REQUIRES FREETYPE LIBRARY.  www.freetype.org
 
 Currently this only extracts the printable 7-bit ASCII chars of a font.
@@ -22,13 +60,22 @@ See notes at end for glyph nomenclature & other tidbits.
 #include <ft2build.h>
 #include <stdint.h>
 #include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
 #include FT_GLYPH_H
 #include FT_MODULE_H
 #include FT_TRUETYPE_DRIVER_H
+#include FT_TRUETYPE_TABLES_H
+#include FT_TRUETYPE_TAGS_H
 #include "gfxfont.h" // Adafruit_GFX font structures
 
 #define DPI 141 // Approximate res. of Adafruit 2.8" TFT
 
+// How glyphs are loaded and rendered: monochrome, or with grey levels (-a)
+FT_Int32 loadFlags = FT_LOAD_TARGET_MONO;
+FT_Render_Mode renderMode = FT_RENDER_MODE_MONO;
+
 // Accumulate bits for output, with periodic hexadecimal byte write
 void enbit(uint8_t value) {
   static uint8_t row = 0, sum = 0, bit = 0x80, firstCall = 1;
@@ -50,9 +97,431 @@ void enbit(uint8_t value) {
   }
 }
 
+// Write a byte array as hexadecimal, 12 values per line
+void printbytes(const uint8_t *bytes, int count) {
+  int i;
+  for (i = 0; i < count; i++) {
+    if (i > 0)
+      printf((i % 12) ? ", " : ",\n  ");
+    printf("0x%02X", bytes[i]);
+  }
+}
+
+#define FALLBACK -1 // Code of the font's missing glyph in a subset
+
+#define MAX_RUNS 128 // Runs of set pixels in a row, at most (255 + 1) / 2
+
+// Find the runs of set pixels of one bitmap row.  Run i covers the pixels
+// from starts[i] (inclusive) to ends[i] (exclusive).  Returns the number of
+// runs.
+int getruns(const FT_Bitmap *bitmap, int y, int *starts, int *ends) {
+  int x = 0, count = 0;
+  const uint8_t *row = bitmap->buffer + y * bitmap->pitch;
+  while (x < bitmap->width) {
+    if (!(row[x / 8] & (0x80 >> (x & 7)))) {
+      x++;
+      continue;
+    }
+    starts[count] = x;
+    while ((x < bitmap->width) && (row[x / 8] & (0x80 >> (x & 7))))
+      x++;
+    ends[count++] = x;
+  }
+  return count;
+}
+
+// Append one bitmap row to `spans`: a count byte, then a (skip, length)
+// pair per run.  Returns the new length of `spans`.
+int enspans(uint8_t *spans, int length, const FT_Bitmap *bitmap, int y) {
+  int starts[MAX_RUNS], ends[MAX_RUNS], i, end = 0;
+  int count = getruns(bitmap, y, starts, ends);
+  spans[length++] = count;
+  for (i = 0; i < count; i++) {
+    spans[length++] = starts[i] - end; // Clear pixels since the previous run
+    spans[length++] = ends[i] - starts[i]; // Set pixels
+    end = ends[i];
+  }
+  return length;
+}
+
+// Append a whole glyph to `packed`, compressed row by row (see GFXpacked in
+// src/fontdata.h), and keep the largest number of runs in a row in
+// `maxRuns`.  Returns the new length of `packed`.
+int enpacked(uint8_t *packed, int length, const FT_Bitmap *bitmap,
+             int *maxRuns) {
+  int starts[MAX_RUNS], ends[MAX_RUNS], count;
+  int prevStarts[MAX_RUNS], prevEnds[MAX_RUNS], prevCount = -1;
+  int i, y, repeat = 0, vertical, end, skip, run;
+
+  for (y = 0; y < bitmap->rows; y++) {
+    count = getruns(bitmap, y, starts, ends);
+    if (count > *maxRuns)
+      *maxRuns = count;
+
+    // Same row as the previous one: extend the pending repeat
+    vertical = (count == prevCount);
+    for (i = 0; i < count && vertical; i++) {
+      vertical = (starts[i] == prevStarts[i]) && (ends[i] == prevEnds[i]);
+    }
+    if (vertical) {
+      if (repeat == 64) { // Longest repeat a code can hold
+        packed[length++] = 0x80 | (repeat - 1);
+        repeat = 0;
+      }
+      repeat++;
+      continue;
+    }
+    if (repeat) {
+      packed[length++] = 0x80 | (repeat - 1);
+      repeat = 0;
+    }
+
+    // Runs moved by less than 8 pixels: one byte per run
+    vertical = (count > 0) && (count == prevCount);
+    for (i = 0; i < count && vertical; i++) {
+      vertical = (starts[i] - prevStarts[i] >= -8) &&
+                 (starts[i] - prevStarts[i] < 8) &&
+                 (ends[i] - prevEnds[i] >= -8) && (ends[i] - prevEnds[i] < 8);
+    }
+    if (vertical) {
+      packed[length++] = 0xC0;
+      for (i = 0; i < count; i++) {
+        packed[length++] = ((starts[i] - prevStarts[i] + 8) << 4) |
+                           (ends[i] - prevEnds[i] + 8);
+      }
+    } else {
+      packed[length++] = count;
+      for (i = 0, end = 0; i < count; i++) {
+        skip = starts[i] - end;
+        run = ends[i] - starts[i];
+        if ((skip < 15) && (run <= 16)) {
+          packed[length++] = (skip << 4) | (run - 1);
+        } else {
+          packed[length++] = 0xF0;
+          packed[length++] = skip;
+          packed[length++] = run;
+        }
+        end = ends[i];
+      }
+    }
+
+    for (i = 0; i < count; i++) {
+      prevStarts[i] = starts[i];
+      prevEnds[i] = ends[i];
+    }
+    prevCount = count;
+  }
+  if (repeat)
+    packed[length++] = 0x80 | (repeat - 1);
+  return length;
+}
+
+// Append the rows of a grey (8-bit) bitmap to `greys`, with `bits` bits per
+// pixel, the leftmost pixel in the high bits, each row starting on a byte.
+// Returns the new length of `greys`.
+int engreys(uint8_t *greys, int length, const FT_Bitmap *bitmap, int bits) {
+  int x, y, level, shift, levels = (1 << bits) - 1;
+  for (y = 0; y < bitmap->rows; y++) {
+    for (x = 0; x < bitmap->width; x++) {
+      level = (bitmap->buffer[y * bitmap->pitch + x] * levels + 127) / 255;
+      shift = 8 - bits - (x * bits & 7);
+      if (shift == 8 - bits) // First pixel of the byte
+        greys[length + x * bits / 8] = 0;
+      greys[length + x * bits / 8] |= level << shift;
+    }
+    length += (bitmap->width * bits + 7) / 8;
+  }
+  return length;
+}
+
+// Decode one UTF-8 character and advance `s` past it.  Returns -1 for an
+// invalid sequence.
+int decodeutf8(const char **s) {
+  const uint8_t *p = (const uint8_t *)*s;
+  int c = *p++, extra = 0;
+  if (c >= 0xF0) {
+    c &= 0x07;
+    extra = 3;
+  } else if (c >= 0xE0) {
+    c &= 0x0F;
+    extra = 2;
+  } else if (c >= 0xC0) {
+    c &= 0x1F;
+    extra = 1;
+  } else if (c >= 0x80) {
+    c = -1;
+  }
+  while (extra-- && c >= 0) {
+    if ((*p & 0xC0) != 0x80)
+      c = -1;
+    else
+      c = (c << 6) | (*p++ & 0x3F);
+  }
+  *s = (const char *)p;
+  return c;
+}
+
+int compareints(const void *a, const void *b) {
+  return *(const int *)a - *(const int *)b;
+}
+
+// Big-endian values of OpenType tables
+#define U16(p) ((uint16_t)((p)[0] << 8 | (p)[1]))
+#define U32(p) ((uint32_t)U16(p) << 16 | U16((p) + 2))
+
+// Size of an OpenType value record of the given format
+int valuesize(int format) {
+  int size = 0;
+  for (; format; format >>= 1)
+    size += (format & 1) * 2;
+  return size;
+}
+
+// Coverage index of `glyph` in an OpenType coverage table, or -1
+int coverageindex(const uint8_t *table, int glyph) {
+  int i, count = U16(table + 2);
+  const uint8_t *r;
+  for (i = 0; i < count; i++) {
+    if (U16(table) == 1) {
+      if (U16(table + 4 + 2 * i) == glyph)
+        return i;
+    } else {
+      r = table + 4 + 6 * i;
+      if ((glyph >= U16(r)) && (glyph <= U16(r + 2)))
+        return U16(r + 4) + glyph - U16(r);
+    }
+  }
+  return -1;
+}
+
+// Class of `glyph` in an OpenType class definition table
+int glyphclass(const uint8_t *table, int glyph) {
+  int i, count;
+  const uint8_t *r;
+  if (U16(table) == 1) {
+    i = glyph - U16(table + 2);
+    return ((i >= 0) && (i < U16(table + 4))) ? U16(table + 6 + 2 * i) : 0;
+  }
+  for (i = 0, count = U16(table + 2); i < count; i++) {
+    r = table + 4 + 6 * i;
+    if ((glyph >= U16(r)) && (glyph <= U16(r + 2)))
+      return U16(r + 4);
+  }
+  return 0;
+}
+
+// Advance adjustment of glyph `left` followed by glyph `right`, in font
+// units, from a GPOS pair adjustment subtable.  Sets *found if the subtable
+// covers the pair.
+int pairadjustment(const uint8_t *sub, int left, int right, int *found) {
+  int i, count, index = coverageindex(sub + U16(sub + 2), left);
+  int format1 = U16(sub + 4);
+  int size = valuesize(format1) + valuesize(U16(sub + 6));
+  const uint8_t *r = NULL;
+  if (index < 0)
+    return 0;
+  if (U16(sub) == 1) { // Pairs of glyphs
+    const uint8_t *set = sub + U16(sub + 10 + 2 * index);
+    for (i = 0, count = U16(set); (i < count) && !r; i++) {
+      if (U16(set + 2 + i * (2 + size)) == right)
+        r = set + 4 + i * (2 + size);
+    }
+  } else if (U16(sub) == 2) { // Pairs of glyph classes
+    r = sub + 16 + (glyphclass(sub + U16(sub + 8), left) * U16(sub + 14) +
+                    glyphclass(sub + U16(sub + 10), right)) *
+                       size;
+  }
+  if (!r)
+    return 0;
+  *found = 1;
+  // XAdvance follows XPlacement and YPlacement, if present
+  return (format1 & 4) ? (int16_t)U16(r + valuesize(format1 & 3)) : 0;
+}
+
+// Kerning of glyph `left` followed by glyph `right`, in font units: the sum
+// of the lookups of the GPOS 'kern' features, given in `lookups`.  In every
+// lookup, the first subtable covering the pair applies.
+int kerning(const uint8_t *gpos, const int *lookups, int lookupCount, int left,
+            int right) {
+  const uint8_t *lookupList = gpos + U16(gpos + 8), *lookup, *sub;
+  int i, j, type, found, total = 0;
+  for (i = 0; i < lookupCount; i++) {
+    lookup = lookupList + U16(lookupList + 2 + 2 * lookups[i]);
+    found = 0;
+    for (j = 0; (j < U16(lookup + 4)) && !found; j++) {
+      sub = lookup + U16(lookup + 6 + 2 * j);
+      type = U16(lookup);
+      if (type == 9) { // Extension: the subtable is further away
+        type = U16(sub + 2);
+        sub += U32(sub + 4);
+      }
+      if (type == 2)
+        total += pairadjustment(sub, left, right, &found);
+    }
+  }
+  return total;
+}
+
+// Output the metrics header of `face` for the code points first..last.
+// Ascent and descent are found as TFT_eSPI::setFreeFont() does, which skips
+// the last glyph.  Returns non-zero on error.
+int printmetrics(FT_Face face, const char *fontName, const char *guardName,
+                 int first, int last) {
+  int i, count = last - first + 1, ascent = 0, descent = 0;
+  int digitAdvance = 0, tabular = 1, right, top;
+  uint8_t *advances = malloc(count);
+  int8_t *rights = malloc(count);
+  if (!advances || !rights) {
+    fprintf(stderr, "Malloc error\n");
+    return 1;
+  }
+  for (i = 0; i < count; i++) {
+    advances[i] = rights[i] = 0;
+    if (FT_Load_Char(face, first + i, loadFlags) ||
+        FT_Render_Glyph(face->glyph, renderMode)) {
+      fprintf(stderr, "Error loading char 0x%02X\n", first + i);
+      continue;
+    }
+    advances[i] = face->glyph->advance.x >> 6;
+    right = face->glyph->bitmap_left + face->glyph->bitmap.width;
+    if (right < -128 || right > 127) {
+      fprintf(stderr, "Char 0x%02X too wide\n", first + i);
+      return 1;
+    }
+    rights[i] = right;
+    if (first + i == last)
+      continue;
+    top = face->glyph->bitmap_top - 1; // -yOffset
+    if (top > ascent)
+      ascent = top;
+    if ((int)face->glyph->bitmap.rows - top > descent)
+      descent = face->glyph->bitmap.rows - top;
+  }
+  for (i = '0'; i <= '9'; i++) {
+    if ((i < first) || (i > last))
+      continue;
+    if (digitAdvance && (advances[i - first] != digitAdvance))
+      tabular = 0;
+    if (advances[i - first] > digitAdvance)
+      digitAdvance = advances[i - first];
+  }
+
+  printf("#ifndef %sMETRICS_H_\n", guardName);
+  printf("#define %sMETRICS_H_\n\n", guardName);
+  printf("#include \"fontdata.h\"\n\n");
+  printf("constexpr uint8_t %sAdvances[] = {\n  ", fontName);
+  printbytes(advances, count);
+  printf(" };\n\n");
+  printf("constexpr int8_t %sInkRights[] = {\n  ", fontName);
+  for (i = 0; i < count; i++) {
+    if (i > 0)
+      printf((i % 12) ? ", " : ",\n  ");
+    printf("%4d", rights[i]);
+  }
+  printf(" };\n\n");
+  printf("constexpr GFXmetrics %sMetrics = {\n", fontName);
+  printf("  0x%02X, 0x%02X,\n", first, last);
+  printf("  %sAdvances,\n", fontName);
+  printf("  %sInkRights,\n", fontName);
+  printf("  %ld, %d, %d, %d, %s };\n\n",
+         face->size->metrics.height ? face->size->metrics.height >> 6
+                                    : (long)(ascent + descent),
+         ascent, descent, digitAdvance, tabular ? "true" : "false");
+  printf("#endif /* %sMETRICS_H_ */\n", guardName);
+  return 0;
+}
+
+// Parse one code point of a -r list and advance `s` past it.  Returns -1
+// if there is none.
+int parsecode(const char **s) {
+  char *end;
+  long c;
+  if (((*s)[0] == 'U' || (*s)[0] == 'u') && (*s)[1] == '+')
+    c = strtol(*s + 2, &end, 16);
+  else
+    c = strtol(*s, &end, 0);
+  if ((end == *s) || (c < 0) || (c > 0x10FFFF))
+    return -1;
+  *s = end;
+  return c;
+}
+
+// Append the integers from..to to `list`, grown as needed.  Returns 0 if
+// out of memory.
+int addints(int **list, int *count, int *capacity, int from, int to) {
+  for (; from <= to; from++) {
+    if (*count == *capacity) {
+      *capacity = *capacity ? 2 * *capacity : 256;
+      if (!(*list = realloc(*list, *capacity * sizeof(int))))
+        return 0;
+    }
+    (*list)[(*count)++] = from;
+  }
+  return 1;
+}
+
+// Write binary output, little-endian as the font pack format is (see
+// src/fontpack.h), counting the bytes written
+long written = 0;
+
+void put8(int value) {
+  putchar(value & 0xFF);
+  written++;
+}
+
+void put16(int value) {
+  put8(value);
+  put8(value >> 8);
+}
+
+void put32(uint32_t value) {
+  put16(value & 0xFFFF);
+  put16(value >> 16);
+}
+
+// Pad the output with zeros to a multiple of 4 bytes
+void align4(void) {
+  while (written & 3)
+    put8(0);
+}
+
+#define ALIGN4(n) (((n) + 3) & ~3)
+
+#define PACK_HEADER 92   // Bytes of FontPackFont
+#define PACK_NAME 32     // Bytes of FontPackFont::name
+#define PACK_GLYPH 12    // Bytes of a GFXglyph of TFT_eSPI, 32-bit offset
+#define PACK_RANGE 8     // Bytes of a GFXrange
+#define PACK_KERNPAIR 6  // Bytes of a GFXkernPair
+
+// Print a code point of the glyph table as a comment
+void printcode(int c) {
+  if (c == FALLBACK) {
+    printf("missing glyph");
+  } else {
+    printf("0x%02X", c);
+    if ((c >= ' ') && (c <= '~'))
+      printf(" '%c'", c);
+  }
+}
+
 int main(int argc, char *argv[]) {
   int i, j, err, size, first = ' ', last = '~', bitmapOffset = 0, x, y, byte;
-  char *fontName, c, *ptr;
+  int opt, withSpans = 0, spansLength = 0, spansCapacity = 0;
+  int withPacked = 0, packedLength = 0, packedCapacity = 0, maxRuns = 0;
+  int *codes = NULL, count = 0, capacity = 0, ascent = 0, from, to;
+  int subset, ranges, withKerning = 0, *lookups = NULL, lookupCount = 0;
+  int lookupCapacity = 0, *kerns = NULL, kernCount = 0, kernCapacity = 0;
+  int *glyphIds, left, right, dx, withMetrics = 0, withBinary = 0;
+  int rawCapacity = 0, dataLength, offset, glyphsAt, dataAt, spanOffsetsAt;
+  int spansAt, rangesAt, kernsAt, greyBits = 0, greyLength = 0;
+  int greyCapacity = 0;
+  FT_ULong gposLength = 0;
+  uint8_t *gpos = NULL;
+  const uint8_t *features, *feature;
+  const char *charset = NULL, *rangeset = NULL, *cp;
+  char *fontName, *guardName, c, *ptr;
+  uint8_t *spans = NULL, *packed = NULL, *raw = NULL, *greys = NULL;
+  uint32_t *spanOffsets = NULL;
   FT_Library library;
   FT_Face face;
   FT_Glyph glyph;
@@ -62,14 +531,66 @@ int main(int argc, char *argv[]) {
   uint8_t bit;
 
   // Parse command line.  Valid syntaxes are:
-  //   fontconvert [filename] [size]
-  //   fontconvert [filename] [size] [last char]
-  //   fontconvert [filename] [size] [first char] [last char]
+  //   fontconvert [options] [filename] [size]
+  //   fontconvert [options] [filename] [size] [last char]
+  //   fontconvert [options] [filename] [size] [first char] [last char]
   // Unless overridden, default first and last chars are
   // ' ' (space) and '~', respectively
 
+  while ((opt = getopt(argc, argv, "szkmba:c:r:")) != -1) {
+    switch (opt) {
+    case 'c':
+      charset = optarg;
+      break;
+    case 'r':
+      rangeset = optarg;
+      break;
+    case 's':
+      withSpans = 1;
+      break;
+    case 'z':
+      withPacked = 1;
+      break;
+    case 'k':
+      withKerning = 1;
+      break;
+    case 'm':
+      withMetrics = 1;
+      break;
+    case 'b':
+      withBinary = 1;
+      break;
+    case 'a':
+      greyBits = atoi(optarg);
+      if ((greyBits != 2) && (greyBits != 4)) {
+        fprintf(stderr, "Option -a takes 2 or 4 bits per pixel\n");
+        argc = 0;
+      }
+      break;
+    default:
+      argc = 0; // Print usage
+    }
+  }
+  if (withSpans && withPacked) {
+    fprintf(stderr, "Options -s and -z are exclusive\n");
+    argc = 0;
+  }
+  if (greyBits && (withSpans || withPacked)) {
+    fprintf(stderr, "Option -a excludes -s and -z\n");
+    argc = 0;
+  }
+  if (withMetrics && withBinary) {
+    fprintf(stderr, "Options -m and -b are exclusive\n");
+    argc = 0;
+  }
+  argc -= optind - 1; // Positional arguments, as if there were no options
+  argv += optind - 1;
+
   if (argc < 3) {
-    fprintf(stderr, "Usage: %s fontfile size [first] [last]\n", argv[0]);
+    fprintf(stderr,
+            "Usage: %s [-s|-z|-a bits] [-k] [-m|-b] [-c chars] [-r ranges] "
+            "fontfile size [first] [last]\n",
+            argv[0]);
     return 1;
   }
 
@@ -94,9 +615,59 @@ int main(int argc, char *argv[]) {
   else
     ptr = argv[1]; // No path; font in local dir.
 
+  // Characters to convert: the whole range, or the subset in code point
+  // order followed by the missing glyph
+  subset = charset || rangeset;
+  for (cp = charset; cp && *cp;) {
+    if ((from = decodeutf8(&cp)) < 0) {
+      fprintf(stderr, "Invalid UTF-8 in character set\n");
+      return 1;
+    }
+    if (!addints(&codes, &count, &capacity, from, from)) {
+      fprintf(stderr, "Malloc error\n");
+      return 1;
+    }
+  }
+  for (cp = rangeset; cp && *cp;) {
+    to = from = parsecode(&cp);
+    if ((from >= 0) && (*cp == '-')) {
+      cp++;
+      to = parsecode(&cp);
+    }
+    if ((from < 0) || (to < from) || (*cp && (*cp++ != ','))) {
+      fprintf(stderr, "Invalid code point range\n");
+      return 1;
+    }
+    if (!addints(&codes, &count, &capacity, from, to)) {
+      fprintf(stderr, "Malloc error\n");
+      return 1;
+    }
+  }
+  if (subset) {
+    qsort(codes, count, sizeof(int), compareints);
+    for (i = 0, j = 0; i < count; i++) { // Remove duplicates
+      if (!j || codes[i] != codes[j - 1])
+        codes[j++] = codes[i];
+    }
+    count = j;
+    if (!count) {
+      fprintf(stderr, "No characters to convert\n");
+      return 1;
+    }
+    if (!addints(&codes, &count, &capacity, FALLBACK, FALLBACK)) {
+      fprintf(stderr, "Malloc error\n");
+      return 1;
+    }
+  } else if (!addints(&codes, &count, &capacity, first, last)) {
+    fprintf(stderr, "Malloc error\n");
+    return 1;
+  }
+
   // Allocate space for font name and glyph table
   if ((!(fontName = malloc(strlen(ptr) + 20))) ||
-      (!(table = (GFXglyph *)malloc((last - first + 1) * sizeof(GFXglyph))))) {
+      (!(guardName = malloc(strlen(ptr) + 20))) ||
+      (!(table = (GFXglyph *)malloc(count * sizeof(GFXglyph)))) ||
+      (!(spanOffsets = malloc(count * sizeof(uint32_t))))) {
     fprintf(stderr, "Malloc error\n");
     return 1;
   }
@@ -110,11 +681,19 @@ int main(int argc, char *argv[]) {
   // Insert font size and 7/8 bit.  fontName was alloc'd w/extra
   // space to allow this, we're not sprintfing into Forbidden Zone.
   sprintf(ptr, "%dpt%db", size, (last > 127) ? 8 : 7);
+  if (greyBits)
+    sprintf(ptr + strlen(ptr), "_%dbpp", greyBits);
   // Space and punctuation chars in name replaced w/ underscores.
   for (i = 0; (c = fontName[i]); i++) {
     if (isspace(c) || ispunct(c))
       fontName[i] = '_';
   }
+  // Include guard: font name in upper case, without the underscores
+  for (i = 0, j = 0; (c = fontName[i]); i++) {
+    if (c != '_')
+      guardName[j++] = toupper(c);
+  }
+  guardName[j] = 0;
 
   // Init FreeType lib, load font
   if ((err = FT_Init_FreeType(&library))) {
@@ -126,7 +705,13 @@ int main(int argc, char *argv[]) {
   // This improves clarity of fonts since this library does not
   // support rendering multiple levels of gray in a glyph.
   // See https://github.com/adafruit/Adafruit-GFX-Library/issues/103
-  FT_UInt interpreter_version = TT_INTERPRETER_VERSION_35;
+  // Grey levels (-a) get the default engine, made for them.
+  FT_UInt interpreter_version =
+      greyBits ? TT_INTERPRETER_VERSION_40 : TT_INTERPRETER_VERSION_35;
+  if (greyBits) {
+    loadFlags = FT_LOAD_TARGET_NORMAL;
+    renderMode = FT_RENDER_MODE_NORMAL;
+  }
   FT_Property_Set(library, "truetype", "interpreter-version",
                   &interpreter_version);
 
@@ -138,28 +723,70 @@ int main(int argc, char *argv[]) {
 
   // << 6 because '26dot6' fixed-point format
   FT_Set_Char_Size(face, size << 6, 0, DPI, 0);
-  FT_Select_Charmap(face, ft_encoding_latin_1);
+  // Unicode, which extends Latin-1, if the font has it
+  if (FT_Select_Charmap(face, FT_ENCODING_UNICODE))
+    FT_Select_Charmap(face, ft_encoding_latin_1);
+
+  if (subset) {
+    // Characters without a glyph would get a copy of the missing glyph
+    for (i = 0, j = 0; i < count - 1; i++) {
+      if (FT_Get_Char_Index(face, codes[i])) {
+        codes[j++] = codes[i];
+        continue;
+      }
+      if (i == j)
+        fprintf(stderr, "%s: no glyph for", argv[1]);
+      fprintf(stderr, " U+%04X", codes[i]);
+    }
+    if (i != j)
+      fputc('\n', stderr);
+    codes[j] = FALLBACK;
+    count = j + 1;
+  }
+
+  if (withMetrics) {
+    err = printmetrics(face, fontName, guardName, first, last);
+    FT_Done_FreeType(library);
+    return err;
+  }
 
-  // Currently all symbols from 'first' to 'last' are processed.
-  // Fonts may contain WAY more glyphs than that, but this code
-  // will need to handle encoding stuff to deal with extracting
-  // the right symbols, and that's not done yet.
-  // fprintf(stderr, "%ld glyphs\n", face->num_glyphs);
+  // A subset keeps the ascent of the whole range, which TFT_eSPI finds
+  // from glyphs 'first' to 'last' - 1
+  if (subset) {
+    for (i = first; i < last; i++) {
+      if (!FT_Load_Char(face, i, loadFlags) &&
+          !FT_Render_Glyph(face->glyph, renderMode) &&
+          (face->glyph->bitmap_top - 1 > ascent))
+        ascent = face->glyph->bitmap_top - 1;
+    }
+  }
 
-  printf("#include <Arduino.h>\n");
-  printf("#include <M5Stack.h>\n\n");
-  printf("const uint8_t %sBitmaps[] PROGMEM = {\n  ", fontName);
+  if (!withBinary) {
+    printf("#ifndef %s_H_\n", guardName);
+    printf("#define %s_H_\n\n", guardName);
+    printf("#include <Arduino.h>\n");
+    printf("#include <M5Stack.h>\n\n");
+    if (withSpans || withPacked || greyBits || withKerning || subset)
+      printf("#include \"fontdata.h\"\n\n");
+    if (!withPacked && !greyBits)
+      printf("const uint8_t %sBitmaps[] PROGMEM = {\n  ", fontName);
+  }
 
   // Process glyphs and output huge bitmap data array
-  for (i = first, j = 0; i <= last; i++, j++) {
+  for (j = 0; j < count; j++) {
+    i = codes[j];
     // MONO renderer provides clean image with perfect crop
     // (no wasted pixels) via bitmap struct.
-    if ((err = FT_Load_Char(face, i, FT_LOAD_TARGET_MONO))) {
+    if (i == FALLBACK)
+      err = FT_Load_Glyph(face, 0, loadFlags); // .notdef
+    else
+      err = FT_Load_Char(face, i, loadFlags);
+    if (err) {
       fprintf(stderr, "Error %d loading char '%c'\n", err, i);
       continue;
     }
 
-    if ((err = FT_Render_Glyph(face->glyph, FT_RENDER_MODE_MONO))) {
+    if ((err = FT_Render_Glyph(face->glyph, renderMode))) {
       fprintf(stderr, "Error %d rendering char '%c'\n", err, i);
       continue;
     }
@@ -180,68 +807,384 @@ int main(int argc, char *argv[]) {
     // code currently doesn't check for overflow.  (Doesn't
     // check that size & offsets are within bounds either for
     // that matter...please convert fonts responsibly.)
-    table[j].bitmapOffset = bitmapOffset;
+    table[j].bitmapOffset =
+        withPacked ? packedLength : (greyBits ? greyLength : bitmapOffset);
     table[j].width = bitmap->width;
     table[j].height = bitmap->rows;
     table[j].xAdvance = face->glyph->advance.x >> 6;
     table[j].xOffset = g->left;
     table[j].yOffset = 1 - g->top;
 
-    for (y = 0; y < bitmap->rows; y++) {
-      for (x = 0; x < bitmap->width; x++) {
-        byte = x / 8;
-        bit = 0x80 >> (x & 7);
-        enbit(bitmap->buffer[y * bitmap->pitch + byte] & bit);
+    if (greyBits) {
+      // Rows of whole bytes
+      int n = bitmap->rows * ((bitmap->width * greyBits + 7) / 8);
+      if (greyLength + n > greyCapacity) {
+        greyCapacity = 2 * greyCapacity + n;
+        if (!(greys = realloc(greys, greyCapacity))) {
+          fprintf(stderr, "Malloc error\n");
+          return 1;
+        }
+      }
+      greyLength = engreys(greys, greyLength, bitmap, greyBits);
+      if (greyLength > 0xFFFF) { // bitmapOffset is 16-bit
+        fprintf(stderr, "Grey bitmaps over 64K\n");
+        return 1;
+      }
+    } else if (withBinary && !withPacked) {
+      // Same bits as enbit() prints, kept for the record
+      if (bitmapOffset + (bitmap->width * bitmap->rows + 7) / 8 >
+          rawCapacity) {
+        rawCapacity = 2 * rawCapacity + (bitmap->width * bitmap->rows + 7) / 8;
+        if (!(raw = realloc(raw, rawCapacity))) {
+          fprintf(stderr, "Malloc error\n");
+          return 1;
+        }
+      }
+      memset(raw + bitmapOffset, 0, (bitmap->width * bitmap->rows + 7) / 8);
+      for (y = 0; y < bitmap->rows; y++) {
+        for (x = 0; x < bitmap->width; x++) {
+          if (bitmap->buffer[y * bitmap->pitch + x / 8] & (0x80 >> (x & 7)))
+            raw[bitmapOffset + (y * bitmap->width + x) / 8] |=
+                0x80 >> ((y * bitmap->width + x) & 7);
+        }
+      }
+    } else if (!withPacked) {
+      for (y = 0; y < bitmap->rows; y++) {
+        for (x = 0; x < bitmap->width; x++) {
+          byte = x / 8;
+          bit = 0x80 >> (x & 7);
+          enbit(bitmap->buffer[y * bitmap->pitch + byte] & bit);
+        }
       }
-    }
 
-    // Pad end of char bitmap to next byte boundary if needed
-    int n = (bitmap->width * bitmap->rows) & 7;
-    if (n) {     // Pixel count not an even multiple of 8?
-      n = 8 - n; // # bits to next multiple
-      while (n--)
-        enbit(0);
+      // Pad end of char bitmap to next byte boundary if needed
+      int n = (bitmap->width * bitmap->rows) & 7;
+      if (n) {     // Pixel count not an even multiple of 8?
+        n = 8 - n; // # bits to next multiple
+        while (n--)
+          enbit(0);
+      }
     }
+    // Raw size, also counted with -z and -a for the report
     bitmapOffset += (bitmap->width * bitmap->rows + 7) / 8;
 
+    if (withPacked) {
+      // Worst case per row: a code byte and 3 bytes for every other pixel
+      if (packedLength + bitmap->rows * (2 * bitmap->width + 3) >
+          packedCapacity) {
+        packedCapacity =
+            2 * packedCapacity + bitmap->rows * (2 * bitmap->width + 3);
+        if (!(packed = realloc(packed, packedCapacity))) {
+          fprintf(stderr, "Malloc error\n");
+          return 1;
+        }
+      }
+      packedLength = enpacked(packed, packedLength, bitmap, &maxRuns);
+      if (packedLength > 0xFFFF) { // bitmapOffset is 16-bit
+        fprintf(stderr, "Compressed bitmaps over 64K\n");
+        return 1;
+      }
+    }
+
+    spanOffsets[j] = spansLength;
+    if (withSpans) {
+      // Worst case per row: a count byte and a run for every other pixel
+      if (spansLength + bitmap->rows * (bitmap->width + 2) > spansCapacity) {
+        spansCapacity = 2 * spansCapacity + bitmap->rows * (bitmap->width + 2);
+        if (!(spans = realloc(spans, spansCapacity))) {
+          fprintf(stderr, "Malloc error\n");
+          return 1;
+        }
+      }
+      for (y = 0; y < bitmap->rows; y++)
+        spansLength = enspans(spans, spansLength, bitmap, y);
+    }
+
     FT_Done_Glyph(glyph);
   }
 
+  if (withKerning) {
+    // Lookups of the 'kern' features, of all scripts and languages
+    if (FT_Load_Sfnt_Table(face, TTAG_GPOS, 0, NULL, &gposLength) ||
+        !(gpos = malloc(gposLength)) ||
+        FT_Load_Sfnt_Table(face, TTAG_GPOS, 0, gpos, &gposLength)) {
+      fprintf(stderr, "%s: no GPOS table\n", argv[1]);
+      gposLength = 0;
+    }
+    features = gposLength ? gpos + U16(gpos + 6) : NULL;
+    for (i = 0; features && (i < U16(features)); i++) {
+      if (memcmp(features + 2 + 6 * i, "kern", 4))
+        continue;
+      feature = features + U16(features + 2 + 6 * i + 4);
+      for (j = 0; j < U16(feature + 2); j++) {
+        if (!addints(&lookups, &lookupCount, &lookupCapacity,
+                     U16(feature + 4 + 2 * j), U16(feature + 4 + 2 * j))) {
+          fprintf(stderr, "Malloc error\n");
+          return 1;
+        }
+      }
+    }
+    qsort(lookups, lookupCount, sizeof(int), compareints);
+    for (i = 0, j = 0; i < lookupCount; i++) { // Remove duplicates
+      if (!j || lookups[i] != lookups[j - 1])
+        lookups[j++] = lookups[i];
+    }
+    lookupCount = j;
+
+    // Pairs of converted glyphs, as (left, right, dx) triples sorted by
+    // glyph index, dx rounded to pixels
+    if (!(glyphIds = malloc(count * sizeof(int)))) {
+      fprintf(stderr, "Malloc error\n");
+      return 1;
+    }
+    for (j = 0; j < count; j++) { // 0 for the missing glyph, not kerned
+      glyphIds[j] =
+          (codes[j] == FALLBACK) ? 0 : FT_Get_Char_Index(face, codes[j]);
+    }
+    for (left = 0; lookupCount && (left < count); left++) {
+      for (right = 0; glyphIds[left] && (right < count); right++) {
+        if (!glyphIds[right])
+          continue;
+        dx = kerning(gpos, lookups, lookupCount, glyphIds[left],
+                     glyphIds[right]);
+        dx = (FT_MulFix(dx, face->size->metrics.x_scale) + 32) >> 6;
+        if (dx < -128 || dx > 127) {
+          fprintf(stderr, "Kerning of glyphs %d and %d out of range\n", left,
+                  right);
+          dx = (dx < 0) ? -128 : 127;
+        }
+        if (dx && (!addints(&kerns, &kernCount, &kernCapacity, left, left) ||
+                   !addints(&kerns, &kernCount, &kernCapacity, right, right) ||
+                   !addints(&kerns, &kernCount, &kernCapacity, dx, dx))) {
+          fprintf(stderr, "Malloc error\n");
+          return 1;
+        }
+      }
+    }
+    kernCount /= 3;
+    if (!kernCount)
+      fprintf(stderr, "%s: no kerning pairs\n", fontName);
+  }
+
+  if (withBinary) {
+    // Font pack record, see FontPackFont in src/fontpack.h
+    if (strlen(fontName) >= PACK_NAME) {
+      fprintf(stderr, "Font name %s too long for a font pack\n", fontName);
+      return 1;
+    }
+    ranges = 0;
+    for (j = 0; subset && (j < count - 1); j = i) {
+      for (i = j + 1; (i < count - 1) && (codes[i] == codes[i - 1] + 1); i++)
+        ;
+      ranges++;
+    }
+    dataLength =
+        withPacked ? packedLength : (greyBits ? greyLength : bitmapOffset);
+    offset = PACK_HEADER;
+    glyphsAt = offset;
+    offset += count * PACK_GLYPH;
+    dataAt = offset;
+    offset = ALIGN4(offset + dataLength);
+    spanOffsetsAt = withSpans ? offset : 0;
+    spansAt = withSpans ? offset + count * 4 : 0;
+    if (withSpans)
+      offset = ALIGN4(spansAt + spansLength);
+    rangesAt = subset ? offset : 0;
+    offset += ranges * PACK_RANGE;
+    kernsAt = kernCount ? offset : 0;
+    offset = ALIGN4(offset + kernCount * PACK_KERNPAIR);
+
+    put32(0x46584647); // "GFXF"
+    put32(offset);
+    for (i = 0; i < PACK_NAME; i++)
+      put8(i < strlen(fontName) ? fontName[i] : 0);
+    if (subset) {
+      put16(0);
+      put16(count - 1);
+    } else {
+      put16(first);
+      put16(last);
+    }
+    put16(count);
+    put16(ranges);
+    put16(subset ? count - 1 : 0);
+    put16(kernCount);
+    if (face->size->metrics.height == 0)
+      put8(table[0].height);
+    else
+      put8(face->size->metrics.height >> 6);
+    put8(withPacked ? maxRuns : 0);
+    put8(ascent);
+    put8(greyBits);
+    put32(glyphsAt);
+    put32(withPacked ? 0 : dataAt);
+    put32(withPacked ? dataAt : 0);
+    put32(dataLength);
+    put32(spansAt);
+    put32(spanOffsetsAt);
+    put32(withSpans ? spansLength : 0);
+    put32(rangesAt);
+    put32(kernsAt);
+
+    for (j = 0; j < count; j++) {
+      put32(table[j].bitmapOffset);
+      put8(table[j].width);
+      put8(table[j].height);
+      put8(table[j].xAdvance);
+      put8(table[j].xOffset);
+      put8(table[j].yOffset);
+      put8(0); // padding to the alignment of bitmapOffset
+      put16(0);
+    }
+    for (i = 0; i < dataLength; i++)
+      put8(withPacked ? packed[i] : (greyBits ? greys[i] : raw[i]));
+    align4();
+    for (j = 0; withSpans && (j < count); j++)
+      put32(spanOffsets[j]);
+    for (i = 0; withSpans && (i < spansLength); i++)
+      put8(spans[i]);
+    align4();
+    for (j = 0; subset && (j < count - 1); j = i) {
+      for (i = j + 1; (i < count - 1) && (codes[i] == codes[i - 1] + 1); i++)
+        ;
+      put32(codes[j]);
+      put16(i - j);
+      put16(j);
+    }
+    for (j = 0; j < kernCount; j++) {
+      put16(kerns[3 * j]);
+      put16(kerns[3 * j + 1]);
+      put8(kerns[3 * j + 2]);
+      put8(0);
+    }
+    align4();
+    FT_Done_FreeType(library);
+    return 0;
+  }
+
+  if (withPacked) {
+    printf("const uint8_t %sPackedData[] PROGMEM = {\n  ", fontName);
+    printbytes(packed, packedLength);
+  } else if (greyBits) {
+    printf("const uint8_t %sGreyData[] PROGMEM = {\n  ", fontName);
+    printbytes(greys, greyLength);
+  }
   printf(" };\n\n"); // End bitmap array
 
   // Output glyph attributes table (one per character)
   printf("const GFXglyph %sGlyphs[] PROGMEM = {\n", fontName);
-  for (i = first, j = 0; i <= last; i++, j++) {
+  for (j = 0; j < count; j++) {
+    i = codes[j];
     printf("  { %5d, %3d, %3d, %3d, %4d, %4d }", table[j].bitmapOffset,
            table[j].width, table[j].height, table[j].xAdvance, table[j].xOffset,
            table[j].yOffset);
-    if (i < last) {
-      printf(",   // 0x%02X", i);
-      if ((i >= ' ') && (i <= '~')) {
-        printf(" '%c'", i);
-      }
+    printf((j < count - 1) ? ",   // " : " }; // ");
+    printcode(i);
+    if (j < count - 1)
       putchar('\n');
-    }
   }
-  printf(" }; // 0x%02X", last);
-  if ((last >= ' ') && (last <= '~'))
-    printf(" '%c'", last);
   printf("\n\n");
 
   // Output font structure
   printf("const GFXfont %s PROGMEM = {\n", fontName);
-  printf("  (uint8_t  *)%sBitmaps,\n", fontName);
+  printf("  (uint8_t  *)%s%s,\n", fontName,
+         withPacked ? "PackedData" : (greyBits ? "GreyData" : "Bitmaps"));
   printf("  (GFXglyph *)%sGlyphs,\n", fontName);
+  if (subset) {
+    // Glyph indices rather than code points, so that TFT_eSPI stays within
+    // the table when it scans it
+    printf("  0, %d, ", count - 1);
+  } else {
+    printf("  0x%02X, 0x%02X, ", first, last);
+  }
   if (face->size->metrics.height == 0) {
     // No face height info, assume fixed width and get from a glyph.
-    printf("  0x%02X, 0x%02X, %d };\n\n", first, last, table[0].height);
+    printf("%d };\n\n", table[0].height);
   } else {
-    printf("  0x%02X, 0x%02X, %ld };\n\n", first, last,
-           face->size->metrics.height >> 6);
+    printf("%ld };\n\n", face->size->metrics.height >> 6);
+  }
+  if (withSpans) {
+    printf("const uint8_t %sSpanData[] PROGMEM = {\n  ", fontName);
+    printbytes(spans, spansLength);
+    printf(" };\n\n");
+    printf("const uint32_t %sSpanOffsets[] PROGMEM = {\n  ", fontName);
+    for (j = 0; j < count; j++) {
+      if (j > 0)
+        printf((j % 8) ? ", " : ",\n  ");
+      printf("%5u", spanOffsets[j]);
+    }
+    printf(" };\n\n");
+    printf("const GFXspans %sSpans PROGMEM = {\n", fontName);
+    printf("  %sSpanData,\n", fontName);
+    printf("  %sSpanOffsets };\n\n", fontName);
+  }
+
+  if (withPacked) {
+    printf("const GFXpacked %sPacked PROGMEM = {\n", fontName);
+    printf("  %sPackedData,\n", fontName);
+    printf("  %d };\n\n", maxRuns);
   }
-  printf("// Approx. %d bytes\n", bitmapOffset + (last - first + 1) * 7 + 7);
+
+  if (greyBits) {
+    printf("const GFXgreys %sGreys PROGMEM = {\n", fontName);
+    printf("  %sGreyData,\n", fontName);
+    printf("  %d };\n\n", greyBits);
+  }
+
+  ranges = 0;
+  if (subset) {
+    // Runs of consecutive code points; the missing glyph has none
+    printf("const GFXrange %sRanges[] PROGMEM = {\n", fontName);
+    for (j = 0; j < count - 1; j = i) {
+      for (i = j + 1; (i < count - 1) && (codes[i] == codes[i - 1] + 1); i++)
+        ;
+      printf(ranges ? ",\n" : "");
+      printf("  { 0x%04X, %3d, %3d }", codes[j], i - j, j);
+      ranges++;
+    }
+    printf(" };\n\n");
+    printf("const GFXsubset %sSubset PROGMEM = {\n", fontName);
+    printf("  %sRanges,\n", fontName);
+    printf("  %d, %d, %d };\n\n", ranges, count - 1, ascent);
+  }
+
+  if (kernCount) {
+    printf("const GFXkernPair %sKernPairs[] PROGMEM = {\n", fontName);
+    for (j = 0; j < kernCount; j++) {
+      printf("  { %3d, %3d, %3d }", kerns[3 * j], kerns[3 * j + 1],
+             kerns[3 * j + 2]);
+      printf((j < kernCount - 1) ? ",   // " : " }; // ");
+      printcode(codes[kerns[3 * j]]);
+      printf(", ");
+      printcode(codes[kerns[3 * j + 1]]);
+      putchar('\n');
+    }
+    printf("\n");
+    printf("const GFXkerning %sKerning PROGMEM = {\n", fontName);
+    printf("  %sKernPairs,\n", fontName);
+    printf("  %d };\n\n", kernCount);
+  }
+
+  printf("// Approx. %d bytes\n",
+         (withPacked ? packedLength : (greyBits ? greyLength : bitmapOffset)) +
+             count * 7 + 7 +
+             (subset ? ranges * 8 + 8 : 0) +
+             (kernCount ? kernCount * 6 + 8 : 0));
   // Size estimate is based on AVR struct and pointer sizes;
   // actual size may vary.
+  if (withSpans)
+    printf("// Spans: approx. %d bytes\n", spansLength + count * 4 + 8);
+  if (withPacked) {
+    printf("// Bitmaps: %d bytes raw, %d bytes compressed\n", bitmapOffset,
+           packedLength);
+    fprintf(stderr, "%s: bitmaps %d -> %d bytes (%.2fx)\n", fontName,
+            bitmapOffset, packedLength,
+            packedLength ? (double)bitmapOffset / packedLength : 0);
+  }
+  if (greyBits)
+    printf("// Bitmaps: %d bytes at 1 bit, %d bytes at %d bits per pixel\n",
+           bitmapOffset, greyLength, greyBits);
+  printf("\n\n#endif /* %s_H_ */\n", guardName);
 
   FT_Done_FreeType(library);
 
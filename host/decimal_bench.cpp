@@ -0,0 +1,81 @@
+// Copyright 2021 Jacques Supcik <jacques@supcik.net>
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file decimal_bench.cpp
+ * @author Jacques Supcik <jacques@supcik.net>
+ *
+ * @brief Micro-benchmark of the decimal parser against strtof()
+ *
+ * @date 2026-10-17
+ * @version 0.1.1
+ ***************************************************************************/
+
+#include <Arduino.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <chrono>
+
+#include "host.h"
+#include "payload.h"
+
+const int kIterations = 20000;  // passes over the corpus per parser
+
+typedef std::chrono::steady_clock WallClock;
+
+// Mean wall time of `parse` on a field of the corpus, in nanoseconds
+template <typename Parse>
+static double timeParse(Parse parse)
+{
+    float sum                   = 0;
+    WallClock::time_point start = WallClock::now();
+    for (int i = 0; i < kIterations; i++) {
+        for (int j = 0; j < kDecimalCorpusSize; j++) {
+            sum += parse(kDecimalCorpus[j]);
+        }
+    }
+    double elapsed =
+        std::chrono::duration<double, std::nano>(WallClock::now() - start)
+            .count();
+    // Keeps the parsing from being optimized away
+    if (sum == 1) printf("sum: %f\n", sum);
+    return elapsed / kIterations / kDecimalCorpusSize;
+}
+
+int benchDecimal()
+{
+    double parseTime = timeParse([](const char* text) {
+        float value = 0;
+        parseDecimal({text, strlen(text)}, value);
+        return value;
+    });
+    // strtof() needs a null-terminated copy of the field, which the payload
+    // is not
+    double strtofTime = timeParse([](const char* text) {
+        char buffer[64];
+        size_t length = strlen(text);
+        if (length >= sizeof(buffer)) length = sizeof(buffer) - 1;
+        memcpy(buffer, text, length);
+        buffer[length] = '\0';
+        return strtof(buffer, nullptr);
+    });
+    printf("%-14s %12s\n", "parser", "ns/field");
+    printf("%-14s %12.1f\n", "parseDecimal", parseTime);
+    printf("%-14s %12.1f\n", "strtof", strtofTime);
+    printf("%d fields, speedup %.1fx\n",
+           kDecimalCorpusSize,
+           parseTime > 0 ? strtofTime / parseTime : 0);
+    return 0;
+}
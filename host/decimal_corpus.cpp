@@ -0,0 +1,87 @@
+// Copyright 2021 Jacques Supcik <jacques@supcik.net>
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file decimal_corpus.cpp
+ * @author Jacques Supcik <jacques@supcik.net>
+ *
+ * @brief Fields for the decimal parser, from well-formed to hostile
+ *
+ * @date 2026-10-17
+ * @version 0.1.1
+ ***************************************************************************/
+
+#include "host.h"
+
+// Well-formed numbers, then blanks, signs, points, long fields and garbage
+const char* const kDecimalCorpus[] = {
+    // Well-formed
+    "0",
+    "7",
+    "45.3",
+    "-12.5",
+    "+3.25",
+    "1000",
+    "2480",
+    "0.001",
+    ".5",
+    "5.",
+    "-.75",
+    "+0",
+    "-0",
+    "00012.50",
+    "123456789",
+    "1234567890.5",
+    "3.14159265358979",
+    "999999999.9",
+    "0.000000000001234",
+    // Blanks around the number, as publishers send them
+    "  12.5",
+    "\t-3.5\r\n",
+    "12.5 ",
+    "8\n",
+    // Signs and points
+    "-",
+    "+",
+    "--1",
+    "+-1",
+    ".",
+    "..",
+    "1..2",
+    "1.2.3",
+    "-1.2.",
+    // Long fields
+    "123456789012345678901234567890",
+    "-123456789012345678901234567890.5",
+    "99999999999999999999999999",
+    "1234567890123456789012345678901234567890",
+    "0.000000000000000000000000000001",
+    "0.00000000000000000000000000000000000000000000000001",
+    "1.000000000000000000000000000000000000000000000000001",
+    // Empty and garbage
+    "",
+    "  ",
+    "\r\n",
+    "12a",
+    "a12",
+    "1 2",
+    "1,5",
+    "1e3",
+    "0x1A",
+    "inf",
+    "nan",
+};
+
+const int kDecimalCorpusSize =
+    sizeof(kDecimalCorpus) / sizeof(kDecimalCorpus[0]);
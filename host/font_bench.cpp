@@ -0,0 +1,410 @@
+// Copyright 2021 Jacques Supcik <jacques@supcik.net>
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file font_bench.cpp
+ * @author Jacques Supcik <jacques@supcik.net>
+ *
+ * @brief Host benchmark of the text renderers
+ *
+ * @date 2026-10-17
+ * @version 0.1.1
+ ***************************************************************************/
+
+#include <Arduino.h>
+#include <M5Stack.h>
+
+#include <chrono>
+#include <vector>
+
+#include "IBMPlexSansSemiBold32pt8b2bpp.h"
+#include "IBMPlexSansSemiBold32pt8b4bpp.h"
+#include "IBMPlexSansSemiBold40pt8b2bpp.h"
+#include "IBMPlexSansSemiBold40pt8b4bpp.h"
+#include "blitter.h"
+#include "fonts.h"
+#include "glyphcache.h"
+#include "glyphs.h"
+#include "host.h"
+
+const int kIterations       = 2000;  // draws timed per text and renderer
+const int kDecodeIterations = 200;   // decodings of a whole font
+const int kLookupIterations = 20000;  // lookups of kLookupText
+const int kBlitBatches      = 20;     // batches of draws, see timeBlit()
+
+// Characters looked up in every font: digits, units and a character no font
+// has, which subsets find as their missing glyph
+static const char kLookupText[] = "0123456789 -.°C → 45.3°C";
+
+struct BenchText {
+    const char* name;
+    const GFXfont* font;
+    const char* text;
+};
+
+static const BenchText kTexts[] = {
+    {"temperature", &IBMPlexSans_SemiBold40pt8b, "45.3°C"},
+    {"volume", &IBMPlexSans_SemiBold40pt8b, "2480 l"},
+    {"power", &IBMPlexSans_SemiBold32pt8b, "3120W"},
+    {"timestamp", &IBMPlexMono_Regular9pt8b, "2021-11-30 07:45"},
+};
+
+// Texts of the kerned fonts, for the layout
+static const BenchText kKernTexts[] = {
+    {"temperature", &IBMPlexSans_SemiBold40pt8b, "-12.5°C"},
+    {"volume", &IBMPlexSans_SemiBold40pt8b, "2480 l"},
+    {"power", &IBMPlexSans_SemiBold32pt8b, "3120W"},
+    {"unknown", &IBMPlexSans_SemiBold32pt8b, "  nanW"},
+    {"timestamp", &IBMPlexMono_Regular9pt8b, "2021-11-30 07:45"},
+};
+
+// Anti-aliased fonts are not in the registry: their tables are given here
+#define GREY_FACE(name)                                                    \
+    {&name, nullptr, nullptr, &name##Greys, &name##Subset, &name##Kerning, \
+     nullptr}
+
+// The value texts, with the value fonts anti-aliased
+struct BenchGreyText {
+    const char* name;
+    const GFXfont* font;  // monochrome
+    FontFace grey2;       // 2 bits per pixel
+    FontFace grey4;       // 4 bits per pixel
+    const char* text;
+};
+
+static const BenchGreyText kGreyTexts[] = {
+    {"temperature",
+     &IBMPlexSans_SemiBold40pt8b,
+     GREY_FACE(IBMPlexSans_SemiBold40pt8b_2bpp),
+     GREY_FACE(IBMPlexSans_SemiBold40pt8b_4bpp),
+     "45.3°C"},
+    {"volume",
+     &IBMPlexSans_SemiBold40pt8b,
+     GREY_FACE(IBMPlexSans_SemiBold40pt8b_2bpp),
+     GREY_FACE(IBMPlexSans_SemiBold40pt8b_4bpp),
+     "2480 l"},
+    {"power",
+     &IBMPlexSans_SemiBold32pt8b,
+     GREY_FACE(IBMPlexSans_SemiBold32pt8b_2bpp),
+     GREY_FACE(IBMPlexSans_SemiBold32pt8b_4bpp),
+     "3120W"},
+};
+
+struct BenchFont {
+    const char* name;
+    const GFXfont* font;
+};
+
+static const BenchFont kBenchFonts[] = {
+    {"Sans SemiBold 40", &IBMPlexSans_SemiBold40pt8b},
+    {"Sans SemiBold 32", &IBMPlexSans_SemiBold32pt8b},
+    {"Mono Regular 9", &IBMPlexMono_Regular9pt8b},
+};
+
+typedef std::chrono::steady_clock WallClock;
+
+static double elapsedMicros(WallClock::time_point start)
+{
+    return std::chrono::duration<double, std::micro>(WallClock::now() - start)
+        .count();
+}
+
+static const char* encodingName(const FontFace& face)
+{
+    if (face.packed != nullptr) return "packed";
+    if (face.spans != nullptr) return "spans";
+    return "bitmap";
+}
+
+// Copy of a font with raw bitmaps, decoded from the firmware's encoding
+struct RawFont {
+    std::vector<uint8_t> bitmap;
+    std::vector<GFXglyph> glyphs;
+    GFXfont font;
+    FontFace face;
+
+    explicit RawFont(const GFXfont* source)
+    {
+        FontFace encoded = fontFace(source);
+        uint32_t bit     = 0;
+        for (int i = 0; i <= source->last - source->first; i++) {
+            GFXglyph glyph     = source->glyph[i];
+            glyph.bitmapOffset = (bit + 7) / 8;
+            bit                = glyph.bitmapOffset * 8;
+            bitmap.resize(glyph.bitmapOffset + glyph.width * glyph.height);
+            GlyphReader reader;
+            reader.begin(encoded, i);
+            for (int y = 0; y < glyph.height; y++) {
+                int runs = reader.next();
+                for (int r = 0; r < runs; r++) {
+                    const GlyphRun& run = reader.runs()[r];
+                    for (int x = run.start; x < run.end; x++) {
+                        uint32_t b = bit + y * glyph.width + x;
+                        bitmap[b >> 3] |= 0x80 >> (b & 7);
+                    }
+                }
+            }
+            bit += glyph.width * glyph.height;
+            glyphs.push_back(glyph);
+        }
+        font        = *source;
+        font.bitmap = bitmap.data();
+        font.glyph  = glyphs.data();
+        face        = encoded;
+        face.font   = &font;
+        face.spans  = nullptr;
+        face.packed = nullptr;
+    }
+};
+
+// Mean time to decode a glyph row, in nanoseconds
+static double timeDecode(const FontFace& face)
+{
+    unsigned long rows          = 0;
+    unsigned long runs          = 0;
+    const GFXfont* font         = face.font;
+    WallClock::time_point start = WallClock::now();
+    for (int n = 0; n < kDecodeIterations; n++) {
+        for (int i = 0; i <= font->last - font->first; i++) {
+            GlyphReader reader;
+            reader.begin(face, i);
+            for (int y = 0; y < font->glyph[i].height; y++) {
+                runs += reader.next();
+                rows++;
+            }
+        }
+    }
+    double elapsed = elapsedMicros(start);
+    // Keeps the decoding from being optimized away
+    if (runs == 0) printf("no runs\n");
+    return rows == 0 ? 0 : elapsed * 1000 / rows;
+}
+
+// Mean time to decode a character of kLookupText and find its glyph, in
+// nanoseconds
+static double timeLookup(const FontFace& face)
+{
+    unsigned long chars         = 0;
+    long sum                    = 0;
+    WallClock::time_point start = WallClock::now();
+    for (int n = 0; n < kLookupIterations; n++) {
+        const uint8_t* p = reinterpret_cast<const uint8_t*>(kLookupText);
+        while (*p) {
+            sum += glyphIndex(face, decodeUtf8(p));
+            chars++;
+        }
+    }
+    double elapsed = elapsedMicros(start);
+    // Keeps the lookups from being optimized away
+    if (sum == 0) printf("no glyphs\n");
+    return chars == 0 ? 0 : elapsed * 1000 / chars;
+}
+
+// Work done per draw: bits tested by the bitmap renderer and runs filled
+static void countWork(const FontFace& face,
+                      const char* text,
+                      unsigned long& bits,
+                      unsigned long& runs)
+{
+    bits             = 0;
+    runs             = 0;
+    const uint8_t* p = reinterpret_cast<const uint8_t*>(text);
+    while (*p) {
+        int index = glyphIndex(face, decodeUtf8(p));
+        if (index < 0) continue;
+        const GFXglyph* glyph = &face.font->glyph[index];
+        bits += glyph->width * glyph->height;
+        GlyphReader reader;
+        reader.begin(face, index);
+        for (int y = 0; y < glyph->height; y++) runs += reader.next();
+    }
+}
+
+// Wall time of blitText() on a laid out text, in microseconds: the best mean
+// of kBlitBatches batches of draws, the least disturbed by other processes
+static double timeBlit(const FontFace& face,
+                       const char* text,
+                       GlyphCache* cache = nullptr)
+{
+    TextLayout layout;
+    layoutText(face, text, layout);
+    Box area    = inkBox(layout, 0, 0);
+    int draws   = kIterations / kBlitBatches;
+    double best = 0;
+    for (int batch = 0; batch < kBlitBatches; batch++) {
+        WallClock::time_point start = WallClock::now();
+        for (int i = 0; i < draws; i++) {
+            blitText(layout, 0, 0, WHITE, BLACK, area, cache);
+        }
+        double mean = elapsedMicros(start) / draws;
+        if (batch == 0 || mean < best) best = mean;
+    }
+    return best;
+}
+
+// Mean wall time of layoutText(), in microseconds
+static double timeLayout(const FontFace& face, const char* text)
+{
+    TextLayout layout;
+    long width                  = 0;
+    WallClock::time_point start = WallClock::now();
+    for (int i = 0; i < kIterations; i++) {
+        layoutText(face, text, layout);
+        width += layout.width;
+    }
+    double elapsed = elapsedMicros(start);
+    // Keeps the layout from being optimized away
+    if (width == 0) printf("no width\n");
+    return elapsed / kIterations;
+}
+
+// Number of kerned pairs in `text`
+static int countKerned(const FontFace& face, const char* text)
+{
+    TextLayout layout;
+    layoutText(face, text, layout);
+    int pairs = 0;
+    for (int i = 1; i < layout.count; i++) {
+        if (kerning(face, layout.glyphs[i - 1], layout.glyphs[i]) != 0) {
+            pairs++;
+        }
+    }
+    return pairs;
+}
+
+int benchFonts()
+{
+    printf("%-18s %-8s %16s %16s %17s\n",
+           "font",
+           "encoding",
+           "decode (ns/row)",
+           "bitmap (ns/row)",
+           "lookup (ns/char)");
+    for (const BenchFont& bench : kBenchFonts) {
+        FontFace face = fontFace(bench.font);
+        RawFont raw(bench.font);
+        printf("%-18s %-8s %16.1f %16.1f %17.1f\n",
+               bench.name,
+               encodingName(face),
+               timeDecode(face),
+               timeDecode(raw.face),
+               timeLookup(face));
+    }
+    printf("\n");
+
+    printf("%-12s %-8s %8s %8s %12s %12s %8s\n",
+           "text",
+           "encoding",
+           "bits",
+           "runs",
+           "bitmap (us)",
+           "encoded (us)",
+           "speed-up");
+    for (const BenchText& bench : kTexts) {
+        FontFace face = fontFace(bench.font);
+        RawFont raw(bench.font);
+        unsigned long bits, runs;
+        countWork(face, bench.text, bits, runs);
+        double bitmapTime  = timeBlit(raw.face, bench.text);
+        double encodedTime = timeBlit(face, bench.text);
+        printf("%-12s %-8s %8lu %8lu %12.2f %12.2f %7.1fx\n",
+               bench.name,
+               encodingName(face),
+               bits,
+               runs,
+               bitmapTime,
+               encodedTime,
+               encodedTime > 0 ? bitmapTime / encodedTime : 0);
+    }
+    printf("\n");
+
+    printf("%-12s %8s %14s %12s %12s\n",
+           "text",
+           "kerned",
+           "width (px)",
+           "plain (us)",
+           "kerned (us)");
+    for (const BenchText& bench : kKernTexts) {
+        FontFace face  = fontFace(bench.font);
+        FontFace plain = face;
+        plain.kerning  = nullptr;
+        char widths[32];
+        snprintf(widths,
+                 sizeof(widths),
+                 "%d -> %d",
+                 textWidth(plain, bench.text),
+                 textWidth(face, bench.text));
+        printf("%-12s %8d %14s %12.3f %12.3f\n",
+               bench.name,
+               countKerned(face, bench.text),
+               widths,
+               timeLayout(plain, bench.text),
+               timeLayout(face, bench.text));
+    }
+    printf("\n");
+
+    // Blending against the background, through the palette, next to the
+    // monochrome runs of the firmware's fonts
+    printf("%-12s %12s %12s %12s %8s %8s\n",
+           "text",
+           "1 bpp (us)",
+           "2 bpp (us)",
+           "4 bpp (us)",
+           "2 bpp",
+           "4 bpp");
+    for (const BenchGreyText& bench : kGreyTexts) {
+        double monoTime  = timeBlit(fontFace(bench.font), bench.text);
+        double grey2Time = timeBlit(bench.grey2, bench.text);
+        double grey4Time = timeBlit(bench.grey4, bench.text);
+        printf("%-12s %12.2f %12.2f %12.2f %7.2fx %7.2fx\n",
+               bench.name,
+               monoTime,
+               grey2Time,
+               grey4Time,
+               monoTime > 0 ? grey2Time / monoTime : 0,
+               monoTime > 0 ? grey4Time / monoTime : 0);
+    }
+    printf("\n");
+
+    // Rows copied from the images of the glyph cache, expanded by the first
+    // draw, next to the rows decoded at every draw. The host reads the fonts
+    // from RAM, not from flash, and its simulated LCD costs more than the
+    // decoding: the gain is smaller than on the device.
+    GlyphCache cache(GLYPH_CACHE_BUDGET);
+    printf("%-12s %12s %12s %8s %8s %8s\n",
+           "text",
+           "decoded (us)",
+           "cached (us)",
+           "speedup",
+           "hits",
+           "misses");
+    for (const BenchText& bench : kTexts) {
+        FontFace face = fontFace(bench.font);
+        cache.resetCounters();
+        double decodedTime = timeBlit(face, bench.text);
+        double cachedTime  = timeBlit(face, bench.text, &cache);
+        printf("%-12s %12.2f %12.2f %7.2fx %8lu %8lu\n",
+               bench.name,
+               decodedTime,
+               cachedTime,
+               cachedTime > 0 ? decodedTime / cachedTime : 0,
+               cache.hits(),
+               cache.misses());
+    }
+    printf("glyph cache: %d images, %u of %u bytes\n",
+           cache.size(),
+           (unsigned)cache.bytes(),
+           (unsigned)cache.budget());
+    return 0;
+}
@@ -0,0 +1,170 @@
+// Copyright 2021 Jacques Supcik <jacques@supcik.net>
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file font_pack.cpp
+ * @author Jacques Supcik <jacques@supcik.net>
+ *
+ * @brief Host check of the font packs against the compiled fonts
+ *
+ * @date 2026-10-17
+ * @version 0.1.1
+ ***************************************************************************/
+
+#include <Arduino.h>
+#include <M5Stack.h>
+#include <esp_partition.h>
+
+#include "fontpack.h"
+#include "fonts.h"
+#include "glyphs.h"
+#include "host.h"
+
+static const char* encodingName(const FontFace& face)
+{
+    if (face.packed != nullptr) return "packed";
+    if (face.spans != nullptr) return "spans";
+    return "bitmap";
+}
+
+// Whether glyph `index` of `a` and `b` has the same metrics and rows
+static bool sameGlyph(const FontFace& a, const FontFace& b, int index)
+{
+    const GFXglyph& ga = a.font->glyph[index];
+    const GFXglyph& gb = b.font->glyph[index];
+    if (ga.width != gb.width || ga.height != gb.height ||
+        ga.xAdvance != gb.xAdvance || ga.xOffset != gb.xOffset ||
+        ga.yOffset != gb.yOffset) {
+        return false;
+    }
+    GlyphReader ra, rb;
+    if (ra.begin(a, index) != rb.begin(b, index)) return false;
+    for (int y = 0; y < ga.height; y++) {
+        int runs = ra.next();
+        if (rb.next() != runs) return false;
+        for (int i = 0; i < runs; i++) {
+            if (ra.runs()[i].start != rb.runs()[i].start ||
+                ra.runs()[i].end != rb.runs()[i].end) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+// Describes the first difference between `pack` and `builtin`, or returns
+// nullptr if they draw the same
+static const char* compareFaces(const FontFace& pack, const FontFace& builtin)
+{
+    const GFXfont* a = pack.font;
+    const GFXfont* b = builtin.font;
+    if (a->first != b->first || a->last != b->last ||
+        a->yAdvance != b->yAdvance) {
+        return "font";
+    }
+    if ((pack.spans == nullptr) != (builtin.spans == nullptr) ||
+        (pack.packed == nullptr) != (builtin.packed == nullptr)) {
+        return "encoding";
+    }
+    for (int i = 0; i <= a->last - a->first; i++) {
+        if (!sameGlyph(pack, builtin, i)) return "glyphs";
+    }
+    if ((pack.subset == nullptr) != (builtin.subset == nullptr)) {
+        return "subset";
+    }
+    if (pack.subset != nullptr) {
+        const GFXsubset& sa = *pack.subset;
+        const GFXsubset& sb = *builtin.subset;
+        if (sa.count != sb.count || sa.fallback != sb.fallback ||
+            sa.ascent != sb.ascent) {
+            return "subset";
+        }
+        for (int i = 0; i < sa.count; i++) {
+            if (sa.ranges[i].first != sb.ranges[i].first ||
+                sa.ranges[i].count != sb.ranges[i].count ||
+                sa.ranges[i].glyph != sb.ranges[i].glyph) {
+                return "subset";
+            }
+        }
+    }
+    int pairs = builtin.kerning != nullptr ? builtin.kerning->count : 0;
+    if ((pack.kerning != nullptr ? pack.kerning->count : 0) != pairs) {
+        return "kerning";
+    }
+    for (int i = 0; i < pairs; i++) {
+        const GFXkernPair& pa = pack.kerning->pairs[i];
+        const GFXkernPair& pb = builtin.kerning->pairs[i];
+        if (pa.left != pb.left || pa.right != pb.right || pa.dx != pb.dx) {
+            return "kerning";
+        }
+    }
+    return nullptr;
+}
+
+int checkFontPack(const char* path,
+                  const char* outputDir,
+                  const char* goldenDir)
+{
+    if (!setPartitionImage("fonts", path)) {
+        fprintf(stderr, "cannot read %s\n", path);
+        return 1;
+    }
+    int count = loadFontPartition();
+    if (count < 0) {
+        fprintf(stderr, "%s: not a valid font pack\n", path);
+        return 1;
+    }
+    FontPackHeader header;
+    esp_partition_read(esp_partition_find_first(
+                           ESP_PARTITION_TYPE_DATA,
+                           ESP_PARTITION_SUBTYPE_ANY,
+                           "fonts"),
+                       0,
+                       &header,
+                       sizeof(header));
+    printf("%s: %d fonts, %u bytes, id %.16s\n\n",
+           path,
+           count,
+           (unsigned)header.size,
+           header.id);
+
+    int failures = 0;
+    printf("%-28s %-8s %7s %8s  %s\n",
+           "font",
+           "encoding",
+           "glyphs",
+           "pairs",
+           "compiled font");
+    for (int i = 0; i < count; i++) {
+        const PackFont& font   = packFont(i);
+        const GFXfont* builtin = findFont(font.name);
+        const char* difference =
+            builtin == nullptr ? "missing"
+                               : compareFaces(font.face, builtinFace(builtin));
+        if (difference != nullptr) failures++;
+        printf("%-28s %-8s %7d %8d  %s%s\n",
+               font.name,
+               encodingName(font.face),
+               font.font.last - font.font.first + 1,
+               font.face.kerning != nullptr ? font.face.kerning->count : 0,
+               difference != nullptr ? "differs: " : "identical",
+               difference != nullptr ? difference : "");
+    }
+    if (outputDir == nullptr) return failures == 0 ? 0 : 1;
+
+    // fontFace() now returns the fonts of the pack
+    printf("\n");
+    if (dumpScreens(outputDir, goldenDir) != 0) failures++;
+    return failures == 0 ? 0 : 1;
+}
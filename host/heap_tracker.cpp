@@ -0,0 +1,95 @@
+// Copyright 2021 Jacques Supcik <jacques@supcik.net>
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file heap_tracker.cpp
+ * @author Jacques Supcik <jacques@supcik.net>
+ *
+ * @brief C++ heap usage tracking for the host tools
+ *
+ * @date 2026-10-17
+ * @version 0.1.1
+ ***************************************************************************/
+
+#include <stddef.h>
+#include <stdlib.h>
+
+#include <new>
+
+#include "host.h"
+
+// Each block is preceded by a header holding its size. The header keeps
+// the alignment guaranteed by malloc.
+union BlockHeader {
+    size_t size;
+    max_align_t align;
+};
+
+static HeapStats stats;
+
+const HeapStats& heapStats() { return stats; }
+
+void resetHeapPeak() { stats.peak = stats.current; }
+
+void* operator new(size_t size)
+{
+    BlockHeader* header =
+        static_cast<BlockHeader*>(malloc(sizeof(BlockHeader) + size));
+    if (header == nullptr) throw std::bad_alloc();
+    header->size = size;
+    stats.current += size;
+    stats.allocations++;
+    if (stats.current > stats.peak) stats.peak = stats.current;
+    return header + 1;
+}
+
+void* operator new[](size_t size) { return operator new(size); }
+
+void* operator new(size_t size, const std::nothrow_t&) noexcept
+{
+    try {
+        return operator new(size);
+    } catch (const std::bad_alloc&) {
+        return nullptr;
+    }
+}
+
+void* operator new[](size_t size, const std::nothrow_t&) noexcept
+{
+    return operator new(size, std::nothrow);
+}
+
+void operator delete(void* p) noexcept
+{
+    if (p == nullptr) return;
+    BlockHeader* header = static_cast<BlockHeader*>(p) - 1;
+    stats.current -= header->size;
+    free(header);
+}
+
+void operator delete[](void* p) noexcept { operator delete(p); }
+
+void operator delete(void* p, size_t) noexcept { operator delete(p); }
+
+void operator delete[](void* p, size_t) noexcept { operator delete(p); }
+
+void operator delete(void* p, const std::nothrow_t&) noexcept
+{
+    operator delete(p);
+}
+
+void operator delete[](void* p, const std::nothrow_t&) noexcept
+{
+    operator delete(p);
+}
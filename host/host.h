@@ -0,0 +1,82 @@
+// Copyright 2021 Jacques Supcik <jacques@supcik.net>
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file host.h
+ * @author Jacques Supcik <jacques@supcik.net>
+ *
+ * @brief Tools of the host build
+ *
+ * @date 2026-10-17
+ * @version 0.1.1
+ ***************************************************************************/
+
+#ifndef HOST_H_
+#define HOST_H_
+
+#include <stddef.h>
+
+// Arduino entry points of the firmware, in main.cpp
+void setup();
+void loop();
+
+// Runs setup() and loop() for `seconds` of simulated time.
+int runFirmware(unsigned long seconds);
+
+// Renders every screen into PPM files in `outputDir` and prints what each
+// frame costs on the SPI bus. The value screens are rendered with every
+// backend; the images of the backends other than the default one have its
+// name as a suffix. If `goldenDir` is not null, compares each screen with
+// the image of the screen in it, whatever the backend, and returns 1 if any
+// pixel differs. The reference images are in test/golden: to update them,
+// render into that directory and remove the images of the other backends.
+int dumpScreens(const char* outputDir, const char* goldenDir);
+
+// Replays an MQTT trace through the firmware under the simulated clock and
+// prints the cost of each message, then the allocations of the text payload
+// parser against the getField() one it replaced. See record_trace.py for the
+// format.
+int replayTrace(const char* path, bool verbose);
+
+// Loads the font pack at `path` the way the firmware does, from a stand-in
+// of its partition, and compares each of its fonts with the font compiled
+// into the firmware. If `outputDir` is not null, then renders the screens
+// with the fonts of the pack, as dumpScreens() does. Returns 1 if any font
+// or screen differs.
+int checkFontPack(const char* path,
+                  const char* outputDir,
+                  const char* goldenDir);
+
+// Times the text renderers of blitter.cpp on the value fonts and prints the
+// work each one does per draw.
+int benchFonts();
+
+// Fields of every shape for parseDecimal(), in decimal_corpus.cpp: the unit
+// tests check the results against strtof(), benchDecimal() times both.
+extern const char* const kDecimalCorpus[];
+extern const int kDecimalCorpusSize;
+
+// Times parseDecimal() and strtof() on kDecimalCorpus.
+int benchDecimal();
+
+// C++ heap usage of the process, tracked by heap_tracker.cpp
+struct HeapStats {
+    size_t current;             // bytes allocated
+    size_t peak;                // high-water mark of `current`
+    unsigned long allocations;  // number of allocations
+};
+const HeapStats& heapStats();
+void resetHeapPeak();
+
+#endif /* HOST_H_ */
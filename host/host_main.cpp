@@ -0,0 +1,100 @@
+// Copyright 2021 Jacques Supcik <jacques@supcik.net>
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file host_main.cpp
+ * @author Jacques Supcik <jacques@supcik.net>
+ *
+ * @brief Entry point of the host build
+ *
+ * @date 2026-10-17
+ * @version 0.1.1
+ ***************************************************************************/
+
+// Usage:
+//
+//   program [run] [seconds]               run the firmware (default: 60 s)
+//   program screens OUTPUT_DIR [GOLDEN_DIR]
+//   program replay TRACE [-v]
+//   program fontpack PACK [OUTPUT_DIR [GOLDEN_DIR]]
+//   program bench [fonts|decimal]         time the text renderers or the
+//                                         decimal parser
+//
+// Unit tests provide their own main().
+
+#ifndef PIO_UNIT_TESTING
+
+#include <Arduino.h>
+
+#include "clock.h"
+#include "host.h"
+
+int runFirmware(unsigned long seconds)
+{
+    setup();
+    while (nowMs() < seconds * 1000) {
+        loop();
+    }
+    return 0;
+}
+
+static int usage(const char* program)
+{
+    fprintf(stderr,
+            "usage: %s [run] [seconds]\n"
+            "       %s screens OUTPUT_DIR [GOLDEN_DIR]\n"
+            "       %s replay TRACE [-v]\n"
+            "       %s fontpack PACK [OUTPUT_DIR [GOLDEN_DIR]]\n"
+            "       %s bench [fonts|decimal]\n",
+            program,
+            program,
+            program,
+            program,
+            program);
+    return 2;
+}
+
+int main(int argc, char* argv[])
+{
+    const char* command = argc > 1 ? argv[1] : "run";
+    if (strcmp(command, "screens") == 0) {
+        if (argc < 3 || argc > 4) return usage(argv[0]);
+        return dumpScreens(argv[2], argc > 3 ? argv[3] : nullptr);
+    }
+    if (strcmp(command, "replay") == 0) {
+        if (argc < 3 || argc > 4) return usage(argv[0]);
+        bool verbose = argc > 3 && strcmp(argv[3], "-v") == 0;
+        return replayTrace(argv[2], verbose);
+    }
+    if (strcmp(command, "fontpack") == 0) {
+        if (argc < 3 || argc > 5) return usage(argv[0]);
+        return checkFontPack(argv[2],
+                             argc > 3 ? argv[3] : nullptr,
+                             argc > 4 ? argv[4] : nullptr);
+    }
+    if (strcmp(command, "bench") == 0) {
+        if (argc > 3) return usage(argv[0]);
+        if (argc == 2 || strcmp(argv[2], "fonts") == 0) return benchFonts();
+        if (strcmp(argv[2], "decimal") == 0) return benchDecimal();
+        return usage(argv[0]);
+    }
+    if (strcmp(command, "run") == 0) {
+        argc--;
+        argv++;
+    }
+    if (argc > 2) return usage(argv[0]);
+    return runFirmware(argc > 1 ? strtoul(argv[1], nullptr, 10) : 60);
+}
+
+#endif /* PIO_UNIT_TESTING */
@@ -0,0 +1,101 @@
+#!/usr/bin/env python3
+"""Build an MQTT trace for `program replay` (see host/trace_replay.cpp).
+
+The trace has one message per line:
+
+  TIME_MS <tab> TOPIC <tab> PAYLOAD
+
+TIME_MS counts from the first message. A payload that is not printable
+text is written as "hex:" followed by its bytes in hexadecimal.
+
+Sources:
+
+  # serial log of the device, as printed by messageReceived()
+  ./record_trace.py serial device.log > week.trace
+  # with the time stamps of `pio device monitor --filter time`
+  pio device monitor --filter time | tee device.log
+
+  # live from the broker, time stamped on arrival
+  mosquitto_sub -h HOST -t TOPIC -v | ./record_trace.py broker > live.trace
+
+Serial lines without a time stamp are spaced by --interval milliseconds.
+Binary payloads are not printed in full by the firmware and are skipped.
+"""
+
+import argparse
+import re
+import sys
+import time
+
+INCOMING = re.compile(r"incoming: (\S+) - (.*)$")
+MONITOR_TIME = re.compile(r"^(\d\d):(\d\d):(\d\d)\.(\d\d\d) > ")
+
+
+def encode(payload):
+    printable = all(0x20 <= b < 0x7F or b >= 0x80 for b in payload)
+    if printable:
+        try:
+            return payload.decode("utf-8")
+        except UnicodeDecodeError:
+            pass
+    return "hex:" + payload.hex()
+
+
+def from_serial(lines, interval):
+    previous = None
+    day = 0
+    t = 0
+    for line in lines:
+        line = line.rstrip("\r\n")
+        match = INCOMING.search(line)
+        if not match:
+            continue
+        topic, payload = match.groups()
+        if payload.startswith("<binary"):
+            print("skipping binary payload: " + line, file=sys.stderr)
+            continue
+        stamp = MONITOR_TIME.match(line)
+        if stamp:
+            h, m, s, ms = (int(g) for g in stamp.groups())
+            clock = ((h * 60 + m) * 60 + s) * 1000 + ms
+            if previous is not None and clock + day < previous:
+                day += 24 * 3600 * 1000  # the monitor clock wrapped
+            t = clock + day
+        elif previous is not None:
+            t = previous + interval
+        previous = t
+        yield t, topic, payload.encode("utf-8")
+
+
+def from_broker(lines):
+    for line in lines:
+        arrival = int(time.monotonic() * 1000)
+        topic, _, payload = line.rstrip("\n").partition(" ")
+        yield arrival, topic, payload.encode("utf-8", "surrogateescape")
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("source", choices=["serial", "broker"])
+    parser.add_argument("input", nargs="?", default="-",
+                        help="log file (default: standard input)")
+    parser.add_argument("--interval", type=int, default=1000,
+                        help="spacing of serial lines without time stamp, in ms")
+    args = parser.parse_args()
+
+    source = sys.stdin if args.input == "-" else open(args.input, errors="replace")
+    if args.source == "serial":
+        messages = from_serial(source, args.interval)
+    else:
+        messages = from_broker(source)
+
+    origin = None
+    for t, topic, payload in messages:
+        if origin is None:
+            origin = t
+        sys.stdout.write("%d\t%s\t%s\n" % (t - origin, topic, encode(payload)))
+        sys.stdout.flush()
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,165 @@
+// Copyright 2021 Jacques Supcik <jacques@supcik.net>
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file screen_dump.cpp
+ * @author Jacques Supcik <jacques@supcik.net>
+ *
+ * @brief Renders the screens with the simulated LCD
+ *
+ * @date 2026-10-17
+ * @version 0.1.1
+ ***************************************************************************/
+
+#include <Arduino.h>
+#include <M5Stack.h>
+
+#include <string>
+#include <vector>
+
+#include "global.h"
+#include "host.h"
+#include "screens.h"
+
+struct Sample {
+    const char* name;
+    data values;
+};
+
+static const Sample kSamples[] = {
+    {"normal", {"2021-11-30 07:45", 123, 45.3, 450, 1200}},
+    {"hot", {"2021-11-30 19:05", 2480, 65.0, 3120, 0}},
+};
+
+static bool loadPpm(const std::string& path, std::vector<uint8_t>& rgb)
+{
+    FILE* file = fopen(path.c_str(), "rb");
+    if (file == nullptr) return false;
+    int width, height, depth;
+    bool ok = fscanf(file, "P6 %d %d %d", &width, &height, &depth) == 3 &&
+              fgetc(file) != EOF;
+    if (ok) {
+        rgb.resize(static_cast<size_t>(width) * height * 3);
+        ok = fread(rgb.data(), 1, rgb.size(), file) == rgb.size();
+    }
+    fclose(file);
+    return ok;
+}
+
+// Returns the number of pixels that differ, or -1 if an image is missing
+static long compare(const std::string& path, const std::string& goldenPath)
+{
+    std::vector<uint8_t> image, golden;
+    if (!loadPpm(path, image) || !loadPpm(goldenPath, golden) ||
+        image.size() != golden.size()) {
+        return -1;
+    }
+    long count = 0;
+    for (size_t i = 0; i < image.size(); i += 3) {
+        if (memcmp(&image[i], &golden[i], 3) != 0) count++;
+    }
+    return count;
+}
+
+int dumpScreens(const char* outputDir, const char* goldenDir)
+{
+    struct Frame {
+        std::string name;
+        void (*render)();
+    };
+    std::vector<Frame> frames = {
+        {"welcome", displayWelcome},
+        {"wifi_error", displayWifiConnectionError},
+        {"mqtt_error", displayMqttConnectionError},
+    };
+
+    Serial.setOutput(nullptr);
+    gHasData = true;
+    gStale   = false;
+
+    int failures = 0;
+    printf("%-30s %12s %10s %10s %8s\n",
+           "screen",
+           "transactions",
+           "pixels",
+           "bytes",
+           "diff");
+
+    // `golden` is the name of the reference image, if it is not `name`
+    auto record = [&](const std::string& name, const std::string& golden) {
+        const LcdStats& stats = M5.Lcd.stats();
+        std::string path      = std::string(outputDir) + "/" + name + ".ppm";
+        if (!M5.Lcd.savePpm(path.c_str())) {
+            fprintf(stderr, "cannot write %s\n", path.c_str());
+            failures++;
+            return;
+        }
+        printf("%-30s %12llu %10llu %10llu",
+               name.c_str(),
+               (unsigned long long)stats.transactions,
+               (unsigned long long)stats.pixels,
+               (unsigned long long)stats.bytes);
+        if (goldenDir != nullptr) {
+            long diff = compare(
+                path, std::string(goldenDir) + "/" + golden + ".ppm");
+            if (diff != 0) failures++;
+            if (diff < 0) {
+                printf(" %8s", "missing");
+            } else {
+                printf(" %8ld", diff);
+            }
+        }
+        printf("\n");
+    };
+
+    for (const Frame& frame : frames) {
+        M5.Lcd.resetStats();
+        frame.render();
+        record(frame.name, frame.name);
+    }
+
+    // The value screens are drawn with each backend, so that their costs
+    // can be compared. The backends draw the same pixels: the images of the
+    // default one are named after the screen alone, and the images of all
+    // of them are compared with these.
+    const RenderBackend backends[] = {
+        kRenderDirect, kRenderSprite, kRenderBlit};
+    for (int screen = 0; screen < 3; screen++) {
+        for (RenderBackend backend : backends) {
+            gRenderBackend     = backend;
+            gScreenNo          = screen;
+            std::string prefix = "screen" + std::to_string(screen) + "_";
+            std::string suffix =
+                backend == RENDER_BACKEND
+                    ? ""
+                    : std::string("_") + kRenderBackendNames[backend];
+
+            // Full paint of the screen, then an update to the other values
+            std::string name = prefix + kSamples[0].name;
+            displayWelcome();
+            gData = kSamples[0].values;
+            M5.Lcd.resetStats();
+            displayValues();
+            record(name + suffix, name);
+
+            name  = prefix + kSamples[1].name + "_update";
+            gData = kSamples[1].values;
+            M5.Lcd.resetStats();
+            displayValues();
+            record(name + suffix, name);
+        }
+    }
+    gRenderBackend = RENDER_BACKEND;
+    return failures == 0 ? 0 : 1;
+}
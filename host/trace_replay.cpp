@@ -0,0 +1,302 @@
+// Copyright 2021 Jacques Supcik <jacques@supcik.net>
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file trace_replay.cpp
+ * @author Jacques Supcik <jacques@supcik.net>
+ *
+ * @brief Replays MQTT traces through the firmware
+ *
+ * @date 2026-10-17
+ * @version 0.1.1
+ ***************************************************************************/
+
+#include <Arduino.h>
+#include <MQTT.h>
+
+#include <chrono>
+#include <string>
+#include <vector>
+
+#include "clock.h"
+#include "glyphcache.h"
+#include "host.h"
+#include "payload.h"
+#include "scheduler.h"
+
+// Defined in main.cpp
+extern MQTTClient client;
+extern RenderScheduler scheduler;
+
+// After a message, the firmware runs for this long before the simulated
+// clock jumps to the next message: enough for the scheduler to render it.
+const unsigned long kSettleTime = 1000;  // milliseconds
+
+struct TraceMessage {
+    unsigned long time;  // milliseconds since the start of the trace
+    std::string topic;
+    std::string payload;
+};
+
+// Accumulates durations, in microseconds of wall time
+struct Timing {
+    unsigned long count = 0;
+    double total        = 0;
+    double max          = 0;
+
+    void add(double us)
+    {
+        count++;
+        total += us;
+        if (us > max) max = us;
+    }
+    double mean() const { return count == 0 ? 0 : total / count; }
+};
+
+typedef std::chrono::steady_clock WallClock;
+
+static double elapsedMicros(WallClock::time_point start)
+{
+    return std::chrono::duration<double, std::micro>(WallClock::now() - start)
+        .count();
+}
+
+static bool decodeHex(const std::string& hex, std::string& bytes)
+{
+    if (hex.size() % 2 != 0) return false;
+    bytes.clear();
+    for (size_t i = 0; i < hex.size(); i += 2) {
+        char* end;
+        std::string pair = hex.substr(i, 2);
+        long value       = strtol(pair.c_str(), &end, 16);
+        if (*end != '\0') return false;
+        bytes.push_back(static_cast<char>(value));
+    }
+    return true;
+}
+
+// One message per line: TIME_MS <tab> TOPIC <tab> PAYLOAD, where a payload
+// starting with "hex:" is hex-encoded. Lines starting with '#' are ignored.
+static bool loadTrace(const char* path, std::vector<TraceMessage>& messages)
+{
+    FILE* file = fopen(path, "r");
+    if (file == nullptr) {
+        fprintf(stderr, "cannot open %s\n", path);
+        return false;
+    }
+    char line[4096];
+    int lineNo = 0;
+    bool ok    = true;
+    while (ok && fgets(line, sizeof(line), file) != nullptr) {
+        lineNo++;
+        line[strcspn(line, "\r\n")] = '\0';
+        if (line[0] == '#' || line[0] == '\0') continue;
+
+        char* topic   = strchr(line, '\t');
+        char* payload = topic ? strchr(topic + 1, '\t') : nullptr;
+        if (payload == nullptr) {
+            ok = false;
+            break;
+        }
+        *topic++   = '\0';
+        *payload++ = '\0';
+
+        TraceMessage message;
+        message.time  = strtoul(line, nullptr, 10);
+        message.topic = topic;
+        if (strncmp(payload, "hex:", 4) == 0) {
+            ok = decodeHex(payload + 4, message.payload);
+        } else {
+            message.payload = payload;
+        }
+        if (!messages.empty() && message.time < messages.back().time) {
+            ok = false;
+        }
+        messages.push_back(message);
+    }
+    fclose(file);
+    if (!ok) fprintf(stderr, "%s:%d: malformed trace line\n", path, lineNo);
+    return ok;
+}
+
+// The payload parser that the tokenizer replaced, kept as the baseline of
+// the comparison below
+struct BaselineData {
+    String timestamp;
+    float consumption;
+    float temp;
+    float electricityConsumption;
+    float electricityProduction;
+};
+
+static String getField(String& text)
+{
+    int pos = text.indexOf(";");
+    if (pos < 0) {
+        pos = text.length();
+    }
+    String result = text.substring(0, pos);
+    text          = text.substring(pos + 1);
+    return result;
+}
+
+static void baselineParse(String& payload, BaselineData& out)
+{
+    String field = getField(payload);
+    if (field.length() > 0) out.timestamp = field;
+    field = getField(payload);
+    if (field.length() > 0) out.consumption = field.toFloat();
+    field = getField(payload);
+    if (field.length() > 0) out.temp = field.toFloat();
+    field = getField(payload);
+    if (field.length() > 0) out.electricityConsumption = field.toFloat();
+    field = getField(payload);
+    if (field.length() > 0) out.electricityProduction = field.toFloat();
+}
+
+// Parses the text payloads of the trace with the baseline getField() parser
+// and with the tokenizer, and reports the allocations of both. The baseline
+// also pays for the String that the MQTT library builds for its callback.
+static void compareParsers(const std::vector<TraceMessage>& messages)
+{
+    BaselineData baselineData = {};
+    data tokenizerData        = {};
+    Timing baseline, tokenizer;
+    unsigned long baselineAllocations  = 0;
+    unsigned long tokenizerAllocations = 0;
+
+    for (const TraceMessage& message : messages) {
+        const std::string& bytes = message.payload;
+        if (!bytes.empty() &&
+            static_cast<uint8_t>(bytes[0]) == kBinaryPayloadMagic) {
+            continue;
+        }
+
+        unsigned long allocations   = heapStats().allocations;
+        WallClock::time_point start = WallClock::now();
+        {
+            String payload(bytes.data(), bytes.size());
+            baselineParse(payload, baselineData);
+        }
+        baseline.add(elapsedMicros(start));
+        baselineAllocations += heapStats().allocations - allocations;
+
+        allocations = heapStats().allocations;
+        start       = WallClock::now();
+        parsePayload(bytes.data(), bytes.size(), tokenizerData);
+        tokenizer.add(elapsedMicros(start));
+        tokenizerAllocations += heapStats().allocations - allocations;
+    }
+
+    unsigned long count = baseline.count;
+    printf("text payloads:     %lu\n", count);
+    printf("getField parser:   %.2f allocations, %.2f us mean per message\n",
+           count == 0 ? 0.0 : (double)baselineAllocations / count,
+           baseline.mean());
+    printf("tokenizer:         %.2f allocations, %.2f us mean per message\n",
+           count == 0 ? 0.0 : (double)tokenizerAllocations / count,
+           tokenizer.mean());
+}
+
+int replayTrace(const char* path, bool verbose)
+{
+    std::vector<TraceMessage> messages;
+    if (!loadTrace(path, messages)) return 1;
+    if (messages.empty()) {
+        fprintf(stderr, "%s: empty trace\n", path);
+        return 1;
+    }
+
+    Serial.setOutput(verbose ? stdout : nullptr);
+    // Only count the memory used by the firmware, not by the trace
+    size_t heapBaseline = heapStats().current;
+    resetHeapPeak();
+    WallClock::time_point wallStart = WallClock::now();
+    setup();
+    // Leave the connection some time to come up before the first message
+    unsigned long origin = nowMs() + 5000 - messages.front().time;
+
+    Timing parse, render;
+    unsigned long dropped           = 0;
+    unsigned long parseAllocations  = 0;
+    unsigned long renderAllocations = 0;
+
+    auto runUntil = [&](unsigned long time) {
+        while (nowMs() < time) {
+            unsigned long frames            = scheduler.frames();
+            unsigned long allocations       = heapStats().allocations;
+            WallClock::time_point loopStart = WallClock::now();
+            loop();
+            if (scheduler.frames() != frames) {
+                render.add(elapsedMicros(loopStart));
+                renderAllocations += heapStats().allocations - allocations;
+            }
+        }
+    };
+
+    for (const TraceMessage& message : messages) {
+        unsigned long arrival = origin + message.time;
+        // Fast-forward over the idle time between messages
+        if (nowMs() + kSettleTime < arrival) {
+            runUntil(nowMs() + kSettleTime);
+            if (nowMs() < arrival) sleepMs(arrival - nowMs());
+        }
+        runUntil(arrival);
+
+        unsigned long allocations   = heapStats().allocations;
+        WallClock::time_point start = WallClock::now();
+        bool delivered              = client.deliver(message.topic.c_str(),
+                                        message.payload.data(),
+                                        message.payload.size());
+        double us = elapsedMicros(start);
+        parseAllocations += heapStats().allocations - allocations;
+        if (!delivered) {
+            dropped++;
+            continue;
+        }
+        parse.add(us);
+        if (verbose) {
+            printf("replay: t=%lu ms, parse %.2f us\n", message.time, us);
+        }
+    }
+    runUntil(nowMs() + kSettleTime);
+
+    double wallSeconds = elapsedMicros(wallStart) / 1e6;
+    double simSeconds  = nowMs() / 1000.0;
+    printf("messages:          %zu (%lu dropped)\n", messages.size(), dropped);
+    printf("parse time:        %.2f us mean, %.2f us max\n",
+           parse.mean(),
+           parse.max);
+    printf("parse allocations: %.2f per message\n",
+           parse.count == 0 ? 0.0 : (double)parseAllocations / parse.count);
+    printf("frames rendered:   %lu\n", render.count);
+    printf("render time:       %.2f us mean, %.2f us max\n",
+           render.mean(),
+           render.max);
+    printf("frame allocations: %.2f per frame\n",
+           render.count == 0 ? 0.0 : (double)renderAllocations / render.count);
+    printf("redraws skipped:   %lu\n", scheduler.coalesced());
+    printf("glyph cache:       %zu bytes, %lu hits, %lu misses, %lu reused\n",
+           gGlyphCache.bytes(),
+           gGlyphCache.hits(),
+           gGlyphCache.misses(),
+           gGlyphCache.reused());
+    printf("heap high-water:   %zu bytes\n", heapStats().peak - heapBaseline);
+    printf("simulated time:    %.1f s in %.3f s (%.0fx real time)\n",
+           simSeconds,
+           wallSeconds,
+           wallSeconds > 0 ? simSeconds / wallSeconds : 0);
+    compareParsers(messages);
+    return 0;
+}
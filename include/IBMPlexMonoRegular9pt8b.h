@@ -1,9 +1,12 @@
+// Generated by fonts/build.py from manifest.txt, inputs 39839d70b9cd9581
 #ifndef IBMPLEXMONOREGULAR9PT8B_H_
 #define IBMPLEXMONOREGULAR9PT8B_H_
 
 #include <Arduino.h>
 #include <M5Stack.h>
 
+#include "fontdata.h"
+
 const uint8_t IBMPlexMono_Regular9pt8bBitmaps[] PROGMEM = {
   0x00, 0x49, 0x24, 0x92, 0x40, 0x7E, 0x8C, 0x63, 0x18, 0x80, 0x0C, 0x81,
   0x30, 0x24, 0x04, 0x87, 0x9E, 0x32, 0x06, 0xC0, 0x98, 0xF3, 0xC2, 0x40,
@@ -482,7 +485,988 @@ const GFXfont IBMPlexMono_Regular9pt8b PROGMEM = {
   (GFXglyph *)IBMPlexMono_Regular9pt8bGlyphs,
   0x20, 0xFF, 23 };
 
+const uint8_t IBMPlexMono_Regular9pt8bSpanData[] PROGMEM = {
+  0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03,
+  0x02, 0x00, 0x01, 0x03, 0x01, 0x02, 0x00, 0x01, 0x03, 0x01, 0x02, 0x00,
+  0x01, 0x03, 0x01, 0x02, 0x00, 0x01, 0x03, 0x01, 0x02, 0x00, 0x01, 0x03,
+  0x01, 0x02, 0x04, 0x02, 0x02, 0x01, 0x02, 0x04, 0x01, 0x02, 0x02, 0x02,
+  0x04, 0x01, 0x02, 0x01, 0x02, 0x04, 0x01, 0x02, 0x01, 0x02, 0x01, 0x04,
+  0x02, 0x04, 0x02, 0x03, 0x02, 0x02, 0x01, 0x02, 0x03, 0x02, 0x01, 0x02,
+  0x02, 0x03, 0x01, 0x02, 0x02, 0x02, 0x00, 0x04, 0x02, 0x04, 0x02, 0x03,
+  0x01, 0x02, 0x01, 0x02, 0x02, 0x02, 0x02, 0x01, 0x02, 0x02, 0x02, 0x02,
+  0x01, 0x02, 0x02, 0x01, 0x02, 0x02, 0x01, 0x04, 0x01, 0x01, 0x04, 0x01,
+  0x01, 0x02, 0x05, 0x03, 0x01, 0x02, 0x01, 0x01, 0x02, 0x02, 0x03, 0x01,
+  0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x00, 0x02, 0x02, 0x01, 0x02, 0x01,
+  0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x01, 0x01, 0x03, 0x04, 0x02,
+  0x04, 0x01, 0x02, 0x02, 0x02, 0x04, 0x01, 0x02, 0x02, 0x02, 0x04, 0x01,
+  0x03, 0x01, 0x03, 0x00, 0x01, 0x03, 0x01, 0x02, 0x02, 0x03, 0x00, 0x03,
+  0x01, 0x01, 0x02, 0x01, 0x01, 0x02, 0x05, 0x01, 0x04, 0x01, 0x01, 0x04,
+  0x01, 0x02, 0x02, 0x03, 0x04, 0x02, 0x03, 0x01, 0x01, 0x02, 0x02, 0x02,
+  0x02, 0x03, 0x00, 0x02, 0x03, 0x01, 0x02, 0x01, 0x03, 0x00, 0x02, 0x03,
+  0x01, 0x01, 0x02, 0x03, 0x01, 0x01, 0x02, 0x02, 0x01, 0x01, 0x02, 0x01,
+  0x04, 0x01, 0x01, 0x00, 0x01, 0x06, 0x03, 0x02, 0x03, 0x04, 0x02, 0x01,
+  0x03, 0x02, 0x02, 0x01, 0x01, 0x03, 0x02, 0x03, 0x02, 0x01, 0x02, 0x01,
+  0x03, 0x02, 0x03, 0x01, 0x02, 0x02, 0x02, 0x02, 0x01, 0x02, 0x00, 0x02,
+  0x04, 0x03, 0x01, 0x02, 0x04, 0x02, 0x01, 0x02, 0x02, 0x02, 0x01, 0x01,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01,
+  0x03, 0x03, 0x02, 0x03, 0x00, 0x02, 0x01, 0x02, 0x02, 0x01, 0x03, 0x00,
+  0x01, 0x03, 0x02, 0x01, 0x01, 0x02, 0x00, 0x01, 0x04, 0x02, 0x02, 0x00,
+  0x01, 0x05, 0x01, 0x03, 0x00, 0x02, 0x03, 0x01, 0x01, 0x01, 0x02, 0x01,
+  0x04, 0x02, 0x02, 0x01, 0x00, 0x01, 0x01, 0x00, 0x01, 0x01, 0x00, 0x01,
+  0x01, 0x00, 0x01, 0x01, 0x00, 0x01, 0x01, 0x03, 0x02, 0x01, 0x02, 0x01,
+  0x01, 0x01, 0x02, 0x01, 0x01, 0x01, 0x01, 0x00, 0x02, 0x01, 0x00, 0x01,
+  0x01, 0x00, 0x01, 0x01, 0x00, 0x01, 0x01, 0x00, 0x01, 0x01, 0x00, 0x01,
+  0x01, 0x00, 0x01, 0x01, 0x00, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02,
+  0x01, 0x02, 0x01, 0x01, 0x03, 0x02, 0x01, 0x00, 0x02, 0x01, 0x02, 0x01,
+  0x01, 0x02, 0x02, 0x01, 0x03, 0x01, 0x01, 0x03, 0x02, 0x01, 0x04, 0x01,
+  0x01, 0x04, 0x01, 0x01, 0x04, 0x01, 0x01, 0x04, 0x01, 0x01, 0x04, 0x01,
+  0x01, 0x04, 0x01, 0x01, 0x03, 0x02, 0x01, 0x03, 0x01, 0x01, 0x02, 0x02,
+  0x01, 0x02, 0x01, 0x01, 0x00, 0x02, 0x01, 0x04, 0x01, 0x01, 0x04, 0x01,
+  0x01, 0x04, 0x01, 0x03, 0x00, 0x03, 0x01, 0x01, 0x01, 0x03, 0x01, 0x02,
+  0x05, 0x01, 0x03, 0x03, 0x02, 0x02, 0x02, 0x01, 0x02, 0x02, 0x02, 0x01,
+  0x03, 0x01, 0x02, 0x01, 0x02, 0x03, 0x02, 0x01, 0x04, 0x01, 0x01, 0x04,
+  0x01, 0x01, 0x04, 0x01, 0x01, 0x04, 0x01, 0x01, 0x00, 0x09, 0x01, 0x04,
+  0x01, 0x01, 0x04, 0x01, 0x01, 0x04, 0x01, 0x01, 0x04, 0x01, 0x01, 0x01,
+  0x02, 0x01, 0x00, 0x02, 0x01, 0x00, 0x02, 0x01, 0x00, 0x02, 0x01, 0x00,
+  0x01, 0x01, 0x00, 0x05, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x06,
+  0x01, 0x01, 0x05, 0x02, 0x01, 0x05, 0x01, 0x01, 0x05, 0x01, 0x01, 0x04,
+  0x01, 0x01, 0x04, 0x01, 0x01, 0x03, 0x02, 0x01, 0x03, 0x01, 0x01, 0x03,
+  0x01, 0x01, 0x02, 0x02, 0x01, 0x02, 0x01, 0x01, 0x01, 0x02, 0x01, 0x01,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x02, 0x01, 0x00, 0x01, 0x01, 0x02,
+  0x05, 0x02, 0x01, 0x02, 0x03, 0x02, 0x02, 0x01, 0x01, 0x05, 0x01, 0x02,
+  0x00, 0x02, 0x05, 0x02, 0x02, 0x00, 0x02, 0x05, 0x02, 0x03, 0x00, 0x02,
+  0x01, 0x03, 0x01, 0x02, 0x03, 0x00, 0x02, 0x01, 0x03, 0x01, 0x02, 0x02,
+  0x00, 0x02, 0x05, 0x02, 0x02, 0x00, 0x02, 0x05, 0x02, 0x02, 0x00, 0x02,
+  0x05, 0x02, 0x02, 0x01, 0x01, 0x05, 0x01, 0x02, 0x01, 0x02, 0x03, 0x02,
+  0x01, 0x02, 0x05, 0x01, 0x03, 0x03, 0x01, 0x02, 0x04, 0x02, 0x01, 0x02,
+  0x01, 0x02, 0x02, 0x00, 0x02, 0x02, 0x02, 0x01, 0x04, 0x02, 0x01, 0x04,
+  0x02, 0x01, 0x04, 0x02, 0x01, 0x04, 0x02, 0x01, 0x04, 0x02, 0x01, 0x04,
+  0x02, 0x01, 0x04, 0x02, 0x01, 0x04, 0x02, 0x01, 0x01, 0x08, 0x01, 0x02,
+  0x05, 0x02, 0x01, 0x02, 0x03, 0x02, 0x02, 0x00, 0x02, 0x05, 0x01, 0x01,
+  0x07, 0x01, 0x01, 0x07, 0x01, 0x01, 0x06, 0x02, 0x01, 0x06, 0x01, 0x01,
+  0x05, 0x01, 0x01, 0x04, 0x01, 0x01, 0x03, 0x01, 0x01, 0x02, 0x01, 0x01,
+  0x00, 0x02, 0x01, 0x00, 0x09, 0x01, 0x02, 0x05, 0x02, 0x01, 0x02, 0x03,
+  0x02, 0x02, 0x00, 0x02, 0x04, 0x02, 0x01, 0x07, 0x01, 0x01, 0x06, 0x02,
+  0x01, 0x06, 0x01, 0x01, 0x03, 0x03, 0x01, 0x06, 0x02, 0x01, 0x07, 0x01,
+  0x01, 0x07, 0x01, 0x02, 0x00, 0x01, 0x06, 0x01, 0x02, 0x00, 0x02, 0x04,
+  0x02, 0x01, 0x01, 0x05, 0x01, 0x05, 0x02, 0x01, 0x04, 0x03, 0x02, 0x04,
+  0x01, 0x01, 0x01, 0x02, 0x03, 0x01, 0x02, 0x01, 0x02, 0x02, 0x02, 0x02,
+  0x01, 0x02, 0x02, 0x01, 0x03, 0x01, 0x02, 0x01, 0x02, 0x03, 0x01, 0x02,
+  0x00, 0x02, 0x04, 0x01, 0x02, 0x00, 0x01, 0x05, 0x01, 0x01, 0x00, 0x09,
+  0x01, 0x06, 0x01, 0x01, 0x06, 0x01, 0x01, 0x06, 0x01, 0x01, 0x01, 0x07,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x02, 0x01, 0x01, 0x01, 0x04, 0x02, 0x01, 0x02, 0x03, 0x02, 0x01, 0x07,
+  0x01, 0x01, 0x07, 0x02, 0x01, 0x07, 0x02, 0x02, 0x01, 0x01, 0x05, 0x01,
+  0x02, 0x00, 0x03, 0x03, 0x02, 0x01, 0x02, 0x05, 0x01, 0x04, 0x03, 0x01,
+  0x03, 0x02, 0x01, 0x02, 0x02, 0x01, 0x02, 0x01, 0x01, 0x01, 0x02, 0x02,
+  0x01, 0x01, 0x01, 0x04, 0x02, 0x00, 0x03, 0x03, 0x02, 0x02, 0x00, 0x02,
+  0x05, 0x02, 0x02, 0x00, 0x02, 0x05, 0x02, 0x02, 0x00, 0x02, 0x05, 0x02,
+  0x02, 0x01, 0x01, 0x05, 0x01, 0x02, 0x01, 0x02, 0x03, 0x02, 0x01, 0x02,
+  0x05, 0x01, 0x00, 0x09, 0x02, 0x00, 0x02, 0x05, 0x02, 0x02, 0x00, 0x02,
+  0x05, 0x01, 0x01, 0x06, 0x02, 0x01, 0x06, 0x01, 0x01, 0x05, 0x02, 0x01,
+  0x05, 0x02, 0x01, 0x04, 0x02, 0x01, 0x04, 0x02, 0x01, 0x04, 0x01, 0x01,
+  0x03, 0x02, 0x01, 0x03, 0x01, 0x01, 0x02, 0x02, 0x01, 0x02, 0x05, 0x02,
+  0x01, 0x02, 0x03, 0x02, 0x02, 0x01, 0x01, 0x05, 0x01, 0x02, 0x00, 0x02,
+  0x05, 0x02, 0x02, 0x01, 0x01, 0x05, 0x01, 0x02, 0x01, 0x02, 0x03, 0x02,
+  0x01, 0x03, 0x03, 0x02, 0x01, 0x02, 0x03, 0x02, 0x02, 0x00, 0x02, 0x05,
+  0x02, 0x02, 0x00, 0x02, 0x05, 0x02, 0x02, 0x00, 0x02, 0x05, 0x02, 0x02,
+  0x01, 0x02, 0x03, 0x02, 0x01, 0x02, 0x05, 0x01, 0x02, 0x05, 0x02, 0x01,
+  0x02, 0x03, 0x02, 0x02, 0x01, 0x01, 0x05, 0x01, 0x02, 0x00, 0x02, 0x05,
+  0x02, 0x02, 0x00, 0x02, 0x05, 0x02, 0x02, 0x00, 0x02, 0x05, 0x02, 0x02,
+  0x01, 0x02, 0x03, 0x03, 0x02, 0x02, 0x04, 0x01, 0x01, 0x01, 0x06, 0x02,
+  0x01, 0x06, 0x01, 0x01, 0x05, 0x02, 0x01, 0x04, 0x02, 0x01, 0x02, 0x03,
+  0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+  0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x02, 0x01, 0x00, 0x02, 0x01, 0x00,
+  0x02, 0x01, 0x00, 0x02, 0x01, 0x00, 0x01, 0x01, 0x06, 0x01, 0x01, 0x05,
+  0x02, 0x01, 0x03, 0x02, 0x01, 0x01, 0x03, 0x01, 0x00, 0x02, 0x01, 0x00,
+  0x02, 0x01, 0x01, 0x03, 0x01, 0x03, 0x02, 0x01, 0x05, 0x02, 0x01, 0x06,
+  0x01, 0x01, 0x00, 0x09, 0x00, 0x00, 0x00, 0x01, 0x00, 0x09, 0x01, 0x00,
+  0x01, 0x01, 0x00, 0x02, 0x01, 0x02, 0x02, 0x01, 0x03, 0x03, 0x01, 0x05,
+  0x02, 0x01, 0x05, 0x02, 0x01, 0x03, 0x03, 0x01, 0x02, 0x02, 0x01, 0x00,
+  0x02, 0x01, 0x00, 0x01, 0x01, 0x02, 0x05, 0x02, 0x01, 0x02, 0x03, 0x02,
+  0x02, 0x01, 0x01, 0x05, 0x01, 0x02, 0x00, 0x01, 0x06, 0x01, 0x01, 0x06,
+  0x02, 0x01, 0x06, 0x02, 0x01, 0x03, 0x04, 0x01, 0x03, 0x02, 0x01, 0x03,
+  0x02, 0x00, 0x00, 0x01, 0x03, 0x02, 0x01, 0x03, 0x03, 0x01, 0x02, 0x05,
+  0x02, 0x01, 0x02, 0x03, 0x02, 0x02, 0x01, 0x01, 0x05, 0x01, 0x02, 0x01,
+  0x01, 0x05, 0x01, 0x02, 0x00, 0x02, 0x02, 0x05, 0x03, 0x00, 0x02, 0x01,
+  0x02, 0x02, 0x02, 0x03, 0x00, 0x02, 0x01, 0x01, 0x03, 0x02, 0x03, 0x00,
+  0x02, 0x01, 0x01, 0x03, 0x02, 0x03, 0x00, 0x02, 0x01, 0x01, 0x03, 0x02,
+  0x03, 0x00, 0x02, 0x01, 0x02, 0x02, 0x02, 0x02, 0x00, 0x02, 0x02, 0x05,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x01, 0x01, 0x03, 0x04,
+  0x01, 0x03, 0x03, 0x01, 0x03, 0x03, 0x02, 0x03, 0x01, 0x01, 0x01, 0x02,
+  0x02, 0x02, 0x01, 0x02, 0x02, 0x02, 0x02, 0x01, 0x02, 0x02, 0x02, 0x01,
+  0x03, 0x01, 0x02, 0x02, 0x01, 0x03, 0x01, 0x02, 0x01, 0x02, 0x03, 0x02,
+  0x01, 0x01, 0x07, 0x02, 0x01, 0x01, 0x05, 0x01, 0x02, 0x00, 0x02, 0x05,
+  0x02, 0x02, 0x00, 0x02, 0x05, 0x02, 0x02, 0x00, 0x01, 0x07, 0x01, 0x01,
+  0x00, 0x06, 0x02, 0x00, 0x01, 0x04, 0x02, 0x02, 0x00, 0x01, 0x05, 0x01,
+  0x02, 0x00, 0x01, 0x05, 0x01, 0x02, 0x00, 0x01, 0x05, 0x01, 0x02, 0x00,
+  0x01, 0x04, 0x02, 0x01, 0x00, 0x06, 0x02, 0x00, 0x01, 0x05, 0x01, 0x02,
+  0x00, 0x01, 0x05, 0x02, 0x02, 0x00, 0x01, 0x05, 0x02, 0x02, 0x00, 0x01,
+  0x05, 0x02, 0x02, 0x00, 0x01, 0x05, 0x01, 0x01, 0x00, 0x06, 0x01, 0x03,
+  0x04, 0x02, 0x02, 0x01, 0x03, 0x02, 0x02, 0x01, 0x02, 0x04, 0x02, 0x01,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x02, 0x01, 0x00, 0x02, 0x01,
+  0x00, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x01, 0x02, 0x04,
+  0x02, 0x02, 0x02, 0x01, 0x03, 0x02, 0x01, 0x03, 0x04, 0x01, 0x00, 0x06,
+  0x02, 0x00, 0x01, 0x04, 0x02, 0x02, 0x00, 0x01, 0x05, 0x01, 0x02, 0x00,
+  0x01, 0x05, 0x02, 0x02, 0x00, 0x01, 0x05, 0x02, 0x02, 0x00, 0x01, 0x05,
+  0x02, 0x02, 0x00, 0x01, 0x05, 0x02, 0x02, 0x00, 0x01, 0x05, 0x02, 0x02,
+  0x00, 0x01, 0x05, 0x02, 0x02, 0x00, 0x01, 0x05, 0x02, 0x02, 0x00, 0x01,
+  0x05, 0x01, 0x02, 0x00, 0x01, 0x04, 0x02, 0x01, 0x00, 0x06, 0x01, 0x00,
+  0x07, 0x01, 0x00, 0x01, 0x01, 0x00, 0x01, 0x01, 0x00, 0x01, 0x01, 0x00,
+  0x01, 0x01, 0x00, 0x01, 0x01, 0x00, 0x07, 0x01, 0x00, 0x01, 0x01, 0x00,
+  0x01, 0x01, 0x00, 0x01, 0x01, 0x00, 0x01, 0x01, 0x00, 0x01, 0x01, 0x00,
+  0x07, 0x01, 0x00, 0x08, 0x01, 0x00, 0x01, 0x01, 0x00, 0x01, 0x01, 0x00,
+  0x01, 0x01, 0x00, 0x01, 0x01, 0x00, 0x01, 0x01, 0x00, 0x07, 0x01, 0x00,
+  0x01, 0x01, 0x00, 0x01, 0x01, 0x00, 0x01, 0x01, 0x00, 0x01, 0x01, 0x00,
+  0x01, 0x01, 0x00, 0x01, 0x01, 0x02, 0x05, 0x02, 0x01, 0x02, 0x03, 0x02,
+  0x02, 0x01, 0x01, 0x05, 0x01, 0x01, 0x00, 0x02, 0x01, 0x00, 0x02, 0x01,
+  0x00, 0x02, 0x01, 0x00, 0x02, 0x02, 0x00, 0x02, 0x02, 0x04, 0x02, 0x00,
+  0x02, 0x05, 0x01, 0x02, 0x00, 0x02, 0x05, 0x01, 0x02, 0x01, 0x01, 0x05,
+  0x01, 0x02, 0x01, 0x02, 0x03, 0x02, 0x02, 0x02, 0x04, 0x01, 0x01, 0x02,
+  0x00, 0x02, 0x05, 0x01, 0x02, 0x00, 0x02, 0x05, 0x01, 0x02, 0x00, 0x02,
+  0x05, 0x01, 0x02, 0x00, 0x02, 0x05, 0x01, 0x02, 0x00, 0x02, 0x05, 0x01,
+  0x02, 0x00, 0x02, 0x05, 0x01, 0x01, 0x00, 0x08, 0x02, 0x00, 0x02, 0x05,
+  0x01, 0x02, 0x00, 0x02, 0x05, 0x01, 0x02, 0x00, 0x02, 0x05, 0x01, 0x02,
+  0x00, 0x02, 0x05, 0x01, 0x02, 0x00, 0x02, 0x05, 0x01, 0x02, 0x00, 0x02,
+  0x05, 0x01, 0x01, 0x00, 0x07, 0x01, 0x03, 0x01, 0x01, 0x03, 0x01, 0x01,
+  0x03, 0x01, 0x01, 0x03, 0x01, 0x01, 0x03, 0x01, 0x01, 0x03, 0x01, 0x01,
+  0x03, 0x01, 0x01, 0x03, 0x01, 0x01, 0x03, 0x01, 0x01, 0x03, 0x01, 0x01,
+  0x03, 0x01, 0x01, 0x00, 0x07, 0x01, 0x02, 0x06, 0x01, 0x06, 0x02, 0x01,
+  0x06, 0x02, 0x01, 0x06, 0x02, 0x01, 0x06, 0x02, 0x01, 0x06, 0x02, 0x01,
+  0x06, 0x02, 0x01, 0x06, 0x02, 0x01, 0x06, 0x02, 0x01, 0x06, 0x02, 0x02,
+  0x00, 0x02, 0x04, 0x02, 0x02, 0x01, 0x02, 0x03, 0x01, 0x01, 0x02, 0x04,
+  0x02, 0x00, 0x01, 0x05, 0x02, 0x02, 0x00, 0x01, 0x04, 0x02, 0x02, 0x00,
+  0x01, 0x04, 0x01, 0x02, 0x00, 0x01, 0x03, 0x02, 0x02, 0x00, 0x01, 0x02,
+  0x02, 0x02, 0x00, 0x01, 0x01, 0x02, 0x01, 0x00, 0x05, 0x02, 0x00, 0x02,
+  0x01, 0x02, 0x02, 0x00, 0x01, 0x03, 0x02, 0x02, 0x00, 0x01, 0x04, 0x01,
+  0x02, 0x00, 0x01, 0x04, 0x02, 0x02, 0x00, 0x01, 0x05, 0x02, 0x02, 0x00,
+  0x01, 0x05, 0x03, 0x01, 0x00, 0x02, 0x01, 0x00, 0x02, 0x01, 0x00, 0x02,
+  0x01, 0x00, 0x02, 0x01, 0x00, 0x02, 0x01, 0x00, 0x02, 0x01, 0x00, 0x02,
+  0x01, 0x00, 0x02, 0x01, 0x00, 0x02, 0x01, 0x00, 0x02, 0x01, 0x00, 0x02,
+  0x01, 0x00, 0x02, 0x01, 0x00, 0x08, 0x02, 0x00, 0x02, 0x05, 0x02, 0x02,
+  0x00, 0x03, 0x03, 0x03, 0x02, 0x00, 0x03, 0x03, 0x03, 0x02, 0x00, 0x04,
+  0x01, 0x04, 0x04, 0x00, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x04,
+  0x00, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x03, 0x00, 0x02, 0x02,
+  0x01, 0x02, 0x02, 0x03, 0x00, 0x02, 0x02, 0x01, 0x02, 0x02, 0x03, 0x00,
+  0x02, 0x02, 0x01, 0x02, 0x02, 0x02, 0x00, 0x02, 0x05, 0x02, 0x02, 0x00,
+  0x02, 0x05, 0x02, 0x02, 0x00, 0x02, 0x05, 0x02, 0x02, 0x00, 0x02, 0x05,
+  0x02, 0x02, 0x00, 0x02, 0x04, 0x02, 0x02, 0x00, 0x02, 0x04, 0x02, 0x02,
+  0x00, 0x03, 0x03, 0x02, 0x03, 0x00, 0x01, 0x01, 0x01, 0x03, 0x02, 0x03,
+  0x00, 0x01, 0x01, 0x01, 0x03, 0x02, 0x03, 0x00, 0x01, 0x01, 0x02, 0x02,
+  0x02, 0x03, 0x00, 0x01, 0x02, 0x01, 0x02, 0x02, 0x03, 0x00, 0x01, 0x02,
+  0x02, 0x01, 0x02, 0x03, 0x00, 0x01, 0x03, 0x01, 0x01, 0x02, 0x03, 0x00,
+  0x01, 0x03, 0x01, 0x01, 0x02, 0x02, 0x00, 0x01, 0x03, 0x04, 0x02, 0x00,
+  0x01, 0x04, 0x03, 0x02, 0x00, 0x01, 0x04, 0x03, 0x01, 0x02, 0x05, 0x02,
+  0x01, 0x02, 0x03, 0x02, 0x02, 0x01, 0x01, 0x05, 0x01, 0x02, 0x00, 0x02,
+  0x05, 0x02, 0x02, 0x00, 0x02, 0x05, 0x02, 0x02, 0x00, 0x02, 0x05, 0x02,
+  0x02, 0x00, 0x02, 0x05, 0x02, 0x02, 0x00, 0x02, 0x05, 0x02, 0x02, 0x00,
+  0x02, 0x05, 0x02, 0x02, 0x00, 0x02, 0x05, 0x02, 0x02, 0x01, 0x01, 0x05,
+  0x01, 0x02, 0x01, 0x02, 0x03, 0x02, 0x01, 0x02, 0x05, 0x01, 0x00, 0x06,
+  0x02, 0x00, 0x01, 0x05, 0x01, 0x02, 0x00, 0x01, 0x05, 0x02, 0x02, 0x00,
+  0x01, 0x05, 0x02, 0x02, 0x00, 0x01, 0x05, 0x02, 0x02, 0x00, 0x01, 0x05,
+  0x01, 0x01, 0x00, 0x06, 0x01, 0x00, 0x01, 0x01, 0x00, 0x01, 0x01, 0x00,
+  0x01, 0x01, 0x00, 0x01, 0x01, 0x00, 0x01, 0x01, 0x00, 0x01, 0x01, 0x02,
+  0x05, 0x02, 0x01, 0x02, 0x03, 0x02, 0x02, 0x01, 0x01, 0x05, 0x01, 0x02,
+  0x00, 0x02, 0x05, 0x02, 0x02, 0x00, 0x02, 0x05, 0x02, 0x02, 0x00, 0x02,
+  0x05, 0x02, 0x02, 0x00, 0x02, 0x05, 0x02, 0x02, 0x00, 0x02, 0x05, 0x02,
+  0x02, 0x00, 0x02, 0x05, 0x02, 0x02, 0x00, 0x02, 0x05, 0x02, 0x02, 0x01,
+  0x01, 0x05, 0x01, 0x02, 0x01, 0x02, 0x03, 0x02, 0x01, 0x02, 0x05, 0x01,
+  0x04, 0x01, 0x01, 0x04, 0x01, 0x01, 0x04, 0x04, 0x01, 0x00, 0x06, 0x02,
+  0x00, 0x01, 0x05, 0x01, 0x02, 0x00, 0x01, 0x05, 0x02, 0x02, 0x00, 0x01,
+  0x05, 0x02, 0x02, 0x00, 0x01, 0x05, 0x02, 0x02, 0x00, 0x01, 0x05, 0x01,
+  0x01, 0x00, 0x06, 0x02, 0x00, 0x01, 0x02, 0x02, 0x02, 0x00, 0x01, 0x03,
+  0x02, 0x02, 0x00, 0x01, 0x03, 0x02, 0x02, 0x00, 0x01, 0x04, 0x02, 0x02,
+  0x00, 0x01, 0x05, 0x01, 0x02, 0x00, 0x01, 0x05, 0x02, 0x01, 0x02, 0x05,
+  0x02, 0x01, 0x02, 0x04, 0x02, 0x02, 0x00, 0x02, 0x05, 0x01, 0x01, 0x00,
+  0x02, 0x01, 0x00, 0x02, 0x01, 0x01, 0x02, 0x01, 0x03, 0x04, 0x01, 0x06,
+  0x02, 0x01, 0x07, 0x02, 0x01, 0x07, 0x02, 0x02, 0x00, 0x01, 0x06, 0x02,
+  0x02, 0x00, 0x02, 0x04, 0x02, 0x01, 0x02, 0x05, 0x01, 0x00, 0x09, 0x01,
+  0x04, 0x01, 0x01, 0x04, 0x01, 0x01, 0x04, 0x01, 0x01, 0x04, 0x01, 0x01,
+  0x04, 0x01, 0x01, 0x04, 0x01, 0x01, 0x04, 0x01, 0x01, 0x04, 0x01, 0x01,
+  0x04, 0x01, 0x01, 0x04, 0x01, 0x01, 0x04, 0x01, 0x01, 0x04, 0x01, 0x02,
+  0x00, 0x01, 0x05, 0x01, 0x02, 0x00, 0x01, 0x05, 0x01, 0x02, 0x00, 0x01,
+  0x05, 0x01, 0x02, 0x00, 0x01, 0x05, 0x01, 0x02, 0x00, 0x01, 0x05, 0x01,
+  0x02, 0x00, 0x01, 0x05, 0x01, 0x02, 0x00, 0x01, 0x05, 0x01, 0x02, 0x00,
+  0x01, 0x05, 0x01, 0x02, 0x00, 0x01, 0x05, 0x01, 0x02, 0x00, 0x01, 0x05,
+  0x01, 0x02, 0x00, 0x01, 0x05, 0x01, 0x02, 0x00, 0x02, 0x03, 0x02, 0x01,
+  0x01, 0x05, 0x02, 0x00, 0x01, 0x07, 0x01, 0x02, 0x00, 0x02, 0x05, 0x02,
+  0x02, 0x00, 0x02, 0x05, 0x02, 0x02, 0x01, 0x01, 0x05, 0x01, 0x02, 0x01,
+  0x02, 0x03, 0x02, 0x02, 0x01, 0x02, 0x03, 0x02, 0x02, 0x02, 0x01, 0x03,
+  0x01, 0x02, 0x02, 0x01, 0x03, 0x01, 0x02, 0x02, 0x02, 0x01, 0x02, 0x02,
+  0x02, 0x02, 0x01, 0x02, 0x02, 0x03, 0x01, 0x01, 0x01, 0x01, 0x03, 0x03,
+  0x01, 0x03, 0x03, 0x02, 0x00, 0x01, 0x07, 0x01, 0x02, 0x00, 0x01, 0x07,
+  0x01, 0x02, 0x00, 0x01, 0x07, 0x01, 0x03, 0x00, 0x01, 0x03, 0x01, 0x03,
+  0x01, 0x03, 0x00, 0x01, 0x02, 0x03, 0x02, 0x01, 0x04, 0x00, 0x01, 0x02,
+  0x01, 0x01, 0x01, 0x02, 0x01, 0x04, 0x00, 0x02, 0x01, 0x01, 0x01, 0x01,
+  0x01, 0x02, 0x04, 0x00, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x04,
+  0x00, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x00, 0x04, 0x01,
+  0x04, 0x02, 0x01, 0x02, 0x03, 0x02, 0x02, 0x01, 0x02, 0x03, 0x02, 0x02,
+  0x01, 0x02, 0x03, 0x02, 0x02, 0x00, 0x02, 0x05, 0x02, 0x02, 0x01, 0x01,
+  0x05, 0x01, 0x02, 0x01, 0x02, 0x03, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01,
+  0x02, 0x03, 0x01, 0x01, 0x02, 0x01, 0x03, 0x03, 0x01, 0x04, 0x02, 0x01,
+  0x03, 0x03, 0x02, 0x02, 0x02, 0x01, 0x02, 0x02, 0x02, 0x01, 0x03, 0x01,
+  0x02, 0x01, 0x02, 0x03, 0x02, 0x02, 0x00, 0x02, 0x05, 0x02, 0x02, 0x00,
+  0x02, 0x05, 0x02, 0x02, 0x00, 0x02, 0x07, 0x02, 0x02, 0x01, 0x02, 0x05,
+  0x02, 0x02, 0x02, 0x02, 0x04, 0x01, 0x02, 0x02, 0x02, 0x03, 0x02, 0x02,
+  0x03, 0x02, 0x01, 0x02, 0x02, 0x04, 0x01, 0x01, 0x01, 0x01, 0x04, 0x03,
+  0x01, 0x05, 0x01, 0x01, 0x05, 0x01, 0x01, 0x05, 0x01, 0x01, 0x05, 0x01,
+  0x01, 0x05, 0x01, 0x01, 0x05, 0x01, 0x01, 0x00, 0x09, 0x01, 0x07, 0x01,
+  0x01, 0x06, 0x02, 0x01, 0x06, 0x01, 0x01, 0x05, 0x02, 0x01, 0x04, 0x02,
+  0x01, 0x04, 0x01, 0x01, 0x03, 0x02, 0x01, 0x02, 0x02, 0x01, 0x02, 0x01,
+  0x01, 0x01, 0x02, 0x01, 0x00, 0x02, 0x01, 0x00, 0x09, 0x01, 0x00, 0x05,
+  0x01, 0x00, 0x01, 0x01, 0x00, 0x01, 0x01, 0x00, 0x01, 0x01, 0x00, 0x01,
+  0x01, 0x00, 0x01, 0x01, 0x00, 0x01, 0x01, 0x00, 0x01, 0x01, 0x00, 0x01,
+  0x01, 0x00, 0x01, 0x01, 0x00, 0x01, 0x01, 0x00, 0x01, 0x01, 0x00, 0x01,
+  0x01, 0x00, 0x01, 0x01, 0x00, 0x01, 0x01, 0x00, 0x05, 0x01, 0x00, 0x01,
+  0x01, 0x00, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x01,
+  0x01, 0x02, 0x01, 0x01, 0x02, 0x02, 0x01, 0x03, 0x01, 0x01, 0x03, 0x01,
+  0x01, 0x03, 0x02, 0x01, 0x04, 0x01, 0x01, 0x04, 0x02, 0x01, 0x05, 0x01,
+  0x01, 0x05, 0x01, 0x01, 0x05, 0x02, 0x01, 0x06, 0x01, 0x01, 0x00, 0x05,
+  0x01, 0x04, 0x01, 0x01, 0x04, 0x01, 0x01, 0x04, 0x01, 0x01, 0x04, 0x01,
+  0x01, 0x04, 0x01, 0x01, 0x04, 0x01, 0x01, 0x04, 0x01, 0x01, 0x04, 0x01,
+  0x01, 0x04, 0x01, 0x01, 0x04, 0x01, 0x01, 0x04, 0x01, 0x01, 0x04, 0x01,
+  0x01, 0x04, 0x01, 0x01, 0x04, 0x01, 0x01, 0x00, 0x05, 0x01, 0x03, 0x03,
+  0x02, 0x03, 0x01, 0x01, 0x01, 0x02, 0x02, 0x02, 0x01, 0x02, 0x02, 0x02,
+  0x01, 0x03, 0x01, 0x02, 0x01, 0x02, 0x03, 0x02, 0x02, 0x01, 0x01, 0x05,
+  0x01, 0x02, 0x00, 0x02, 0x05, 0x02, 0x01, 0x00, 0x09, 0x01, 0x00, 0x02,
+  0x01, 0x01, 0x02, 0x01, 0x02, 0x01, 0x01, 0x02, 0x04, 0x02, 0x01, 0x01,
+  0x04, 0x01, 0x01, 0x06, 0x02, 0x01, 0x06, 0x02, 0x01, 0x01, 0x07, 0x02,
+  0x00, 0x02, 0x04, 0x02, 0x02, 0x00, 0x02, 0x04, 0x02, 0x02, 0x00, 0x02,
+  0x04, 0x02, 0x02, 0x01, 0x05, 0x01, 0x02, 0x01, 0x00, 0x01, 0x01, 0x00,
+  0x01, 0x01, 0x00, 0x01, 0x01, 0x00, 0x01, 0x02, 0x00, 0x01, 0x01, 0x04,
+  0x02, 0x00, 0x02, 0x03, 0x02, 0x02, 0x00, 0x01, 0x05, 0x02, 0x02, 0x00,
+  0x01, 0x05, 0x02, 0x02, 0x00, 0x01, 0x05, 0x02, 0x02, 0x00, 0x01, 0x05,
+  0x02, 0x02, 0x00, 0x01, 0x05, 0x02, 0x02, 0x00, 0x02, 0x03, 0x02, 0x02,
+  0x00, 0x01, 0x01, 0x04, 0x01, 0x02, 0x04, 0x02, 0x01, 0x01, 0x03, 0x02,
+  0x02, 0x00, 0x01, 0x04, 0x01, 0x01, 0x00, 0x01, 0x01, 0x00, 0x01, 0x01,
+  0x00, 0x01, 0x02, 0x00, 0x01, 0x05, 0x01, 0x02, 0x00, 0x02, 0x03, 0x02,
+  0x01, 0x02, 0x04, 0x01, 0x07, 0x01, 0x01, 0x07, 0x01, 0x01, 0x07, 0x01,
+  0x01, 0x07, 0x01, 0x02, 0x02, 0x04, 0x01, 0x01, 0x02, 0x01, 0x02, 0x03,
+  0x02, 0x02, 0x00, 0x02, 0x05, 0x01, 0x02, 0x00, 0x02, 0x05, 0x01, 0x02,
+  0x00, 0x02, 0x05, 0x01, 0x02, 0x00, 0x02, 0x05, 0x01, 0x02, 0x00, 0x02,
+  0x05, 0x01, 0x02, 0x01, 0x02, 0x03, 0x02, 0x02, 0x02, 0x04, 0x01, 0x01,
+  0x01, 0x02, 0x05, 0x02, 0x01, 0x02, 0x03, 0x02, 0x02, 0x01, 0x01, 0x05,
+  0x01, 0x02, 0x00, 0x02, 0x05, 0x02, 0x01, 0x00, 0x09, 0x01, 0x00, 0x02,
+  0x01, 0x01, 0x01, 0x02, 0x01, 0x02, 0x04, 0x01, 0x01, 0x02, 0x05, 0x01,
+  0x04, 0x05, 0x01, 0x04, 0x01, 0x01, 0x04, 0x01, 0x01, 0x04, 0x01, 0x01,
+  0x00, 0x09, 0x01, 0x04, 0x01, 0x01, 0x04, 0x01, 0x01, 0x04, 0x01, 0x01,
+  0x04, 0x01, 0x01, 0x04, 0x01, 0x01, 0x04, 0x01, 0x01, 0x04, 0x01, 0x01,
+  0x01, 0x07, 0x01, 0x06, 0x03, 0x01, 0x02, 0x05, 0x02, 0x01, 0x02, 0x03,
+  0x02, 0x02, 0x01, 0x01, 0x05, 0x01, 0x02, 0x01, 0x01, 0x05, 0x01, 0x02,
+  0x01, 0x02, 0x03, 0x02, 0x01, 0x02, 0x05, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x01, 0x01, 0x01, 0x07, 0x02, 0x01, 0x01, 0x06, 0x01, 0x02, 0x00, 0x02,
+  0x06, 0x01, 0x02, 0x00, 0x02, 0x05, 0x02, 0x01, 0x01, 0x07, 0x01, 0x00,
+  0x01, 0x01, 0x00, 0x01, 0x01, 0x00, 0x01, 0x01, 0x00, 0x01, 0x02, 0x00,
+  0x01, 0x01, 0x04, 0x02, 0x00, 0x02, 0x03, 0x02, 0x02, 0x00, 0x01, 0x05,
+  0x01, 0x02, 0x00, 0x01, 0x05, 0x01, 0x02, 0x00, 0x01, 0x05, 0x01, 0x02,
+  0x00, 0x01, 0x05, 0x01, 0x02, 0x00, 0x01, 0x05, 0x01, 0x02, 0x00, 0x01,
+  0x05, 0x01, 0x02, 0x00, 0x01, 0x05, 0x01, 0x01, 0x03, 0x02, 0x01, 0x03,
+  0x02, 0x00, 0x00, 0x01, 0x00, 0x05, 0x01, 0x03, 0x02, 0x01, 0x03, 0x02,
+  0x01, 0x03, 0x02, 0x01, 0x03, 0x02, 0x01, 0x03, 0x02, 0x01, 0x03, 0x02,
+  0x01, 0x03, 0x02, 0x01, 0x00, 0x08, 0x01, 0x04, 0x02, 0x01, 0x04, 0x02,
+  0x00, 0x00, 0x01, 0x00, 0x06, 0x01, 0x04, 0x02, 0x01, 0x04, 0x02, 0x01,
+  0x04, 0x02, 0x01, 0x04, 0x02, 0x01, 0x04, 0x02, 0x01, 0x04, 0x02, 0x01,
+  0x04, 0x02, 0x01, 0x04, 0x02, 0x01, 0x04, 0x02, 0x01, 0x04, 0x02, 0x01,
+  0x04, 0x02, 0x01, 0x00, 0x05, 0x01, 0x00, 0x01, 0x01, 0x00, 0x01, 0x01,
+  0x00, 0x01, 0x01, 0x00, 0x01, 0x02, 0x00, 0x01, 0x05, 0x02, 0x02, 0x00,
+  0x01, 0x04, 0x01, 0x02, 0x00, 0x01, 0x02, 0x02, 0x02, 0x00, 0x01, 0x01,
+  0x02, 0x01, 0x00, 0x05, 0x02, 0x00, 0x02, 0x02, 0x02, 0x02, 0x00, 0x01,
+  0x04, 0x01, 0x02, 0x00, 0x01, 0x04, 0x02, 0x02, 0x00, 0x01, 0x05, 0x02,
+  0x01, 0x00, 0x04, 0x01, 0x03, 0x01, 0x01, 0x03, 0x01, 0x01, 0x03, 0x01,
+  0x01, 0x03, 0x01, 0x01, 0x03, 0x01, 0x01, 0x03, 0x01, 0x01, 0x03, 0x01,
+  0x01, 0x03, 0x01, 0x01, 0x03, 0x01, 0x01, 0x03, 0x01, 0x01, 0x03, 0x01,
+  0x01, 0x00, 0x07, 0x03, 0x00, 0x01, 0x01, 0x02, 0x02, 0x02, 0x03, 0x00,
+  0x02, 0x02, 0x02, 0x01, 0x02, 0x03, 0x00, 0x01, 0x03, 0x01, 0x03, 0x01,
+  0x03, 0x00, 0x01, 0x03, 0x01, 0x03, 0x01, 0x03, 0x00, 0x01, 0x03, 0x01,
+  0x03, 0x01, 0x03, 0x00, 0x01, 0x03, 0x01, 0x03, 0x01, 0x03, 0x00, 0x01,
+  0x03, 0x01, 0x03, 0x01, 0x03, 0x00, 0x01, 0x03, 0x01, 0x03, 0x01, 0x03,
+  0x00, 0x01, 0x03, 0x01, 0x03, 0x01, 0x02, 0x00, 0x01, 0x01, 0x04, 0x02,
+  0x00, 0x02, 0x03, 0x02, 0x02, 0x00, 0x01, 0x05, 0x01, 0x02, 0x00, 0x01,
+  0x05, 0x01, 0x02, 0x00, 0x01, 0x05, 0x01, 0x02, 0x00, 0x01, 0x05, 0x01,
+  0x02, 0x00, 0x01, 0x05, 0x01, 0x02, 0x00, 0x01, 0x05, 0x01, 0x02, 0x00,
+  0x01, 0x05, 0x01, 0x01, 0x02, 0x05, 0x02, 0x01, 0x02, 0x03, 0x02, 0x02,
+  0x01, 0x01, 0x05, 0x01, 0x02, 0x00, 0x02, 0x05, 0x02, 0x02, 0x00, 0x02,
+  0x05, 0x02, 0x02, 0x00, 0x02, 0x05, 0x02, 0x02, 0x01, 0x01, 0x05, 0x01,
+  0x02, 0x01, 0x02, 0x03, 0x02, 0x01, 0x02, 0x05, 0x02, 0x00, 0x01, 0x01,
+  0x04, 0x02, 0x00, 0x02, 0x03, 0x02, 0x02, 0x00, 0x01, 0x05, 0x02, 0x02,
+  0x00, 0x01, 0x05, 0x02, 0x02, 0x00, 0x01, 0x05, 0x02, 0x02, 0x00, 0x01,
+  0x05, 0x02, 0x02, 0x00, 0x01, 0x05, 0x02, 0x02, 0x00, 0x02, 0x03, 0x02,
+  0x02, 0x00, 0x01, 0x01, 0x04, 0x01, 0x00, 0x01, 0x01, 0x00, 0x01, 0x01,
+  0x00, 0x01, 0x01, 0x00, 0x01, 0x02, 0x02, 0x04, 0x01, 0x01, 0x02, 0x01,
+  0x02, 0x03, 0x02, 0x02, 0x00, 0x02, 0x05, 0x01, 0x02, 0x00, 0x02, 0x05,
+  0x01, 0x02, 0x00, 0x02, 0x05, 0x01, 0x02, 0x00, 0x02, 0x05, 0x01, 0x02,
+  0x00, 0x02, 0x05, 0x01, 0x02, 0x01, 0x02, 0x03, 0x02, 0x02, 0x02, 0x04,
+  0x01, 0x01, 0x01, 0x07, 0x01, 0x01, 0x07, 0x01, 0x01, 0x07, 0x01, 0x01,
+  0x07, 0x01, 0x02, 0x00, 0x05, 0x01, 0x03, 0x01, 0x03, 0x03, 0x01, 0x03,
+  0x02, 0x01, 0x03, 0x02, 0x01, 0x03, 0x02, 0x01, 0x03, 0x02, 0x01, 0x03,
+  0x02, 0x01, 0x03, 0x02, 0x01, 0x00, 0x08, 0x01, 0x02, 0x05, 0x02, 0x01,
+  0x02, 0x04, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x01, 0x02, 0x05,
+  0x01, 0x07, 0x01, 0x01, 0x07, 0x02, 0x02, 0x00, 0x02, 0x05, 0x01, 0x01,
+  0x02, 0x05, 0x01, 0x03, 0x01, 0x01, 0x03, 0x01, 0x01, 0x03, 0x01, 0x01,
+  0x03, 0x01, 0x01, 0x00, 0x09, 0x01, 0x03, 0x01, 0x01, 0x03, 0x01, 0x01,
+  0x03, 0x01, 0x01, 0x03, 0x01, 0x01, 0x03, 0x01, 0x01, 0x03, 0x01, 0x01,
+  0x03, 0x01, 0x01, 0x03, 0x06, 0x02, 0x00, 0x01, 0x05, 0x01, 0x02, 0x00,
+  0x01, 0x05, 0x01, 0x02, 0x00, 0x01, 0x05, 0x01, 0x02, 0x00, 0x01, 0x05,
+  0x01, 0x02, 0x00, 0x01, 0x05, 0x01, 0x02, 0x00, 0x01, 0x05, 0x01, 0x02,
+  0x00, 0x01, 0x05, 0x01, 0x02, 0x00, 0x02, 0x03, 0x02, 0x02, 0x01, 0x04,
+  0x01, 0x01, 0x02, 0x00, 0x02, 0x05, 0x02, 0x02, 0x01, 0x01, 0x05, 0x01,
+  0x02, 0x01, 0x02, 0x03, 0x02, 0x02, 0x02, 0x01, 0x03, 0x01, 0x02, 0x02,
+  0x01, 0x03, 0x01, 0x02, 0x02, 0x02, 0x01, 0x02, 0x02, 0x03, 0x01, 0x01,
+  0x01, 0x02, 0x03, 0x01, 0x01, 0x01, 0x01, 0x03, 0x03, 0x03, 0x00, 0x01,
+  0x03, 0x01, 0x03, 0x01, 0x03, 0x00, 0x01, 0x02, 0x03, 0x02, 0x01, 0x04,
+  0x00, 0x01, 0x02, 0x01, 0x01, 0x01, 0x02, 0x01, 0x04, 0x00, 0x01, 0x02,
+  0x01, 0x01, 0x01, 0x02, 0x01, 0x04, 0x00, 0x02, 0x01, 0x01, 0x01, 0x01,
+  0x02, 0x01, 0x04, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02,
+  0x01, 0x02, 0x03, 0x02, 0x02, 0x01, 0x02, 0x03, 0x02, 0x02, 0x01, 0x02,
+  0x03, 0x02, 0x02, 0x00, 0x02, 0x05, 0x02, 0x02, 0x01, 0x02, 0x03, 0x02,
+  0x02, 0x02, 0x02, 0x01, 0x02, 0x01, 0x03, 0x03, 0x01, 0x04, 0x01, 0x02,
+  0x03, 0x01, 0x01, 0x01, 0x02, 0x02, 0x02, 0x01, 0x02, 0x02, 0x01, 0x02,
+  0x03, 0x02, 0x02, 0x00, 0x02, 0x05, 0x02, 0x02, 0x00, 0x02, 0x05, 0x02,
+  0x02, 0x01, 0x01, 0x05, 0x01, 0x02, 0x01, 0x02, 0x04, 0x01, 0x02, 0x01,
+  0x02, 0x03, 0x02, 0x02, 0x02, 0x01, 0x03, 0x01, 0x02, 0x02, 0x02, 0x01,
+  0x02, 0x02, 0x03, 0x01, 0x01, 0x01, 0x01, 0x03, 0x03, 0x01, 0x04, 0x02,
+  0x01, 0x04, 0x01, 0x01, 0x03, 0x02, 0x01, 0x03, 0x01, 0x01, 0x01, 0x03,
+  0x01, 0x00, 0x07, 0x01, 0x05, 0x02, 0x01, 0x04, 0x02, 0x01, 0x03, 0x02,
+  0x01, 0x03, 0x01, 0x01, 0x02, 0x01, 0x01, 0x01, 0x02, 0x01, 0x00, 0x02,
+  0x01, 0x00, 0x07, 0x01, 0x03, 0x04, 0x01, 0x02, 0x02, 0x01, 0x02, 0x02,
+  0x01, 0x03, 0x01, 0x01, 0x03, 0x02, 0x01, 0x04, 0x01, 0x01, 0x04, 0x01,
+  0x01, 0x00, 0x04, 0x01, 0x03, 0x02, 0x01, 0x04, 0x01, 0x01, 0x03, 0x02,
+  0x01, 0x03, 0x01, 0x01, 0x02, 0x02, 0x01, 0x02, 0x02, 0x01, 0x02, 0x02,
+  0x01, 0x03, 0x04, 0x01, 0x00, 0x01, 0x01, 0x00, 0x01, 0x01, 0x00, 0x01,
+  0x01, 0x00, 0x01, 0x01, 0x00, 0x01, 0x01, 0x00, 0x01, 0x01, 0x00, 0x01,
+  0x01, 0x00, 0x01, 0x01, 0x00, 0x01, 0x01, 0x00, 0x01, 0x01, 0x00, 0x01,
+  0x01, 0x00, 0x01, 0x01, 0x00, 0x01, 0x01, 0x00, 0x01, 0x01, 0x00, 0x01,
+  0x01, 0x00, 0x01, 0x01, 0x00, 0x04, 0x01, 0x03, 0x02, 0x01, 0x03, 0x02,
+  0x01, 0x03, 0x01, 0x01, 0x02, 0x02, 0x01, 0x02, 0x01, 0x01, 0x02, 0x01,
+  0x01, 0x03, 0x04, 0x01, 0x02, 0x02, 0x01, 0x02, 0x01, 0x01, 0x02, 0x02,
+  0x01, 0x03, 0x01, 0x01, 0x03, 0x02, 0x01, 0x03, 0x02, 0x01, 0x03, 0x02,
+  0x01, 0x00, 0x04, 0x02, 0x01, 0x04, 0x03, 0x01, 0x02, 0x00, 0x01, 0x03,
+  0x04, 0x01, 0x00, 0x09, 0x02, 0x00, 0x01, 0x07, 0x01, 0x02, 0x00, 0x01,
+  0x07, 0x01, 0x02, 0x00, 0x01, 0x07, 0x01, 0x02, 0x00, 0x01, 0x07, 0x01,
+  0x02, 0x00, 0x01, 0x07, 0x01, 0x02, 0x00, 0x01, 0x07, 0x01, 0x02, 0x00,
+  0x01, 0x07, 0x01, 0x02, 0x00, 0x01, 0x07, 0x01, 0x02, 0x00, 0x01, 0x07,
+  0x01, 0x02, 0x00, 0x01, 0x07, 0x01, 0x02, 0x00, 0x01, 0x07, 0x01, 0x02,
+  0x00, 0x01, 0x07, 0x01, 0x01, 0x00, 0x09, 0x01, 0x00, 0x09, 0x02, 0x00,
+  0x01, 0x07, 0x01, 0x02, 0x00, 0x01, 0x07, 0x01, 0x02, 0x00, 0x01, 0x07,
+  0x01, 0x02, 0x00, 0x01, 0x07, 0x01, 0x02, 0x00, 0x01, 0x07, 0x01, 0x02,
+  0x00, 0x01, 0x07, 0x01, 0x02, 0x00, 0x01, 0x07, 0x01, 0x02, 0x00, 0x01,
+  0x07, 0x01, 0x02, 0x00, 0x01, 0x07, 0x01, 0x02, 0x00, 0x01, 0x07, 0x01,
+  0x02, 0x00, 0x01, 0x07, 0x01, 0x02, 0x00, 0x01, 0x07, 0x01, 0x01, 0x00,
+  0x09, 0x01, 0x00, 0x09, 0x02, 0x00, 0x01, 0x07, 0x01, 0x02, 0x00, 0x01,
+  0x07, 0x01, 0x02, 0x00, 0x01, 0x07, 0x01, 0x02, 0x00, 0x01, 0x07, 0x01,
+  0x02, 0x00, 0x01, 0x07, 0x01, 0x02, 0x00, 0x01, 0x07, 0x01, 0x02, 0x00,
+  0x01, 0x07, 0x01, 0x02, 0x00, 0x01, 0x07, 0x01, 0x02, 0x00, 0x01, 0x07,
+  0x01, 0x02, 0x00, 0x01, 0x07, 0x01, 0x02, 0x00, 0x01, 0x07, 0x01, 0x02,
+  0x00, 0x01, 0x07, 0x01, 0x01, 0x00, 0x09, 0x01, 0x00, 0x09, 0x02, 0x00,
+  0x01, 0x07, 0x01, 0x02, 0x00, 0x01, 0x07, 0x01, 0x02, 0x00, 0x01, 0x07,
+  0x01, 0x02, 0x00, 0x01, 0x07, 0x01, 0x02, 0x00, 0x01, 0x07, 0x01, 0x02,
+  0x00, 0x01, 0x07, 0x01, 0x02, 0x00, 0x01, 0x07, 0x01, 0x02, 0x00, 0x01,
+  0x07, 0x01, 0x02, 0x00, 0x01, 0x07, 0x01, 0x02, 0x00, 0x01, 0x07, 0x01,
+  0x02, 0x00, 0x01, 0x07, 0x01, 0x02, 0x00, 0x01, 0x07, 0x01, 0x01, 0x00,
+  0x09, 0x01, 0x00, 0x09, 0x02, 0x00, 0x01, 0x07, 0x01, 0x02, 0x00, 0x01,
+  0x07, 0x01, 0x02, 0x00, 0x01, 0x07, 0x01, 0x02, 0x00, 0x01, 0x07, 0x01,
+  0x02, 0x00, 0x01, 0x07, 0x01, 0x02, 0x00, 0x01, 0x07, 0x01, 0x02, 0x00,
+  0x01, 0x07, 0x01, 0x02, 0x00, 0x01, 0x07, 0x01, 0x02, 0x00, 0x01, 0x07,
+  0x01, 0x02, 0x00, 0x01, 0x07, 0x01, 0x02, 0x00, 0x01, 0x07, 0x01, 0x02,
+  0x00, 0x01, 0x07, 0x01, 0x01, 0x00, 0x09, 0x01, 0x00, 0x09, 0x02, 0x00,
+  0x01, 0x07, 0x01, 0x02, 0x00, 0x01, 0x07, 0x01, 0x02, 0x00, 0x01, 0x07,
+  0x01, 0x02, 0x00, 0x01, 0x07, 0x01, 0x02, 0x00, 0x01, 0x07, 0x01, 0x02,
+  0x00, 0x01, 0x07, 0x01, 0x02, 0x00, 0x01, 0x07, 0x01, 0x02, 0x00, 0x01,
+  0x07, 0x01, 0x02, 0x00, 0x01, 0x07, 0x01, 0x02, 0x00, 0x01, 0x07, 0x01,
+  0x02, 0x00, 0x01, 0x07, 0x01, 0x02, 0x00, 0x01, 0x07, 0x01, 0x01, 0x00,
+  0x09, 0x01, 0x00, 0x09, 0x02, 0x00, 0x01, 0x07, 0x01, 0x02, 0x00, 0x01,
+  0x07, 0x01, 0x02, 0x00, 0x01, 0x07, 0x01, 0x02, 0x00, 0x01, 0x07, 0x01,
+  0x02, 0x00, 0x01, 0x07, 0x01, 0x02, 0x00, 0x01, 0x07, 0x01, 0x02, 0x00,
+  0x01, 0x07, 0x01, 0x02, 0x00, 0x01, 0x07, 0x01, 0x02, 0x00, 0x01, 0x07,
+  0x01, 0x02, 0x00, 0x01, 0x07, 0x01, 0x02, 0x00, 0x01, 0x07, 0x01, 0x02,
+  0x00, 0x01, 0x07, 0x01, 0x01, 0x00, 0x09, 0x01, 0x00, 0x09, 0x02, 0x00,
+  0x01, 0x07, 0x01, 0x02, 0x00, 0x01, 0x07, 0x01, 0x02, 0x00, 0x01, 0x07,
+  0x01, 0x02, 0x00, 0x01, 0x07, 0x01, 0x02, 0x00, 0x01, 0x07, 0x01, 0x02,
+  0x00, 0x01, 0x07, 0x01, 0x02, 0x00, 0x01, 0x07, 0x01, 0x02, 0x00, 0x01,
+  0x07, 0x01, 0x02, 0x00, 0x01, 0x07, 0x01, 0x02, 0x00, 0x01, 0x07, 0x01,
+  0x02, 0x00, 0x01, 0x07, 0x01, 0x02, 0x00, 0x01, 0x07, 0x01, 0x01, 0x00,
+  0x09, 0x01, 0x00, 0x09, 0x02, 0x00, 0x01, 0x07, 0x01, 0x02, 0x00, 0x01,
+  0x07, 0x01, 0x02, 0x00, 0x01, 0x07, 0x01, 0x02, 0x00, 0x01, 0x07, 0x01,
+  0x02, 0x00, 0x01, 0x07, 0x01, 0x02, 0x00, 0x01, 0x07, 0x01, 0x02, 0x00,
+  0x01, 0x07, 0x01, 0x02, 0x00, 0x01, 0x07, 0x01, 0x02, 0x00, 0x01, 0x07,
+  0x01, 0x02, 0x00, 0x01, 0x07, 0x01, 0x02, 0x00, 0x01, 0x07, 0x01, 0x02,
+  0x00, 0x01, 0x07, 0x01, 0x01, 0x00, 0x09, 0x01, 0x00, 0x09, 0x02, 0x00,
+  0x01, 0x07, 0x01, 0x02, 0x00, 0x01, 0x07, 0x01, 0x02, 0x00, 0x01, 0x07,
+  0x01, 0x02, 0x00, 0x01, 0x07, 0x01, 0x02, 0x00, 0x01, 0x07, 0x01, 0x02,
+  0x00, 0x01, 0x07, 0x01, 0x02, 0x00, 0x01, 0x07, 0x01, 0x02, 0x00, 0x01,
+  0x07, 0x01, 0x02, 0x00, 0x01, 0x07, 0x01, 0x02, 0x00, 0x01, 0x07, 0x01,
+  0x02, 0x00, 0x01, 0x07, 0x01, 0x02, 0x00, 0x01, 0x07, 0x01, 0x01, 0x00,
+  0x09, 0x01, 0x00, 0x09, 0x02, 0x00, 0x01, 0x07, 0x01, 0x02, 0x00, 0x01,
+  0x07, 0x01, 0x02, 0x00, 0x01, 0x07, 0x01, 0x02, 0x00, 0x01, 0x07, 0x01,
+  0x02, 0x00, 0x01, 0x07, 0x01, 0x02, 0x00, 0x01, 0x07, 0x01, 0x02, 0x00,
+  0x01, 0x07, 0x01, 0x02, 0x00, 0x01, 0x07, 0x01, 0x02, 0x00, 0x01, 0x07,
+  0x01, 0x02, 0x00, 0x01, 0x07, 0x01, 0x02, 0x00, 0x01, 0x07, 0x01, 0x02,
+  0x00, 0x01, 0x07, 0x01, 0x01, 0x00, 0x09, 0x01, 0x00, 0x09, 0x02, 0x00,
+  0x01, 0x07, 0x01, 0x02, 0x00, 0x01, 0x07, 0x01, 0x02, 0x00, 0x01, 0x07,
+  0x01, 0x02, 0x00, 0x01, 0x07, 0x01, 0x02, 0x00, 0x01, 0x07, 0x01, 0x02,
+  0x00, 0x01, 0x07, 0x01, 0x02, 0x00, 0x01, 0x07, 0x01, 0x02, 0x00, 0x01,
+  0x07, 0x01, 0x02, 0x00, 0x01, 0x07, 0x01, 0x02, 0x00, 0x01, 0x07, 0x01,
+  0x02, 0x00, 0x01, 0x07, 0x01, 0x02, 0x00, 0x01, 0x07, 0x01, 0x01, 0x00,
+  0x09, 0x01, 0x00, 0x09, 0x02, 0x00, 0x01, 0x07, 0x01, 0x02, 0x00, 0x01,
+  0x07, 0x01, 0x02, 0x00, 0x01, 0x07, 0x01, 0x02, 0x00, 0x01, 0x07, 0x01,
+  0x02, 0x00, 0x01, 0x07, 0x01, 0x02, 0x00, 0x01, 0x07, 0x01, 0x02, 0x00,
+  0x01, 0x07, 0x01, 0x02, 0x00, 0x01, 0x07, 0x01, 0x02, 0x00, 0x01, 0x07,
+  0x01, 0x02, 0x00, 0x01, 0x07, 0x01, 0x02, 0x00, 0x01, 0x07, 0x01, 0x02,
+  0x00, 0x01, 0x07, 0x01, 0x01, 0x00, 0x09, 0x01, 0x00, 0x09, 0x02, 0x00,
+  0x01, 0x07, 0x01, 0x02, 0x00, 0x01, 0x07, 0x01, 0x02, 0x00, 0x01, 0x07,
+  0x01, 0x02, 0x00, 0x01, 0x07, 0x01, 0x02, 0x00, 0x01, 0x07, 0x01, 0x02,
+  0x00, 0x01, 0x07, 0x01, 0x02, 0x00, 0x01, 0x07, 0x01, 0x02, 0x00, 0x01,
+  0x07, 0x01, 0x02, 0x00, 0x01, 0x07, 0x01, 0x02, 0x00, 0x01, 0x07, 0x01,
+  0x02, 0x00, 0x01, 0x07, 0x01, 0x02, 0x00, 0x01, 0x07, 0x01, 0x01, 0x00,
+  0x09, 0x01, 0x00, 0x09, 0x02, 0x00, 0x01, 0x07, 0x01, 0x02, 0x00, 0x01,
+  0x07, 0x01, 0x02, 0x00, 0x01, 0x07, 0x01, 0x02, 0x00, 0x01, 0x07, 0x01,
+  0x02, 0x00, 0x01, 0x07, 0x01, 0x02, 0x00, 0x01, 0x07, 0x01, 0x02, 0x00,
+  0x01, 0x07, 0x01, 0x02, 0x00, 0x01, 0x07, 0x01, 0x02, 0x00, 0x01, 0x07,
+  0x01, 0x02, 0x00, 0x01, 0x07, 0x01, 0x02, 0x00, 0x01, 0x07, 0x01, 0x02,
+  0x00, 0x01, 0x07, 0x01, 0x01, 0x00, 0x09, 0x01, 0x00, 0x09, 0x02, 0x00,
+  0x01, 0x07, 0x01, 0x02, 0x00, 0x01, 0x07, 0x01, 0x02, 0x00, 0x01, 0x07,
+  0x01, 0x02, 0x00, 0x01, 0x07, 0x01, 0x02, 0x00, 0x01, 0x07, 0x01, 0x02,
+  0x00, 0x01, 0x07, 0x01, 0x02, 0x00, 0x01, 0x07, 0x01, 0x02, 0x00, 0x01,
+  0x07, 0x01, 0x02, 0x00, 0x01, 0x07, 0x01, 0x02, 0x00, 0x01, 0x07, 0x01,
+  0x02, 0x00, 0x01, 0x07, 0x01, 0x02, 0x00, 0x01, 0x07, 0x01, 0x01, 0x00,
+  0x09, 0x01, 0x00, 0x09, 0x02, 0x00, 0x01, 0x07, 0x01, 0x02, 0x00, 0x01,
+  0x07, 0x01, 0x02, 0x00, 0x01, 0x07, 0x01, 0x02, 0x00, 0x01, 0x07, 0x01,
+  0x02, 0x00, 0x01, 0x07, 0x01, 0x02, 0x00, 0x01, 0x07, 0x01, 0x02, 0x00,
+  0x01, 0x07, 0x01, 0x02, 0x00, 0x01, 0x07, 0x01, 0x02, 0x00, 0x01, 0x07,
+  0x01, 0x02, 0x00, 0x01, 0x07, 0x01, 0x02, 0x00, 0x01, 0x07, 0x01, 0x02,
+  0x00, 0x01, 0x07, 0x01, 0x01, 0x00, 0x09, 0x01, 0x00, 0x09, 0x02, 0x00,
+  0x01, 0x07, 0x01, 0x02, 0x00, 0x01, 0x07, 0x01, 0x02, 0x00, 0x01, 0x07,
+  0x01, 0x02, 0x00, 0x01, 0x07, 0x01, 0x02, 0x00, 0x01, 0x07, 0x01, 0x02,
+  0x00, 0x01, 0x07, 0x01, 0x02, 0x00, 0x01, 0x07, 0x01, 0x02, 0x00, 0x01,
+  0x07, 0x01, 0x02, 0x00, 0x01, 0x07, 0x01, 0x02, 0x00, 0x01, 0x07, 0x01,
+  0x02, 0x00, 0x01, 0x07, 0x01, 0x02, 0x00, 0x01, 0x07, 0x01, 0x01, 0x00,
+  0x09, 0x01, 0x00, 0x09, 0x02, 0x00, 0x01, 0x07, 0x01, 0x02, 0x00, 0x01,
+  0x07, 0x01, 0x02, 0x00, 0x01, 0x07, 0x01, 0x02, 0x00, 0x01, 0x07, 0x01,
+  0x02, 0x00, 0x01, 0x07, 0x01, 0x02, 0x00, 0x01, 0x07, 0x01, 0x02, 0x00,
+  0x01, 0x07, 0x01, 0x02, 0x00, 0x01, 0x07, 0x01, 0x02, 0x00, 0x01, 0x07,
+  0x01, 0x02, 0x00, 0x01, 0x07, 0x01, 0x02, 0x00, 0x01, 0x07, 0x01, 0x02,
+  0x00, 0x01, 0x07, 0x01, 0x01, 0x00, 0x09, 0x01, 0x00, 0x09, 0x02, 0x00,
+  0x01, 0x07, 0x01, 0x02, 0x00, 0x01, 0x07, 0x01, 0x02, 0x00, 0x01, 0x07,
+  0x01, 0x02, 0x00, 0x01, 0x07, 0x01, 0x02, 0x00, 0x01, 0x07, 0x01, 0x02,
+  0x00, 0x01, 0x07, 0x01, 0x02, 0x00, 0x01, 0x07, 0x01, 0x02, 0x00, 0x01,
+  0x07, 0x01, 0x02, 0x00, 0x01, 0x07, 0x01, 0x02, 0x00, 0x01, 0x07, 0x01,
+  0x02, 0x00, 0x01, 0x07, 0x01, 0x02, 0x00, 0x01, 0x07, 0x01, 0x01, 0x00,
+  0x09, 0x01, 0x00, 0x09, 0x02, 0x00, 0x01, 0x07, 0x01, 0x02, 0x00, 0x01,
+  0x07, 0x01, 0x02, 0x00, 0x01, 0x07, 0x01, 0x02, 0x00, 0x01, 0x07, 0x01,
+  0x02, 0x00, 0x01, 0x07, 0x01, 0x02, 0x00, 0x01, 0x07, 0x01, 0x02, 0x00,
+  0x01, 0x07, 0x01, 0x02, 0x00, 0x01, 0x07, 0x01, 0x02, 0x00, 0x01, 0x07,
+  0x01, 0x02, 0x00, 0x01, 0x07, 0x01, 0x02, 0x00, 0x01, 0x07, 0x01, 0x02,
+  0x00, 0x01, 0x07, 0x01, 0x01, 0x00, 0x09, 0x01, 0x00, 0x09, 0x02, 0x00,
+  0x01, 0x07, 0x01, 0x02, 0x00, 0x01, 0x07, 0x01, 0x02, 0x00, 0x01, 0x07,
+  0x01, 0x02, 0x00, 0x01, 0x07, 0x01, 0x02, 0x00, 0x01, 0x07, 0x01, 0x02,
+  0x00, 0x01, 0x07, 0x01, 0x02, 0x00, 0x01, 0x07, 0x01, 0x02, 0x00, 0x01,
+  0x07, 0x01, 0x02, 0x00, 0x01, 0x07, 0x01, 0x02, 0x00, 0x01, 0x07, 0x01,
+  0x02, 0x00, 0x01, 0x07, 0x01, 0x02, 0x00, 0x01, 0x07, 0x01, 0x01, 0x00,
+  0x09, 0x01, 0x00, 0x09, 0x02, 0x00, 0x01, 0x07, 0x01, 0x02, 0x00, 0x01,
+  0x07, 0x01, 0x02, 0x00, 0x01, 0x07, 0x01, 0x02, 0x00, 0x01, 0x07, 0x01,
+  0x02, 0x00, 0x01, 0x07, 0x01, 0x02, 0x00, 0x01, 0x07, 0x01, 0x02, 0x00,
+  0x01, 0x07, 0x01, 0x02, 0x00, 0x01, 0x07, 0x01, 0x02, 0x00, 0x01, 0x07,
+  0x01, 0x02, 0x00, 0x01, 0x07, 0x01, 0x02, 0x00, 0x01, 0x07, 0x01, 0x02,
+  0x00, 0x01, 0x07, 0x01, 0x01, 0x00, 0x09, 0x01, 0x00, 0x09, 0x02, 0x00,
+  0x01, 0x07, 0x01, 0x02, 0x00, 0x01, 0x07, 0x01, 0x02, 0x00, 0x01, 0x07,
+  0x01, 0x02, 0x00, 0x01, 0x07, 0x01, 0x02, 0x00, 0x01, 0x07, 0x01, 0x02,
+  0x00, 0x01, 0x07, 0x01, 0x02, 0x00, 0x01, 0x07, 0x01, 0x02, 0x00, 0x01,
+  0x07, 0x01, 0x02, 0x00, 0x01, 0x07, 0x01, 0x02, 0x00, 0x01, 0x07, 0x01,
+  0x02, 0x00, 0x01, 0x07, 0x01, 0x02, 0x00, 0x01, 0x07, 0x01, 0x01, 0x00,
+  0x09, 0x01, 0x00, 0x09, 0x02, 0x00, 0x01, 0x07, 0x01, 0x02, 0x00, 0x01,
+  0x07, 0x01, 0x02, 0x00, 0x01, 0x07, 0x01, 0x02, 0x00, 0x01, 0x07, 0x01,
+  0x02, 0x00, 0x01, 0x07, 0x01, 0x02, 0x00, 0x01, 0x07, 0x01, 0x02, 0x00,
+  0x01, 0x07, 0x01, 0x02, 0x00, 0x01, 0x07, 0x01, 0x02, 0x00, 0x01, 0x07,
+  0x01, 0x02, 0x00, 0x01, 0x07, 0x01, 0x02, 0x00, 0x01, 0x07, 0x01, 0x02,
+  0x00, 0x01, 0x07, 0x01, 0x01, 0x00, 0x09, 0x01, 0x00, 0x09, 0x02, 0x00,
+  0x01, 0x07, 0x01, 0x02, 0x00, 0x01, 0x07, 0x01, 0x02, 0x00, 0x01, 0x07,
+  0x01, 0x02, 0x00, 0x01, 0x07, 0x01, 0x02, 0x00, 0x01, 0x07, 0x01, 0x02,
+  0x00, 0x01, 0x07, 0x01, 0x02, 0x00, 0x01, 0x07, 0x01, 0x02, 0x00, 0x01,
+  0x07, 0x01, 0x02, 0x00, 0x01, 0x07, 0x01, 0x02, 0x00, 0x01, 0x07, 0x01,
+  0x02, 0x00, 0x01, 0x07, 0x01, 0x02, 0x00, 0x01, 0x07, 0x01, 0x01, 0x00,
+  0x09, 0x01, 0x00, 0x09, 0x02, 0x00, 0x01, 0x07, 0x01, 0x02, 0x00, 0x01,
+  0x07, 0x01, 0x02, 0x00, 0x01, 0x07, 0x01, 0x02, 0x00, 0x01, 0x07, 0x01,
+  0x02, 0x00, 0x01, 0x07, 0x01, 0x02, 0x00, 0x01, 0x07, 0x01, 0x02, 0x00,
+  0x01, 0x07, 0x01, 0x02, 0x00, 0x01, 0x07, 0x01, 0x02, 0x00, 0x01, 0x07,
+  0x01, 0x02, 0x00, 0x01, 0x07, 0x01, 0x02, 0x00, 0x01, 0x07, 0x01, 0x02,
+  0x00, 0x01, 0x07, 0x01, 0x01, 0x00, 0x09, 0x01, 0x00, 0x09, 0x02, 0x00,
+  0x01, 0x07, 0x01, 0x02, 0x00, 0x01, 0x07, 0x01, 0x02, 0x00, 0x01, 0x07,
+  0x01, 0x02, 0x00, 0x01, 0x07, 0x01, 0x02, 0x00, 0x01, 0x07, 0x01, 0x02,
+  0x00, 0x01, 0x07, 0x01, 0x02, 0x00, 0x01, 0x07, 0x01, 0x02, 0x00, 0x01,
+  0x07, 0x01, 0x02, 0x00, 0x01, 0x07, 0x01, 0x02, 0x00, 0x01, 0x07, 0x01,
+  0x02, 0x00, 0x01, 0x07, 0x01, 0x02, 0x00, 0x01, 0x07, 0x01, 0x01, 0x00,
+  0x09, 0x01, 0x00, 0x09, 0x02, 0x00, 0x01, 0x07, 0x01, 0x02, 0x00, 0x01,
+  0x07, 0x01, 0x02, 0x00, 0x01, 0x07, 0x01, 0x02, 0x00, 0x01, 0x07, 0x01,
+  0x02, 0x00, 0x01, 0x07, 0x01, 0x02, 0x00, 0x01, 0x07, 0x01, 0x02, 0x00,
+  0x01, 0x07, 0x01, 0x02, 0x00, 0x01, 0x07, 0x01, 0x02, 0x00, 0x01, 0x07,
+  0x01, 0x02, 0x00, 0x01, 0x07, 0x01, 0x02, 0x00, 0x01, 0x07, 0x01, 0x02,
+  0x00, 0x01, 0x07, 0x01, 0x01, 0x00, 0x09, 0x01, 0x00, 0x09, 0x02, 0x00,
+  0x01, 0x07, 0x01, 0x02, 0x00, 0x01, 0x07, 0x01, 0x02, 0x00, 0x01, 0x07,
+  0x01, 0x02, 0x00, 0x01, 0x07, 0x01, 0x02, 0x00, 0x01, 0x07, 0x01, 0x02,
+  0x00, 0x01, 0x07, 0x01, 0x02, 0x00, 0x01, 0x07, 0x01, 0x02, 0x00, 0x01,
+  0x07, 0x01, 0x02, 0x00, 0x01, 0x07, 0x01, 0x02, 0x00, 0x01, 0x07, 0x01,
+  0x02, 0x00, 0x01, 0x07, 0x01, 0x02, 0x00, 0x01, 0x07, 0x01, 0x01, 0x00,
+  0x09, 0x01, 0x00, 0x09, 0x02, 0x00, 0x01, 0x07, 0x01, 0x02, 0x00, 0x01,
+  0x07, 0x01, 0x02, 0x00, 0x01, 0x07, 0x01, 0x02, 0x00, 0x01, 0x07, 0x01,
+  0x02, 0x00, 0x01, 0x07, 0x01, 0x02, 0x00, 0x01, 0x07, 0x01, 0x02, 0x00,
+  0x01, 0x07, 0x01, 0x02, 0x00, 0x01, 0x07, 0x01, 0x02, 0x00, 0x01, 0x07,
+  0x01, 0x02, 0x00, 0x01, 0x07, 0x01, 0x02, 0x00, 0x01, 0x07, 0x01, 0x02,
+  0x00, 0x01, 0x07, 0x01, 0x01, 0x00, 0x09, 0x01, 0x00, 0x09, 0x02, 0x00,
+  0x01, 0x07, 0x01, 0x02, 0x00, 0x01, 0x07, 0x01, 0x02, 0x00, 0x01, 0x07,
+  0x01, 0x02, 0x00, 0x01, 0x07, 0x01, 0x02, 0x00, 0x01, 0x07, 0x01, 0x02,
+  0x00, 0x01, 0x07, 0x01, 0x02, 0x00, 0x01, 0x07, 0x01, 0x02, 0x00, 0x01,
+  0x07, 0x01, 0x02, 0x00, 0x01, 0x07, 0x01, 0x02, 0x00, 0x01, 0x07, 0x01,
+  0x02, 0x00, 0x01, 0x07, 0x01, 0x02, 0x00, 0x01, 0x07, 0x01, 0x01, 0x00,
+  0x09, 0x01, 0x00, 0x09, 0x02, 0x00, 0x01, 0x07, 0x01, 0x02, 0x00, 0x01,
+  0x07, 0x01, 0x02, 0x00, 0x01, 0x07, 0x01, 0x02, 0x00, 0x01, 0x07, 0x01,
+  0x02, 0x00, 0x01, 0x07, 0x01, 0x02, 0x00, 0x01, 0x07, 0x01, 0x02, 0x00,
+  0x01, 0x07, 0x01, 0x02, 0x00, 0x01, 0x07, 0x01, 0x02, 0x00, 0x01, 0x07,
+  0x01, 0x02, 0x00, 0x01, 0x07, 0x01, 0x02, 0x00, 0x01, 0x07, 0x01, 0x02,
+  0x00, 0x01, 0x07, 0x01, 0x01, 0x00, 0x09, 0x00, 0x01, 0x00, 0x03, 0x01,
+  0x00, 0x03, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x03, 0x01, 0x01, 0x03, 0x01, 0x01, 0x02,
+  0x04, 0x03, 0x00, 0x02, 0x01, 0x01, 0x01, 0x02, 0x02, 0x00, 0x01, 0x02,
+  0x01, 0x02, 0x00, 0x01, 0x02, 0x01, 0x02, 0x00, 0x01, 0x02, 0x01, 0x02,
+  0x00, 0x01, 0x02, 0x01, 0x03, 0x00, 0x01, 0x02, 0x01, 0x01, 0x01, 0x03,
+  0x00, 0x02, 0x01, 0x01, 0x02, 0x01, 0x01, 0x02, 0x04, 0x01, 0x03, 0x01,
+  0x01, 0x03, 0x01, 0x01, 0x03, 0x05, 0x02, 0x02, 0x01, 0x04, 0x02, 0x02,
+  0x01, 0x02, 0x04, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x02, 0x01, 0x01, 0x02, 0x01, 0x00, 0x07, 0x01, 0x02, 0x01, 0x01, 0x02,
+  0x01, 0x01, 0x01, 0x02, 0x01, 0x00, 0x02, 0x01, 0x00, 0x09, 0x01, 0x00,
+  0x09, 0x02, 0x00, 0x01, 0x07, 0x01, 0x02, 0x00, 0x01, 0x07, 0x01, 0x02,
+  0x00, 0x01, 0x07, 0x01, 0x02, 0x00, 0x01, 0x07, 0x01, 0x02, 0x00, 0x01,
+  0x07, 0x01, 0x02, 0x00, 0x01, 0x07, 0x01, 0x02, 0x00, 0x01, 0x07, 0x01,
+  0x02, 0x00, 0x01, 0x07, 0x01, 0x02, 0x00, 0x01, 0x07, 0x01, 0x02, 0x00,
+  0x01, 0x07, 0x01, 0x02, 0x00, 0x01, 0x07, 0x01, 0x02, 0x00, 0x01, 0x07,
+  0x01, 0x01, 0x00, 0x09, 0x02, 0x00, 0x02, 0x07, 0x02, 0x02, 0x01, 0x02,
+  0x05, 0x02, 0x02, 0x02, 0x01, 0x05, 0x01, 0x02, 0x02, 0x02, 0x03, 0x02,
+  0x02, 0x03, 0x01, 0x03, 0x01, 0x02, 0x03, 0x02, 0x01, 0x02, 0x02, 0x04,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x09, 0x01, 0x05, 0x01, 0x01, 0x05, 0x01,
+  0x01, 0x05, 0x01, 0x01, 0x05, 0x01, 0x01, 0x01, 0x09, 0x01, 0x00, 0x01,
+  0x01, 0x00, 0x01, 0x01, 0x00, 0x01, 0x01, 0x00, 0x01, 0x01, 0x00, 0x01,
+  0x01, 0x00, 0x01, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01,
+  0x01, 0x00, 0x01, 0x01, 0x00, 0x01, 0x01, 0x00, 0x01, 0x01, 0x00, 0x01,
+  0x01, 0x00, 0x01, 0x01, 0x02, 0x04, 0x02, 0x01, 0x01, 0x03, 0x02, 0x01,
+  0x00, 0x02, 0x01, 0x00, 0x02, 0x01, 0x01, 0x02, 0x01, 0x01, 0x05, 0x02,
+  0x00, 0x01, 0x04, 0x02, 0x02, 0x00, 0x01, 0x05, 0x01, 0x02, 0x00, 0x01,
+  0x05, 0x02, 0x02, 0x00, 0x02, 0x04, 0x01, 0x01, 0x01, 0x05, 0x01, 0x04,
+  0x02, 0x01, 0x05, 0x02, 0x01, 0x05, 0x02, 0x02, 0x00, 0x01, 0x04, 0x02,
+  0x01, 0x01, 0x04, 0x02, 0x00, 0x02, 0x01, 0x02, 0x02, 0x00, 0x02, 0x01,
+  0x02, 0x01, 0x03, 0x05, 0x02, 0x02, 0x01, 0x05, 0x01, 0x02, 0x01, 0x01,
+  0x07, 0x01, 0x03, 0x01, 0x01, 0x02, 0x03, 0x02, 0x01, 0x04, 0x00, 0x01,
+  0x02, 0x01, 0x03, 0x01, 0x02, 0x01, 0x03, 0x00, 0x01, 0x02, 0x01, 0x06,
+  0x01, 0x03, 0x00, 0x01, 0x02, 0x01, 0x06, 0x01, 0x04, 0x00, 0x01, 0x02,
+  0x01, 0x03, 0x01, 0x02, 0x01, 0x03, 0x01, 0x01, 0x02, 0x03, 0x02, 0x01,
+  0x02, 0x01, 0x01, 0x07, 0x01, 0x02, 0x02, 0x01, 0x05, 0x01, 0x01, 0x03,
+  0x05, 0x01, 0x01, 0x03, 0x02, 0x00, 0x01, 0x02, 0x02, 0x01, 0x04, 0x01,
+  0x01, 0x00, 0x05, 0x02, 0x00, 0x01, 0x03, 0x01, 0x02, 0x00, 0x01, 0x02,
+  0x02, 0x02, 0x00, 0x03, 0x01, 0x01, 0x02, 0x03, 0x01, 0x03, 0x01, 0x02,
+  0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x02, 0x02, 0x02, 0x02, 0x00, 0x02,
+  0x02, 0x02, 0x02, 0x00, 0x02, 0x02, 0x02, 0x02, 0x01, 0x02, 0x02, 0x02,
+  0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x03, 0x01, 0x03, 0x01, 0x01, 0x00,
+  0x09, 0x01, 0x07, 0x02, 0x01, 0x07, 0x02, 0x01, 0x07, 0x02, 0x01, 0x00,
+  0x05, 0x01, 0x02, 0x03, 0x02, 0x01, 0x01, 0x03, 0x01, 0x03, 0x00, 0x01,
+  0x01, 0x03, 0x01, 0x01, 0x04, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x01, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x01, 0x02, 0x01, 0x01, 0x03,
+  0x01, 0x01, 0x02, 0x03, 0x01, 0x00, 0x05, 0x01, 0x02, 0x03, 0x02, 0x01,
+  0x01, 0x03, 0x01, 0x02, 0x00, 0x02, 0x03, 0x02, 0x02, 0x00, 0x02, 0x03,
+  0x02, 0x02, 0x01, 0x01, 0x03, 0x01, 0x01, 0x02, 0x03, 0x01, 0x04, 0x01,
+  0x01, 0x04, 0x01, 0x01, 0x04, 0x01, 0x01, 0x04, 0x01, 0x01, 0x00, 0x09,
+  0x01, 0x04, 0x01, 0x01, 0x04, 0x01, 0x01, 0x04, 0x01, 0x01, 0x04, 0x01,
+  0x00, 0x01, 0x00, 0x09, 0x01, 0x01, 0x03, 0x02, 0x00, 0x01, 0x02, 0x02,
+  0x01, 0x03, 0x02, 0x01, 0x03, 0x01, 0x01, 0x02, 0x01, 0x01, 0x01, 0x01,
+  0x01, 0x00, 0x05, 0x01, 0x01, 0x03, 0x02, 0x00, 0x01, 0x02, 0x02, 0x01,
+  0x03, 0x02, 0x01, 0x01, 0x02, 0x01, 0x03, 0x02, 0x02, 0x00, 0x01, 0x03,
+  0x01, 0x01, 0x01, 0x03, 0x01, 0x01, 0x02, 0x01, 0x00, 0x02, 0x01, 0x00,
+  0x01, 0x02, 0x00, 0x01, 0x05, 0x01, 0x02, 0x00, 0x01, 0x05, 0x01, 0x02,
+  0x00, 0x01, 0x05, 0x01, 0x02, 0x00, 0x01, 0x05, 0x01, 0x02, 0x00, 0x01,
+  0x05, 0x01, 0x02, 0x00, 0x01, 0x05, 0x01, 0x02, 0x00, 0x01, 0x05, 0x01,
+  0x02, 0x00, 0x02, 0x02, 0x03, 0x02, 0x00, 0x05, 0x01, 0x01, 0x01, 0x00,
+  0x01, 0x01, 0x00, 0x01, 0x01, 0x00, 0x01, 0x01, 0x00, 0x01, 0x01, 0x02,
+  0x06, 0x02, 0x01, 0x04, 0x02, 0x01, 0x02, 0x00, 0x05, 0x02, 0x01, 0x02,
+  0x00, 0x05, 0x02, 0x01, 0x02, 0x00, 0x05, 0x02, 0x01, 0x02, 0x00, 0x05,
+  0x02, 0x01, 0x02, 0x01, 0x04, 0x02, 0x01, 0x02, 0x02, 0x03, 0x02, 0x01,
+  0x02, 0x04, 0x01, 0x02, 0x01, 0x02, 0x04, 0x01, 0x02, 0x01, 0x02, 0x04,
+  0x01, 0x02, 0x01, 0x02, 0x04, 0x01, 0x02, 0x01, 0x02, 0x04, 0x01, 0x02,
+  0x01, 0x02, 0x04, 0x01, 0x02, 0x01, 0x02, 0x04, 0x01, 0x02, 0x01, 0x02,
+  0x04, 0x01, 0x02, 0x01, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x01,
+  0x01, 0x01, 0x02, 0x02, 0x01, 0x00, 0x04, 0x01, 0x01, 0x02, 0x02, 0x00,
+  0x01, 0x01, 0x01, 0x01, 0x02, 0x01, 0x01, 0x02, 0x01, 0x01, 0x02, 0x01,
+  0x01, 0x02, 0x01, 0x01, 0x00, 0x05, 0x01, 0x01, 0x03, 0x02, 0x00, 0x01,
+  0x03, 0x01, 0x02, 0x00, 0x01, 0x03, 0x01, 0x02, 0x00, 0x01, 0x03, 0x01,
+  0x02, 0x00, 0x01, 0x03, 0x01, 0x02, 0x00, 0x01, 0x03, 0x01, 0x01, 0x01,
+  0x03, 0x02, 0x00, 0x01, 0x03, 0x01, 0x02, 0x00, 0x02, 0x02, 0x02, 0x02,
+  0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+  0x02, 0x02, 0x02, 0x01, 0x02, 0x02, 0x02, 0x02, 0x00, 0x02, 0x02, 0x02,
+  0x02, 0x00, 0x01, 0x03, 0x01, 0x02, 0x01, 0x02, 0x06, 0x02, 0x03, 0x00,
+  0x01, 0x01, 0x01, 0x06, 0x01, 0x02, 0x02, 0x01, 0x05, 0x01, 0x02, 0x02,
+  0x01, 0x05, 0x01, 0x02, 0x02, 0x01, 0x04, 0x01, 0x02, 0x00, 0x05, 0x02,
+  0x01, 0x01, 0x06, 0x01, 0x02, 0x03, 0x02, 0x03, 0x02, 0x02, 0x03, 0x01,
+  0x04, 0x02, 0x03, 0x02, 0x01, 0x04, 0x01, 0x01, 0x01, 0x03, 0x02, 0x01,
+  0x03, 0x01, 0x02, 0x01, 0x02, 0x01, 0x01, 0x04, 0x05, 0x02, 0x00, 0x02,
+  0x07, 0x01, 0x02, 0x01, 0x02, 0x06, 0x02, 0x03, 0x00, 0x01, 0x01, 0x01,
+  0x06, 0x01, 0x02, 0x02, 0x01, 0x05, 0x01, 0x02, 0x02, 0x01, 0x05, 0x01,
+  0x02, 0x02, 0x01, 0x04, 0x01, 0x02, 0x00, 0x05, 0x02, 0x01, 0x01, 0x06,
+  0x01, 0x02, 0x03, 0x02, 0x02, 0x03, 0x03, 0x03, 0x01, 0x02, 0x01, 0x02,
+  0x02, 0x02, 0x02, 0x01, 0x06, 0x01, 0x02, 0x02, 0x01, 0x05, 0x02, 0x02,
+  0x01, 0x01, 0x05, 0x01, 0x02, 0x00, 0x02, 0x04, 0x05, 0x02, 0x01, 0x03,
+  0x05, 0x02, 0x03, 0x00, 0x01, 0x02, 0x02, 0x04, 0x01, 0x02, 0x02, 0x01,
+  0x05, 0x01, 0x02, 0x03, 0x02, 0x03, 0x01, 0x03, 0x00, 0x01, 0x02, 0x02,
+  0x02, 0x01, 0x02, 0x01, 0x03, 0x03, 0x01, 0x01, 0x06, 0x01, 0x02, 0x03,
+  0x02, 0x03, 0x02, 0x02, 0x03, 0x01, 0x04, 0x02, 0x03, 0x02, 0x01, 0x04,
+  0x01, 0x01, 0x01, 0x03, 0x02, 0x01, 0x03, 0x01, 0x02, 0x01, 0x02, 0x01,
+  0x01, 0x04, 0x05, 0x02, 0x00, 0x02, 0x07, 0x01, 0x01, 0x03, 0x02, 0x01,
+  0x02, 0x03, 0x00, 0x00, 0x01, 0x03, 0x02, 0x01, 0x03, 0x02, 0x01, 0x01,
+  0x04, 0x01, 0x00, 0x02, 0x01, 0x00, 0x01, 0x02, 0x00, 0x01, 0x05, 0x02,
+  0x02, 0x00, 0x02, 0x03, 0x02, 0x01, 0x01, 0x05, 0x01, 0x02, 0x02, 0x01,
+  0x03, 0x02, 0x01, 0x04, 0x01, 0x00, 0x01, 0x03, 0x03, 0x01, 0x03, 0x03,
+  0x02, 0x03, 0x01, 0x01, 0x01, 0x02, 0x02, 0x02, 0x01, 0x02, 0x02, 0x02,
+  0x02, 0x01, 0x02, 0x02, 0x02, 0x01, 0x03, 0x01, 0x02, 0x02, 0x01, 0x03,
+  0x01, 0x02, 0x01, 0x02, 0x03, 0x02, 0x01, 0x01, 0x07, 0x02, 0x01, 0x01,
+  0x05, 0x01, 0x02, 0x00, 0x02, 0x05, 0x02, 0x02, 0x00, 0x02, 0x05, 0x02,
+  0x02, 0x00, 0x01, 0x07, 0x01, 0x01, 0x05, 0x02, 0x01, 0x04, 0x02, 0x01,
+  0x04, 0x01, 0x00, 0x01, 0x03, 0x03, 0x01, 0x03, 0x03, 0x02, 0x03, 0x01,
+  0x01, 0x01, 0x02, 0x02, 0x02, 0x01, 0x02, 0x02, 0x02, 0x02, 0x01, 0x02,
+  0x02, 0x02, 0x01, 0x03, 0x01, 0x02, 0x02, 0x01, 0x03, 0x01, 0x02, 0x01,
+  0x02, 0x03, 0x02, 0x01, 0x01, 0x07, 0x02, 0x01, 0x01, 0x05, 0x01, 0x02,
+  0x00, 0x02, 0x05, 0x02, 0x02, 0x00, 0x02, 0x05, 0x02, 0x02, 0x00, 0x01,
+  0x07, 0x01, 0x01, 0x03, 0x03, 0x02, 0x02, 0x02, 0x01, 0x02, 0x02, 0x02,
+  0x01, 0x03, 0x01, 0x00, 0x01, 0x03, 0x03, 0x01, 0x03, 0x03, 0x02, 0x03,
+  0x01, 0x01, 0x01, 0x02, 0x02, 0x02, 0x01, 0x02, 0x02, 0x02, 0x02, 0x01,
+  0x02, 0x02, 0x02, 0x01, 0x03, 0x01, 0x02, 0x02, 0x01, 0x03, 0x01, 0x02,
+  0x01, 0x02, 0x03, 0x02, 0x01, 0x01, 0x07, 0x02, 0x01, 0x01, 0x05, 0x01,
+  0x02, 0x00, 0x02, 0x05, 0x02, 0x02, 0x00, 0x02, 0x05, 0x02, 0x02, 0x00,
+  0x01, 0x07, 0x01, 0x02, 0x02, 0x03, 0x01, 0x01, 0x02, 0x01, 0x01, 0x02,
+  0x04, 0x00, 0x00, 0x01, 0x03, 0x03, 0x01, 0x03, 0x03, 0x02, 0x03, 0x01,
+  0x01, 0x01, 0x02, 0x02, 0x02, 0x01, 0x02, 0x02, 0x02, 0x02, 0x01, 0x02,
+  0x02, 0x02, 0x01, 0x03, 0x01, 0x02, 0x02, 0x01, 0x03, 0x01, 0x02, 0x01,
+  0x02, 0x03, 0x02, 0x01, 0x01, 0x07, 0x02, 0x01, 0x01, 0x05, 0x01, 0x02,
+  0x00, 0x02, 0x05, 0x02, 0x02, 0x00, 0x02, 0x05, 0x02, 0x02, 0x00, 0x01,
+  0x07, 0x01, 0x02, 0x02, 0x02, 0x01, 0x02, 0x02, 0x02, 0x02, 0x01, 0x02,
+  0x00, 0x01, 0x03, 0x03, 0x01, 0x03, 0x03, 0x02, 0x03, 0x01, 0x01, 0x01,
+  0x02, 0x02, 0x02, 0x01, 0x02, 0x02, 0x02, 0x02, 0x01, 0x02, 0x02, 0x02,
+  0x01, 0x03, 0x01, 0x02, 0x02, 0x01, 0x03, 0x01, 0x02, 0x01, 0x02, 0x03,
+  0x02, 0x01, 0x01, 0x07, 0x02, 0x01, 0x01, 0x05, 0x01, 0x02, 0x00, 0x02,
+  0x05, 0x02, 0x02, 0x00, 0x02, 0x05, 0x02, 0x02, 0x00, 0x01, 0x07, 0x01,
+  0x01, 0x03, 0x03, 0x02, 0x02, 0x02, 0x01, 0x02, 0x02, 0x02, 0x02, 0x01,
+  0x02, 0x01, 0x03, 0x03, 0x00, 0x01, 0x03, 0x03, 0x01, 0x03, 0x03, 0x02,
+  0x03, 0x01, 0x01, 0x01, 0x02, 0x02, 0x02, 0x01, 0x02, 0x02, 0x02, 0x02,
+  0x01, 0x02, 0x02, 0x02, 0x01, 0x03, 0x01, 0x02, 0x02, 0x01, 0x03, 0x01,
+  0x02, 0x01, 0x02, 0x03, 0x02, 0x01, 0x01, 0x07, 0x02, 0x01, 0x01, 0x05,
+  0x01, 0x02, 0x00, 0x02, 0x05, 0x02, 0x02, 0x00, 0x02, 0x05, 0x02, 0x02,
+  0x00, 0x01, 0x07, 0x01, 0x01, 0x04, 0x06, 0x02, 0x04, 0x01, 0x01, 0x01,
+  0x02, 0x03, 0x02, 0x01, 0x01, 0x02, 0x03, 0x01, 0x02, 0x01, 0x02, 0x03,
+  0x01, 0x02, 0x01, 0x02, 0x03, 0x01, 0x02, 0x01, 0x02, 0x02, 0x02, 0x02,
+  0x04, 0x02, 0x02, 0x01, 0x03, 0x01, 0x01, 0x02, 0x05, 0x02, 0x01, 0x02,
+  0x03, 0x01, 0x02, 0x01, 0x02, 0x03, 0x01, 0x02, 0x01, 0x01, 0x04, 0x01,
+  0x02, 0x00, 0x02, 0x04, 0x04, 0x01, 0x03, 0x04, 0x02, 0x02, 0x01, 0x03,
+  0x02, 0x02, 0x01, 0x02, 0x04, 0x02, 0x01, 0x01, 0x01, 0x01, 0x00, 0x02,
+  0x01, 0x00, 0x02, 0x01, 0x00, 0x02, 0x01, 0x00, 0x02, 0x01, 0x00, 0x02,
+  0x01, 0x01, 0x01, 0x02, 0x01, 0x02, 0x04, 0x02, 0x02, 0x02, 0x01, 0x03,
+  0x02, 0x01, 0x03, 0x04, 0x01, 0x04, 0x01, 0x01, 0x04, 0x03, 0x02, 0x03,
+  0x01, 0x02, 0x01, 0x01, 0x03, 0x03, 0x01, 0x01, 0x02, 0x01, 0x02, 0x02,
+  0x01, 0x03, 0x01, 0x00, 0x01, 0x00, 0x07, 0x01, 0x00, 0x01, 0x01, 0x00,
+  0x01, 0x01, 0x00, 0x01, 0x01, 0x00, 0x01, 0x01, 0x00, 0x01, 0x01, 0x00,
+  0x07, 0x01, 0x00, 0x01, 0x01, 0x00, 0x01, 0x01, 0x00, 0x01, 0x01, 0x00,
+  0x01, 0x01, 0x00, 0x01, 0x01, 0x00, 0x07, 0x01, 0x04, 0x02, 0x01, 0x03,
+  0x02, 0x01, 0x03, 0x01, 0x00, 0x01, 0x00, 0x07, 0x01, 0x00, 0x01, 0x01,
+  0x00, 0x01, 0x01, 0x00, 0x01, 0x01, 0x00, 0x01, 0x01, 0x00, 0x01, 0x01,
+  0x00, 0x07, 0x01, 0x00, 0x01, 0x01, 0x00, 0x01, 0x01, 0x00, 0x01, 0x01,
+  0x00, 0x01, 0x01, 0x00, 0x01, 0x01, 0x00, 0x07, 0x01, 0x02, 0x03, 0x02,
+  0x01, 0x02, 0x01, 0x02, 0x02, 0x01, 0x01, 0x03, 0x01, 0x00, 0x01, 0x00,
+  0x07, 0x01, 0x00, 0x01, 0x01, 0x00, 0x01, 0x01, 0x00, 0x01, 0x01, 0x00,
+  0x01, 0x01, 0x00, 0x01, 0x01, 0x00, 0x07, 0x01, 0x00, 0x01, 0x01, 0x00,
+  0x01, 0x01, 0x00, 0x01, 0x01, 0x00, 0x01, 0x01, 0x00, 0x01, 0x01, 0x00,
+  0x07, 0x02, 0x01, 0x02, 0x01, 0x02, 0x02, 0x01, 0x02, 0x01, 0x02, 0x00,
+  0x01, 0x00, 0x07, 0x01, 0x00, 0x01, 0x01, 0x00, 0x01, 0x01, 0x00, 0x01,
+  0x01, 0x00, 0x01, 0x01, 0x00, 0x01, 0x01, 0x00, 0x07, 0x01, 0x00, 0x01,
+  0x01, 0x00, 0x01, 0x01, 0x00, 0x01, 0x01, 0x00, 0x01, 0x01, 0x00, 0x01,
+  0x01, 0x00, 0x07, 0x01, 0x01, 0x02, 0x01, 0x02, 0x02, 0x01, 0x03, 0x01,
+  0x00, 0x01, 0x00, 0x07, 0x01, 0x03, 0x01, 0x01, 0x03, 0x01, 0x01, 0x03,
+  0x01, 0x01, 0x03, 0x01, 0x01, 0x03, 0x01, 0x01, 0x03, 0x01, 0x01, 0x03,
+  0x01, 0x01, 0x03, 0x01, 0x01, 0x03, 0x01, 0x01, 0x03, 0x01, 0x01, 0x03,
+  0x01, 0x01, 0x00, 0x07, 0x01, 0x04, 0x02, 0x01, 0x03, 0x02, 0x01, 0x03,
+  0x01, 0x00, 0x01, 0x00, 0x07, 0x01, 0x03, 0x01, 0x01, 0x03, 0x01, 0x01,
+  0x03, 0x01, 0x01, 0x03, 0x01, 0x01, 0x03, 0x01, 0x01, 0x03, 0x01, 0x01,
+  0x03, 0x01, 0x01, 0x03, 0x01, 0x01, 0x03, 0x01, 0x01, 0x03, 0x01, 0x01,
+  0x03, 0x01, 0x01, 0x00, 0x07, 0x01, 0x02, 0x03, 0x02, 0x01, 0x02, 0x01,
+  0x02, 0x02, 0x01, 0x01, 0x03, 0x01, 0x00, 0x01, 0x00, 0x07, 0x01, 0x03,
+  0x01, 0x01, 0x03, 0x01, 0x01, 0x03, 0x01, 0x01, 0x03, 0x01, 0x01, 0x03,
+  0x01, 0x01, 0x03, 0x01, 0x01, 0x03, 0x01, 0x01, 0x03, 0x01, 0x01, 0x03,
+  0x01, 0x01, 0x03, 0x01, 0x01, 0x03, 0x01, 0x01, 0x00, 0x07, 0x02, 0x01,
+  0x02, 0x01, 0x02, 0x02, 0x01, 0x02, 0x01, 0x02, 0x00, 0x01, 0x00, 0x07,
+  0x01, 0x03, 0x01, 0x01, 0x03, 0x01, 0x01, 0x03, 0x01, 0x01, 0x03, 0x01,
+  0x01, 0x03, 0x01, 0x01, 0x03, 0x01, 0x01, 0x03, 0x01, 0x01, 0x03, 0x01,
+  0x01, 0x03, 0x01, 0x01, 0x03, 0x01, 0x01, 0x03, 0x01, 0x01, 0x00, 0x07,
+  0x01, 0x02, 0x06, 0x02, 0x02, 0x01, 0x04, 0x02, 0x02, 0x02, 0x01, 0x05,
+  0x01, 0x02, 0x02, 0x01, 0x05, 0x02, 0x02, 0x02, 0x01, 0x05, 0x02, 0x02,
+  0x02, 0x01, 0x05, 0x02, 0x02, 0x00, 0x06, 0x02, 0x02, 0x02, 0x02, 0x01,
+  0x05, 0x02, 0x02, 0x02, 0x01, 0x05, 0x02, 0x02, 0x02, 0x01, 0x05, 0x02,
+  0x02, 0x02, 0x01, 0x05, 0x01, 0x02, 0x02, 0x01, 0x04, 0x02, 0x01, 0x02,
+  0x06, 0x02, 0x01, 0x03, 0x01, 0x01, 0x02, 0x00, 0x01, 0x02, 0x04, 0x00,
+  0x00, 0x02, 0x00, 0x02, 0x04, 0x02, 0x02, 0x00, 0x02, 0x04, 0x02, 0x02,
+  0x00, 0x03, 0x03, 0x02, 0x03, 0x00, 0x01, 0x01, 0x01, 0x03, 0x02, 0x03,
+  0x00, 0x01, 0x01, 0x01, 0x03, 0x02, 0x03, 0x00, 0x01, 0x01, 0x02, 0x02,
+  0x02, 0x03, 0x00, 0x01, 0x02, 0x01, 0x02, 0x02, 0x03, 0x00, 0x01, 0x02,
+  0x02, 0x01, 0x02, 0x03, 0x00, 0x01, 0x03, 0x01, 0x01, 0x02, 0x03, 0x00,
+  0x01, 0x03, 0x01, 0x01, 0x02, 0x02, 0x00, 0x01, 0x03, 0x04, 0x02, 0x00,
+  0x01, 0x04, 0x03, 0x02, 0x00, 0x01, 0x04, 0x03, 0x01, 0x02, 0x02, 0x01,
+  0x03, 0x02, 0x01, 0x04, 0x01, 0x00, 0x01, 0x02, 0x05, 0x02, 0x01, 0x02,
+  0x03, 0x02, 0x02, 0x01, 0x01, 0x05, 0x01, 0x02, 0x00, 0x02, 0x05, 0x02,
+  0x02, 0x00, 0x02, 0x05, 0x02, 0x02, 0x00, 0x02, 0x05, 0x02, 0x02, 0x00,
+  0x02, 0x05, 0x02, 0x02, 0x00, 0x02, 0x05, 0x02, 0x02, 0x00, 0x02, 0x05,
+  0x02, 0x02, 0x00, 0x02, 0x05, 0x02, 0x02, 0x01, 0x01, 0x05, 0x01, 0x02,
+  0x01, 0x02, 0x03, 0x02, 0x01, 0x02, 0x05, 0x01, 0x05, 0x02, 0x01, 0x04,
+  0x02, 0x01, 0x04, 0x01, 0x00, 0x01, 0x02, 0x05, 0x02, 0x01, 0x02, 0x03,
+  0x02, 0x02, 0x01, 0x01, 0x05, 0x01, 0x02, 0x00, 0x02, 0x05, 0x02, 0x02,
+  0x00, 0x02, 0x05, 0x02, 0x02, 0x00, 0x02, 0x05, 0x02, 0x02, 0x00, 0x02,
+  0x05, 0x02, 0x02, 0x00, 0x02, 0x05, 0x02, 0x02, 0x00, 0x02, 0x05, 0x02,
+  0x02, 0x00, 0x02, 0x05, 0x02, 0x02, 0x01, 0x01, 0x05, 0x01, 0x02, 0x01,
+  0x02, 0x03, 0x02, 0x01, 0x02, 0x05, 0x01, 0x03, 0x03, 0x02, 0x02, 0x02,
+  0x01, 0x02, 0x02, 0x02, 0x01, 0x03, 0x01, 0x00, 0x01, 0x02, 0x05, 0x02,
+  0x01, 0x02, 0x03, 0x02, 0x02, 0x01, 0x01, 0x05, 0x01, 0x02, 0x00, 0x02,
+  0x05, 0x02, 0x02, 0x00, 0x02, 0x05, 0x02, 0x02, 0x00, 0x02, 0x05, 0x02,
+  0x02, 0x00, 0x02, 0x05, 0x02, 0x02, 0x00, 0x02, 0x05, 0x02, 0x02, 0x00,
+  0x02, 0x05, 0x02, 0x02, 0x00, 0x02, 0x05, 0x02, 0x02, 0x01, 0x01, 0x05,
+  0x01, 0x02, 0x01, 0x02, 0x03, 0x02, 0x01, 0x02, 0x05, 0x02, 0x02, 0x03,
+  0x01, 0x01, 0x02, 0x01, 0x01, 0x02, 0x04, 0x00, 0x00, 0x01, 0x02, 0x05,
+  0x02, 0x01, 0x02, 0x03, 0x02, 0x02, 0x01, 0x01, 0x05, 0x01, 0x02, 0x00,
+  0x02, 0x05, 0x02, 0x02, 0x00, 0x02, 0x05, 0x02, 0x02, 0x00, 0x02, 0x05,
+  0x02, 0x02, 0x00, 0x02, 0x05, 0x02, 0x02, 0x00, 0x02, 0x05, 0x02, 0x02,
+  0x00, 0x02, 0x05, 0x02, 0x02, 0x00, 0x02, 0x05, 0x02, 0x02, 0x01, 0x01,
+  0x05, 0x01, 0x02, 0x01, 0x02, 0x03, 0x02, 0x01, 0x02, 0x05, 0x02, 0x02,
+  0x02, 0x01, 0x02, 0x02, 0x02, 0x02, 0x01, 0x02, 0x00, 0x01, 0x02, 0x05,
+  0x02, 0x01, 0x02, 0x03, 0x02, 0x02, 0x01, 0x01, 0x05, 0x01, 0x02, 0x00,
+  0x02, 0x05, 0x02, 0x02, 0x00, 0x02, 0x05, 0x02, 0x02, 0x00, 0x02, 0x05,
+  0x02, 0x02, 0x00, 0x02, 0x05, 0x02, 0x02, 0x00, 0x02, 0x05, 0x02, 0x02,
+  0x00, 0x02, 0x05, 0x02, 0x02, 0x00, 0x02, 0x05, 0x02, 0x02, 0x01, 0x01,
+  0x05, 0x01, 0x02, 0x01, 0x02, 0x03, 0x02, 0x01, 0x02, 0x05, 0x02, 0x00,
+  0x01, 0x05, 0x01, 0x02, 0x00, 0x02, 0x03, 0x02, 0x02, 0x01, 0x02, 0x01,
+  0x02, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x02, 0x01, 0x02, 0x01, 0x02,
+  0x02, 0x00, 0x02, 0x03, 0x02, 0x02, 0x00, 0x01, 0x05, 0x01, 0x01, 0x07,
+  0x01, 0x01, 0x02, 0x07, 0x02, 0x01, 0x02, 0x03, 0x02, 0x02, 0x01, 0x01,
+  0x04, 0x02, 0x02, 0x00, 0x02, 0x04, 0x03, 0x03, 0x00, 0x02, 0x03, 0x01,
+  0x01, 0x02, 0x03, 0x00, 0x02, 0x02, 0x02, 0x01, 0x02, 0x03, 0x00, 0x02,
+  0x02, 0x01, 0x02, 0x02, 0x03, 0x00, 0x02, 0x01, 0x02, 0x02, 0x02, 0x03,
+  0x00, 0x02, 0x01, 0x01, 0x03, 0x02, 0x02, 0x00, 0x03, 0x04, 0x02, 0x02,
+  0x01, 0x02, 0x04, 0x01, 0x02, 0x01, 0x02, 0x03, 0x02, 0x01, 0x00, 0x07,
+  0x01, 0x00, 0x01, 0x01, 0x01, 0x02, 0x01, 0x02, 0x02, 0x01, 0x03, 0x01,
+  0x00, 0x02, 0x00, 0x01, 0x05, 0x01, 0x02, 0x00, 0x01, 0x05, 0x01, 0x02,
+  0x00, 0x01, 0x05, 0x01, 0x02, 0x00, 0x01, 0x05, 0x01, 0x02, 0x00, 0x01,
+  0x05, 0x01, 0x02, 0x00, 0x01, 0x05, 0x01, 0x02, 0x00, 0x01, 0x05, 0x01,
+  0x02, 0x00, 0x01, 0x05, 0x01, 0x02, 0x00, 0x01, 0x05, 0x01, 0x02, 0x00,
+  0x01, 0x05, 0x01, 0x02, 0x00, 0x01, 0x05, 0x01, 0x02, 0x00, 0x02, 0x03,
+  0x02, 0x01, 0x01, 0x05, 0x01, 0x04, 0x02, 0x01, 0x03, 0x02, 0x01, 0x03,
+  0x01, 0x00, 0x02, 0x00, 0x01, 0x05, 0x01, 0x02, 0x00, 0x01, 0x05, 0x01,
+  0x02, 0x00, 0x01, 0x05, 0x01, 0x02, 0x00, 0x01, 0x05, 0x01, 0x02, 0x00,
+  0x01, 0x05, 0x01, 0x02, 0x00, 0x01, 0x05, 0x01, 0x02, 0x00, 0x01, 0x05,
+  0x01, 0x02, 0x00, 0x01, 0x05, 0x01, 0x02, 0x00, 0x01, 0x05, 0x01, 0x02,
+  0x00, 0x01, 0x05, 0x01, 0x02, 0x00, 0x01, 0x05, 0x01, 0x02, 0x00, 0x02,
+  0x03, 0x02, 0x01, 0x01, 0x05, 0x01, 0x02, 0x03, 0x02, 0x01, 0x02, 0x01,
+  0x02, 0x02, 0x01, 0x01, 0x03, 0x01, 0x00, 0x02, 0x00, 0x01, 0x05, 0x01,
+  0x02, 0x00, 0x01, 0x05, 0x01, 0x02, 0x00, 0x01, 0x05, 0x01, 0x02, 0x00,
+  0x01, 0x05, 0x01, 0x02, 0x00, 0x01, 0x05, 0x01, 0x02, 0x00, 0x01, 0x05,
+  0x01, 0x02, 0x00, 0x01, 0x05, 0x01, 0x02, 0x00, 0x01, 0x05, 0x01, 0x02,
+  0x00, 0x01, 0x05, 0x01, 0x02, 0x00, 0x01, 0x05, 0x01, 0x02, 0x00, 0x01,
+  0x05, 0x01, 0x02, 0x00, 0x02, 0x03, 0x02, 0x01, 0x01, 0x05, 0x02, 0x01,
+  0x02, 0x01, 0x02, 0x02, 0x01, 0x02, 0x01, 0x02, 0x00, 0x02, 0x00, 0x01,
+  0x05, 0x01, 0x02, 0x00, 0x01, 0x05, 0x01, 0x02, 0x00, 0x01, 0x05, 0x01,
+  0x02, 0x00, 0x01, 0x05, 0x01, 0x02, 0x00, 0x01, 0x05, 0x01, 0x02, 0x00,
+  0x01, 0x05, 0x01, 0x02, 0x00, 0x01, 0x05, 0x01, 0x02, 0x00, 0x01, 0x05,
+  0x01, 0x02, 0x00, 0x01, 0x05, 0x01, 0x02, 0x00, 0x01, 0x05, 0x01, 0x02,
+  0x00, 0x01, 0x05, 0x01, 0x02, 0x00, 0x02, 0x03, 0x02, 0x01, 0x01, 0x05,
+  0x01, 0x06, 0x02, 0x01, 0x05, 0x02, 0x01, 0x05, 0x01, 0x00, 0x02, 0x00,
+  0x02, 0x07, 0x02, 0x02, 0x01, 0x02, 0x05, 0x02, 0x02, 0x02, 0x02, 0x04,
+  0x01, 0x02, 0x02, 0x02, 0x03, 0x02, 0x02, 0x03, 0x02, 0x01, 0x02, 0x02,
+  0x04, 0x01, 0x01, 0x01, 0x01, 0x04, 0x03, 0x01, 0x05, 0x01, 0x01, 0x05,
+  0x01, 0x01, 0x05, 0x01, 0x01, 0x05, 0x01, 0x01, 0x05, 0x01, 0x01, 0x05,
+  0x01, 0x01, 0x00, 0x01, 0x01, 0x00, 0x01, 0x01, 0x00, 0x01, 0x01, 0x00,
+  0x06, 0x02, 0x00, 0x01, 0x05, 0x01, 0x02, 0x00, 0x01, 0x05, 0x02, 0x02,
+  0x00, 0x01, 0x05, 0x02, 0x02, 0x00, 0x01, 0x05, 0x02, 0x02, 0x00, 0x01,
+  0x05, 0x01, 0x01, 0x00, 0x06, 0x01, 0x00, 0x01, 0x01, 0x00, 0x01, 0x01,
+  0x00, 0x01, 0x01, 0x01, 0x03, 0x01, 0x00, 0x01, 0x01, 0x00, 0x01, 0x01,
+  0x00, 0x01, 0x01, 0x00, 0x08, 0x02, 0x00, 0x01, 0x05, 0x01, 0x02, 0x00,
+  0x01, 0x04, 0x02, 0x02, 0x00, 0x01, 0x03, 0x02, 0x02, 0x00, 0x01, 0x02,
+  0x02, 0x02, 0x00, 0x01, 0x02, 0x03, 0x02, 0x00, 0x01, 0x05, 0x02, 0x02,
+  0x00, 0x01, 0x06, 0x01, 0x02, 0x00, 0x01, 0x06, 0x01, 0x01, 0x07, 0x01,
+  0x01, 0x07, 0x01, 0x01, 0x06, 0x02, 0x01, 0x02, 0x04, 0x01, 0x02, 0x02,
+  0x01, 0x03, 0x02, 0x01, 0x04, 0x01, 0x00, 0x00, 0x01, 0x02, 0x04, 0x02,
+  0x01, 0x01, 0x04, 0x01, 0x01, 0x06, 0x02, 0x01, 0x06, 0x02, 0x01, 0x01,
+  0x07, 0x02, 0x00, 0x02, 0x04, 0x02, 0x02, 0x00, 0x02, 0x04, 0x02, 0x02,
+  0x00, 0x02, 0x04, 0x02, 0x02, 0x01, 0x05, 0x01, 0x02, 0x01, 0x05, 0x02,
+  0x01, 0x04, 0x02, 0x01, 0x04, 0x01, 0x00, 0x00, 0x01, 0x02, 0x04, 0x02,
+  0x01, 0x01, 0x04, 0x01, 0x01, 0x06, 0x02, 0x01, 0x06, 0x02, 0x01, 0x01,
+  0x07, 0x02, 0x00, 0x02, 0x04, 0x02, 0x02, 0x00, 0x02, 0x04, 0x02, 0x02,
+  0x00, 0x02, 0x04, 0x02, 0x02, 0x01, 0x05, 0x01, 0x02, 0x01, 0x03, 0x03,
+  0x02, 0x02, 0x02, 0x01, 0x02, 0x02, 0x02, 0x01, 0x03, 0x01, 0x00, 0x00,
+  0x01, 0x02, 0x04, 0x02, 0x01, 0x01, 0x04, 0x01, 0x01, 0x06, 0x02, 0x01,
+  0x06, 0x02, 0x01, 0x01, 0x07, 0x02, 0x00, 0x02, 0x04, 0x02, 0x02, 0x00,
+  0x02, 0x04, 0x02, 0x02, 0x00, 0x02, 0x04, 0x02, 0x02, 0x01, 0x05, 0x01,
+  0x02, 0x02, 0x02, 0x03, 0x01, 0x01, 0x02, 0x01, 0x01, 0x02, 0x04, 0x00,
+  0x00, 0x01, 0x02, 0x04, 0x02, 0x01, 0x01, 0x04, 0x01, 0x01, 0x06, 0x02,
+  0x01, 0x06, 0x02, 0x01, 0x01, 0x07, 0x02, 0x00, 0x02, 0x04, 0x02, 0x02,
+  0x00, 0x02, 0x04, 0x02, 0x02, 0x00, 0x02, 0x04, 0x02, 0x02, 0x01, 0x05,
+  0x01, 0x02, 0x02, 0x02, 0x02, 0x01, 0x02, 0x02, 0x02, 0x02, 0x01, 0x02,
+  0x00, 0x00, 0x01, 0x02, 0x04, 0x02, 0x01, 0x01, 0x04, 0x01, 0x01, 0x06,
+  0x02, 0x01, 0x06, 0x02, 0x01, 0x01, 0x07, 0x02, 0x00, 0x02, 0x04, 0x02,
+  0x02, 0x00, 0x02, 0x04, 0x02, 0x02, 0x00, 0x02, 0x04, 0x02, 0x02, 0x01,
+  0x05, 0x01, 0x02, 0x01, 0x03, 0x03, 0x02, 0x02, 0x02, 0x01, 0x02, 0x02,
+  0x02, 0x02, 0x01, 0x02, 0x01, 0x03, 0x03, 0x00, 0x01, 0x02, 0x04, 0x02,
+  0x01, 0x01, 0x04, 0x01, 0x01, 0x06, 0x02, 0x01, 0x06, 0x02, 0x01, 0x01,
+  0x07, 0x02, 0x00, 0x02, 0x04, 0x02, 0x02, 0x00, 0x02, 0x04, 0x02, 0x02,
+  0x00, 0x02, 0x04, 0x02, 0x02, 0x01, 0x05, 0x01, 0x02, 0x02, 0x02, 0x03,
+  0x01, 0x03, 0x03, 0x01, 0x01, 0x02, 0x02, 0x03, 0x01, 0x03, 0x00, 0x01,
+  0x04, 0x01, 0x03, 0x01, 0x02, 0x05, 0x01, 0x03, 0x02, 0x01, 0x01, 0x0A,
+  0x02, 0x00, 0x02, 0x03, 0x01, 0x03, 0x00, 0x02, 0x03, 0x01, 0x03, 0x01,
+  0x03, 0x00, 0x02, 0x02, 0x03, 0x02, 0x01, 0x02, 0x01, 0x03, 0x02, 0x03,
+  0x01, 0x02, 0x04, 0x02, 0x01, 0x01, 0x03, 0x02, 0x02, 0x00, 0x01, 0x04,
+  0x01, 0x01, 0x00, 0x01, 0x01, 0x00, 0x01, 0x01, 0x00, 0x01, 0x02, 0x00,
+  0x01, 0x05, 0x01, 0x02, 0x00, 0x02, 0x03, 0x02, 0x01, 0x02, 0x04, 0x01,
+  0x03, 0x01, 0x01, 0x03, 0x03, 0x02, 0x02, 0x01, 0x02, 0x01, 0x01, 0x02,
+  0x03, 0x01, 0x02, 0x02, 0x01, 0x03, 0x02, 0x01, 0x04, 0x01, 0x00, 0x00,
+  0x01, 0x02, 0x05, 0x02, 0x01, 0x02, 0x03, 0x02, 0x02, 0x01, 0x01, 0x05,
+  0x01, 0x02, 0x00, 0x02, 0x05, 0x02, 0x01, 0x00, 0x09, 0x01, 0x00, 0x02,
+  0x01, 0x01, 0x01, 0x02, 0x01, 0x02, 0x04, 0x01, 0x01, 0x02, 0x05, 0x01,
+  0x05, 0x02, 0x01, 0x04, 0x02, 0x01, 0x04, 0x01, 0x00, 0x00, 0x01, 0x02,
+  0x05, 0x02, 0x01, 0x02, 0x03, 0x02, 0x02, 0x01, 0x01, 0x05, 0x01, 0x02,
+  0x00, 0x02, 0x05, 0x02, 0x01, 0x00, 0x09, 0x01, 0x00, 0x02, 0x01, 0x01,
+  0x01, 0x02, 0x01, 0x02, 0x04, 0x01, 0x01, 0x02, 0x05, 0x01, 0x03, 0x03,
+  0x02, 0x02, 0x02, 0x01, 0x02, 0x02, 0x02, 0x01, 0x03, 0x01, 0x00, 0x00,
+  0x01, 0x02, 0x05, 0x02, 0x01, 0x02, 0x03, 0x02, 0x02, 0x01, 0x01, 0x05,
+  0x01, 0x02, 0x00, 0x02, 0x05, 0x02, 0x01, 0x00, 0x09, 0x01, 0x00, 0x02,
+  0x01, 0x01, 0x01, 0x02, 0x01, 0x02, 0x04, 0x01, 0x01, 0x02, 0x05, 0x02,
+  0x02, 0x02, 0x01, 0x02, 0x02, 0x02, 0x02, 0x01, 0x02, 0x00, 0x00, 0x01,
+  0x02, 0x05, 0x02, 0x01, 0x02, 0x03, 0x02, 0x02, 0x01, 0x01, 0x05, 0x01,
+  0x02, 0x00, 0x02, 0x05, 0x02, 0x01, 0x00, 0x09, 0x01, 0x00, 0x02, 0x01,
+  0x01, 0x01, 0x02, 0x01, 0x02, 0x04, 0x01, 0x01, 0x02, 0x05, 0x01, 0x02,
+  0x02, 0x01, 0x03, 0x02, 0x01, 0x04, 0x01, 0x00, 0x00, 0x01, 0x00, 0x05,
+  0x01, 0x03, 0x02, 0x01, 0x03, 0x02, 0x01, 0x03, 0x02, 0x01, 0x03, 0x02,
+  0x01, 0x03, 0x02, 0x01, 0x03, 0x02, 0x01, 0x03, 0x02, 0x01, 0x00, 0x08,
+  0x01, 0x05, 0x02, 0x01, 0x04, 0x02, 0x01, 0x04, 0x01, 0x00, 0x00, 0x01,
+  0x00, 0x05, 0x01, 0x03, 0x02, 0x01, 0x03, 0x02, 0x01, 0x03, 0x02, 0x01,
+  0x03, 0x02, 0x01, 0x03, 0x02, 0x01, 0x03, 0x02, 0x01, 0x03, 0x02, 0x01,
+  0x00, 0x08, 0x01, 0x03, 0x03, 0x02, 0x02, 0x02, 0x01, 0x02, 0x02, 0x02,
+  0x01, 0x03, 0x01, 0x00, 0x00, 0x01, 0x00, 0x05, 0x01, 0x03, 0x02, 0x01,
+  0x03, 0x02, 0x01, 0x03, 0x02, 0x01, 0x03, 0x02, 0x01, 0x03, 0x02, 0x01,
+  0x03, 0x02, 0x01, 0x03, 0x02, 0x01, 0x00, 0x08, 0x02, 0x02, 0x02, 0x01,
+  0x02, 0x02, 0x02, 0x02, 0x01, 0x02, 0x00, 0x00, 0x01, 0x00, 0x05, 0x01,
+  0x03, 0x02, 0x01, 0x03, 0x02, 0x01, 0x03, 0x02, 0x01, 0x03, 0x02, 0x01,
+  0x03, 0x02, 0x01, 0x03, 0x02, 0x01, 0x03, 0x02, 0x01, 0x00, 0x08, 0x02,
+  0x01, 0x03, 0x02, 0x01, 0x01, 0x04, 0x02, 0x02, 0x02, 0x02, 0x01, 0x02,
+  0x01, 0x06, 0x01, 0x02, 0x02, 0x04, 0x01, 0x01, 0x02, 0x01, 0x02, 0x03,
+  0x02, 0x02, 0x01, 0x01, 0x05, 0x02, 0x02, 0x00, 0x02, 0x05, 0x02, 0x02,
+  0x00, 0x02, 0x05, 0x02, 0x02, 0x00, 0x02, 0x05, 0x02, 0x02, 0x01, 0x01,
+  0x05, 0x01, 0x02, 0x01, 0x02, 0x03, 0x02, 0x01, 0x02, 0x05, 0x02, 0x01,
+  0x03, 0x01, 0x01, 0x02, 0x00, 0x01, 0x02, 0x04, 0x00, 0x00, 0x02, 0x00,
+  0x01, 0x01, 0x04, 0x02, 0x00, 0x02, 0x03, 0x02, 0x02, 0x00, 0x01, 0x05,
+  0x01, 0x02, 0x00, 0x01, 0x05, 0x01, 0x02, 0x00, 0x01, 0x05, 0x01, 0x02,
+  0x00, 0x01, 0x05, 0x01, 0x02, 0x00, 0x01, 0x05, 0x01, 0x02, 0x00, 0x01,
+  0x05, 0x01, 0x02, 0x00, 0x01, 0x05, 0x01, 0x01, 0x02, 0x02, 0x01, 0x03,
+  0x02, 0x01, 0x04, 0x01, 0x00, 0x00, 0x01, 0x02, 0x05, 0x02, 0x01, 0x02,
+  0x03, 0x02, 0x02, 0x01, 0x01, 0x05, 0x01, 0x02, 0x00, 0x02, 0x05, 0x02,
+  0x02, 0x00, 0x02, 0x05, 0x02, 0x02, 0x00, 0x02, 0x05, 0x02, 0x02, 0x01,
+  0x01, 0x05, 0x01, 0x02, 0x01, 0x02, 0x03, 0x02, 0x01, 0x02, 0x05, 0x01,
+  0x05, 0x02, 0x01, 0x04, 0x02, 0x01, 0x04, 0x01, 0x00, 0x00, 0x01, 0x02,
+  0x05, 0x02, 0x01, 0x02, 0x03, 0x02, 0x02, 0x01, 0x01, 0x05, 0x01, 0x02,
+  0x00, 0x02, 0x05, 0x02, 0x02, 0x00, 0x02, 0x05, 0x02, 0x02, 0x00, 0x02,
+  0x05, 0x02, 0x02, 0x01, 0x01, 0x05, 0x01, 0x02, 0x01, 0x02, 0x03, 0x02,
+  0x01, 0x02, 0x05, 0x01, 0x03, 0x03, 0x02, 0x02, 0x02, 0x01, 0x02, 0x02,
+  0x02, 0x01, 0x03, 0x01, 0x00, 0x00, 0x01, 0x02, 0x05, 0x02, 0x01, 0x02,
+  0x03, 0x02, 0x02, 0x01, 0x01, 0x05, 0x01, 0x02, 0x00, 0x02, 0x05, 0x02,
+  0x02, 0x00, 0x02, 0x05, 0x02, 0x02, 0x00, 0x02, 0x05, 0x02, 0x02, 0x01,
+  0x01, 0x05, 0x01, 0x02, 0x01, 0x02, 0x03, 0x02, 0x01, 0x02, 0x05, 0x02,
+  0x02, 0x03, 0x01, 0x01, 0x02, 0x01, 0x01, 0x02, 0x04, 0x00, 0x00, 0x01,
+  0x02, 0x05, 0x02, 0x01, 0x02, 0x03, 0x02, 0x02, 0x01, 0x01, 0x05, 0x01,
+  0x02, 0x00, 0x02, 0x05, 0x02, 0x02, 0x00, 0x02, 0x05, 0x02, 0x02, 0x00,
+  0x02, 0x05, 0x02, 0x02, 0x01, 0x01, 0x05, 0x01, 0x02, 0x01, 0x02, 0x03,
+  0x02, 0x01, 0x02, 0x05, 0x02, 0x02, 0x02, 0x01, 0x02, 0x02, 0x02, 0x02,
+  0x01, 0x02, 0x00, 0x00, 0x01, 0x02, 0x05, 0x02, 0x01, 0x02, 0x03, 0x02,
+  0x02, 0x01, 0x01, 0x05, 0x01, 0x02, 0x00, 0x02, 0x05, 0x02, 0x02, 0x00,
+  0x02, 0x05, 0x02, 0x02, 0x00, 0x02, 0x05, 0x02, 0x02, 0x01, 0x01, 0x05,
+  0x01, 0x02, 0x01, 0x02, 0x03, 0x02, 0x01, 0x02, 0x05, 0x01, 0x03, 0x03,
+  0x01, 0x03, 0x03, 0x00, 0x00, 0x01, 0x00, 0x09, 0x00, 0x00, 0x01, 0x03,
+  0x03, 0x01, 0x03, 0x03, 0x01, 0x07, 0x01, 0x01, 0x02, 0x07, 0x02, 0x01,
+  0x02, 0x03, 0x02, 0x02, 0x01, 0x01, 0x04, 0x02, 0x03, 0x00, 0x02, 0x03,
+  0x01, 0x01, 0x02, 0x03, 0x00, 0x02, 0x02, 0x01, 0x02, 0x02, 0x03, 0x00,
+  0x02, 0x01, 0x01, 0x03, 0x02, 0x02, 0x01, 0x02, 0x04, 0x01, 0x02, 0x01,
+  0x02, 0x03, 0x02, 0x01, 0x00, 0x07, 0x01, 0x00, 0x01, 0x01, 0x01, 0x02,
+  0x01, 0x02, 0x02, 0x01, 0x03, 0x01, 0x00, 0x00, 0x02, 0x00, 0x01, 0x05,
+  0x01, 0x02, 0x00, 0x01, 0x05, 0x01, 0x02, 0x00, 0x01, 0x05, 0x01, 0x02,
+  0x00, 0x01, 0x05, 0x01, 0x02, 0x00, 0x01, 0x05, 0x01, 0x02, 0x00, 0x01,
+  0x05, 0x01, 0x02, 0x00, 0x01, 0x05, 0x01, 0x02, 0x00, 0x02, 0x03, 0x02,
+  0x02, 0x01, 0x04, 0x01, 0x01, 0x01, 0x04, 0x02, 0x01, 0x03, 0x02, 0x01,
+  0x03, 0x01, 0x00, 0x00, 0x02, 0x00, 0x01, 0x05, 0x01, 0x02, 0x00, 0x01,
+  0x05, 0x01, 0x02, 0x00, 0x01, 0x05, 0x01, 0x02, 0x00, 0x01, 0x05, 0x01,
+  0x02, 0x00, 0x01, 0x05, 0x01, 0x02, 0x00, 0x01, 0x05, 0x01, 0x02, 0x00,
+  0x01, 0x05, 0x01, 0x02, 0x00, 0x02, 0x03, 0x02, 0x02, 0x01, 0x04, 0x01,
+  0x01, 0x01, 0x02, 0x03, 0x02, 0x01, 0x02, 0x01, 0x02, 0x02, 0x01, 0x01,
+  0x03, 0x01, 0x00, 0x00, 0x02, 0x00, 0x01, 0x05, 0x01, 0x02, 0x00, 0x01,
+  0x05, 0x01, 0x02, 0x00, 0x01, 0x05, 0x01, 0x02, 0x00, 0x01, 0x05, 0x01,
+  0x02, 0x00, 0x01, 0x05, 0x01, 0x02, 0x00, 0x01, 0x05, 0x01, 0x02, 0x00,
+  0x01, 0x05, 0x01, 0x02, 0x00, 0x02, 0x03, 0x02, 0x02, 0x01, 0x04, 0x01,
+  0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x02, 0x01, 0x02, 0x01, 0x02, 0x00,
+  0x00, 0x02, 0x00, 0x01, 0x05, 0x01, 0x02, 0x00, 0x01, 0x05, 0x01, 0x02,
+  0x00, 0x01, 0x05, 0x01, 0x02, 0x00, 0x01, 0x05, 0x01, 0x02, 0x00, 0x01,
+  0x05, 0x01, 0x02, 0x00, 0x01, 0x05, 0x01, 0x02, 0x00, 0x01, 0x05, 0x01,
+  0x02, 0x00, 0x02, 0x03, 0x02, 0x02, 0x01, 0x04, 0x01, 0x01, 0x01, 0x05,
+  0x02, 0x01, 0x04, 0x02, 0x01, 0x04, 0x01, 0x00, 0x00, 0x02, 0x00, 0x02,
+  0x05, 0x02, 0x02, 0x01, 0x01, 0x05, 0x01, 0x02, 0x01, 0x02, 0x04, 0x01,
+  0x02, 0x01, 0x02, 0x03, 0x02, 0x02, 0x02, 0x01, 0x03, 0x01, 0x02, 0x02,
+  0x02, 0x01, 0x02, 0x02, 0x03, 0x01, 0x01, 0x01, 0x01, 0x03, 0x03, 0x01,
+  0x04, 0x02, 0x01, 0x04, 0x01, 0x01, 0x03, 0x02, 0x01, 0x03, 0x01, 0x01,
+  0x01, 0x03, 0x01, 0x00, 0x01, 0x01, 0x00, 0x01, 0x01, 0x00, 0x01, 0x01,
+  0x00, 0x01, 0x02, 0x00, 0x01, 0x01, 0x04, 0x02, 0x00, 0x02, 0x03, 0x02,
+  0x02, 0x00, 0x01, 0x05, 0x02, 0x02, 0x00, 0x01, 0x05, 0x02, 0x02, 0x00,
+  0x01, 0x05, 0x02, 0x02, 0x00, 0x01, 0x05, 0x02, 0x02, 0x00, 0x01, 0x05,
+  0x02, 0x02, 0x00, 0x02, 0x03, 0x02, 0x02, 0x00, 0x01, 0x01, 0x04, 0x01,
+  0x00, 0x01, 0x01, 0x00, 0x01, 0x01, 0x00, 0x01, 0x01, 0x00, 0x01, 0x02,
+  0x02, 0x02, 0x01, 0x02, 0x02, 0x02, 0x02, 0x01, 0x02, 0x00, 0x00, 0x02,
+  0x00, 0x02, 0x05, 0x02, 0x02, 0x01, 0x01, 0x05, 0x01, 0x02, 0x01, 0x02,
+  0x04, 0x01, 0x02, 0x01, 0x02, 0x03, 0x02, 0x02, 0x02, 0x01, 0x03, 0x01,
+  0x02, 0x02, 0x02, 0x01, 0x02, 0x02, 0x03, 0x01, 0x01, 0x01, 0x01, 0x03,
+  0x03, 0x01, 0x04, 0x02, 0x01, 0x04, 0x01, 0x01, 0x03, 0x02, 0x01, 0x03,
+  0x01, 0x01, 0x01, 0x03 };
+
+const uint32_t IBMPlexMono_Regular9pt8bSpanOffsets[] PROGMEM = {
+      0,     1,    36,    61,   126,   205,   278,   339,
+    354,   402,   450,   487,   514,   529,   532,   538,
+    586,   651,   694,   737,   784,   837,   884,   937,
+    980,  1039,  1092,  1109,  1135,  1165,  1174,  1204,
+   1245,  1320,  1379,  1438,  1485,  1546,  1585,  1624,
+   1679,  1742,  1781,  1824,  1887,  1926,  2005,  2084,
+   2145,  2194,  2264,  2325,  2372,  2411,  2474,  2535,
+   2620,  2679,  2730,  2769,  2817,  2865,  2913,  2946,
+   2949,  2958,  2995,  3052,  3087,  3144,  3179,  3218,
+   3274,  3331,  3366,  3413,  3468,  3507,  3570,  3615,
+   3656,  3713,  3770,  3799,  3830,  3869,  3914,  3957,
+   4022,  4063,  4116,  4143,  4191,  4239,  4287,  4297,
+   4363,  4429,  4495,  4561,  4627,  4693,  4759,  4825,
+   4891,  4957,  5023,  5089,  5155,  5221,  5287,  5353,
+   5419,  5485,  5551,  5617,  5683,  5749,  5815,  5881,
+   5947,  6013,  6079,  6145,  6211,  6277,  6343,  6409,
+   6475,  6476,  6508,  6567,  6610,  6676,  6729,  6771,
+   6831,  6841,  6913,  6942,  6982,  6994,  6997,  7036,
+   7039,  7065,  7096,  7119,  7144,  7153,  7210,  7288,
+   7294,  7303,  7326,  7357,  7397,  7466,  7533,  7604,
+   7640,  7709,  7778,  7851,  7922,  7992,  8068,  8129,
+   8190,  8239,  8288,  8341,  8391,  8440,  8489,  8542,
+   8592,  8653,  8744,  8815,  8886,  8961,  9034,  9106,
+   9142,  9219,  9292,  9365,  9442,  9516,  9577,  9626,
+   9693,  9741,  9789,  9841,  9890,  9939,  9993, 10044,
+  10093, 10139, 10185, 10235, 10282, 10320, 10358, 10400,
+  10439, 10498, 10555, 10607, 10659, 10715, 10768, 10821,
+  10840, 10893, 10949, 11005, 11065, 11122, 11186, 11255 };
+
+const GFXspans IBMPlexMono_Regular9pt8bSpans PROGMEM = {
+  IBMPlexMono_Regular9pt8bSpanData,
+  IBMPlexMono_Regular9pt8bSpanOffsets };
+
 // Approx. 4504 bytes
+// Spans: approx. 12224 bytes
 
 
 #endif /* IBMPLEXMONOREGULAR9PT8B_H_ */
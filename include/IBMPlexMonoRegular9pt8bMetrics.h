@@ -0,0 +1,55 @@
+// Generated by fonts/build.py from manifest.txt, inputs 0251ac1e9e54245c
+#ifndef IBMPLEXMONOREGULAR9PT8BMETRICS_H_
+#define IBMPLEXMONOREGULAR9PT8BMETRICS_H_
+
+#include "fontdata.h"
+
+constexpr uint8_t IBMPlexMono_Regular9pt8bAdvances[] = {
+  0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B,
+  0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B,
+  0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B,
+  0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B,
+  0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B,
+  0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B,
+  0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B,
+  0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B,
+  0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B,
+  0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B,
+  0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B,
+  0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B,
+  0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B,
+  0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B,
+  0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B,
+  0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B,
+  0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B,
+  0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B,
+  0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B };
+
+constexpr int8_t IBMPlexMono_Regular9pt8bInkRights[] = {
+     1,    7,    8,   11,   10,   11,   10,    6,    9,    7,   10,   10,
+     7,    8,    7,    9,   10,   10,   10,    9,   10,   10,   10,   10,
+    10,   10,    7,    7,    9,   10,    9,    9,   10,   10,   10,   10,
+    10,    9,   10,    9,    9,    9,    9,   11,   10,   10,   10,   10,
+    10,   10,   10,   10,   10,    9,   10,   10,   10,   11,   10,    9,
+     9,    7,   10,   10,    6,   10,   10,    9,    9,   10,   10,   10,
+     9,   10,    8,   10,    9,   10,    9,   10,   10,    9,   10,   10,
+    10,    9,   10,   10,   10,   10,    9,    9,    6,    9,   10,   10,
+    10,   10,   10,   10,   10,   10,   10,   10,   10,   10,   10,   10,
+    10,   10,   10,   10,   10,   10,   10,   10,   10,   10,   10,   10,
+    10,   10,   10,   10,   10,   10,   10,   10,    1,    7,    9,   10,
+    10,   11,    6,   10,    8,   11,    8,    9,   10,    8,    9,    8,
+     9,   10,    8,    8,    8,    9,    9,    7,    8,    8,    8,   10,
+    11,   11,   11,   10,   10,   10,   10,   10,   10,   10,   10,   10,
+     9,    9,    9,    9,    9,    9,    9,    9,   10,   10,   10,   10,
+    10,   10,   10,    9,   10,    9,    9,    9,    9,   11,   10,   10,
+    10,   10,   10,   10,   10,   10,   11,    9,   10,   10,   10,   10,
+    10,   10,   10,   10,   10,    9,   10,   10,   10,   10,   10,   10,
+    10,    9,    9,    9,    9,   10,   10,   10 };
+
+constexpr GFXmetrics IBMPlexMono_Regular9pt8bMetrics = {
+  0x20, 0xFF,
+  IBMPlexMono_Regular9pt8bAdvances,
+  IBMPlexMono_Regular9pt8bInkRights,
+  23, 17, 5, 11, true };
+
+#endif /* IBMPLEXMONOREGULAR9PT8BMETRICS_H_ */
@@ -1,5 +1,6 @@
-#ifndef IBMPLEXMONOSEMIBOLD32PT7B_H_
-#define IBMPLEXMONOSEMIBOLD32PT7B_H_
+// Generated by fonts/build.py from manifest.txt, inputs 68a12727a997e66b
+#ifndef IBMPLEXMONOSEMIBOLD32PT8B_H_
+#define IBMPLEXMONOSEMIBOLD32PT8B_H_
 
 #include <Arduino.h>
 #include <M5Stack.h>
@@ -2229,4 +2230,4 @@ const GFXfont IBMPlexMono_SemiBold32pt8b PROGMEM = {
 // Approx. 25753 bytes
 
 
-#endif /* IBMPLEXMONOSEMIBOLD32PT7B_H_ */
+#endif /* IBMPLEXMONOSEMIBOLD32PT8B_H_ */
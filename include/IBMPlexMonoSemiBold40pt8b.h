@@ -1,3 +1,4 @@
+// Generated by fonts/build.py from manifest.txt, inputs 027256c074dc292d
 #ifndef IBMPLEXMONOSEMIBOLD40PT8B_H_
 #define IBMPLEXMONOSEMIBOLD40PT8B_H_
 
@@ -1,3 +1,4 @@
+// Generated by fonts/build.py from manifest.txt, inputs 41bc3ed7eecc1146
 #ifndef IBMPLEXSANSBOLD18PT8B_H_
 #define IBMPLEXSANSBOLD18PT8B_H_
 
@@ -0,0 +1,55 @@
+// Generated by fonts/build.py from manifest.txt, inputs 5dce611613e089ca
+#ifndef IBMPLEXSANSBOLD18PT8BMETRICS_H_
+#define IBMPLEXSANSBOLD18PT8BMETRICS_H_
+
+#include "fontdata.h"
+
+constexpr uint8_t IBMPlexSans_Bold18pt8bAdvances[] = {
+  0x08, 0x0B, 0x11, 0x16, 0x15, 0x22, 0x19, 0x09, 0x0C, 0x0C, 0x15, 0x15,
+  0x0B, 0x0E, 0x0B, 0x10, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15,
+  0x15, 0x15, 0x0C, 0x0C, 0x15, 0x15, 0x15, 0x12, 0x20, 0x18, 0x17, 0x17,
+  0x18, 0x15, 0x14, 0x19, 0x19, 0x0F, 0x14, 0x18, 0x13, 0x1D, 0x19, 0x19,
+  0x17, 0x19, 0x18, 0x16, 0x14, 0x18, 0x17, 0x22, 0x18, 0x17, 0x15, 0x0C,
+  0x10, 0x0C, 0x15, 0x13, 0x15, 0x14, 0x15, 0x12, 0x15, 0x14, 0x0D, 0x13,
+  0x15, 0x0A, 0x0A, 0x14, 0x0B, 0x1F, 0x15, 0x14, 0x15, 0x15, 0x0E, 0x12,
+  0x0D, 0x15, 0x13, 0x1D, 0x14, 0x13, 0x12, 0x0D, 0x0E, 0x0D, 0x15, 0x11,
+  0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+  0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+  0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x08, 0x0B, 0x13, 0x14,
+  0x16, 0x17, 0x0E, 0x14, 0x15, 0x1C, 0x10, 0x14, 0x15, 0x0E, 0x10, 0x15,
+  0x10, 0x15, 0x0C, 0x0C, 0x15, 0x15, 0x18, 0x0D, 0x15, 0x0C, 0x0F, 0x14,
+  0x1D, 0x1E, 0x1D, 0x11, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x22, 0x17,
+  0x15, 0x15, 0x15, 0x15, 0x0F, 0x0F, 0x0F, 0x0F, 0x19, 0x19, 0x19, 0x19,
+  0x19, 0x19, 0x19, 0x15, 0x19, 0x18, 0x18, 0x18, 0x18, 0x17, 0x17, 0x18,
+  0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x1E, 0x12, 0x14, 0x14, 0x14, 0x14,
+  0x0A, 0x0A, 0x0A, 0x0A, 0x15, 0x15, 0x14, 0x14, 0x14, 0x14, 0x14, 0x15,
+  0x14, 0x15, 0x15, 0x15, 0x15, 0x13, 0x15, 0x13 };
+
+constexpr int8_t IBMPlexSans_Bold18pt8bInkRights[] = {
+     1,    9,   15,   22,   20,   32,   25,    7,   12,   11,   20,   19,
+     9,   12,    9,   15,   20,   20,   19,   19,   20,   20,   20,   19,
+    20,   20,    9,    9,   17,   19,   17,   17,   30,   23,   22,   22,
+    22,   19,   19,   23,   23,   13,   17,   24,   18,   26,   23,   23,
+    22,   23,   22,   20,   19,   22,   22,   33,   23,   23,   20,   10,
+    16,    9,   20,   18,   13,   19,   20,   17,   19,   19,   12,   19,
+    19,    8,    8,   20,   10,   29,   19,   19,   20,   19,   13,   17,
+    12,   19,   19,   29,   19,   19,   17,   11,    9,   12,   19,   16,
+    16,   16,   16,   16,   16,   16,   16,   16,   16,   16,   16,   16,
+    16,   16,   16,   16,   16,   16,   16,   16,   16,   16,   16,   16,
+    16,   16,   16,   16,   16,   16,   16,   16,    1,    9,   18,   20,
+    22,   22,    9,   18,   17,   26,   14,   17,   19,   12,   15,   16,
+    14,   19,   11,   11,   16,   19,   22,   10,   16,   11,   14,   18,
+    28,   29,   28,   17,   23,   23,   23,   23,   23,   23,   32,   22,
+    19,   19,   19,   19,   13,   13,   14,   14,   23,   23,   23,   23,
+    23,   23,   23,   18,   23,   22,   22,   22,   22,   23,   22,   23,
+    19,   19,   19,   19,   19,   19,   29,   17,   19,   19,   19,   19,
+     8,   11,   12,   12,   19,   19,   19,   19,   19,   19,   19,   19,
+    20,   19,   19,   19,   19,   19,   20,   19 };
+
+constexpr GFXmetrics IBMPlexSans_Bold18pt8bMetrics = {
+  0x20, 0xFF,
+  IBMPlexSans_Bold18pt8bAdvances,
+  IBMPlexSans_Bold18pt8bInkRights,
+  46, 34, 9, 21, true };
+
+#endif /* IBMPLEXSANSBOLD18PT8BMETRICS_H_ */
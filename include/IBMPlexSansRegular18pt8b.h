@@ -1,3 +1,4 @@
+// Generated by fonts/build.py from manifest.txt, inputs 89038ab6b0abb639
 #ifndef IBMPLEXSANSREGULAR18PT8B_H_
 #define IBMPLEXSANSREGULAR18PT8B_H_
 
@@ -0,0 +1,55 @@
+// Generated by fonts/build.py from manifest.txt, inputs fef93c2e74c2a540
+#ifndef IBMPLEXSANSREGULAR18PT8BMETRICS_H_
+#define IBMPLEXSANSREGULAR18PT8BMETRICS_H_
+
+#include "fontdata.h"
+
+constexpr uint8_t IBMPlexSans_Regular18pt8bAdvances[] = {
+  0x08, 0x0A, 0x0F, 0x19, 0x15, 0x20, 0x18, 0x08, 0x0C, 0x0C, 0x10, 0x15,
+  0x0A, 0x0E, 0x0A, 0x0D, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15,
+  0x15, 0x15, 0x0A, 0x0A, 0x15, 0x15, 0x15, 0x11, 0x1F, 0x16, 0x17, 0x16,
+  0x17, 0x14, 0x14, 0x18, 0x19, 0x0E, 0x12, 0x16, 0x12, 0x1C, 0x19, 0x19,
+  0x15, 0x19, 0x16, 0x14, 0x14, 0x18, 0x15, 0x1F, 0x15, 0x15, 0x14, 0x0B,
+  0x0D, 0x0B, 0x15, 0x14, 0x15, 0x13, 0x14, 0x12, 0x14, 0x13, 0x0B, 0x12,
+  0x14, 0x09, 0x09, 0x12, 0x0A, 0x1F, 0x14, 0x14, 0x14, 0x14, 0x0D, 0x11,
+  0x0C, 0x14, 0x11, 0x1B, 0x12, 0x11, 0x10, 0x0C, 0x0B, 0x0C, 0x15, 0x11,
+  0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+  0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+  0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x08, 0x0A, 0x12, 0x15,
+  0x15, 0x15, 0x0B, 0x15, 0x15, 0x1B, 0x0E, 0x12, 0x15, 0x0E, 0x11, 0x15,
+  0x10, 0x15, 0x0C, 0x0C, 0x15, 0x14, 0x17, 0x0B, 0x15, 0x0D, 0x0E, 0x12,
+  0x1E, 0x1F, 0x1D, 0x10, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x20, 0x16,
+  0x14, 0x14, 0x14, 0x14, 0x0E, 0x0E, 0x0E, 0x0E, 0x18, 0x19, 0x19, 0x19,
+  0x19, 0x19, 0x19, 0x15, 0x19, 0x18, 0x18, 0x18, 0x18, 0x15, 0x15, 0x16,
+  0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x1E, 0x12, 0x13, 0x13, 0x13, 0x13,
+  0x09, 0x09, 0x09, 0x09, 0x13, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x15,
+  0x14, 0x14, 0x14, 0x14, 0x14, 0x11, 0x14, 0x11 };
+
+constexpr int8_t IBMPlexSans_Regular18pt8bInkRights[] = {
+     1,    7,   11,   23,   19,   30,   23,    5,   12,    9,   15,   19,
+     7,   12,    7,   12,   19,   19,   19,   18,   19,   19,   19,   18,
+    19,   19,    7,    7,   18,   19,   18,   16,   29,   21,   21,   21,
+    21,   18,   18,   22,   22,   12,   15,   21,   17,   25,   22,   23,
+    20,   23,   20,   18,   19,   21,   20,   30,   20,   20,   19,    9,
+    13,    8,   19,   19,   12,   18,   18,   17,   17,   17,   10,   18,
+    17,    6,    6,   18,    9,   28,   17,   18,   18,   17,   12,   15,
+    11,   17,   16,   26,   17,   17,   15,   10,    7,   11,   19,   16,
+    16,   16,   16,   16,   16,   16,   16,   16,   16,   16,   16,   16,
+    16,   16,   16,   16,   16,   16,   16,   16,   16,   16,   16,   16,
+    16,   16,   16,   16,   16,   16,   16,   16,    1,    7,   17,   19,
+    21,   20,    7,   18,   15,   25,   13,   16,   19,   12,   15,   15,
+    14,   19,   11,   11,   14,   17,   20,    8,   15,   12,   12,   17,
+    29,   29,   28,   16,   21,   21,   21,   21,   21,   21,   30,   21,
+    18,   18,   18,   18,   12,   12,   13,   13,   22,   22,   23,   23,
+    23,   23,   23,   18,   23,   21,   21,   21,   21,   20,   20,   21,
+    18,   18,   18,   18,   18,   18,   28,   17,   17,   17,   17,   17,
+     6,    8,   10,    9,   17,   17,   18,   18,   18,   18,   18,   19,
+    19,   17,   17,   17,   17,   17,   18,   17 };
+
+constexpr GFXmetrics IBMPlexSans_Regular18pt8bMetrics = {
+  0x20, 0xFF,
+  IBMPlexSans_Regular18pt8bAdvances,
+  IBMPlexSans_Regular18pt8bInkRights,
+  46, 33, 10, 21, true };
+
+#endif /* IBMPLEXSANSREGULAR18PT8BMETRICS_H_ */
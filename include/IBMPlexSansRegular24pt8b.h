@@ -1,3 +1,4 @@
+// Generated by fonts/build.py from manifest.txt, inputs 63232f451ec0960d
 #ifndef IBMPLEXSANSREGULAR24PT8B_H_
 #define IBMPLEXSANSREGULAR24PT8B_H_
 
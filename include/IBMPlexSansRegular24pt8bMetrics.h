@@ -0,0 +1,55 @@
+// Generated by fonts/build.py from manifest.txt, inputs 93079cf94bc328e9
+#ifndef IBMPLEXSANSREGULAR24PT8BMETRICS_H_
+#define IBMPLEXSANSREGULAR24PT8BMETRICS_H_
+
+#include "fontdata.h"
+
+constexpr uint8_t IBMPlexSans_Regular24pt8bAdvances[] = {
+  0x0B, 0x0D, 0x14, 0x22, 0x1C, 0x2C, 0x21, 0x0B, 0x10, 0x10, 0x15, 0x1C,
+  0x0D, 0x13, 0x0D, 0x12, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C,
+  0x1C, 0x1C, 0x0E, 0x0E, 0x1C, 0x1C, 0x1C, 0x16, 0x2A, 0x1E, 0x1F, 0x1D,
+  0x20, 0x1B, 0x1A, 0x21, 0x21, 0x13, 0x18, 0x1E, 0x18, 0x26, 0x21, 0x21,
+  0x1C, 0x21, 0x1E, 0x1B, 0x1B, 0x20, 0x1D, 0x2A, 0x1D, 0x1C, 0x1B, 0x0F,
+  0x12, 0x0F, 0x1C, 0x1B, 0x1C, 0x19, 0x1B, 0x18, 0x1B, 0x1A, 0x0F, 0x19,
+  0x1B, 0x0C, 0x0C, 0x19, 0x0D, 0x29, 0x1B, 0x1A, 0x1B, 0x1B, 0x11, 0x17,
+  0x11, 0x1B, 0x17, 0x24, 0x18, 0x17, 0x16, 0x10, 0x0F, 0x10, 0x1C, 0x16,
+  0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16,
+  0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16,
+  0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x0B, 0x0D, 0x18, 0x1C,
+  0x1D, 0x1C, 0x0F, 0x1C, 0x1C, 0x24, 0x13, 0x18, 0x1C, 0x13, 0x16, 0x1C,
+  0x16, 0x1C, 0x10, 0x10, 0x1C, 0x1B, 0x1F, 0x0F, 0x1C, 0x11, 0x13, 0x18,
+  0x28, 0x29, 0x27, 0x16, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x2B, 0x1D,
+  0x1B, 0x1B, 0x1B, 0x1B, 0x13, 0x13, 0x13, 0x13, 0x20, 0x21, 0x21, 0x21,
+  0x21, 0x21, 0x21, 0x1C, 0x21, 0x20, 0x20, 0x20, 0x20, 0x1C, 0x1C, 0x1E,
+  0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x29, 0x18, 0x1A, 0x1A, 0x1A, 0x1A,
+  0x0C, 0x0C, 0x0C, 0x0C, 0x1A, 0x1B, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1C,
+  0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x17, 0x1B, 0x17 };
+
+constexpr int8_t IBMPlexSans_Regular24pt8bInkRights[] = {
+     1,    9,   15,   31,   25,   41,   32,    7,   16,   12,   19,   25,
+     9,   16,    9,   16,   25,   26,   25,   24,   26,   25,   25,   25,
+    25,   25,    9,    9,   24,   25,   24,   20,   39,   29,   28,   27,
+    29,   24,   24,   29,   29,   16,   20,   29,   22,   34,   29,   30,
+    26,   30,   28,   25,   26,   28,   28,   41,   28,   27,   25,   12,
+    17,   11,   26,   25,   16,   24,   25,   23,   23,   24,   14,   25,
+    23,    8,    8,   24,   11,   37,   23,   24,   25,   23,   16,   20,
+    15,   23,   22,   35,   23,   22,   20,   13,    9,   15,   25,   21,
+    21,   21,   21,   21,   21,   21,   21,   21,   21,   21,   21,   21,
+    21,   21,   21,   21,   21,   21,   21,   21,   21,   21,   21,   21,
+    21,   21,   21,   21,   21,   21,   21,   21,    1,    9,   22,   26,
+    28,   27,    9,   24,   21,   34,   17,   22,   25,   16,   20,   21,
+    19,   25,   14,   14,   19,   23,   27,   10,   20,   15,   17,   22,
+    39,   39,   37,   21,   29,   29,   29,   29,   29,   29,   40,   27,
+    24,   24,   24,   24,   16,   16,   17,   16,   29,   29,   30,   30,
+    30,   30,   30,   24,   30,   28,   28,   28,   28,   27,   26,   29,
+    24,   24,   24,   24,   24,   24,   39,   23,   24,   24,   24,   24,
+     8,   11,   14,   13,   24,   23,   24,   24,   24,   24,   24,   25,
+    25,   23,   23,   23,   23,   22,   25,   22 };
+
+constexpr GFXmetrics IBMPlexSans_Regular24pt8bMetrics = {
+  0x20, 0xFF,
+  IBMPlexSans_Regular24pt8bAdvances,
+  IBMPlexSans_Regular24pt8bInkRights,
+  61, 46, 13, 28, true };
+
+#endif /* IBMPLEXSANSREGULAR24PT8BMETRICS_H_ */
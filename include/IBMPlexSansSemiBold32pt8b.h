@@ -1,2107 +1,180 @@
+// Generated by fonts/build.py from manifest.txt, inputs 334b12ee526f15fd
 #ifndef IBMPLEXSANSSEMIBOLD32PT8B_H_
 #define IBMPLEXSANSSEMIBOLD32PT8B_H_
 
 #include <Arduino.h>
 #include <M5Stack.h>
 
-const uint8_t IBMPlexSans_SemiBold32pt8bBitmaps[] PROGMEM = {
-  0x00, 0x7F, 0xCF, 0xF9, 0xFF, 0x3F, 0xE7, 0xFC, 0xFF, 0x9F, 0xF3, 0xFE,
-  0x7F, 0xCF, 0xF9, 0xFF, 0x3F, 0xE7, 0xFC, 0xFF, 0x8F, 0xF1, 0xFC, 0x3F,
-  0x87, 0xF0, 0xFE, 0x1F, 0xC3, 0xF8, 0x3F, 0x07, 0xE0, 0xF8, 0x1F, 0x03,
-  0xE0, 0x7C, 0x0F, 0x81, 0xF0, 0x1E, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x0F, 0x87, 0xFC, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF,
-  0x3F, 0xE1, 0xF0, 0xFF, 0x07, 0xFF, 0xF8, 0x3F, 0xFF, 0xC1, 0xFF, 0xFE,
-  0x0F, 0xFF, 0xF0, 0x7F, 0xFF, 0x83, 0xFF, 0xFC, 0x1F, 0xFF, 0xE0, 0xFF,
-  0xFF, 0x07, 0xFF, 0xF8, 0x3F, 0xFF, 0xC1, 0xFF, 0xFE, 0x0F, 0xFF, 0xF0,
-  0x7F, 0xFF, 0x83, 0xFF, 0xFC, 0x1F, 0xFF, 0xE0, 0xFF, 0xFF, 0x07, 0xFF,
-  0xF8, 0x3F, 0xFF, 0xC1, 0xFF, 0xFE, 0x0F, 0xF0, 0x00, 0x07, 0xC0, 0x0F,
-  0xC0, 0x00, 0x0F, 0x80, 0x1F, 0x00, 0x00, 0x3F, 0x00, 0x3E, 0x00, 0x00,
-  0x7E, 0x00, 0x7C, 0x00, 0x00, 0xF8, 0x01, 0xF8, 0x00, 0x01, 0xF0, 0x03,
-  0xF0, 0x00, 0x03, 0xE0, 0x07, 0xC0, 0x00, 0x07, 0xC0, 0x0F, 0x80, 0x00,
-  0x1F, 0x80, 0x1F, 0x00, 0x00, 0x3F, 0x00, 0x3E, 0x00, 0x00, 0x7C, 0x00,
-  0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF,
-  0xFF, 0xFF, 0x00, 0x3E, 0x00, 0x7E, 0x00, 0x00, 0x7C, 0x00, 0xF8, 0x00,
-  0x00, 0xF8, 0x01, 0xF0, 0x00, 0x01, 0xF0, 0x03, 0xE0, 0x00, 0x07, 0xE0,
-  0x07, 0xC0, 0x00, 0x0F, 0xC0, 0x0F, 0x80, 0x00, 0x1F, 0x00, 0x3F, 0x00,
-  0x00, 0x3E, 0x00, 0x7E, 0x00, 0x00, 0x7C, 0x00, 0xF8, 0x00, 0x00, 0xF8,
-  0x01, 0xF0, 0x00, 0x03, 0xF0, 0x03, 0xE0, 0x00, 0x07, 0xE0, 0x07, 0xC0,
-  0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF,
-  0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xF0, 0x03, 0xF0, 0x03, 0xE0, 0x00, 0x07, 0xC0, 0x0F, 0xC0, 0x00, 0x0F,
-  0x80, 0x1F, 0x80, 0x00, 0x1F, 0x00, 0x3E, 0x00, 0x00, 0x3E, 0x00, 0x7C,
-  0x00, 0x00, 0xFC, 0x00, 0xF8, 0x00, 0x01, 0xF8, 0x03, 0xF0, 0x00, 0x03,
-  0xE0, 0x07, 0xE0, 0x00, 0x07, 0xC0, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x1F,
-  0x00, 0x00, 0x3F, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-  0x01, 0xF8, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00,
-  0x00, 0x3F, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x7F, 0xF8, 0x00,
-  0x01, 0xFF, 0xFF, 0x80, 0x01, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFE,
-  0x03, 0xFF, 0xFF, 0xFF, 0x83, 0xFF, 0xFF, 0xFF, 0xE1, 0xFF, 0x9F, 0x3F,
-  0xF1, 0xFF, 0x0F, 0x87, 0xE0, 0xFF, 0x07, 0xC1, 0xE0, 0x7F, 0x83, 0xE0,
-  0x60, 0x3F, 0x81, 0xF0, 0x00, 0x1F, 0xC0, 0xF8, 0x00, 0x0F, 0xE0, 0x7C,
-  0x00, 0x07, 0xF8, 0x3E, 0x00, 0x03, 0xFC, 0x1F, 0x00, 0x01, 0xFF, 0x0F,
-  0x80, 0x00, 0x7F, 0xE7, 0xC0, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x0F, 0xFF,
-  0xFC, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xF8, 0x00, 0x1F,
-  0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xF0, 0x00,
-  0x07, 0xFF, 0xFC, 0x00, 0x03, 0xE7, 0xFE, 0x00, 0x01, 0xF1, 0xFF, 0x00,
-  0x00, 0xF8, 0x7F, 0xC0, 0x00, 0x7C, 0x1F, 0xE0, 0x00, 0x3E, 0x0F, 0xF0,
-  0x00, 0x1F, 0x07, 0xF8, 0x00, 0x0F, 0x83, 0xFC, 0x10, 0x07, 0xC1, 0xFE,
-  0x1C, 0x03, 0xE0, 0xFF, 0x1F, 0x81, 0xF0, 0xFF, 0x3F, 0xE0, 0xF8, 0xFF,
-  0xBF, 0xFE, 0x7D, 0xFF, 0x8F, 0xFF, 0xFF, 0xFF, 0xC1, 0xFF, 0xFF, 0xFF,
-  0xC0, 0x7F, 0xFF, 0xFF, 0xC0, 0x1F, 0xFF, 0xFF, 0x80, 0x03, 0xFF, 0xFF,
-  0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0xFC,
-  0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x1F,
-  0x80, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x1F, 0xFE, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0xFE, 0x00, 0x00,
-  0x3F, 0x80, 0x07, 0xFF, 0xF8, 0x00, 0x01, 0xFC, 0x00, 0x3F, 0xFF, 0xF0,
-  0x00, 0x0F, 0xE0, 0x01, 0xFE, 0x1F, 0xE0, 0x00, 0x7F, 0x80, 0x07, 0xF0,
-  0x3F, 0x80, 0x01, 0xFC, 0x00, 0x1F, 0xC0, 0xFE, 0x00, 0x0F, 0xE0, 0x00,
-  0xFE, 0x01, 0xFC, 0x00, 0x7F, 0x80, 0x03, 0xF8, 0x07, 0xF0, 0x01, 0xFC,
-  0x00, 0x0F, 0xE0, 0x1F, 0xC0, 0x0F, 0xE0, 0x00, 0x3F, 0x80, 0x7F, 0x00,
-  0x7F, 0x80, 0x00, 0xFE, 0x01, 0xFC, 0x01, 0xFC, 0x00, 0x03, 0xF8, 0x07,
-  0xF0, 0x0F, 0xE0, 0x00, 0x0F, 0xE0, 0x1F, 0xC0, 0x7F, 0x80, 0x00, 0x3F,
-  0x80, 0x7F, 0x03, 0xFC, 0x00, 0x00, 0xFE, 0x01, 0xFC, 0x0F, 0xE0, 0x00,
-  0x01, 0xFC, 0x0F, 0xE0, 0x7F, 0x00, 0x00, 0x07, 0xF0, 0x3F, 0x83, 0xFC,
-  0x00, 0x00, 0x1F, 0xE1, 0xFE, 0x0F, 0xE0, 0x00, 0x00, 0x3F, 0xFF, 0xF0,
-  0x7F, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x83, 0xFC, 0x07, 0xF8, 0x00, 0xFF,
-  0xFE, 0x0F, 0xE0, 0x7F, 0xF8, 0x01, 0xFF, 0xE0, 0x7F, 0x07, 0xFF, 0xF0,
-  0x01, 0xFE, 0x03, 0xFC, 0x3F, 0xFF, 0xE0, 0x00, 0x00, 0x0F, 0xE0, 0xFF,
-  0xFF, 0xC0, 0x00, 0x00, 0x7F, 0x07, 0xF8, 0x7F, 0x00, 0x00, 0x03, 0xFC,
-  0x1F, 0xC0, 0xFE, 0x00, 0x00, 0x1F, 0xE0, 0xFE, 0x03, 0xF8, 0x00, 0x00,
-  0x7F, 0x03, 0xF8, 0x07, 0xE0, 0x00, 0x03, 0xF8, 0x0F, 0xE0, 0x1F, 0xC0,
-  0x00, 0x1F, 0xE0, 0x3F, 0x80, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0xFE, 0x01,
-  0xFC, 0x00, 0x03, 0xF8, 0x03, 0xF8, 0x07, 0xF0, 0x00, 0x1F, 0xE0, 0x0F,
-  0xE0, 0x1F, 0xC0, 0x00, 0x7F, 0x00, 0x3F, 0x80, 0x7F, 0x00, 0x03, 0xF8,
-  0x00, 0xFE, 0x01, 0xFC, 0x00, 0x1F, 0xE0, 0x03, 0xF8, 0x07, 0xE0, 0x00,
-  0x7F, 0x00, 0x07, 0xE0, 0x3F, 0x80, 0x03, 0xF8, 0x00, 0x1F, 0xC0, 0xFE,
-  0x00, 0x1F, 0xE0, 0x00, 0x7F, 0x87, 0xF0, 0x00, 0xFF, 0x00, 0x00, 0xFF,
-  0xFF, 0xC0, 0x03, 0xF8, 0x00, 0x03, 0xFF, 0xFE, 0x00, 0x1F, 0xC0, 0x00,
-  0x07, 0xFF, 0xF0, 0x00, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x00,
-  0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x7F,
-  0xFE, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0xFF, 0xC0,
-  0x00, 0x03, 0xFF, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xFF, 0xE0, 0x00, 0x0F,
-  0xFC, 0x3F, 0xF0, 0x00, 0x0F, 0xF0, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x0F,
-  0xF0, 0x00, 0x0F, 0xE0, 0x0F, 0xF0, 0x00, 0x0F, 0xE0, 0x07, 0xF0, 0x00,
-  0x0F, 0xE0, 0x0F, 0xF0, 0x00, 0x0F, 0xE0, 0x0F, 0xF0, 0x00, 0x0F, 0xF0,
-  0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x1F, 0xE0, 0x00, 0x07, 0xF8, 0x3F, 0xE0,
-  0x00, 0x07, 0xFC, 0x7F, 0xC0, 0x00, 0x03, 0xFE, 0xFF, 0x80, 0x00, 0x03,
-  0xFF, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xFC,
-  0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x07, 0xFE,
-  0x07, 0xFF, 0xF0, 0x07, 0xFE, 0x0F, 0xFF, 0xF8, 0x0F, 0xFE, 0x1F, 0xF7,
-  0xFC, 0x0F, 0xFE, 0x3F, 0xE7, 0xFE, 0x0F, 0xFE, 0x7F, 0xC3, 0xFF, 0x0F,
-  0xFE, 0x7F, 0x81, 0xFF, 0x8F, 0xC0, 0xFF, 0x00, 0xFF, 0x9F, 0xC0, 0xFF,
-  0x00, 0x7F, 0xDF, 0xC0, 0xFF, 0x00, 0x3F, 0xFF, 0xC0, 0xFF, 0x00, 0x1F,
-  0xFF, 0x80, 0xFF, 0x00, 0x0F, 0xFF, 0x80, 0xFF, 0x00, 0x0F, 0xFF, 0x00,
-  0xFF, 0x00, 0x07, 0xFF, 0x00, 0xFF, 0x00, 0x03, 0xFF, 0x00, 0xFF, 0x80,
-  0x03, 0xFF, 0x80, 0xFF, 0xC0, 0x0F, 0xFF, 0xC0, 0x7F, 0xF0, 0x3F, 0xFF,
-  0xE0, 0x3F, 0xFF, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0xDF, 0xF8, 0x1F,
-  0xFF, 0xFF, 0x8F, 0xFC, 0x07, 0xFF, 0xFF, 0x07, 0xFE, 0x03, 0xFF, 0xFC,
-  0x03, 0xFF, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0x00, 0x1F, 0xE0, 0x07, 0xF0, 0x01, 0xFC, 0x00, 0x7F,
-  0x00, 0x1F, 0xE0, 0x07, 0xF8, 0x00, 0xFE, 0x00, 0x3F, 0xC0, 0x07, 0xF0,
-  0x01, 0xFE, 0x00, 0x3F, 0x80, 0x0F, 0xF0, 0x01, 0xFC, 0x00, 0x3F, 0x80,
-  0x0F, 0xF0, 0x01, 0xFC, 0x00, 0x3F, 0x80, 0x0F, 0xF0, 0x01, 0xFC, 0x00,
-  0x3F, 0x80, 0x07, 0xF0, 0x00, 0xFE, 0x00, 0x3F, 0xC0, 0x07, 0xF8, 0x00,
-  0xFF, 0x00, 0x1F, 0xE0, 0x03, 0xFC, 0x00, 0x7F, 0x80, 0x0F, 0xF0, 0x01,
-  0xFE, 0x00, 0x3F, 0xC0, 0x07, 0xF8, 0x00, 0xFF, 0x00, 0x1F, 0xE0, 0x03,
-  0xFC, 0x00, 0x3F, 0x80, 0x07, 0xF0, 0x00, 0xFE, 0x00, 0x1F, 0xC0, 0x03,
-  0xFC, 0x00, 0x3F, 0x80, 0x07, 0xF0, 0x00, 0xFE, 0x00, 0x0F, 0xE0, 0x01,
-  0xFC, 0x00, 0x3F, 0xC0, 0x03, 0xF8, 0x00, 0x7F, 0x80, 0x07, 0xF0, 0x00,
-  0xFF, 0x00, 0x0F, 0xE0, 0x01, 0xFE, 0x00, 0x1F, 0xE0, 0x01, 0xFC, 0x00,
-  0x1F, 0xC0, 0x01, 0xFC, 0x00, 0x1F, 0xE0, 0xFF, 0x00, 0x07, 0xF0, 0x00,
-  0x7F, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0xFE, 0x00,
-  0x1F, 0xE0, 0x01, 0xFC, 0x00, 0x3F, 0xC0, 0x03, 0xF8, 0x00, 0x7F, 0x80,
-  0x07, 0xF0, 0x00, 0xFE, 0x00, 0x1F, 0xE0, 0x01, 0xFC, 0x00, 0x3F, 0x80,
-  0x07, 0xF8, 0x00, 0x7F, 0x00, 0x0F, 0xE0, 0x01, 0xFC, 0x00, 0x3F, 0x80,
-  0x07, 0xF8, 0x00, 0xFF, 0x00, 0x1F, 0xE0, 0x03, 0xFC, 0x00, 0x7F, 0x80,
-  0x0F, 0xF0, 0x01, 0xFE, 0x00, 0x3F, 0xC0, 0x07, 0xF8, 0x00, 0xFF, 0x00,
-  0x1F, 0xE0, 0x03, 0xFC, 0x00, 0x7F, 0x80, 0x0F, 0xE0, 0x01, 0xFC, 0x00,
-  0x3F, 0x80, 0x07, 0xF0, 0x01, 0xFE, 0x00, 0x3F, 0x80, 0x07, 0xF0, 0x00,
-  0xFE, 0x00, 0x3F, 0x80, 0x07, 0xF0, 0x01, 0xFE, 0x00, 0x3F, 0x80, 0x0F,
-  0xF0, 0x01, 0xFC, 0x00, 0x7F, 0x80, 0x0F, 0xE0, 0x03, 0xFC, 0x00, 0xFF,
-  0x00, 0x1F, 0xC0, 0x07, 0xF0, 0x01, 0xFE, 0x00, 0xFF, 0x00, 0x00, 0x00,
-  0x0F, 0xE0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00,
-  0x7F, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x03,
-  0xF8, 0x00, 0x10, 0x07, 0xF0, 0x04, 0x3C, 0x0F, 0xE0, 0x78, 0xFE, 0x1F,
-  0xC3, 0xF9, 0xFF, 0xBF, 0xBF, 0xF3, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF,
-  0xFF, 0xEF, 0xFF, 0xFF, 0xFF, 0x83, 0xFF, 0xFF, 0xF8, 0x00, 0x7F, 0xFF,
-  0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x01, 0xFF, 0xF0,
-  0x00, 0x07, 0xFF, 0xF0, 0x00, 0x0F, 0xEF, 0xE0, 0x00, 0x3F, 0x8F, 0xE0,
-  0x00, 0xFF, 0x1F, 0xE0, 0x03, 0xFC, 0x1F, 0xE0, 0x0F, 0xF0, 0x1F, 0xE0,
-  0x1F, 0xE0, 0x3F, 0xC0, 0x1F, 0x80, 0x3F, 0x00, 0x0E, 0x00, 0x38, 0x00,
-  0x0C, 0x00, 0x60, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x7F, 0x80, 0x00,
-  0x01, 0xFE, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00,
-  0x7F, 0x80, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x1F,
-  0xE0, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x07, 0xF8,
-  0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0,
-  0x01, 0xFE, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00,
-  0x7F, 0x80, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x1F,
-  0xE0, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x07, 0xF8,
-  0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x07, 0xC0, 0xFF,
-  0x07, 0xFC, 0x3F, 0xE3, 0xFF, 0x9F, 0xFC, 0x7F, 0xE3, 0xFE, 0x1F, 0xF0,
-  0x3F, 0x80, 0xFC, 0x07, 0xC0, 0x7E, 0x07, 0xE0, 0x3E, 0x03, 0xF0, 0x3F,
-  0x07, 0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0x0F, 0xF9,
-  0xFF, 0x3F, 0xEF, 0xFF, 0xFF, 0xDF, 0xF3, 0xFE, 0x7F, 0xC3, 0xE0, 0x00,
-  0x00, 0x3F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x7E, 0x00,
-  0x00, 0xFE, 0x00, 0x00, 0xFE, 0x00, 0x00, 0xFC, 0x00, 0x01, 0xFC, 0x00,
-  0x01, 0xFC, 0x00, 0x01, 0xF8, 0x00, 0x03, 0xF8, 0x00, 0x03, 0xF8, 0x00,
-  0x03, 0xF8, 0x00, 0x07, 0xF0, 0x00, 0x07, 0xF0, 0x00, 0x07, 0xF0, 0x00,
-  0x0F, 0xE0, 0x00, 0x0F, 0xE0, 0x00, 0x0F, 0xE0, 0x00, 0x0F, 0xC0, 0x00,
-  0x1F, 0xC0, 0x00, 0x1F, 0xC0, 0x00, 0x1F, 0x80, 0x00, 0x3F, 0x80, 0x00,
-  0x3F, 0x80, 0x00, 0x3F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x00,
-  0x7E, 0x00, 0x00, 0xFE, 0x00, 0x00, 0xFE, 0x00, 0x00, 0xFC, 0x00, 0x01,
-  0xFC, 0x00, 0x01, 0xFC, 0x00, 0x01, 0xFC, 0x00, 0x03, 0xF8, 0x00, 0x03,
-  0xF8, 0x00, 0x03, 0xF8, 0x00, 0x07, 0xF0, 0x00, 0x07, 0xF0, 0x00, 0x07,
-  0xF0, 0x00, 0x07, 0xE0, 0x00, 0x0F, 0xE0, 0x00, 0x0F, 0xE0, 0x00, 0x0F,
-  0xC0, 0x00, 0x1F, 0xC0, 0x00, 0x1F, 0xC0, 0x00, 0x1F, 0x80, 0x00, 0x3F,
-  0x80, 0x00, 0x3F, 0x80, 0x00, 0x3F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x7F,
-  0x00, 0x00, 0x7F, 0x00, 0x00, 0xFE, 0x00, 0x00, 0xFE, 0x00, 0x00, 0xFE,
-  0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x01, 0xFF,
-  0xFF, 0x80, 0x03, 0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF,
-  0xFF, 0xF0, 0x1F, 0xFF, 0xFF, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x3F, 0xE0,
-  0x07, 0xFC, 0x3F, 0xE0, 0x07, 0xFC, 0x7F, 0xC0, 0x03, 0xFE, 0x7F, 0xC0,
-  0x03, 0xFE, 0x7F, 0x80, 0x01, 0xFE, 0x7F, 0x80, 0x01, 0xFE, 0xFF, 0x80,
-  0x01, 0xFF, 0xFF, 0x80, 0x01, 0xFF, 0xFF, 0x80, 0x01, 0xFF, 0xFF, 0x00,
-  0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00,
-  0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00,
-  0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00,
-  0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xFF, 0x80,
-  0x01, 0xFF, 0xFF, 0x80, 0x01, 0xFF, 0xFF, 0x80, 0x01, 0xFF, 0x7F, 0x80,
-  0x01, 0xFE, 0x7F, 0x80, 0x01, 0xFE, 0x7F, 0xC0, 0x03, 0xFE, 0x7F, 0xC0,
-  0x03, 0xFE, 0x3F, 0xE0, 0x07, 0xFC, 0x3F, 0xE0, 0x07, 0xFC, 0x1F, 0xF8,
-  0x1F, 0xF8, 0x1F, 0xFF, 0xFF, 0xF8, 0x0F, 0xFF, 0xFF, 0xF0, 0x07, 0xFF,
-  0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0x80, 0x00, 0x7F,
-  0xFE, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x3F,
-  0xFF, 0x00, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x1F,
-  0xFF, 0xE0, 0x00, 0x1F, 0xFF, 0xF0, 0x00, 0x1F, 0xF7, 0xF8, 0x00, 0x1F,
-  0xF3, 0xFC, 0x00, 0x1F, 0xF1, 0xFE, 0x00, 0x0F, 0xF0, 0xFF, 0x00, 0x0F,
-  0xF0, 0x7F, 0x80, 0x0F, 0xF8, 0x3F, 0xC0, 0x0F, 0xF8, 0x1F, 0xE0, 0x07,
-  0xF8, 0x0F, 0xF0, 0x00, 0xF8, 0x07, 0xF8, 0x00, 0x38, 0x03, 0xFC, 0x00,
-  0x08, 0x01, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0x80,
-  0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x0F, 0xF0,
-  0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x01, 0xFE,
-  0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x3F,
-  0xC0, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x07,
-  0xF8, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00,
-  0xFF, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00,
-  0x1F, 0xE0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x7F, 0xFF, 0xFF, 0xFE, 0x3F,
-  0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0xFF, 0xC7,
-  0xFF, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x1F, 0xF0, 0x00,
-  0x01, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xFE, 0x00,
-  0xFF, 0xFF, 0xFE, 0x03, 0xFF, 0xFF, 0xFE, 0x0F, 0xFF, 0xFF, 0xFE, 0x1F,
-  0xF8, 0x1F, 0xFC, 0x7F, 0xC0, 0x0F, 0xFC, 0xFF, 0x00, 0x0F, 0xFB, 0xFE,
-  0x00, 0x1F, 0xF1, 0xF8, 0x00, 0x3F, 0xE0, 0x70, 0x00, 0x3F, 0xC0, 0x40,
-  0x00, 0x7F, 0x80, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00,
-  0x07, 0xFC, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00,
-  0x7F, 0xC0, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x1F,
-  0xF8, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x07, 0xFF,
-  0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x01, 0xFF, 0x80,
-  0x00, 0x07, 0xFE, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x7F, 0xE0, 0x00,
-  0x03, 0xFF, 0x80, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00,
-  0xFF, 0xC0, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x1F,
-  0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFE, 0xFF,
-  0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF,
-  0xFF, 0xFF, 0xE0, 0x00, 0x1F, 0xF8, 0x00, 0x01, 0xFF, 0xFE, 0x00, 0x0F,
-  0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0xFF, 0x07, 0xFF,
-  0xFF, 0xFF, 0x1F, 0xFC, 0x0F, 0xFE, 0x1F, 0xE0, 0x07, 0xFE, 0x1F, 0x80,
-  0x07, 0xFC, 0x0E, 0x00, 0x0F, 0xF8, 0x08, 0x00, 0x0F, 0xF8, 0x00, 0x00,
-  0x1F, 0xF0, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00,
-  0xFF, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x1F,
-  0xF0, 0x00, 0x00, 0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xF8,
-  0x00, 0x07, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0xE0,
-  0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x3F, 0xF0,
-  0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x7F, 0xC0,
-  0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x01, 0xFE, 0x00,
-  0x00, 0x03, 0xFC, 0x10, 0x00, 0x07, 0xF8, 0x70, 0x00, 0x1F, 0xF3, 0xE0,
-  0x00, 0x3F, 0xEF, 0xE0, 0x00, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0x7F, 0xF8,
-  0x1F, 0xFE, 0x7F, 0xFF, 0xFF, 0xF8, 0x7F, 0xFF, 0xFF, 0xE0, 0x7F, 0xFF,
-  0xFF, 0x80, 0x3F, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x07, 0xFE,
-  0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00,
-  0x0F, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0xF0, 0x00,
-  0x00, 0xFF, 0xFC, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x1F, 0xFF, 0xC0,
-  0x00, 0x0F, 0xEF, 0xF0, 0x00, 0x03, 0xFB, 0xFC, 0x00, 0x01, 0xFC, 0xFF,
-  0x00, 0x00, 0x7E, 0x3F, 0xC0, 0x00, 0x3F, 0x8F, 0xF0, 0x00, 0x1F, 0xC3,
-  0xFC, 0x00, 0x07, 0xF0, 0xFF, 0x00, 0x03, 0xF8, 0x3F, 0xC0, 0x01, 0xFC,
-  0x0F, 0xF0, 0x00, 0x7F, 0x03, 0xFC, 0x00, 0x3F, 0x80, 0xFF, 0x00, 0x0F,
-  0xE0, 0x3F, 0xC0, 0x07, 0xF0, 0x0F, 0xF0, 0x03, 0xF8, 0x03, 0xFC, 0x00,
-  0xFE, 0x00, 0xFF, 0x00, 0x7F, 0x00, 0x3F, 0xC0, 0x1F, 0xC0, 0x0F, 0xF0,
-  0x0F, 0xE0, 0x03, 0xFC, 0x07, 0xF0, 0x00, 0xFF, 0x01, 0xFC, 0x00, 0x3F,
-  0xC0, 0xFE, 0x00, 0x0F, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x3F, 0xC0, 0x00,
-  0x00, 0x0F, 0xF0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0x00,
-  0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x03, 0xFC,
-  0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x1F, 0xFF, 0xFF,
-  0xF8, 0x3F, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xE1, 0xFF, 0xFF, 0xFF,
-  0xC3, 0xFF, 0xFF, 0xFF, 0x87, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFE,
-  0x1F, 0xC0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00,
-  0xFE, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x07,
-  0xE0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x3F,
-  0x03, 0xF8, 0x00, 0xFE, 0x1F, 0xFE, 0x01, 0xFC, 0xFF, 0xFF, 0x03, 0xF9,
-  0xFF, 0xFF, 0x07, 0xF7, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0x1F, 0xFC,
-  0x0F, 0xFE, 0x3F, 0xE0, 0x07, 0xFE, 0x3F, 0x80, 0x07, 0xFC, 0x00, 0x00,
-  0x0F, 0xF8, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00,
-  0x3F, 0xE0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x01,
-  0xFF, 0x00, 0x00, 0x03, 0xFE, 0x08, 0x00, 0x07, 0xFC, 0x38, 0x00, 0x0F,
-  0xF1, 0xF0, 0x00, 0x3F, 0xE7, 0xF0, 0x00, 0x7F, 0xDF, 0xF0, 0x01, 0xFF,
-  0x3F, 0xFC, 0x0F, 0xFE, 0x3F, 0xFF, 0xFF, 0xF8, 0x3F, 0xFF, 0xFF, 0xE0,
-  0x3F, 0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xF0, 0x00,
-  0x03, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0x80,
-  0x00, 0x07, 0xFF, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x1F, 0xF8, 0x00,
-  0x00, 0x3F, 0xF0, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0xFF, 0xC0, 0x00,
-  0x01, 0xFF, 0x80, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00,
-  0x07, 0xFC, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00,
-  0x1F, 0xF0, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x3F, 0xE0, 0xFE, 0x00,
-  0x3F, 0xC7, 0xFF, 0xC0, 0x3F, 0xCF, 0xFF, 0xE0, 0x7F, 0x9F, 0xFF, 0xF0,
-  0x7F, 0xBF, 0xFF, 0xF8, 0x7F, 0xBF, 0xFF, 0xFC, 0x7F, 0xF8, 0x1F, 0xFC,
-  0xFF, 0xE0, 0x07, 0xFE, 0xFF, 0xC0, 0x03, 0xFE, 0xFF, 0xC0, 0x01, 0xFF,
-  0xFF, 0x80, 0x01, 0xFF, 0xFF, 0x80, 0x01, 0xFF, 0xFF, 0x80, 0x00, 0xFF,
-  0xFF, 0x80, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0xFF,
-  0x7F, 0x80, 0x00, 0xFF, 0x7F, 0x80, 0x01, 0xFF, 0x7F, 0x80, 0x01, 0xFE,
-  0x7F, 0xC0, 0x01, 0xFE, 0x3F, 0xC0, 0x03, 0xFE, 0x3F, 0xE0, 0x07, 0xFC,
-  0x1F, 0xF8, 0x1F, 0xFC, 0x0F, 0xFF, 0xFF, 0xF8, 0x07, 0xFF, 0xFF, 0xF0,
-  0x03, 0xFF, 0xFF, 0xE0, 0x01, 0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0x00,
-  0x00, 0x0F, 0xF8, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0x80, 0x01, 0xFF, 0xFE, 0x00,
-  0x07, 0xFB, 0xF8, 0x00, 0x1F, 0xEF, 0xE0, 0x00, 0xFF, 0xBF, 0x80, 0x03,
-  0xFC, 0xFE, 0x00, 0x1F, 0xF3, 0xF8, 0x00, 0x7F, 0xCF, 0xE0, 0x01, 0xFE,
-  0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x01, 0xFF, 0x00,
-  0x00, 0x07, 0xFC, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0xFF, 0x80, 0x00,
-  0x03, 0xFC, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x01,
-  0xFE, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x01, 0xFF,
-  0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0xFF, 0x80,
-  0x00, 0x03, 0xFC, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x7F, 0xC0, 0x00,
-  0x01, 0xFE, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x01,
-  0xFF, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0xFF,
-  0x80, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x7F, 0xC0,
-  0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFF,
-  0xC0, 0x07, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 0xFF, 0xF0, 0x1F, 0xFF, 0xFF,
-  0xF8, 0x3F, 0xF8, 0x1F, 0xF8, 0x3F, 0xE0, 0x07, 0xFC, 0x3F, 0xC0, 0x03,
-  0xFC, 0x7F, 0xC0, 0x03, 0xFE, 0x7F, 0x80, 0x01, 0xFE, 0x7F, 0x80, 0x01,
-  0xFE, 0x7F, 0x80, 0x01, 0xFE, 0x7F, 0x80, 0x01, 0xFE, 0x7F, 0x80, 0x01,
-  0xFC, 0x3F, 0x80, 0x01, 0xFC, 0x3F, 0xC0, 0x03, 0xFC, 0x1F, 0xC0, 0x03,
-  0xF8, 0x1F, 0xE0, 0x07, 0xF8, 0x0F, 0xF8, 0x1F, 0xF0, 0x07, 0xFF, 0xFF,
-  0xE0, 0x01, 0xFF, 0xFF, 0x80, 0x00, 0x7F, 0xFE, 0x00, 0x01, 0xFF, 0xFF,
-  0x80, 0x07, 0xFF, 0xFF, 0xE0, 0x1F, 0xFF, 0xFF, 0xF8, 0x3F, 0xF8, 0x1F,
-  0xFC, 0x3F, 0xE0, 0x07, 0xFC, 0x7F, 0xC0, 0x03, 0xFE, 0x7F, 0x80, 0x01,
-  0xFE, 0xFF, 0x80, 0x01, 0xFF, 0xFF, 0x80, 0x01, 0xFF, 0xFF, 0x80, 0x01,
-  0xFF, 0xFF, 0x80, 0x01, 0xFF, 0xFF, 0x80, 0x01, 0xFF, 0xFF, 0x80, 0x01,
-  0xFF, 0xFF, 0x80, 0x01, 0xFF, 0x7F, 0xC0, 0x03, 0xFE, 0x7F, 0xE0, 0x07,
-  0xFE, 0x3F, 0xF8, 0x1F, 0xFC, 0x3F, 0xFF, 0xFF, 0xFC, 0x1F, 0xFF, 0xFF,
-  0xF8, 0x0F, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF,
-  0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0xFF, 0xFE,
-  0x00, 0x01, 0xFF, 0xFF, 0x80, 0x07, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF,
-  0xE0, 0x1F, 0xFF, 0xFF, 0xF0, 0x3F, 0xF8, 0x1F, 0xF8, 0x3F, 0xE0, 0x07,
-  0xFC, 0x7F, 0xC0, 0x03, 0xFC, 0x7F, 0x80, 0x03, 0xFC, 0xFF, 0x80, 0x01,
-  0xFE, 0xFF, 0x80, 0x01, 0xFE, 0xFF, 0x00, 0x01, 0xFE, 0xFF, 0x00, 0x01,
-  0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xFF, 0x00, 0x01,
-  0xFF, 0xFF, 0x80, 0x01, 0xFF, 0xFF, 0x80, 0x01, 0xFF, 0xFF, 0x80, 0x03,
-  0xFF, 0x7F, 0xC0, 0x03, 0xFF, 0x7F, 0xE0, 0x07, 0xFF, 0x7F, 0xF8, 0x1F,
-  0xFE, 0x3F, 0xFF, 0xFD, 0xFE, 0x1F, 0xFF, 0xFD, 0xFE, 0x0F, 0xFF, 0xFB,
-  0xFE, 0x07, 0xFF, 0xF3, 0xFC, 0x03, 0xFF, 0xE3, 0xFC, 0x00, 0x7F, 0x07,
-  0xFC, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x0F,
-  0xF0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x7F,
-  0xC0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x03, 0xFF,
-  0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x1F, 0xF8,
-  0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x01, 0xFF, 0xC0,
-  0x00, 0x07, 0xFF, 0x80, 0x00, 0x1F, 0x0F, 0xF9, 0xFF, 0x3F, 0xEF, 0xFF,
-  0xFF, 0xDF, 0xF3, 0xFE, 0x7F, 0xC3, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x1F, 0x0F, 0xF9, 0xFF, 0x3F, 0xEF, 0xFF, 0xFF, 0xDF, 0xF3,
-  0xFE, 0x7F, 0xC3, 0xE0, 0x07, 0xC0, 0xFF, 0x87, 0xFC, 0x3F, 0xE3, 0xFF,
-  0x9F, 0xFC, 0x7F, 0xC3, 0xFE, 0x1F, 0xF0, 0x3E, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0xFF, 0x07, 0xFC,
-  0x3F, 0xE3, 0xFF, 0x9F, 0xFC, 0x7F, 0xE3, 0xFE, 0x1F, 0xF0, 0x3F, 0x80,
-  0xFC, 0x07, 0xC0, 0x7E, 0x07, 0xE0, 0x3E, 0x03, 0xF0, 0x3F, 0x07, 0xF0,
-  0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x70, 0x00, 0x00, 0x3C, 0x00,
-  0x00, 0x3F, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x1F, 0xF0, 0x00, 0x1F, 0xFC,
-  0x00, 0x0F, 0xFF, 0x00, 0x0F, 0xFF, 0x80, 0x0F, 0xFF, 0x80, 0x07, 0xFF,
-  0xC0, 0x07, 0xFF, 0xC0, 0x03, 0xFF, 0xC0, 0x03, 0xFF, 0xE0, 0x03, 0xFF,
-  0xE0, 0x01, 0xFF, 0xE0, 0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xF0, 0x00, 0x0F,
-  0xF8, 0x00, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x1F, 0xFE, 0x00,
-  0x03, 0xFF, 0xE0, 0x00, 0x3F, 0xFE, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x7F,
-  0xFC, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0x80,
-  0x00, 0xFF, 0xF0, 0x00, 0x1F, 0xFC, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x3F,
-  0xC0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x07, 0x00, 0x00,
-  0x00, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x38, 0x00, 0x00, 0x0F,
-  0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x3F, 0xE0, 0x00,
-  0x0F, 0xFE, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x7F, 0xFC, 0x00, 0x07, 0xFF,
-  0xC0, 0x00, 0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0xFF, 0xF0, 0x00,
-  0x1F, 0xFF, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x1F, 0xFE, 0x00, 0x03, 0xFF,
-  0xC0, 0x00, 0x3F, 0xF0, 0x00, 0x07, 0xFC, 0x00, 0x03, 0xFF, 0x00, 0x03,
-  0xFF, 0xC0, 0x01, 0xFF, 0xE0, 0x01, 0xFF, 0xE0, 0x01, 0xFF, 0xF0, 0x00,
-  0xFF, 0xF0, 0x00, 0xFF, 0xF8, 0x00, 0xFF, 0xF8, 0x00, 0x7F, 0xF8, 0x00,
-  0x7F, 0xFC, 0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xFE, 0x00, 0x03, 0xFE, 0x00,
-  0x00, 0xFF, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x03, 0x80,
-  0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x1F, 0xFF,
-  0x80, 0x07, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xF0, 0x1F, 0xFF, 0xFF, 0x83,
-  0xFF, 0xFF, 0xFC, 0x3F, 0xE0, 0xFF, 0xE7, 0xFC, 0x03, 0xFE, 0x7F, 0x80,
-  0x1F, 0xEF, 0xF0, 0x01, 0xFF, 0x7E, 0x00, 0x1F, 0xF0, 0xE0, 0x00, 0xFF,
-  0x02, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x1F, 0xF0, 0x00,
-  0x01, 0xFF, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x3F,
-  0xE0, 0x00, 0x0F, 0xFE, 0x00, 0x03, 0xFF, 0xC0, 0x07, 0xFF, 0xF8, 0x00,
-  0x7F, 0xFF, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x7F, 0xF8, 0x00, 0x07, 0xFE,
-  0x00, 0x00, 0x7F, 0x80, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x7F, 0x80, 0x00,
-  0x07, 0xF8, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x3F, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x0F,
-  0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0xFF, 0xC0,
-  0x00, 0x07, 0xFC, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x03, 0xF0, 0x00, 0x00,
-  0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x00,
-  0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xC0, 0x00,
-  0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0x80, 0x1F, 0xFC, 0x00,
-  0x03, 0xFE, 0x00, 0x01, 0xFF, 0x80, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0xE0,
-  0x03, 0xF8, 0x00, 0x00, 0x07, 0xF0, 0x03, 0xF8, 0x00, 0x00, 0x01, 0xFC,
-  0x01, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x1F,
-  0x81, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xE0, 0xFC, 0x00, 0xFC, 0x00, 0x03,
-  0xF0, 0xFC, 0x01, 0xFF, 0x9F, 0xC0, 0xFC, 0x7E, 0x01, 0xFF, 0xEF, 0xE0,
-  0x7E, 0x3E, 0x01, 0xFF, 0xFF, 0xF0, 0x1F, 0x3F, 0x01, 0xFF, 0xFF, 0xF8,
-  0x0F, 0x9F, 0x00, 0xFF, 0x07, 0xFC, 0x07, 0xEF, 0x80, 0x7F, 0x01, 0xFE,
-  0x03, 0xF7, 0xC0, 0x7F, 0x00, 0x7F, 0x00, 0xFF, 0xE0, 0x3F, 0x00, 0x3F,
-  0x80, 0x7F, 0xF0, 0x1F, 0x80, 0x1F, 0xC0, 0x3F, 0xF8, 0x0F, 0xC0, 0x0F,
-  0xE0, 0x1F, 0xFC, 0x0F, 0xE0, 0x07, 0xF0, 0x0F, 0xFE, 0x07, 0xF0, 0x03,
-  0xF8, 0x07, 0xFF, 0x03, 0xF8, 0x01, 0xFC, 0x03, 0xFF, 0x81, 0xFC, 0x00,
-  0xFE, 0x01, 0xFF, 0xC0, 0xFE, 0x00, 0x7F, 0x00, 0xFF, 0xE0, 0x3F, 0x00,
-  0x3F, 0x80, 0xFF, 0xF0, 0x1F, 0x80, 0x1F, 0xC0, 0x7D, 0xF8, 0x0F, 0xC0,
-  0x0F, 0xE0, 0x3E, 0x7C, 0x07, 0xF0, 0x07, 0xF0, 0x3F, 0x3E, 0x01, 0xFC,
-  0x07, 0xF8, 0x1F, 0x1F, 0x00, 0xFF, 0x07, 0xFC, 0x1F, 0x8F, 0xC0, 0x7F,
-  0xFF, 0x7F, 0xFF, 0x87, 0xE0, 0x1F, 0xFF, 0x9F, 0xFF, 0xC1, 0xF0, 0x07,
-  0xFF, 0x8F, 0xFF, 0xC0, 0xFC, 0x01, 0xFF, 0x83, 0xFF, 0x80, 0x3E, 0x00,
-  0x3F, 0x80, 0x7F, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0,
-  0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x1F,
-  0xF0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFE, 0x00, 0x00,
-  0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0x80, 0x00,
-  0x00, 0x1F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xE0, 0x00,
-  0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x03,
-  0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xFF, 0xE0,
-  0x00, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x00,
-  0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xEF, 0xF0, 0x00, 0x00, 0x0F, 0xE7,
-  0xF0, 0x00, 0x00, 0x1F, 0xE7, 0xF8, 0x00, 0x00, 0x1F, 0xE7, 0xF8, 0x00,
-  0x00, 0x1F, 0xC3, 0xF8, 0x00, 0x00, 0x3F, 0xC3, 0xFC, 0x00, 0x00, 0x3F,
-  0xC3, 0xFC, 0x00, 0x00, 0x3F, 0x83, 0xFC, 0x00, 0x00, 0x7F, 0x81, 0xFE,
-  0x00, 0x00, 0x7F, 0x81, 0xFE, 0x00, 0x00, 0x7F, 0x01, 0xFE, 0x00, 0x00,
-  0xFF, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0xFE, 0x00,
-  0xFF, 0x00, 0x01, 0xFE, 0x00, 0x7F, 0x80, 0x01, 0xFE, 0x00, 0x7F, 0x80,
-  0x01, 0xFE, 0x00, 0x7F, 0x80, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x03, 0xFF,
-  0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0xFF,
-  0xE0, 0x07, 0xFF, 0xFF, 0xFF, 0xE0, 0x07, 0xFF, 0xFF, 0xFF, 0xE0, 0x0F,
-  0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xF0, 0x00,
-  0x0F, 0xF0, 0x1F, 0xF0, 0x00, 0x0F, 0xF8, 0x1F, 0xE0, 0x00, 0x0F, 0xF8,
-  0x1F, 0xE0, 0x00, 0x07, 0xF8, 0x3F, 0xE0, 0x00, 0x07, 0xFC, 0x3F, 0xC0,
-  0x00, 0x07, 0xFC, 0x3F, 0xC0, 0x00, 0x03, 0xFC, 0x7F, 0xC0, 0x00, 0x03,
-  0xFE, 0x7F, 0x80, 0x00, 0x03, 0xFE, 0x7F, 0x80, 0x00, 0x01, 0xFE, 0xFF,
-  0x80, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xFF, 0xF8,
-  0x0F, 0xFF, 0xFF, 0xFF, 0x83, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF,
-  0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0xFF, 0xE3, 0xFE, 0x00,
-  0x1F, 0xFC, 0xFF, 0x80, 0x01, 0xFF, 0x3F, 0xE0, 0x00, 0x7F, 0xCF, 0xF8,
-  0x00, 0x0F, 0xF3, 0xFE, 0x00, 0x03, 0xFC, 0xFF, 0x80, 0x00, 0xFF, 0x3F,
-  0xE0, 0x00, 0x3F, 0xCF, 0xF8, 0x00, 0x0F, 0xF3, 0xFE, 0x00, 0x07, 0xFC,
-  0xFF, 0x80, 0x01, 0xFE, 0x3F, 0xE0, 0x01, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF,
-  0x83, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF,
-  0xFC, 0x0F, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF,
-  0xFF, 0xFF, 0x3F, 0xE0, 0x00, 0x7F, 0xCF, 0xF8, 0x00, 0x0F, 0xFB, 0xFE,
-  0x00, 0x01, 0xFE, 0xFF, 0x80, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x1F, 0xFF,
-  0xF8, 0x00, 0x07, 0xFF, 0xFE, 0x00, 0x01, 0xFF, 0xFF, 0x80, 0x00, 0x7F,
-  0xFF, 0xE0, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x07, 0xFF, 0xFE, 0x00, 0x03,
-  0xFE, 0xFF, 0x80, 0x01, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF,
-  0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF,
-  0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
-  0x03, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x01, 0xFF, 0xFF, 0xE0,
-  0x00, 0x7F, 0xFF, 0xFE, 0x00, 0x1F, 0xFF, 0xFF, 0xE0, 0x07, 0xFF, 0xFF,
-  0xFE, 0x01, 0xFF, 0xFF, 0xFF, 0xE0, 0x7F, 0xF8, 0x1F, 0xFE, 0x1F, 0xFC,
-  0x00, 0xFF, 0xC3, 0xFE, 0x00, 0x07, 0xFC, 0xFF, 0x80, 0x00, 0xFF, 0x1F,
-  0xF0, 0x00, 0x0F, 0x83, 0xFC, 0x00, 0x00, 0xC0, 0xFF, 0x80, 0x00, 0x20,
-  0x1F, 0xE0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00,
-  0x00, 0x1F, 0xF0, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x7F, 0xC0,
-  0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x3F,
-  0xE0, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00,
-  0x1F, 0xF0, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00,
-  0x00, 0x0F, 0xF8, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xE0,
-  0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x08, 0x0F,
-  0xF8, 0x00, 0x01, 0xC0, 0xFF, 0x80, 0x00, 0x7E, 0x1F, 0xF0, 0x00, 0x0F,
-  0xE1, 0xFF, 0x00, 0x03, 0xFE, 0x3F, 0xF8, 0x01, 0xFF, 0x83, 0xFF, 0xC0,
-  0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0xFF, 0x00, 0x7F,
-  0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xFC, 0x00,
-  0x01, 0xFF, 0xFE, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0xF8,
-  0x00, 0x1F, 0xFF, 0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x7F, 0xFF,
-  0xFF, 0xF8, 0x0F, 0xFF, 0xFF, 0xFF, 0x81, 0xFF, 0xFF, 0xFF, 0xF8, 0x3F,
-  0xFF, 0xFF, 0xFF, 0x87, 0xF8, 0x00, 0xFF, 0xF0, 0xFF, 0x00, 0x03, 0xFF,
-  0x1F, 0xE0, 0x00, 0x3F, 0xE3, 0xFC, 0x00, 0x03, 0xFE, 0x7F, 0x80, 0x00,
-  0x3F, 0xCF, 0xF0, 0x00, 0x07, 0xFD, 0xFE, 0x00, 0x00, 0xFF, 0xBF, 0xC0,
-  0x00, 0x0F, 0xF7, 0xF8, 0x00, 0x01, 0xFE, 0xFF, 0x00, 0x00, 0x3F, 0xFF,
-  0xE0, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x1F,
-  0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xFE, 0x00, 0x00, 0x7F, 0xFF, 0xC0, 0x00,
-  0x0F, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xE0,
-  0x00, 0x07, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x1F, 0xFF,
-  0xF0, 0x00, 0x03, 0xFD, 0xFE, 0x00, 0x00, 0x7F, 0xBF, 0xC0, 0x00, 0x1F,
-  0xF7, 0xF8, 0x00, 0x03, 0xFE, 0xFF, 0x00, 0x00, 0x7F, 0x9F, 0xE0, 0x00,
-  0x1F, 0xF3, 0xFC, 0x00, 0x07, 0xFC, 0x7F, 0x80, 0x01, 0xFF, 0x8F, 0xF0,
-  0x00, 0xFF, 0xE1, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0x07,
-  0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xE0, 0x1F, 0xFF, 0xFF, 0xF8,
-  0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xF0, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x3F, 0xE0,
-  0x00, 0x01, 0xFF, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x7F, 0xC0, 0x00,
-  0x03, 0xFE, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x07,
-  0xFC, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF9, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF,
-  0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF,
-  0xFC, 0xFF, 0xFF, 0xFF, 0xE7, 0xFC, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x01,
-  0xFF, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x03, 0xFE,
-  0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x07, 0xFC, 0x00,
-  0x00, 0x3F, 0xE0, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00,
-  0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x0F, 0xF0, 0x00,
-  0x00, 0xFF, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x0F,
-  0xF0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0xFF, 0x00,
-  0x00, 0x0F, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFC,
-  0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF,
-  0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xCF, 0xF0, 0x00, 0x00, 0xFF, 0x00, 0x00,
-  0x0F, 0xF0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0xFF,
-  0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x0F, 0xF0, 0x00,
-  0x00, 0xFF, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x0F,
-  0xF0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0xFF, 0x00,
-  0x00, 0x0F, 0xF0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00,
-  0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x0F, 0xFF,
-  0xFF, 0x00, 0x01, 0xFF, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xFF, 0xF8, 0x01,
-  0xFF, 0xFF, 0xFF, 0xE0, 0x1F, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xE0, 0x3F,
-  0xFC, 0x0F, 0xFC, 0x00, 0x3F, 0xF0, 0xFF, 0xC0, 0x00, 0xFF, 0x87, 0xFC,
-  0x00, 0x03, 0xFE, 0x7F, 0xC0, 0x00, 0x0F, 0x83, 0xFE, 0x00, 0x00, 0x70,
-  0x1F, 0xE0, 0x00, 0x01, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00,
-  0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x1F,
-  0xE0, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00,
-  0x00, 0x7F, 0xC0, 0x03, 0xFF, 0xFF, 0xFE, 0x00, 0x1F, 0xFF, 0xFF, 0xF0,
-  0x00, 0xFF, 0xFF, 0xFF, 0x80, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF,
-  0xFF, 0xE0, 0x01, 0xFF, 0xFE, 0xFF, 0x00, 0x0F, 0xFF, 0xF7, 0xF8, 0x00,
-  0x00, 0x7F, 0xBF, 0xC0, 0x00, 0x03, 0xFD, 0xFE, 0x00, 0x00, 0x1F, 0xEF,
-  0xF8, 0x00, 0x00, 0xFF, 0x3F, 0xC0, 0x00, 0x07, 0xF9, 0xFE, 0x00, 0x00,
-  0x3F, 0xCF, 0xF8, 0x00, 0x01, 0xFE, 0x3F, 0xE0, 0x00, 0x1F, 0xF1, 0xFF,
-  0x80, 0x01, 0xFF, 0x87, 0xFE, 0x00, 0x1F, 0xFC, 0x3F, 0xFC, 0x03, 0xFF,
-  0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xFB, 0xF8, 0x0F, 0xFF,
-  0xFF, 0xDF, 0xC0, 0x3F, 0xFF, 0xFC, 0xFE, 0x00, 0xFF, 0xFF, 0xC7, 0xF0,
-  0x01, 0xFF, 0xF8, 0x3F, 0x80, 0x01, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00,
-  0x1F, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x7F, 0xFF, 0x80,
-  0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x01, 0xFF, 0xFE, 0x00, 0x00, 0x3F, 0xFF,
-  0xC0, 0x00, 0x07, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x1F,
-  0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x00,
-  0x0F, 0xFF, 0xF0, 0x00, 0x01, 0xFF, 0xFE, 0x00, 0x00, 0x3F, 0xFF, 0xC0,
-  0x00, 0x07, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x1F, 0xFF,
-  0xE0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0,
-  0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x0F, 0xFF,
-  0xF0, 0x00, 0x01, 0xFF, 0xFE, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x07,
-  0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x1F, 0xFF, 0xE0, 0x00,
-  0x03, 0xFF, 0xFC, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0xF0,
-  0x00, 0x01, 0xFF, 0xFE, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x07, 0xFF,
-  0xF8, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x03,
-  0xFF, 0xFC, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x0F, 0xF0, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xF0, 0x3F, 0xE0, 0x03, 0xFE, 0x00, 0x3F, 0xE0, 0x03,
-  0xFE, 0x00, 0x3F, 0xE0, 0x03, 0xFE, 0x00, 0x3F, 0xE0, 0x03, 0xFE, 0x00,
-  0x3F, 0xE0, 0x03, 0xFE, 0x00, 0x3F, 0xE0, 0x03, 0xFE, 0x00, 0x3F, 0xE0,
-  0x03, 0xFE, 0x00, 0x3F, 0xE0, 0x03, 0xFE, 0x00, 0x3F, 0xE0, 0x03, 0xFE,
-  0x00, 0x3F, 0xE0, 0x03, 0xFE, 0x00, 0x3F, 0xE0, 0x03, 0xFE, 0x00, 0x3F,
-  0xE0, 0x03, 0xFE, 0x00, 0x3F, 0xE0, 0x03, 0xFE, 0x00, 0x3F, 0xE0, 0x03,
-  0xFE, 0x00, 0x3F, 0xE0, 0x03, 0xFE, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0x03, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xF0, 0x3F,
-  0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0x03, 0xFF, 0xFF,
-  0xF0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0xFF, 0x00,
-  0x00, 0x0F, 0xF0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00,
-  0xFF, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x0F, 0xF0,
-  0x00, 0x00, 0xFF, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0xFF, 0x00, 0x00,
-  0x0F, 0xF0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0xFF,
-  0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x0F, 0xF0, 0x00,
-  0x00, 0xFF, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x0F,
-  0xF0, 0x00, 0x00, 0xFF, 0x03, 0x00, 0x0F, 0xF7, 0xF8, 0x00, 0xFF, 0xFF,
-  0x80, 0x0F, 0xF7, 0xF8, 0x01, 0xFF, 0x7F, 0xC0, 0x3F, 0xF3, 0xFF, 0x07,
-  0xFE, 0x3F, 0xFF, 0xFF, 0xE1, 0xFF, 0xFF, 0xFC, 0x1F, 0xFF, 0xFF, 0x80,
-  0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xFE, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x3F,
-  0xE0, 0x00, 0xFF, 0x80, 0x00, 0x3F, 0xF7, 0xFC, 0x00, 0x03, 0xFE, 0x3F,
-  0xE0, 0x00, 0x3F, 0xF1, 0xFF, 0x00, 0x03, 0xFF, 0x0F, 0xF8, 0x00, 0x3F,
-  0xF0, 0x7F, 0xC0, 0x01, 0xFF, 0x03, 0xFE, 0x00, 0x1F, 0xF0, 0x1F, 0xF0,
-  0x01, 0xFF, 0x00, 0xFF, 0x80, 0x1F, 0xF8, 0x07, 0xFC, 0x01, 0xFF, 0x80,
-  0x3F, 0xE0, 0x0F, 0xF8, 0x01, 0xFF, 0x00, 0xFF, 0x80, 0x0F, 0xF8, 0x0F,
-  0xF8, 0x00, 0x7F, 0xC0, 0xFF, 0x80, 0x03, 0xFE, 0x0F, 0xFC, 0x00, 0x1F,
-  0xF0, 0x7F, 0xC0, 0x00, 0xFF, 0x87, 0xFC, 0x00, 0x07, 0xFC, 0x7F, 0xC0,
-  0x00, 0x3F, 0xE7, 0xFC, 0x00, 0x01, 0xFF, 0x3F, 0xF0, 0x00, 0x0F, 0xFB,
-  0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xF8, 0x00,
-  0x1F, 0xFF, 0xFF, 0xE0, 0x00, 0xFF, 0xFD, 0xFF, 0x00, 0x07, 0xFF, 0xCF,
-  0xFC, 0x00, 0x3F, 0xFC, 0x3F, 0xF0, 0x01, 0xFF, 0xE0, 0xFF, 0x80, 0x0F,
-  0xFE, 0x07, 0xFE, 0x00, 0x7F, 0xE0, 0x1F, 0xF8, 0x03, 0xFE, 0x00, 0x7F,
-  0xC0, 0x1F, 0xF0, 0x03, 0xFF, 0x00, 0xFF, 0x80, 0x0F, 0xF8, 0x07, 0xFC,
-  0x00, 0x7F, 0xE0, 0x3F, 0xE0, 0x01, 0xFF, 0x81, 0xFF, 0x00, 0x07, 0xFC,
-  0x0F, 0xF8, 0x00, 0x3F, 0xF0, 0x7F, 0xC0, 0x00, 0xFF, 0xC3, 0xFE, 0x00,
-  0x03, 0xFE, 0x1F, 0xF0, 0x00, 0x1F, 0xF8, 0xFF, 0x80, 0x00, 0x7F, 0xE7,
-  0xFC, 0x00, 0x03, 0xFF, 0x3F, 0xE0, 0x00, 0x0F, 0xFD, 0xFF, 0x00, 0x00,
-  0x3F, 0xF0, 0xFF, 0x80, 0x00, 0x3F, 0xE0, 0x00, 0x0F, 0xF8, 0x00, 0x03,
-  0xFE, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x3F, 0xE0, 0x00, 0x0F, 0xF8, 0x00,
-  0x03, 0xFE, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x3F, 0xE0, 0x00, 0x0F, 0xF8,
-  0x00, 0x03, 0xFE, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x3F, 0xE0, 0x00, 0x0F,
-  0xF8, 0x00, 0x03, 0xFE, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x3F, 0xE0, 0x00,
-  0x0F, 0xF8, 0x00, 0x03, 0xFE, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x3F, 0xE0,
-  0x00, 0x0F, 0xF8, 0x00, 0x03, 0xFE, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x3F,
-  0xE0, 0x00, 0x0F, 0xF8, 0x00, 0x03, 0xFE, 0x00, 0x00, 0xFF, 0x80, 0x00,
-  0x3F, 0xE0, 0x00, 0x0F, 0xF8, 0x00, 0x03, 0xFE, 0x00, 0x00, 0xFF, 0x80,
-  0x00, 0x3F, 0xE0, 0x00, 0x0F, 0xF8, 0x00, 0x03, 0xFE, 0x00, 0x00, 0xFF,
-  0x80, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xFF,
-  0xF8, 0x00, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x00,
-  0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x00, 0x3F, 0xFF, 0xFF, 0xE0, 0x00, 0x1F,
-  0xFF, 0xFF, 0xF0, 0x00, 0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xFF,
-  0xFE, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x80, 0x07, 0xFF, 0xFF, 0xFF, 0xC0,
-  0x07, 0xFF, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFB, 0xF8, 0x03, 0xFB,
-  0xFF, 0xFD, 0xFE, 0x03, 0xFD, 0xFF, 0xFE, 0x7F, 0x81, 0xFC, 0xFF, 0xFF,
-  0x3F, 0xC1, 0xFE, 0x7F, 0xFF, 0x8F, 0xF0, 0xFE, 0x3F, 0xFF, 0xC7, 0xF8,
-  0xFF, 0x1F, 0xFF, 0xE1, 0xFE, 0x7F, 0x0F, 0xFF, 0xF0, 0xFF, 0x7F, 0x87,
-  0xFF, 0xF8, 0x3F, 0xFF, 0x83, 0xFF, 0xFC, 0x1F, 0xFF, 0xC1, 0xFF, 0xFE,
-  0x07, 0xFF, 0xC0, 0xFF, 0xFF, 0x03, 0xFF, 0xE0, 0x7F, 0xFF, 0x80, 0xFF,
-  0xE0, 0x3F, 0xFF, 0xC0, 0x7F, 0xF0, 0x1F, 0xFF, 0xE0, 0x1F, 0xF0, 0x0F,
-  0xFF, 0xF0, 0x0F, 0xF8, 0x07, 0xFF, 0xF8, 0x03, 0xF8, 0x03, 0xFF, 0xFC,
-  0x00, 0xF8, 0x01, 0xFF, 0xFE, 0x00, 0x7C, 0x00, 0xFF, 0xFF, 0x00, 0x1C,
-  0x00, 0x7F, 0xFF, 0x80, 0x0E, 0x00, 0x3F, 0xFF, 0xC0, 0x02, 0x00, 0x1F,
-  0xFF, 0xE0, 0x01, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x07, 0xFF, 0xF8,
-  0x00, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0xFE, 0x00, 0x00,
-  0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x00, 0x3F,
-  0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x00, 0x0F, 0xF0, 0xFF,
-  0x80, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00, 0x7F,
-  0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xFF, 0xE0, 0x00,
-  0x3F, 0xFF, 0xFE, 0x00, 0x07, 0xFF, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xFC,
-  0x00, 0x1F, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xF8, 0x00, 0x7F, 0xFF,
-  0xFF, 0x80, 0x0F, 0xFF, 0xFF, 0xF8, 0x01, 0xFF, 0xFE, 0xFF, 0x00, 0x3F,
-  0xFF, 0xDF, 0xF0, 0x07, 0xFF, 0xF9, 0xFE, 0x00, 0xFF, 0xFF, 0x3F, 0xE0,
-  0x1F, 0xFF, 0xE3, 0xFC, 0x03, 0xFF, 0xFC, 0x7F, 0xC0, 0x7F, 0xFF, 0x87,
-  0xFC, 0x0F, 0xFF, 0xF0, 0xFF, 0x81, 0xFF, 0xFE, 0x0F, 0xF8, 0x3F, 0xFF,
-  0xC1, 0xFF, 0x07, 0xFF, 0xF8, 0x1F, 0xF0, 0xFF, 0xFF, 0x03, 0xFE, 0x1F,
-  0xFF, 0xE0, 0x3F, 0xE3, 0xFF, 0xFC, 0x03, 0xFC, 0x7F, 0xFF, 0x80, 0x7F,
-  0xCF, 0xFF, 0xF0, 0x07, 0xF9, 0xFF, 0xFE, 0x00, 0xFF, 0xBF, 0xFF, 0xC0,
-  0x0F, 0xF7, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x1F, 0xFF, 0xFF,
-  0xE0, 0x01, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x03, 0xFF,
-  0xFF, 0xF0, 0x00, 0x7F, 0xFF, 0xFE, 0x00, 0x07, 0xFF, 0xFF, 0xC0, 0x00,
-  0x7F, 0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xE0,
-  0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x01, 0xFF, 0xFF, 0x80, 0x00, 0x1F, 0xF0,
-  0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x00, 0xFF,
-  0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xFF, 0xF0, 0x00, 0x1F, 0xFF, 0xFF, 0xF0,
-  0x00, 0x7F, 0xFF, 0xFF, 0xF0, 0x01, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0xFF,
-  0x80, 0xFF, 0xF0, 0x0F, 0xFC, 0x00, 0x7F, 0xE0, 0x3F, 0xF0, 0x00, 0x7F,
-  0xE0, 0x7F, 0xC0, 0x00, 0x7F, 0xC1, 0xFF, 0x00, 0x00, 0x7F, 0xC3, 0xFE,
-  0x00, 0x00, 0xFF, 0x87, 0xF8, 0x00, 0x00, 0xFF, 0x1F, 0xF0, 0x00, 0x01,
-  0xFF, 0x3F, 0xE0, 0x00, 0x03, 0xFE, 0x7F, 0x80, 0x00, 0x03, 0xFC, 0xFF,
-  0x00, 0x00, 0x07, 0xF9, 0xFE, 0x00, 0x00, 0x0F, 0xF7, 0xFC, 0x00, 0x00,
-  0x1F, 0xEF, 0xF8, 0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x00, 0x7F, 0xFF,
-  0xE0, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0xFF, 0x80, 0x00,
-  0x03, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0xFE, 0x00, 0x00, 0x0F, 0xFB,
-  0xFC, 0x00, 0x00, 0x1F, 0xE7, 0xF8, 0x00, 0x00, 0x3F, 0xCF, 0xF0, 0x00,
-  0x00, 0x7F, 0x9F, 0xF0, 0x00, 0x01, 0xFF, 0x3F, 0xE0, 0x00, 0x03, 0xFE,
-  0x3F, 0xC0, 0x00, 0x07, 0xF8, 0x7F, 0xC0, 0x00, 0x1F, 0xF0, 0xFF, 0x80,
-  0x00, 0x3F, 0xE0, 0xFF, 0x80, 0x00, 0xFF, 0x81, 0xFF, 0x80, 0x03, 0xFF,
-  0x01, 0xFF, 0x80, 0x0F, 0xFC, 0x03, 0xFF, 0xC0, 0x7F, 0xF8, 0x03, 0xFF,
-  0xFF, 0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0xFF, 0x80, 0x03, 0xFF, 0xFF, 0xFE,
-  0x00, 0x03, 0xFF, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xFF, 0xC0, 0x00, 0x00,
-  0xFF, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
-  0x00, 0x7F, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xFF, 0xFC, 0x1F, 0xFF, 0xFF,
-  0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF,
-  0xFF, 0xF9, 0xFE, 0x00, 0x0F, 0xFE, 0xFF, 0x00, 0x01, 0xFF, 0x7F, 0x80,
-  0x00, 0x7F, 0xBF, 0xC0, 0x00, 0x3F, 0xDF, 0xE0, 0x00, 0x1F, 0xFF, 0xF0,
-  0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x03, 0xFF, 0xFE,
-  0x00, 0x01, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x7F, 0xBF,
-  0xC0, 0x00, 0x7F, 0xDF, 0xE0, 0x00, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF, 0xE7,
-  0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xFF, 0xF0,
-  0xFF, 0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xFF, 0xC0,
-  0x1F, 0xE0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00,
-  0x03, 0xFC, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00,
-  0x00, 0x7F, 0x80, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x1F, 0xE0, 0x00,
-  0x00, 0x0F, 0xF0, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x03, 0xFC, 0x00,
-  0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0x80,
-  0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x00,
-  0x01, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xFF,
-  0xE0, 0x00, 0x07, 0xFF, 0xFF, 0xF0, 0x00, 0x1F, 0xFF, 0xFF, 0xF0, 0x00,
-  0x7F, 0xFF, 0xFF, 0xF0, 0x01, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0x80,
-  0xFF, 0xF0, 0x0F, 0xFC, 0x00, 0x7F, 0xE0, 0x3F, 0xF0, 0x00, 0x7F, 0xE0,
-  0x7F, 0xC0, 0x00, 0x7F, 0xC1, 0xFF, 0x00, 0x00, 0x7F, 0xC3, 0xFE, 0x00,
-  0x00, 0xFF, 0x87, 0xF8, 0x00, 0x00, 0xFF, 0x1F, 0xF0, 0x00, 0x01, 0xFF,
-  0x3F, 0xE0, 0x00, 0x03, 0xFE, 0x7F, 0x80, 0x00, 0x03, 0xFC, 0xFF, 0x00,
-  0x00, 0x07, 0xF9, 0xFE, 0x00, 0x00, 0x0F, 0xF7, 0xFC, 0x00, 0x00, 0x1F,
-  0xEF, 0xF8, 0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x00, 0x7F, 0xFF, 0xE0,
-  0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0xFF, 0x80, 0x00, 0x03,
-  0xFF, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0xFE, 0x00, 0x00, 0x0F, 0xFB, 0xFC,
-  0x00, 0x00, 0x1F, 0xE7, 0xF8, 0x00, 0x00, 0x3F, 0xCF, 0xF0, 0x00, 0x00,
-  0x7F, 0x9F, 0xF0, 0x00, 0x01, 0xFF, 0x3F, 0xE0, 0x00, 0x03, 0xFE, 0x7F,
-  0xC0, 0x00, 0x07, 0xFC, 0x7F, 0xC0, 0x00, 0x1F, 0xF0, 0xFF, 0x80, 0x00,
-  0x3F, 0xE0, 0xFF, 0x80, 0x00, 0xFF, 0xC1, 0xFF, 0x80, 0x03, 0xFF, 0x01,
-  0xFF, 0x80, 0x0F, 0xFC, 0x03, 0xFF, 0xC0, 0x7F, 0xF8, 0x03, 0xFF, 0xFF,
-  0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0xFF, 0x80, 0x03, 0xFF, 0xFF, 0xFE, 0x00,
-  0x03, 0xFF, 0xFF, 0xF8, 0x00, 0x03, 0xFF, 0xFF, 0xE0, 0x00, 0x01, 0xFF,
-  0xFF, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00,
-  0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x01,
-  0xFE, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x00, 0x07, 0xFF, 0xF0,
-  0x00, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x00,
-  0x07, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x00,
-  0x3F, 0xFF, 0xFF, 0xF8, 0x0F, 0xFF, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xFF,
-  0xF0, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF,
-  0xFF, 0xF3, 0xFE, 0x00, 0x0F, 0xFC, 0xFF, 0x80, 0x01, 0xFF, 0x3F, 0xE0,
-  0x00, 0x3F, 0xEF, 0xF8, 0x00, 0x0F, 0xFB, 0xFE, 0x00, 0x03, 0xFE, 0xFF,
-  0x80, 0x00, 0xFF, 0xBF, 0xE0, 0x00, 0x3F, 0xEF, 0xF8, 0x00, 0x0F, 0xFB,
-  0xFE, 0x00, 0x03, 0xFE, 0xFF, 0x80, 0x00, 0xFF, 0xBF, 0xE0, 0x00, 0x7F,
-  0xCF, 0xF8, 0x00, 0x3F, 0xF3, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF,
-  0xFE, 0x3F, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0x83, 0xFF, 0xFF,
-  0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0xE0, 0x0F, 0xF8,
-  0x07, 0xFC, 0x03, 0xFE, 0x01, 0xFF, 0x00, 0xFF, 0x80, 0x3F, 0xE0, 0x3F,
-  0xE0, 0x0F, 0xF8, 0x0F, 0xF8, 0x03, 0xFE, 0x03, 0xFE, 0x00, 0x7F, 0xC0,
-  0xFF, 0x80, 0x1F, 0xF0, 0x3F, 0xE0, 0x03, 0xFE, 0x0F, 0xF8, 0x00, 0xFF,
-  0x83, 0xFE, 0x00, 0x1F, 0xF0, 0xFF, 0x80, 0x07, 0xFC, 0x3F, 0xE0, 0x00,
-  0xFF, 0x8F, 0xF8, 0x00, 0x3F, 0xE3, 0xFE, 0x00, 0x07, 0xFC, 0xFF, 0x80,
-  0x01, 0xFF, 0x3F, 0xE0, 0x00, 0x7F, 0xEF, 0xF8, 0x00, 0x0F, 0xFB, 0xFE,
-  0x00, 0x03, 0xFF, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00,
-  0x7F, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xC0,
-  0xFF, 0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 0xFF, 0xFC, 0x7F, 0xF0, 0x1F, 0xFC,
-  0x3F, 0xE0, 0x01, 0xFC, 0x3F, 0xE0, 0x00, 0x7C, 0x1F, 0xF0, 0x00, 0x1C,
-  0x0F, 0xF0, 0x00, 0x04, 0x07, 0xF8, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00,
-  0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x7F, 0xE0, 0x00,
-  0x00, 0x1F, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xFF,
-  0x00, 0x01, 0xFF, 0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0xFF, 0x00, 0x1F, 0xFF,
-  0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x07,
-  0xFF, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xE0, 0x00,
-  0x00, 0x1F, 0xF0, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x03, 0xFE, 0x00,
-  0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x82, 0x00, 0x00, 0x7F, 0xC3,
-  0x00, 0x00, 0x3F, 0xC3, 0xC0, 0x00, 0x1F, 0xE3, 0xF8, 0x00, 0x1F, 0xF3,
-  0xFE, 0x00, 0x1F, 0xFB, 0xFF, 0xE0, 0x3F, 0xF9, 0xFF, 0xFF, 0xFF, 0xFC,
-  0x7F, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xFC,
-  0x00, 0x7F, 0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xC0,
-  0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x0F,
-  0xF8, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x01,
-  0xFF, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00,
-  0x3F, 0xE0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00,
-  0x07, 0xFC, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00,
-  0x00, 0xFF, 0x80, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x3F, 0xE0, 0x00,
-  0x00, 0x1F, 0xF0, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x07, 0xFC, 0x00,
-  0x00, 0x03, 0xFE, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x80,
-  0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x1F, 0xF0,
-  0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x03, 0xFE,
-  0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x7F,
-  0xC0, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x0F,
-  0xF8, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x01,
-  0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x3F, 0xFF,
-  0xC0, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x07, 0xFF,
-  0xF8, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x01, 0xFF, 0xFE, 0x00, 0x00, 0xFF,
-  0xFF, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x1F,
-  0xFF, 0xE0, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x07, 0xFF, 0xF8, 0x00, 0x03,
-  0xFF, 0xFC, 0x00, 0x01, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00,
-  0x7F, 0xFF, 0x80, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0xE0, 0x00,
-  0x0F, 0xFF, 0xF0, 0x00, 0x07, 0xFF, 0xF8, 0x00, 0x03, 0xFF, 0xFC, 0x00,
-  0x01, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x7F, 0xFF, 0x80,
-  0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x0F, 0xFF, 0xF0,
-  0x00, 0x07, 0xFF, 0xF8, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x01, 0xFF, 0xFE,
-  0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x7F, 0xFF,
-  0xE0, 0x00, 0x3F, 0xCF, 0xF8, 0x00, 0x3F, 0xE7, 0xFE, 0x00, 0x3F, 0xF1,
-  0xFF, 0xC0, 0x7F, 0xF0, 0xFF, 0xFF, 0xFF, 0xF8, 0x3F, 0xFF, 0xFF, 0xF8,
-  0x1F, 0xFF, 0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xF8,
-  0x00, 0x1F, 0xFF, 0xF0, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0xFF, 0x80, 0x00,
-  0x03, 0xFF, 0xFE, 0x00, 0x00, 0x1F, 0xF7, 0xF8, 0x00, 0x00, 0x7F, 0x9F,
-  0xF0, 0x00, 0x01, 0xFE, 0x7F, 0xC0, 0x00, 0x0F, 0xF8, 0xFF, 0x00, 0x00,
-  0x3F, 0xC3, 0xFC, 0x00, 0x00, 0xFF, 0x0F, 0xF8, 0x00, 0x07, 0xFC, 0x1F,
-  0xE0, 0x00, 0x1F, 0xE0, 0x7F, 0x80, 0x00, 0x7F, 0x81, 0xFF, 0x00, 0x01,
-  0xFE, 0x03, 0xFC, 0x00, 0x0F, 0xF0, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x3F,
-  0xE0, 0x00, 0xFF, 0x00, 0x7F, 0x80, 0x07, 0xF8, 0x01, 0xFE, 0x00, 0x1F,
-  0xE0, 0x07, 0xFC, 0x00, 0x7F, 0x80, 0x0F, 0xF0, 0x03, 0xFC, 0x00, 0x3F,
-  0xC0, 0x0F, 0xF0, 0x00, 0xFF, 0x80, 0x3F, 0xC0, 0x01, 0xFE, 0x01, 0xFE,
-  0x00, 0x07, 0xF8, 0x07, 0xF8, 0x00, 0x1F, 0xE0, 0x1F, 0xE0, 0x00, 0x3F,
-  0xC0, 0x7F, 0x00, 0x00, 0xFF, 0x03, 0xFC, 0x00, 0x03, 0xFC, 0x0F, 0xF0,
-  0x00, 0x07, 0xF8, 0x3F, 0x80, 0x00, 0x1F, 0xE1, 0xFE, 0x00, 0x00, 0x7F,
-  0x87, 0xF8, 0x00, 0x00, 0xFE, 0x1F, 0xC0, 0x00, 0x03, 0xFC, 0x7F, 0x00,
-  0x00, 0x0F, 0xF3, 0xFC, 0x00, 0x00, 0x1F, 0xCF, 0xF0, 0x00, 0x00, 0x7F,
-  0x3F, 0x80, 0x00, 0x01, 0xFE, 0xFE, 0x00, 0x00, 0x03, 0xFF, 0xF8, 0x00,
-  0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0xFF,
-  0xFC, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00,
-  0x00, 0x1F, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0xFF,
-  0xC0, 0x00, 0xFF, 0x00, 0x01, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0x00, 0x01,
-  0xFF, 0x80, 0x00, 0xFF, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x00, 0xFF, 0x7F,
-  0x80, 0x01, 0xFF, 0xC0, 0x01, 0xFE, 0x7F, 0x80, 0x03, 0xFF, 0xC0, 0x01,
-  0xFE, 0x7F, 0x80, 0x03, 0xFF, 0xC0, 0x01, 0xFE, 0x7F, 0x80, 0x03, 0xFF,
-  0xC0, 0x01, 0xFE, 0x7F, 0xC0, 0x03, 0xFF, 0xC0, 0x01, 0xFC, 0x3F, 0xC0,
-  0x07, 0xFF, 0xE0, 0x03, 0xFC, 0x3F, 0xC0, 0x07, 0xFF, 0xE0, 0x03, 0xFC,
-  0x3F, 0xC0, 0x07, 0xFF, 0xE0, 0x03, 0xFC, 0x3F, 0xC0, 0x07, 0xE7, 0xE0,
-  0x03, 0xF8, 0x1F, 0xE0, 0x07, 0xE7, 0xF0, 0x03, 0xF8, 0x1F, 0xE0, 0x0F,
-  0xE7, 0xF0, 0x07, 0xF8, 0x1F, 0xE0, 0x0F, 0xE7, 0xF0, 0x07, 0xF8, 0x1F,
-  0xE0, 0x0F, 0xC7, 0xF0, 0x07, 0xF8, 0x0F, 0xE0, 0x0F, 0xC3, 0xF8, 0x07,
-  0xF0, 0x0F, 0xF0, 0x1F, 0xC3, 0xF8, 0x07, 0xF0, 0x0F, 0xF0, 0x1F, 0xC3,
-  0xF8, 0x0F, 0xF0, 0x0F, 0xF0, 0x1F, 0x83, 0xF8, 0x0F, 0xF0, 0x0F, 0xF0,
-  0x1F, 0x81, 0xFC, 0x0F, 0xE0, 0x07, 0xF0, 0x3F, 0x81, 0xFC, 0x0F, 0xE0,
-  0x07, 0xF8, 0x3F, 0x81, 0xFC, 0x1F, 0xE0, 0x07, 0xF8, 0x3F, 0x01, 0xFC,
-  0x1F, 0xE0, 0x07, 0xF8, 0x3F, 0x00, 0xFE, 0x1F, 0xC0, 0x03, 0xF8, 0x7F,
-  0x00, 0xFE, 0x1F, 0xC0, 0x03, 0xF8, 0x7F, 0x00, 0xFE, 0x1F, 0xC0, 0x03,
-  0xFC, 0x7E, 0x00, 0xFE, 0x3F, 0xC0, 0x03, 0xFC, 0x7E, 0x00, 0x7E, 0x3F,
-  0x80, 0x01, 0xFC, 0xFE, 0x00, 0x7F, 0x3F, 0x80, 0x01, 0xFC, 0xFE, 0x00,
-  0x7F, 0x3F, 0x80, 0x01, 0xFE, 0xFC, 0x00, 0x7F, 0x3F, 0x80, 0x01, 0xFE,
-  0xFC, 0x00, 0x3F, 0x7F, 0x00, 0x00, 0xFE, 0xFC, 0x00, 0x3F, 0xFF, 0x00,
-  0x00, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x3F,
-  0xFF, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0xFF, 0xF8,
-  0x00, 0x1F, 0xFE, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x1F, 0xFE, 0x00, 0x00,
-  0x7F, 0xF8, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x1F, 0xFE,
-  0x00, 0x00, 0x7F, 0xF0, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x3F, 0xF0, 0x00,
-  0x0F, 0xFC, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x0F, 0xFC, 0x00, 0x7F, 0xE0,
-  0x00, 0x07, 0xFC, 0x7F, 0xC0, 0x00, 0x1F, 0xF0, 0xFF, 0xC0, 0x00, 0x3F,
-  0xE0, 0xFF, 0x80, 0x00, 0xFF, 0x81, 0xFF, 0x80, 0x01, 0xFE, 0x01, 0xFF,
-  0x80, 0x07, 0xFC, 0x01, 0xFF, 0x00, 0x1F, 0xF0, 0x03, 0xFF, 0x00, 0x3F,
-  0xE0, 0x03, 0xFE, 0x00, 0xFF, 0x80, 0x03, 0xFE, 0x01, 0xFE, 0x00, 0x07,
-  0xFE, 0x07, 0xFC, 0x00, 0x07, 0xFC, 0x1F, 0xF0, 0x00, 0x07, 0xFC, 0x3F,
-  0xC0, 0x00, 0x0F, 0xF8, 0xFF, 0x80, 0x00, 0x0F, 0xF9, 0xFE, 0x00, 0x00,
-  0x1F, 0xFF, 0xF8, 0x00, 0x00, 0x1F, 0xFF, 0xF0, 0x00, 0x00, 0x1F, 0xFF,
-  0xC0, 0x00, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00,
-  0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0xFF,
-  0xE0, 0x00, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0x0F, 0xFF, 0xE0, 0x00,
-  0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x01, 0xFF,
-  0xFF, 0x80, 0x00, 0x03, 0xFC, 0xFF, 0x80, 0x00, 0x0F, 0xF8, 0xFF, 0x80,
-  0x00, 0x3F, 0xE1, 0xFF, 0x00, 0x00, 0x7F, 0x81, 0xFF, 0x00, 0x01, 0xFF,
-  0x03, 0xFF, 0x00, 0x03, 0xFC, 0x03, 0xFE, 0x00, 0x0F, 0xF8, 0x03, 0xFE,
-  0x00, 0x3F, 0xE0, 0x07, 0xFE, 0x00, 0x7F, 0x80, 0x07, 0xFC, 0x01, 0xFF,
-  0x00, 0x0F, 0xFC, 0x07, 0xFC, 0x00, 0x0F, 0xF8, 0x0F, 0xF8, 0x00, 0x0F,
-  0xF8, 0x3F, 0xE0, 0x00, 0x1F, 0xF8, 0x7F, 0xC0, 0x00, 0x1F, 0xF1, 0xFF,
-  0x00, 0x00, 0x3F, 0xF7, 0xFC, 0x00, 0x00, 0x3F, 0xF0, 0xFF, 0x80, 0x00,
-  0x07, 0xFD, 0xFF, 0x00, 0x00, 0x3F, 0xE7, 0xFC, 0x00, 0x00, 0xFF, 0x8F,
-  0xF8, 0x00, 0x07, 0xFC, 0x3F, 0xE0, 0x00, 0x1F, 0xF0, 0x7F, 0xC0, 0x00,
-  0xFF, 0x81, 0xFF, 0x80, 0x03, 0xFE, 0x03, 0xFE, 0x00, 0x1F, 0xF0, 0x0F,
-  0xFC, 0x00, 0x7F, 0xC0, 0x1F, 0xF0, 0x03, 0xFE, 0x00, 0x3F, 0xE0, 0x0F,
-  0xF0, 0x00, 0xFF, 0x80, 0x7F, 0xC0, 0x01, 0xFF, 0x01, 0xFE, 0x00, 0x07,
-  0xFC, 0x0F, 0xF8, 0x00, 0x0F, 0xF8, 0x3F, 0xC0, 0x00, 0x3F, 0xE1, 0xFF,
-  0x00, 0x00, 0x7F, 0xC7, 0xF8, 0x00, 0x01, 0xFF, 0x3F, 0xE0, 0x00, 0x03,
-  0xFE, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0xF8, 0x00, 0x00, 0x1F, 0xFF, 0xE0,
-  0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x01,
-  0xFF, 0xE0, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xFC, 0x00,
-  0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x01,
-  0xFE, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00,
-  0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x07,
-  0xF8, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00,
-  0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x1F,
-  0xE0, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00,
-  0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x7F,
-  0x80, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0x9F, 0xFF,
-  0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF,
-  0xFF, 0xFF, 0xF9, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x07, 0xFE, 0x00,
-  0x00, 0x07, 0xFE, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x03, 0xFE, 0x00,
-  0x00, 0x03, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0x00,
-  0x00, 0x01, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x80,
-  0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0x80,
-  0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x7F, 0xC0,
-  0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x7F, 0xE0,
-  0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x3F, 0xF0,
-  0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x1F, 0xF0,
-  0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x1F, 0xF8,
-  0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x07, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0x83, 0xFC, 0x1F, 0xE0, 0xFF, 0x07, 0xF8, 0x3F, 0xC1, 0xFE, 0x0F,
-  0xF0, 0x7F, 0x83, 0xFC, 0x1F, 0xE0, 0xFF, 0x07, 0xF8, 0x3F, 0xC1, 0xFE,
-  0x0F, 0xF0, 0x7F, 0x83, 0xFC, 0x1F, 0xE0, 0xFF, 0x07, 0xF8, 0x3F, 0xC1,
-  0xFE, 0x0F, 0xF0, 0x7F, 0x83, 0xFC, 0x1F, 0xE0, 0xFF, 0x07, 0xF8, 0x3F,
-  0xC1, 0xFE, 0x0F, 0xF0, 0x7F, 0x83, 0xFC, 0x1F, 0xE0, 0xFF, 0x07, 0xF8,
-  0x3F, 0xC1, 0xFE, 0x0F, 0xF0, 0x7F, 0x83, 0xFC, 0x1F, 0xE0, 0xFF, 0x07,
-  0xF8, 0x3F, 0xC1, 0xFE, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xF8, 0xFE, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x1F, 0xC0, 0x00, 0x07, 0xE0,
-  0x00, 0x03, 0xF8, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x3F,
-  0x80, 0x00, 0x1F, 0xC0, 0x00, 0x0F, 0xE0, 0x00, 0x03, 0xF8, 0x00, 0x01,
-  0xFC, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x1F, 0xC0, 0x00,
-  0x0F, 0xE0, 0x00, 0x03, 0xF0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0xFE, 0x00,
-  0x00, 0x3F, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x0F, 0xE0, 0x00, 0x03, 0xF0,
-  0x00, 0x01, 0xFC, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x1F,
-  0xC0, 0x00, 0x0F, 0xE0, 0x00, 0x03, 0xF0, 0x00, 0x01, 0xFC, 0x00, 0x00,
-  0xFE, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x0F, 0xE0, 0x00,
-  0x07, 0xF0, 0x00, 0x01, 0xF8, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x7F, 0x00,
-  0x00, 0x1F, 0x80, 0x00, 0x0F, 0xE0, 0x00, 0x07, 0xF0, 0x00, 0x01, 0xF8,
-  0x00, 0x00, 0xFE, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x0F,
-  0xE0, 0x00, 0x07, 0xF0, 0x00, 0x01, 0xF8, 0x00, 0x00, 0xFE, 0x00, 0x00,
-  0x7F, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x0F, 0xE0, 0x00, 0x07, 0xF0, 0x00,
-  0x03, 0xF8, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x3F, 0x80,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x83, 0xFC, 0x1F, 0xE0,
-  0xFF, 0x07, 0xF8, 0x3F, 0xC1, 0xFE, 0x0F, 0xF0, 0x7F, 0x83, 0xFC, 0x1F,
-  0xE0, 0xFF, 0x07, 0xF8, 0x3F, 0xC1, 0xFE, 0x0F, 0xF0, 0x7F, 0x83, 0xFC,
-  0x1F, 0xE0, 0xFF, 0x07, 0xF8, 0x3F, 0xC1, 0xFE, 0x0F, 0xF0, 0x7F, 0x83,
-  0xFC, 0x1F, 0xE0, 0xFF, 0x07, 0xF8, 0x3F, 0xC1, 0xFE, 0x0F, 0xF0, 0x7F,
-  0x83, 0xFC, 0x1F, 0xE0, 0xFF, 0x07, 0xF8, 0x3F, 0xC1, 0xFE, 0x0F, 0xF0,
-  0x7F, 0x83, 0xFC, 0x1F, 0xE0, 0xFF, 0x07, 0xF8, 0x3F, 0xC1, 0xFE, 0x0F,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x0F, 0xF0,
-  0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x1F, 0xF8,
-  0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x7F, 0xFE,
-  0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x01, 0xFE, 0x7F,
-  0x80, 0x01, 0xFE, 0x7F, 0x80, 0x03, 0xFC, 0x3F, 0xC0, 0x03, 0xF8, 0x3F,
-  0xC0, 0x07, 0xF8, 0x1F, 0xE0, 0x07, 0xF0, 0x1F, 0xE0, 0x0F, 0xF0, 0x0F,
-  0xF0, 0x1F, 0xE0, 0x0F, 0xF8, 0x1F, 0xE0, 0x07, 0xF8, 0x3F, 0xC0, 0x03,
-  0xFC, 0x3F, 0xC0, 0x03, 0xFC, 0x7F, 0x80, 0x01, 0xFE, 0x7F, 0x80, 0x01,
-  0xFE, 0xFF, 0x00, 0x00, 0xFF, 0x7E, 0x00, 0x00, 0xFE, 0x1E, 0x00, 0x00,
-  0x78, 0x04, 0x00, 0x00, 0x60, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x02, 0x00, 0x78, 0x0F, 0xC1, 0xFF, 0x07,
-  0xF8, 0x1F, 0xE0, 0x7F, 0x03, 0xFC, 0x0F, 0xE0, 0x3F, 0x80, 0xFC, 0x07,
-  0xF0, 0x1E, 0x00, 0x40, 0x00, 0x3F, 0xE0, 0x00, 0x03, 0xFF, 0xF8, 0x00,
-  0x1F, 0xFF, 0xFC, 0x00, 0x7F, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xFC, 0x07,
-  0xFF, 0xFF, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x0F, 0xC0, 0x1F, 0xF0, 0x0F,
-  0x00, 0x1F, 0xF0, 0x0C, 0x00, 0x3F, 0xE0, 0x10, 0x00, 0x3F, 0xC0, 0x00,
-  0x00, 0x7F, 0x80, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00,
-  0x03, 0xFC, 0x00, 0x3F, 0xFF, 0xF8, 0x03, 0xFF, 0xFF, 0xF0, 0x1F, 0xFF,
-  0xFF, 0xE0, 0x7F, 0xFF, 0xFF, 0xC1, 0xFF, 0xFF, 0xFF, 0x87, 0xFE, 0x00,
-  0xFF, 0x0F, 0xF0, 0x01, 0xFE, 0x3F, 0xE0, 0x03, 0xFC, 0x7F, 0x80, 0x07,
-  0xF8, 0xFF, 0x00, 0x0F, 0xF1, 0xFE, 0x00, 0x1F, 0xE3, 0xFE, 0x00, 0x7F,
-  0xC7, 0xFC, 0x01, 0xFF, 0x87, 0xFE, 0x0F, 0x7F, 0xEF, 0xFF, 0xFE, 0xFF,
-  0xDF, 0xFF, 0xF9, 0xFF, 0x9F, 0xFF, 0xF1, 0xFF, 0x1F, 0xFF, 0xC1, 0xFE,
-  0x1F, 0xFF, 0x01, 0xFC, 0x07, 0xF8, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x03,
-  0xFC, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0xFF,
-  0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x3F, 0xC0,
-  0x00, 0x00, 0xFF, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x0F, 0xF0, 0x00,
-  0x00, 0x3F, 0xC0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x03, 0xFC, 0x0F, 0xE0,
-  0x0F, 0xF1, 0xFF, 0xE0, 0x3F, 0xCF, 0xFF, 0xE0, 0xFF, 0x7F, 0xFF, 0xC3,
-  0xFD, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0xFE, 0x3F, 0xFC, 0x1F, 0xFC, 0xFF,
-  0xC0, 0x1F, 0xF3, 0xFE, 0x00, 0x3F, 0xEF, 0xF0, 0x00, 0xFF, 0xBF, 0xC0,
-  0x01, 0xFE, 0xFF, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xF0, 0x00,
-  0x3F, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x0F,
-  0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0x00, 0x03, 0xFF,
-  0xFC, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xC0, 0x01, 0xFF, 0xFF,
-  0x00, 0x07, 0xFF, 0xFC, 0x00, 0x1F, 0xEF, 0xF0, 0x00, 0xFF, 0xBF, 0xE0,
-  0x03, 0xFE, 0xFF, 0xC0, 0x1F, 0xF3, 0xFF, 0xC1, 0xFF, 0xCF, 0xFF, 0xFF,
-  0xFE, 0x3F, 0xDF, 0xFF, 0xF8, 0xFF, 0x7F, 0xFF, 0xC3, 0xFC, 0xFF, 0xFE,
-  0x0F, 0xF1, 0xFF, 0xE0, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x1F, 0xF0, 0x00,
-  0x07, 0xFF, 0xF0, 0x00, 0x7F, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0x80, 0xFF,
-  0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0xF0, 0x7F, 0xE0, 0xFF, 0xC7, 0xFC, 0x01,
-  0xFE, 0x3F, 0xC0, 0x07, 0xE3, 0xFE, 0x00, 0x3C, 0x1F, 0xE0, 0x01, 0x00,
-  0xFF, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x03, 0xFE,
-  0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x07, 0xFC, 0x00,
-  0x00, 0x3F, 0xE0, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00,
-  0x3F, 0xC0, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x7F,
-  0x80, 0x03, 0x01, 0xFE, 0x00, 0x1E, 0x0F, 0xF0, 0x01, 0xFC, 0x7F, 0xC0,
-  0x1F, 0xF1, 0xFF, 0x83, 0xFF, 0x07, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF,
-  0x00, 0xFF, 0xFF, 0xF8, 0x01, 0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xF0, 0x00,
-  0x07, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x0F, 0xF0, 0x00,
-  0x00, 0x3F, 0xC0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00,
-  0x0F, 0xF0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x03,
-  0xFC, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0xFF,
-  0x00, 0x00, 0x03, 0xFC, 0x01, 0xFC, 0x0F, 0xF0, 0x1F, 0xFE, 0x3F, 0xC1,
-  0xFF, 0xFC, 0xFF, 0x0F, 0xFF, 0xFB, 0xFC, 0x7F, 0xFF, 0xEF, 0xF1, 0xFF,
-  0xFF, 0xFF, 0xCF, 0xFE, 0x0F, 0xFF, 0x3F, 0xE0, 0x0F, 0xFD, 0xFF, 0x00,
-  0x1F, 0xF7, 0xF8, 0x00, 0x3F, 0xDF, 0xE0, 0x00, 0xFF, 0xFF, 0x80, 0x03,
-  0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0xFF,
-  0xFF, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x3F, 0xFF,
-  0xC0, 0x00, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xF0,
-  0x00, 0x3F, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0x80, 0x03, 0xFD, 0xFE, 0x00,
-  0x0F, 0xF7, 0xF8, 0x00, 0x3F, 0xDF, 0xF0, 0x01, 0xFF, 0x3F, 0xE0, 0x0F,
-  0xFC, 0xFF, 0xE0, 0xFF, 0xF1, 0xFF, 0xFF, 0xFF, 0xC7, 0xFF, 0xFE, 0xFF,
-  0x0F, 0xFF, 0xFB, 0xFC, 0x1F, 0xFF, 0xCF, 0xF0, 0x1F, 0xFC, 0x3F, 0xC0,
-  0x1F, 0xC0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x07,
-  0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x7F, 0xFF, 0xFC, 0x01, 0xFF,
-  0xFF, 0xFC, 0x07, 0xFE, 0x0F, 0xFC, 0x0F, 0xF8, 0x07, 0xF8, 0x3F, 0xE0,
-  0x07, 0xF8, 0x7F, 0x80, 0x0F, 0xF1, 0xFE, 0x00, 0x0F, 0xF3, 0xFC, 0x00,
-  0x1F, 0xE7, 0xF8, 0x00, 0x3F, 0xCF, 0xF0, 0x00, 0x7F, 0x9F, 0xE0, 0x00,
-  0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xF8, 0x00, 0x00,
-  0x0F, 0xF0, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00,
-  0x7F, 0x80, 0x00, 0x80, 0x7F, 0x80, 0x01, 0x80, 0xFF, 0x80, 0x07, 0x80,
-  0xFF, 0x80, 0x1F, 0x81, 0xFF, 0xC0, 0xFF, 0x81, 0xFF, 0xFF, 0xFF, 0x01,
-  0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xF0, 0x01, 0xFF, 0xFF, 0xC0, 0x00,
-  0xFF, 0xFE, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x1F, 0xF0, 0x07, 0xFF,
-  0x01, 0xFF, 0xF0, 0x1F, 0xFF, 0x03, 0xFF, 0xF0, 0x3F, 0xFF, 0x07, 0xF8,
-  0x00, 0x7F, 0x80, 0x07, 0xF8, 0x00, 0x7F, 0x80, 0x07, 0xF8, 0x00, 0x7F,
-  0x80, 0x07, 0xF8, 0x00, 0x7F, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0xF8, 0x00,
-  0x7F, 0x80, 0x07, 0xF8, 0x00, 0x7F, 0x80, 0x07, 0xF8, 0x00, 0x7F, 0x80,
-  0x07, 0xF8, 0x00, 0x7F, 0x80, 0x07, 0xF8, 0x00, 0x7F, 0x80, 0x07, 0xF8,
-  0x00, 0x7F, 0x80, 0x07, 0xF8, 0x00, 0x7F, 0x80, 0x07, 0xF8, 0x00, 0x7F,
-  0x80, 0x07, 0xF8, 0x00, 0x7F, 0x80, 0x07, 0xF8, 0x00, 0x7F, 0x80, 0x07,
-  0xF8, 0x00, 0x7F, 0x80, 0x07, 0xF8, 0x00, 0x7F, 0x80, 0x07, 0xF8, 0x00,
-  0x7F, 0x80, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x03,
-  0xFC, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x07,
-  0xFC, 0x00, 0x3F, 0xF7, 0xFC, 0x01, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFF,
-  0x00, 0x0F, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xFF, 0xC0, 0x1F, 0xFF, 0xFF,
-  0xE0, 0x3F, 0xF0, 0x3F, 0xF0, 0x3F, 0xC0, 0x0F, 0xF0, 0x3F, 0x80, 0x0F,
-  0xF0, 0x7F, 0x80, 0x07, 0xF0, 0x7F, 0x80, 0x07, 0xF0, 0x7F, 0x80, 0x07,
-  0xF8, 0x7F, 0x80, 0x07, 0xF0, 0x7F, 0x80, 0x07, 0xF0, 0x3F, 0xC0, 0x0F,
-  0xF0, 0x3F, 0xC0, 0x0F, 0xF0, 0x3F, 0xF0, 0x3F, 0xF0, 0x1F, 0xFF, 0xFF,
-  0xE0, 0x1F, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0x80, 0x03, 0xFF, 0xFF,
-  0x00, 0x01, 0xFF, 0xFE, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x1F, 0x00, 0x00,
-  0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00,
-  0x00, 0x7F, 0x80, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xFF,
-  0xF0, 0x3F, 0xFF, 0xFF, 0xFC, 0x1F, 0xFF, 0xFF, 0xFC, 0x07, 0xFF, 0xFF,
-  0xFE, 0x0F, 0xFF, 0xFF, 0xFF, 0x3E, 0x00, 0x01, 0xFF, 0x7C, 0x00, 0x00,
-  0xFF, 0xFC, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00,
-  0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x03, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFE, 0xFF, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF,
-  0xF0, 0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFC, 0x00, 0xFF, 0x00, 0x00,
-  0x0F, 0xF0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0xFF,
-  0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x0F, 0xF0, 0x00,
-  0x00, 0xFF, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x0F,
-  0xF0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x0F, 0xF0, 0x7F, 0x80, 0xFF, 0x1F,
-  0xFE, 0x0F, 0xF3, 0xFF, 0xF0, 0xFF, 0x7F, 0xFF, 0x8F, 0xF7, 0xFF, 0xFC,
-  0xFF, 0xFF, 0xFF, 0xCF, 0xFE, 0x07, 0xFE, 0xFF, 0xC0, 0x3F, 0xEF, 0xF8,
-  0x01, 0xFE, 0xFF, 0x00, 0x1F, 0xEF, 0xF0, 0x01, 0xFF, 0xFF, 0x00, 0x0F,
-  0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0xFF, 0xFF,
-  0x00, 0x0F, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xF0, 0x00,
-  0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0x00, 0x0F, 0xFF,
-  0xF0, 0x00, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0x00,
-  0x0F, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0xFF,
-  0xFF, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xF0,
-  0x00, 0xFF, 0xFF, 0x00, 0x0F, 0xF0, 0x3E, 0x3F, 0xBF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFE, 0xFE, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x01,
-  0xF0, 0x0F, 0xE0, 0x7F, 0xC1, 0xFF, 0x07, 0xFC, 0x1F, 0xF0, 0x7F, 0xC0,
-  0xFE, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x7F, 0xC1, 0xFF, 0x07, 0xFC, 0x1F, 0xF0, 0x7F, 0xC1, 0xFF, 0x07, 0xFC,
-  0x1F, 0xF0, 0x7F, 0xC1, 0xFF, 0x07, 0xFC, 0x1F, 0xF0, 0x7F, 0xC1, 0xFF,
-  0x07, 0xFC, 0x1F, 0xF0, 0x7F, 0xC1, 0xFF, 0x07, 0xFC, 0x1F, 0xF0, 0x7F,
-  0xC1, 0xFF, 0x07, 0xFC, 0x1F, 0xF0, 0x7F, 0xC1, 0xFF, 0x07, 0xFC, 0x1F,
-  0xF0, 0x7F, 0xC1, 0xFF, 0x07, 0xFC, 0x1F, 0xF0, 0x7F, 0xC1, 0xFF, 0x07,
-  0xFC, 0x1F, 0xF0, 0x7F, 0xC1, 0xFF, 0x07, 0xF8, 0x1F, 0xEF, 0xFF, 0xBF,
-  0xFE, 0xFF, 0xF3, 0xFF, 0xCF, 0xFE, 0x3F, 0xC0, 0xFF, 0x80, 0x00, 0x01,
-  0xFF, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x0F,
-  0xF8, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x7F,
-  0xC0, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x03, 0xFE,
-  0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x1F, 0xF0,
-  0x00, 0x00, 0x3F, 0xE0, 0x03, 0xFF, 0x7F, 0xC0, 0x0F, 0xF8, 0xFF, 0x80,
-  0x3F, 0xE1, 0xFF, 0x00, 0xFF, 0xC3, 0xFE, 0x01, 0xFF, 0x07, 0xFC, 0x07,
-  0xFC, 0x0F, 0xF8, 0x1F, 0xF0, 0x1F, 0xF0, 0x7F, 0xC0, 0x3F, 0xE1, 0xFF,
-  0x00, 0x7F, 0xC7, 0xFC, 0x00, 0xFF, 0x8F, 0xF0, 0x01, 0xFF, 0x3F, 0xC0,
-  0x03, 0xFE, 0xFF, 0x80, 0x07, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFE, 0x00,
-  0x1F, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x7F, 0xFF, 0xFC, 0x00,
-  0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0xE7, 0xFC, 0x03, 0xFF, 0x8F, 0xF8, 0x07,
-  0xFE, 0x0F, 0xF8, 0x0F, 0xF8, 0x1F, 0xF0, 0x1F, 0xF0, 0x1F, 0xF0, 0x3F,
-  0xE0, 0x3F, 0xF0, 0x7F, 0xC0, 0x3F, 0xE0, 0xFF, 0x80, 0x3F, 0xE1, 0xFF,
-  0x00, 0x7F, 0xC3, 0xFE, 0x00, 0x7F, 0xC7, 0xFC, 0x00, 0xFF, 0xCF, 0xF8,
-  0x00, 0xFF, 0x9F, 0xF0, 0x01, 0xFF, 0xBF, 0xE0, 0x01, 0xFF, 0x80, 0xFF,
-  0x0F, 0xF0, 0xFF, 0x0F, 0xF0, 0xFF, 0x0F, 0xF0, 0xFF, 0x0F, 0xF0, 0xFF,
-  0x0F, 0xF0, 0xFF, 0x0F, 0xF0, 0xFF, 0x0F, 0xF0, 0xFF, 0x0F, 0xF0, 0xFF,
-  0x0F, 0xF0, 0xFF, 0x0F, 0xF0, 0xFF, 0x0F, 0xF0, 0xFF, 0x0F, 0xF0, 0xFF,
-  0x0F, 0xF0, 0xFF, 0x0F, 0xF0, 0xFF, 0x0F, 0xF0, 0xFF, 0x0F, 0xF0, 0xFF,
-  0x0F, 0xF0, 0xFF, 0x0F, 0xF0, 0xFF, 0x0F, 0xF0, 0xFF, 0x0F, 0xF0, 0xFF,
-  0x0F, 0xFF, 0x7F, 0xF7, 0xFF, 0x3F, 0xF1, 0xFF, 0x07, 0xF0, 0x00, 0x07,
-  0xF8, 0x00, 0x7F, 0x01, 0xFE, 0x3F, 0xFC, 0x07, 0xFF, 0x83, 0xFC, 0xFF,
-  0xFC, 0x1F, 0xFF, 0x87, 0xFB, 0xFF, 0xFC, 0x7F, 0xFF, 0x8F, 0xF7, 0xFF,
-  0xFD, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0x3F, 0xF8, 0x3F,
-  0xFF, 0x83, 0xFF, 0x7F, 0xE0, 0x1F, 0xFC, 0x03, 0xFE, 0xFF, 0x80, 0x3F,
-  0xF0, 0x03, 0xFD, 0xFE, 0x00, 0x3F, 0xE0, 0x07, 0xFB, 0xFC, 0x00, 0x7F,
-  0x80, 0x0F, 0xFF, 0xF8, 0x00, 0xFF, 0x00, 0x0F, 0xFF, 0xF0, 0x01, 0xFE,
-  0x00, 0x1F, 0xFF, 0xE0, 0x03, 0xFC, 0x00, 0x3F, 0xFF, 0xC0, 0x07, 0xF8,
-  0x00, 0x7F, 0xFF, 0x80, 0x0F, 0xF0, 0x00, 0xFF, 0xFF, 0x00, 0x1F, 0xE0,
-  0x01, 0xFF, 0xFE, 0x00, 0x3F, 0xC0, 0x03, 0xFF, 0xFC, 0x00, 0x7F, 0x80,
-  0x07, 0xFF, 0xF8, 0x00, 0xFF, 0x00, 0x0F, 0xFF, 0xF0, 0x01, 0xFE, 0x00,
-  0x1F, 0xFF, 0xE0, 0x03, 0xFC, 0x00, 0x3F, 0xFF, 0xC0, 0x07, 0xF8, 0x00,
-  0x7F, 0xFF, 0x80, 0x0F, 0xF0, 0x00, 0xFF, 0xFF, 0x00, 0x1F, 0xE0, 0x01,
-  0xFF, 0xFE, 0x00, 0x3F, 0xC0, 0x03, 0xFF, 0xFC, 0x00, 0x7F, 0x80, 0x07,
-  0xFF, 0xF8, 0x00, 0xFF, 0x00, 0x0F, 0xFF, 0xF0, 0x01, 0xFE, 0x00, 0x1F,
-  0xFF, 0xE0, 0x03, 0xFC, 0x00, 0x3F, 0xFF, 0xC0, 0x07, 0xF8, 0x00, 0x7F,
-  0xFF, 0x80, 0x0F, 0xF0, 0x00, 0xFF, 0xFF, 0x00, 0x1F, 0xE0, 0x01, 0xFF,
-  0xFE, 0x00, 0x3F, 0xC0, 0x03, 0xFC, 0x00, 0x07, 0xF8, 0x0F, 0xF1, 0xFF,
-  0xE0, 0xFF, 0x3F, 0xFF, 0x0F, 0xF7, 0xFF, 0xF8, 0xFF, 0x7F, 0xFF, 0xCF,
-  0xFF, 0xFF, 0xFC, 0xFF, 0xE0, 0x7F, 0xEF, 0xFC, 0x03, 0xFE, 0xFF, 0x80,
-  0x1F, 0xEF, 0xF0, 0x01, 0xFE, 0xFF, 0x00, 0x1F, 0xFF, 0xF0, 0x00, 0xFF,
-  0xFF, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xF0,
-  0x00, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0x00, 0x0F,
-  0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0xFF, 0xFF,
-  0x00, 0x0F, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xF0, 0x00,
-  0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0x00, 0x0F, 0xFF,
-  0xF0, 0x00, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0x00,
-  0x0F, 0xFF, 0xF0, 0x00, 0xFF, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0xFF, 0xF8,
-  0x00, 0x07, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x7F, 0xFF, 0xFC,
-  0x01, 0xFF, 0xFF, 0xFC, 0x07, 0xFE, 0x0F, 0xFC, 0x1F, 0xF0, 0x07, 0xFC,
-  0x3F, 0xC0, 0x07, 0xF8, 0xFF, 0x80, 0x0F, 0xF1, 0xFE, 0x00, 0x0F, 0xF3,
-  0xFC, 0x00, 0x1F, 0xE7, 0xF8, 0x00, 0x3F, 0xDF, 0xF0, 0x00, 0x7F, 0xBF,
-  0xE0, 0x00, 0xFF, 0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0x80, 0x03, 0xFF, 0xFF,
-  0x00, 0x07, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xF8,
-  0x00, 0x3F, 0xEF, 0xF0, 0x00, 0x7F, 0x9F, 0xE0, 0x00, 0xFF, 0x3F, 0xC0,
-  0x01, 0xFE, 0x7F, 0x80, 0x03, 0xFC, 0x7F, 0x80, 0x0F, 0xF0, 0xFF, 0x00,
-  0x1F, 0xE1, 0xFF, 0x00, 0x7F, 0xC1, 0xFF, 0x83, 0xFF, 0x01, 0xFF, 0xFF,
-  0xFC, 0x01, 0xFF, 0xFF, 0xF0, 0x01, 0xFF, 0xFF, 0xC0, 0x01, 0xFF, 0xFF,
-  0x00, 0x01, 0xFF, 0xF8, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x03, 0xF8,
-  0x03, 0xFC, 0x7F, 0xF8, 0x0F, 0xF3, 0xFF, 0xF8, 0x3F, 0xDF, 0xFF, 0xF0,
-  0xFF, 0x7F, 0xFF, 0xE3, 0xFF, 0xFF, 0xFF, 0x8F, 0xFF, 0x07, 0xFF, 0x3F,
-  0xF0, 0x07, 0xFC, 0xFF, 0x80, 0x0F, 0xFB, 0xFC, 0x00, 0x3F, 0xEF, 0xF0,
-  0x00, 0x7F, 0xBF, 0xC0, 0x01, 0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xFC, 0x00,
-  0x0F, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0x00, 0x03,
-  0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0xFF,
-  0xFF, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x7F, 0xFF,
-  0xC0, 0x01, 0xFF, 0xFF, 0x00, 0x07, 0xFB, 0xFC, 0x00, 0x3F, 0xEF, 0xF8,
-  0x00, 0xFF, 0xBF, 0xF0, 0x07, 0xFC, 0xFF, 0xF0, 0x7F, 0xF3, 0xFF, 0xFF,
-  0xFF, 0x8F, 0xF7, 0xFF, 0xFE, 0x3F, 0xDF, 0xFF, 0xF0, 0xFF, 0x3F, 0xFF,
-  0x83, 0xFC, 0x7F, 0xF8, 0x0F, 0xF0, 0x3F, 0x80, 0x3F, 0xC0, 0x00, 0x00,
-  0xFF, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x3F,
-  0xC0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x0F, 0xF0,
-  0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x03, 0xFC, 0x00,
-  0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x07, 0xFF,
-  0x8F, 0xF0, 0x7F, 0xFF, 0x3F, 0xC3, 0xFF, 0xFE, 0xFF, 0x1F, 0xFF, 0xFB,
-  0xFC, 0x7F, 0xFF, 0xFF, 0xF3, 0xFF, 0x83, 0xFF, 0xCF, 0xF8, 0x03, 0xFF,
-  0x7F, 0xC0, 0x07, 0xFD, 0xFE, 0x00, 0x0F, 0xF7, 0xF8, 0x00, 0x3F, 0xFF,
-  0xE0, 0x00, 0xFF, 0xFF, 0x80, 0x03, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xF0,
-  0x00, 0x3F, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFC, 0x00,
-  0x0F, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0x00, 0x03,
-  0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0xFF,
-  0x7F, 0x80, 0x03, 0xFD, 0xFE, 0x00, 0x0F, 0xF7, 0xFC, 0x00, 0x7F, 0xCF,
-  0xF8, 0x03, 0xFF, 0x3F, 0xF8, 0x3F, 0xFC, 0x7F, 0xFF, 0xFF, 0xF1, 0xFF,
-  0xFF, 0xBF, 0xC3, 0xFF, 0xFE, 0xFF, 0x07, 0xFF, 0xF3, 0xFC, 0x07, 0xFF,
-  0x0F, 0xF0, 0x07, 0xF0, 0x3F, 0xC0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x03,
-  0xFC, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0xFF,
-  0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x3F, 0xC0,
-  0x00, 0x00, 0xFF, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x0F, 0xF0, 0x00,
-  0x00, 0x3F, 0xC0, 0xFF, 0x03, 0xFF, 0xE3, 0xFF, 0xFC, 0xFF, 0xFF, 0xBF,
-  0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xC0,
-  0x1F, 0xF0, 0x03, 0xFC, 0x00, 0x7F, 0x80, 0x0F, 0xF0, 0x01, 0xFE, 0x00,
-  0x3F, 0xC0, 0x07, 0xF8, 0x00, 0xFF, 0x00, 0x1F, 0xE0, 0x03, 0xFC, 0x00,
-  0x7F, 0x80, 0x0F, 0xF0, 0x01, 0xFE, 0x00, 0x3F, 0xC0, 0x07, 0xF8, 0x00,
-  0xFF, 0x00, 0x1F, 0xE0, 0x03, 0xFC, 0x00, 0x7F, 0x80, 0x0F, 0xF0, 0x01,
-  0xFE, 0x00, 0x3F, 0xC0, 0x07, 0xF8, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x7F,
-  0xC0, 0x00, 0x7F, 0xFF, 0x00, 0x1F, 0xFF, 0xF8, 0x0F, 0xFF, 0xFF, 0x81,
-  0xFF, 0xFF, 0xF8, 0x7F, 0xFF, 0xFF, 0x9F, 0xF8, 0x3F, 0xE3, 0xFC, 0x01,
-  0xF8, 0x7F, 0x80, 0x0E, 0x0F, 0xF0, 0x00, 0x81, 0xFE, 0x00, 0x00, 0x3F,
-  0xC0, 0x00, 0x07, 0xF8, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0xE0,
-  0x01, 0xFF, 0xFF, 0xC0, 0x1F, 0xFF, 0xFE, 0x01, 0xFF, 0xFF, 0xE0, 0x1F,
-  0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0xFF,
-  0x80, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0xFF, 0x08, 0x00, 0x1F, 0xE3, 0x80,
-  0x03, 0xFC, 0xF8, 0x00, 0x7F, 0xBF, 0x80, 0x1F, 0xEF, 0xFC, 0x07, 0xFD,
-  0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xE1, 0xFF, 0xFF, 0xF8, 0x0F, 0xFF,
-  0xFC, 0x00, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x03, 0xF8, 0x00,
-  0x3F, 0x80, 0x03, 0xF8, 0x00, 0x3F, 0x80, 0x03, 0xF8, 0x00, 0x3F, 0x80,
-  0x07, 0xF8, 0x00, 0x7F, 0x80, 0x0F, 0xF8, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x7F,
-  0x80, 0x07, 0xF8, 0x00, 0x7F, 0x80, 0x07, 0xF8, 0x00, 0x7F, 0x80, 0x07,
-  0xF8, 0x00, 0x7F, 0x80, 0x07, 0xF8, 0x00, 0x7F, 0x80, 0x07, 0xF8, 0x00,
-  0x7F, 0x80, 0x07, 0xF8, 0x00, 0x7F, 0x80, 0x07, 0xF8, 0x00, 0x7F, 0x80,
-  0x07, 0xF8, 0x00, 0x7F, 0x80, 0x07, 0xF8, 0x00, 0x7F, 0x80, 0x07, 0xF8,
-  0x00, 0x7F, 0x80, 0x07, 0xFF, 0xE0, 0x7F, 0xFE, 0x03, 0xFF, 0xE0, 0x1F,
-  0xFE, 0x00, 0xFF, 0xE0, 0x03, 0xFE, 0xFF, 0x00, 0x0F, 0xFF, 0xF0, 0x00,
-  0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0x00, 0x0F, 0xFF,
-  0xF0, 0x00, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0x00,
-  0x0F, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0xFF,
-  0xFF, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xF0,
-  0x00, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0x00, 0x0F,
-  0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0xFF, 0xFF,
-  0x00, 0x0F, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0x80, 0x0F, 0xF7, 0xF8, 0x01,
-  0xFF, 0x7F, 0xC0, 0x3F, 0xF7, 0xFE, 0x07, 0xFF, 0x3F, 0xFF, 0xFF, 0xF3,
-  0xFF, 0xFE, 0xFF, 0x1F, 0xFF, 0xEF, 0xF0, 0xFF, 0xFC, 0xFF, 0x07, 0xFF,
-  0x8F, 0xF0, 0x1F, 0xE0, 0x00, 0xFF, 0x00, 0x01, 0xFF, 0xFE, 0x00, 0x03,
-  0xFD, 0xFC, 0x00, 0x07, 0xF3, 0xFC, 0x00, 0x0F, 0xE7, 0xF8, 0x00, 0x3F,
-  0xC7, 0xF0, 0x00, 0x7F, 0x0F, 0xF0, 0x00, 0xFE, 0x1F, 0xE0, 0x03, 0xFC,
-  0x1F, 0xC0, 0x07, 0xF0, 0x3F, 0xC0, 0x0F, 0xE0, 0x7F, 0x80, 0x3F, 0xC0,
-  0x7F, 0x00, 0x7F, 0x00, 0xFF, 0x00, 0xFE, 0x01, 0xFE, 0x03, 0xFC, 0x01,
-  0xFC, 0x07, 0xF0, 0x03, 0xFC, 0x0F, 0xE0, 0x07, 0xF8, 0x1F, 0xC0, 0x07,
-  0xF0, 0x7F, 0x00, 0x0F, 0xE0, 0xFE, 0x00, 0x1F, 0xE1, 0xFC, 0x00, 0x1F,
-  0xC7, 0xF0, 0x00, 0x3F, 0x8F, 0xE0, 0x00, 0x7F, 0x9F, 0xC0, 0x00, 0x7F,
-  0x3F, 0x00, 0x00, 0xFE, 0xFE, 0x00, 0x01, 0xFD, 0xFC, 0x00, 0x01, 0xFF,
-  0xF0, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x07, 0xFF,
-  0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x1F, 0xF0,
-  0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0x7F, 0xFF, 0x00, 0x0F, 0xF0, 0x00,
-  0x7F, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x7F, 0x00, 0x1F, 0xF8, 0x00,
-  0xFE, 0x7F, 0x80, 0x1F, 0xF8, 0x00, 0xFE, 0x7F, 0x80, 0x1F, 0xF8, 0x00,
-  0xFE, 0x7F, 0x80, 0x1F, 0xFC, 0x01, 0xFE, 0x3F, 0x80, 0x3F, 0xFC, 0x01,
-  0xFC, 0x3F, 0x80, 0x3F, 0xFC, 0x01, 0xFC, 0x3F, 0xC0, 0x3F, 0xFE, 0x01,
-  0xFC, 0x1F, 0xC0, 0x7F, 0xFE, 0x03, 0xFC, 0x1F, 0xC0, 0x7E, 0x7E, 0x03,
-  0xF8, 0x1F, 0xC0, 0x7E, 0x7E, 0x03, 0xF8, 0x1F, 0xE0, 0x7E, 0x7F, 0x03,
-  0xF8, 0x0F, 0xE0, 0xFE, 0x7F, 0x07, 0xF0, 0x0F, 0xE0, 0xFC, 0x3F, 0x07,
-  0xF0, 0x0F, 0xE0, 0xFC, 0x3F, 0x87, 0xF0, 0x0F, 0xF0, 0xFC, 0x3F, 0x87,
-  0xF0, 0x07, 0xF1, 0xF8, 0x3F, 0x87, 0xE0, 0x07, 0xF1, 0xF8, 0x1F, 0x8F,
-  0xE0, 0x07, 0xF1, 0xF8, 0x1F, 0xCF, 0xE0, 0x03, 0xFB, 0xF8, 0x1F, 0xCF,
-  0xE0, 0x03, 0xFB, 0xF0, 0x0F, 0xCF, 0xC0, 0x03, 0xFB, 0xF0, 0x0F, 0xDF,
-  0xC0, 0x03, 0xFB, 0xF0, 0x0F, 0xFF, 0xC0, 0x01, 0xFF, 0xE0, 0x07, 0xFF,
-  0x80, 0x01, 0xFF, 0xE0, 0x07, 0xFF, 0x80, 0x01, 0xFF, 0xE0, 0x07, 0xFF,
-  0x80, 0x01, 0xFF, 0xE0, 0x07, 0xFF, 0x80, 0x00, 0xFF, 0xC0, 0x03, 0xFF,
-  0x00, 0x00, 0xFF, 0xC0, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0xC0, 0x03, 0xFF,
-  0x00, 0x00, 0x7F, 0x80, 0x01, 0xFF, 0x00, 0xFF, 0xC0, 0x01, 0xFF, 0x7F,
-  0xC0, 0x03, 0xFE, 0x3F, 0xE0, 0x03, 0xFC, 0x1F, 0xF0, 0x07, 0xFC, 0x1F,
-  0xF0, 0x07, 0xF8, 0x0F, 0xF8, 0x0F, 0xF0, 0x07, 0xFC, 0x1F, 0xE0, 0x07,
-  0xFC, 0x1F, 0xE0, 0x03, 0xFE, 0x3F, 0xC0, 0x01, 0xFE, 0x7F, 0x80, 0x01,
-  0xFF, 0x7F, 0x80, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00,
-  0x7F, 0xFE, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00,
-  0x1F, 0xF8, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00,
-  0x7F, 0xFE, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x01,
-  0xFE, 0xFF, 0x80, 0x03, 0xFC, 0x7F, 0xC0, 0x03, 0xFC, 0x3F, 0xC0, 0x07,
-  0xF8, 0x3F, 0xE0, 0x0F, 0xF8, 0x1F, 0xF0, 0x0F, 0xF0, 0x1F, 0xF0, 0x1F,
-  0xE0, 0x0F, 0xF8, 0x3F, 0xE0, 0x07, 0xFC, 0x3F, 0xC0, 0x07, 0xFC, 0x7F,
-  0xC0, 0x03, 0xFE, 0xFF, 0x80, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFE,
-  0x00, 0x03, 0xFF, 0xFC, 0x00, 0x07, 0xFB, 0xFC, 0x00, 0x0F, 0xE7, 0xF8,
-  0x00, 0x3F, 0xCF, 0xF0, 0x00, 0x7F, 0x8F, 0xF0, 0x00, 0xFE, 0x1F, 0xE0,
-  0x03, 0xFC, 0x3F, 0xC0, 0x07, 0xF8, 0x3F, 0xC0, 0x0F, 0xE0, 0x7F, 0x80,
-  0x3F, 0xC0, 0xFF, 0x00, 0x7F, 0x80, 0xFF, 0x00, 0xFE, 0x01, 0xFE, 0x03,
-  0xFC, 0x03, 0xFC, 0x07, 0xF0, 0x03, 0xFC, 0x0F, 0xE0, 0x07, 0xF8, 0x1F,
-  0xC0, 0x0F, 0xF0, 0x7F, 0x00, 0x0F, 0xE0, 0xFE, 0x00, 0x1F, 0xE1, 0xFC,
-  0x00, 0x3F, 0xC7, 0xF0, 0x00, 0x3F, 0x8F, 0xE0, 0x00, 0x7F, 0x1F, 0xC0,
-  0x00, 0xFF, 0x3F, 0x00, 0x00, 0xFE, 0xFE, 0x00, 0x01, 0xFD, 0xFC, 0x00,
-  0x03, 0xFB, 0xF0, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xC0, 0x00,
-  0x0F, 0xFF, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00,
-  0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00,
-  0xFF, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x0F,
-  0xF0, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x1F, 0xFF,
-  0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0xFF, 0xE0,
-  0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF,
-  0xFB, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFD, 0xFF,
-  0xFF, 0xFF, 0x80, 0x00, 0x3F, 0xF0, 0x00, 0x0F, 0xFC, 0x00, 0x01, 0xFF,
-  0x00, 0x00, 0x7F, 0xC0, 0x00, 0x1F, 0xF0, 0x00, 0x07, 0xFE, 0x00, 0x01,
-  0xFF, 0x80, 0x00, 0x3F, 0xE0, 0x00, 0x0F, 0xF8, 0x00, 0x03, 0xFE, 0x00,
-  0x00, 0xFF, 0x80, 0x00, 0x3F, 0xF0, 0x00, 0x0F, 0xFC, 0x00, 0x01, 0xFF,
-  0x00, 0x00, 0x7F, 0xC0, 0x00, 0x1F, 0xF0, 0x00, 0x07, 0xFE, 0x00, 0x01,
-  0xFF, 0x80, 0x00, 0x3F, 0xE0, 0x00, 0x0F, 0xF8, 0x00, 0x03, 0xFE, 0x00,
-  0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x3F,
-  0xE0, 0x1F, 0xFC, 0x07, 0xFF, 0x80, 0xFF, 0xF0, 0x1F, 0xFE, 0x07, 0xF8,
-  0x00, 0xFF, 0x00, 0x1F, 0xE0, 0x03, 0xFC, 0x00, 0x7F, 0x80, 0x0F, 0xF0,
-  0x01, 0xFE, 0x00, 0x3F, 0xC0, 0x07, 0xF8, 0x00, 0xFF, 0x00, 0x1F, 0xE0,
-  0x03, 0xFC, 0x00, 0x7F, 0x80, 0x0F, 0xF0, 0x01, 0xFE, 0x00, 0x3F, 0xC0,
-  0x07, 0xF8, 0x00, 0xFE, 0x00, 0x3F, 0xC0, 0x1F, 0xF0, 0x1F, 0xFE, 0x03,
-  0xFF, 0x80, 0x7F, 0xC0, 0x0F, 0xE0, 0x01, 0xFF, 0x00, 0x3F, 0xF8, 0x07,
-  0xFF, 0x80, 0x1F, 0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xE0, 0x01, 0xFE, 0x00,
-  0x3F, 0xC0, 0x07, 0xF8, 0x00, 0xFF, 0x00, 0x1F, 0xE0, 0x03, 0xFC, 0x00,
-  0x7F, 0x80, 0x0F, 0xF0, 0x01, 0xFE, 0x00, 0x3F, 0xC0, 0x07, 0xF8, 0x00,
-  0xFF, 0x00, 0x1F, 0xE0, 0x03, 0xFC, 0x00, 0x7F, 0x80, 0x0F, 0xF0, 0x01,
-  0xFE, 0x00, 0x1F, 0xFE, 0x03, 0xFF, 0xC0, 0x7F, 0xF8, 0x07, 0xFF, 0x00,
-  0x3F, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0x80, 0x1F,
-  0xFC, 0x03, 0xFF, 0xC0, 0x7F, 0xF8, 0x0F, 0xFF, 0x00, 0x0F, 0xF0, 0x01,
-  0xFE, 0x00, 0x3F, 0xC0, 0x07, 0xF8, 0x00, 0xFF, 0x00, 0x1F, 0xE0, 0x03,
-  0xFC, 0x00, 0x7F, 0x80, 0x0F, 0xF0, 0x01, 0xFE, 0x00, 0x3F, 0xC0, 0x07,
-  0xF8, 0x00, 0xFF, 0x00, 0x1F, 0xE0, 0x03, 0xFC, 0x00, 0x7F, 0x80, 0x0F,
-  0xF0, 0x00, 0xFE, 0x00, 0x1F, 0xE0, 0x01, 0xFF, 0x00, 0x3F, 0xFC, 0x03,
-  0xFF, 0x80, 0x1F, 0xF0, 0x00, 0xFE, 0x00, 0x7F, 0xC0, 0x3F, 0xF8, 0x0F,
-  0xFF, 0x01, 0xFF, 0x00, 0x7F, 0x80, 0x0F, 0xE0, 0x03, 0xFC, 0x00, 0x7F,
-  0x80, 0x0F, 0xF0, 0x01, 0xFE, 0x00, 0x3F, 0xC0, 0x07, 0xF8, 0x00, 0xFF,
-  0x00, 0x1F, 0xE0, 0x03, 0xFC, 0x00, 0x7F, 0x80, 0x0F, 0xF0, 0x01, 0xFE,
-  0x00, 0x3F, 0xC0, 0x07, 0xF8, 0x00, 0xFF, 0x00, 0x1F, 0xE0, 0x03, 0xFC,
-  0x0F, 0xFF, 0x01, 0xFF, 0xE0, 0x3F, 0xFC, 0x07, 0xFF, 0x00, 0xFF, 0x80,
-  0x00, 0x0F, 0xF0, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x07, 0xFF, 0xF8, 0x01,
-  0x3F, 0xFF, 0xF8, 0x1E, 0xFF, 0xFF, 0xFF, 0xF9, 0xFF, 0xFF, 0xFF, 0xF7,
-  0x81, 0xFF, 0xFF, 0xC8, 0x01, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xF0, 0x00,
-  0x00, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0,
-  0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF,
-  0xC0, 0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x03,
-  0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0x00,
-  0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xFF,
-  0x00, 0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x0F,
-  0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xFC, 0x00,
-  0x0F, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xFC,
-  0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x00, 0x3F,
-  0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x00,
-  0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x0F,
-  0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xFC, 0x00,
-  0x0F, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xFC,
-  0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x00, 0x3F,
-  0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x00,
-  0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xF0,
-  0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0xFF,
-  0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x00,
-  0xFF, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF, 0xC0,
-  0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF,
-  0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x00,
-  0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xF0,
-  0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0xFF,
-  0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x00,
-  0xFF, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF, 0xC0,
-  0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF,
-  0xC0, 0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x03,
-  0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0x00,
-  0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xFF,
-  0x00, 0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x0F,
-  0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0,
-  0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF,
-  0xC0, 0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x03,
-  0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0x00,
-  0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xFF,
-  0x00, 0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x0F,
-  0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xFC, 0x00,
-  0x0F, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xFC,
-  0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x00, 0x3F,
-  0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x00,
-  0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x0F,
-  0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xFC, 0x00,
-  0x0F, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xFC,
-  0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x00, 0x3F,
-  0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x00,
-  0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xF0,
-  0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0xFF,
-  0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x00,
-  0xFF, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF, 0xC0,
-  0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF,
-  0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x00,
-  0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xF0,
-  0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0xFF,
-  0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x00,
-  0xFF, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF, 0xC0,
-  0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF,
-  0xC0, 0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x03,
-  0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0x00,
-  0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xFF,
-  0x00, 0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x0F,
-  0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0,
-  0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF,
-  0xC0, 0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x03,
-  0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0x00,
-  0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xFF,
-  0x00, 0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x0F,
-  0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xFC, 0x00,
-  0x0F, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xFC,
-  0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x00, 0x3F,
-  0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x00,
-  0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x0F,
-  0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xFC, 0x00,
-  0x0F, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xFC,
-  0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x00, 0x3F,
-  0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x00,
-  0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xF0,
-  0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0xFF,
-  0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x00,
-  0xFF, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF, 0xC0,
-  0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF,
-  0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x00,
-  0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xF0,
-  0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0xFF,
-  0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x00,
-  0xFF, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF, 0xC0,
-  0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF,
-  0xC0, 0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x03,
-  0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0x00,
-  0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xFF,
-  0x00, 0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x0F,
-  0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0,
-  0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF,
-  0xC0, 0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x03,
-  0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0x00,
-  0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xFF,
-  0x00, 0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x0F,
-  0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xFC, 0x00,
-  0x0F, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xFC,
-  0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x00, 0x3F,
-  0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x00,
-  0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x0F,
-  0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xFC, 0x00,
-  0x0F, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xFC,
-  0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x00, 0x3F,
-  0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x00,
-  0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xF0,
-  0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0xFF,
-  0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x00,
-  0xFF, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF, 0xC0,
-  0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF,
-  0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x00,
-  0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xF0,
-  0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0xFF,
-  0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x00,
-  0xFF, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF, 0xC0,
-  0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF,
-  0xC0, 0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x03,
-  0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0x00,
-  0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xFF,
-  0x00, 0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x0F,
-  0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0,
-  0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF,
-  0xC0, 0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x03,
-  0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0x00,
-  0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xFF,
-  0x00, 0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x0F,
-  0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xFC, 0x00,
-  0x0F, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xFC,
-  0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x00, 0x3F,
-  0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x00,
-  0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x0F,
-  0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xFC, 0x00,
-  0x0F, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xFC,
-  0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x00, 0x3F,
-  0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x00,
-  0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xF0,
-  0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0xFF,
-  0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x00,
-  0xFF, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF, 0xC0,
-  0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF,
-  0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x00,
-  0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xF0,
-  0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0xFF,
-  0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x00,
-  0xFF, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF, 0xC0,
-  0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF,
-  0xC0, 0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x03,
-  0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0x00,
-  0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xFF,
-  0x00, 0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x0F,
-  0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0,
-  0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF,
-  0xC0, 0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x03,
-  0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0x00,
-  0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xFF,
-  0x00, 0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x0F,
-  0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xFC, 0x00,
-  0x0F, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xFC,
-  0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x00, 0x3F,
-  0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x00,
-  0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x0F,
-  0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xFC, 0x00,
-  0x0F, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xFC,
-  0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x00, 0x3F,
-  0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x00,
-  0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xF0,
-  0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0xFF,
-  0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x00,
-  0xFF, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF, 0xC0,
-  0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF,
-  0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x00,
-  0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xF0,
-  0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0xFF,
-  0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x00,
-  0xFF, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF, 0xC0,
-  0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF,
-  0xC0, 0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x03,
-  0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0x00,
-  0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xFF,
-  0x00, 0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x0F,
-  0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0,
-  0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF,
-  0xC0, 0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x03,
-  0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0x00,
-  0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xFF,
-  0x00, 0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x0F,
-  0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xFC, 0x00,
-  0x0F, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xFC,
-  0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x00, 0x3F,
-  0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x00,
-  0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x0F,
-  0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xFC, 0x00,
-  0x0F, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xFC,
-  0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x00, 0x3F,
-  0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x00,
-  0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xF0,
-  0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0xFF,
-  0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x00,
-  0xFF, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF, 0xC0,
-  0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF,
-  0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x00,
-  0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xF0,
-  0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0xFF,
-  0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x00,
-  0xFF, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF, 0xC0,
-  0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF,
-  0xC0, 0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x03,
-  0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0x00,
-  0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xFF,
-  0x00, 0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x0F,
-  0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0,
-  0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF,
-  0xC0, 0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x03,
-  0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0x00,
-  0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xFF,
-  0x00, 0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x0F,
-  0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xFC, 0x00,
-  0x0F, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xFC,
-  0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x00, 0x3F,
-  0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x00,
-  0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x0F,
-  0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xFC, 0x00,
-  0x0F, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xFC,
-  0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x00, 0x3F,
-  0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x00,
-  0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xF0,
-  0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0xFF,
-  0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x00,
-  0xFF, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF, 0xC0,
-  0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF,
-  0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x00,
-  0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xF0,
-  0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0xFF,
-  0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x00,
-  0xFF, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF, 0xC0,
-  0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF,
-  0xC0, 0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x03,
-  0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0x00,
-  0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xFF,
-  0x00, 0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x0F,
-  0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0,
-  0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF,
-  0xC0, 0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x03,
-  0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0x00,
-  0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xFF,
-  0x00, 0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x0F,
-  0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xFC, 0x00,
-  0x0F, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xFC,
-  0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x00, 0x3F,
-  0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x00,
-  0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x0F,
-  0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xFC, 0x00,
-  0x0F, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xFC,
-  0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x00, 0x3F,
-  0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x00,
-  0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xF0,
-  0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0xFF,
-  0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x00,
-  0xFF, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF, 0xC0,
-  0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF,
-  0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x00,
-  0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xF0,
-  0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0xFF,
-  0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x00,
-  0xFF, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF, 0xC0,
-  0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF,
-  0xC0, 0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x03,
-  0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0x00,
-  0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xFF,
-  0x00, 0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x0F,
-  0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0,
-  0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF,
-  0xC0, 0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x03,
-  0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0x00,
-  0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xFF,
-  0x00, 0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x0F,
-  0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xFC, 0x00,
-  0x0F, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xFC,
-  0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x00, 0x3F,
-  0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x00,
-  0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x0F,
-  0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xFC, 0x00,
-  0x0F, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xFC,
-  0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x00, 0x3F,
-  0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x00,
-  0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xF0,
-  0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0xFF,
-  0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x00,
-  0xFF, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF, 0xC0,
-  0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF,
-  0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x00,
-  0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xF0,
-  0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0xFF,
-  0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x00,
-  0xFF, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF, 0xC0,
-  0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF,
-  0xC0, 0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x03,
-  0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0x00,
-  0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xFF,
-  0x00, 0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x0F,
-  0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0,
-  0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF,
-  0xC0, 0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x03,
-  0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0x00,
-  0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xFF,
-  0x00, 0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x0F,
-  0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xFC, 0x00,
-  0x0F, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xFC,
-  0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x00, 0x3F,
-  0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x00,
-  0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x0F,
-  0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xFC, 0x00,
-  0x0F, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xFC,
-  0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x00, 0x3F,
-  0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x00,
-  0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xF0,
-  0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0xFF,
-  0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x00,
-  0xFF, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF, 0xC0,
-  0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF,
-  0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x00,
-  0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xF0,
-  0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0xFF,
-  0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x00,
-  0xFF, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF, 0xC0,
-  0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF,
-  0xC0, 0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x03,
-  0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0x00,
-  0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xFF,
-  0x00, 0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x0F,
-  0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xC0, 0x00, 0x1F, 0x0F, 0xF9, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFB, 0xFE, 0x7F, 0xC3, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
-  0x80, 0xF0, 0x1F, 0x03, 0xE0, 0x7C, 0x0F, 0x81, 0xF0, 0x3E, 0x07, 0xC1,
-  0xFC, 0x3F, 0x87, 0xF0, 0xFE, 0x1F, 0xC3, 0xF8, 0x7F, 0x1F, 0xE3, 0xFE,
-  0x7F, 0xCF, 0xF9, 0xFF, 0x3F, 0xE7, 0xFC, 0xFF, 0x9F, 0xF3, 0xFE, 0x7F,
-  0xCF, 0xF9, 0xFF, 0x3F, 0xE7, 0xFC, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x7E,
-  0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0xFC, 0x00,
-  0x00, 0x07, 0xE0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x01,
-  0xFF, 0xFE, 0x00, 0x1F, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xF0, 0x1F, 0xFF,
-  0xFF, 0xC1, 0xFF, 0xFF, 0xFE, 0x1F, 0xF7, 0xEF, 0xF8, 0xFF, 0x3F, 0x3F,
-  0xCF, 0xF1, 0xF8, 0xF8, 0x7F, 0x0F, 0xC3, 0x07, 0xF8, 0x7E, 0x00, 0x3F,
-  0xC3, 0xF0, 0x01, 0xFE, 0x1F, 0x80, 0x0F, 0xF0, 0xFC, 0x00, 0x7F, 0x87,
-  0xE0, 0x03, 0xFC, 0x3F, 0x00, 0x1F, 0xE1, 0xF8, 0x00, 0xFF, 0x0F, 0xC0,
-  0x07, 0xF8, 0x7E, 0x00, 0x3F, 0xC3, 0xF0, 0x01, 0xFE, 0x1F, 0x80, 0x0F,
-  0xF0, 0xFC, 0x00, 0x7F, 0x87, 0xE0, 0x03, 0xFC, 0x3F, 0x08, 0x0F, 0xE1,
-  0xF8, 0x70, 0x7F, 0x8F, 0xC7, 0xE1, 0xFE, 0x7E, 0x7F, 0xCF, 0xFB, 0xF7,
-  0xFC, 0x3F, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFE, 0x03, 0xFF, 0xFF, 0xE0,
-  0x0F, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x3F, 0xF8, 0x00, 0x00,
-  0x7E, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0xFC,
-  0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x01, 0xF8, 0x00,
-  0x00, 0x07, 0xFE, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xF0,
-  0x01, 0xFF, 0xFF, 0xF8, 0x03, 0xFF, 0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0xFE,
-  0x0F, 0xFF, 0xFF, 0xFF, 0x0F, 0xFE, 0x07, 0xFF, 0x1F, 0xF8, 0x01, 0xFE,
-  0x1F, 0xF0, 0x00, 0x78, 0x1F, 0xF0, 0x00, 0x70, 0x1F, 0xE0, 0x00, 0x40,
-  0x1F, 0xE0, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00,
-  0x1F, 0xE0, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00,
-  0x1F, 0xE0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00,
-  0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0x80,
-  0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0x80,
-  0x03, 0xFE, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00,
-  0x03, 0xFE, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00,
-  0x03, 0xFC, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00,
-  0x1F, 0xE0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFE,
-  0x7F, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFE,
-  0x7F, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFE,
-  0x10, 0x00, 0x00, 0x00, 0x80, 0xC0, 0x00, 0x00, 0x06, 0x0F, 0x00, 0x00,
-  0x00, 0x78, 0xFC, 0x00, 0x00, 0x07, 0xEF, 0xF0, 0x3F, 0xE0, 0x7F, 0xBF,
-  0xCF, 0xFF, 0xE7, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0x83, 0xFF, 0xFF, 0xFF,
-  0xF8, 0x0F, 0xFF, 0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xFF, 0xF8, 0x00, 0xFF,
-  0xC1, 0xFF, 0x80, 0x0F, 0xF8, 0x03, 0xFE, 0x00, 0x7F, 0x80, 0x0F, 0xF0,
-  0x07, 0xF8, 0x00, 0x3F, 0xC0, 0x3F, 0xC0, 0x01, 0xFE, 0x01, 0xFE, 0x00,
-  0x0F, 0xF0, 0x0F, 0xF0, 0x00, 0x7F, 0x80, 0x7F, 0x80, 0x03, 0xFC, 0x03,
-  0xFC, 0x00, 0x1F, 0xE0, 0x1F, 0xE0, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x07,
-  0xF8, 0x07, 0xF8, 0x00, 0x3F, 0xC0, 0x3F, 0xC0, 0x01, 0xFE, 0x01, 0xFE,
-  0x00, 0x0F, 0xF0, 0x0F, 0xF0, 0x00, 0x7F, 0x80, 0x3F, 0xC0, 0x07, 0xF8,
-  0x01, 0xFF, 0x00, 0x7F, 0xC0, 0x07, 0xFE, 0x0F, 0xFC, 0x00, 0x7F, 0xFF,
-  0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0xFF, 0x07,
-  0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 0x9F, 0xFF, 0xCF, 0xF7, 0xF8, 0x1F, 0xF0,
-  0x3F, 0xDF, 0x80, 0x00, 0x00, 0xFC, 0x78, 0x00, 0x00, 0x03, 0xC1, 0x80,
-  0x00, 0x00, 0x0C, 0x08, 0x00, 0x00, 0x00, 0x40, 0xFF, 0xC0, 0x00, 0x0F,
-  0xFB, 0xFE, 0x00, 0x00, 0x7F, 0xCF, 0xF8, 0x00, 0x07, 0xFC, 0x7F, 0xC0,
-  0x00, 0x3F, 0xC1, 0xFF, 0x00, 0x03, 0xFE, 0x0F, 0xF8, 0x00, 0x1F, 0xE0,
-  0x3F, 0xE0, 0x01, 0xFF, 0x01, 0xFF, 0x80, 0x1F, 0xF0, 0x07, 0xFC, 0x00,
-  0xFF, 0x80, 0x3F, 0xF0, 0x0F, 0xF8, 0x00, 0xFF, 0x80, 0x7F, 0x80, 0x03,
-  0xFE, 0x07, 0xFC, 0x00, 0x1F, 0xF0, 0x3F, 0xC0, 0x00, 0x7F, 0xC3, 0xFE,
-  0x00, 0x03, 0xFE, 0x1F, 0xE0, 0x00, 0x0F, 0xF9, 0xFF, 0x00, 0x00, 0x7F,
-  0xCF, 0xF0, 0x00, 0x01, 0xFF, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0xF8, 0x00,
-  0x00, 0x3F, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFF, 0xFC, 0x07, 0xFF, 0xFF,
-  0xFF, 0xE0, 0x3F, 0xFF, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0xFF, 0xF8, 0x0F,
-  0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0x80,
-  0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x01,
-  0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0xFF, 0xF8,
-  0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0xFE, 0x03, 0xFF, 0xFF,
-  0xFF, 0xF0, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00,
-  0x01, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0xC0,
-  0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00,
-  0xFF, 0x80, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xF0, 0x00, 0x1F, 0xFF, 0xE0, 0x03, 0xFF,
-  0xFF, 0x80, 0xFF, 0xFF, 0xFC, 0x1F, 0xFF, 0xFF, 0xE1, 0xFF, 0xFF, 0xFC,
-  0x3F, 0xE0, 0x3F, 0x83, 0xFC, 0x00, 0xF0, 0x3F, 0x80, 0x02, 0x03, 0xF8,
-  0x00, 0x00, 0x3F, 0x80, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x3F, 0x80, 0x00,
-  0x03, 0xFC, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x1F,
-  0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0x00, 0x3F, 0xFF,
-  0xF8, 0x07, 0xFF, 0xFF, 0xC0, 0xF8, 0xFF, 0xFE, 0x3F, 0x00, 0xFF, 0xF7,
-  0xE0, 0x03, 0xFF, 0x7E, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x7F, 0xFC, 0x00,
-  0x07, 0xFF, 0xE0, 0x00, 0x7F, 0xFE, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x7F,
-  0xFF, 0x00, 0x07, 0xEF, 0xFC, 0x00, 0x7C, 0xFF, 0xF8, 0x0F, 0x87, 0xFF,
-  0xF9, 0xF0, 0x3F, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0xFE,
-  0x00, 0x1F, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x7F, 0xF8, 0x00,
-  0x00, 0xFF, 0xC0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x01,
-  0xFC, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x01, 0xFC, 0x04, 0x00, 0x1F, 0xC0,
-  0xF0, 0x03, 0xFC, 0x1F, 0xC0, 0xFF, 0xC3, 0xFF, 0xFF, 0xF8, 0x7F, 0xFF,
-  0xFF, 0x03, 0xFF, 0xFF, 0xE0, 0x1F, 0xFF, 0xFC, 0x00, 0x7F, 0xFF, 0x80,
-  0x00, 0xFF, 0xC0, 0x00, 0x3E, 0x01, 0xF1, 0xFC, 0x0F, 0xEF, 0xF8, 0x7F,
-  0xFF, 0xE1, 0xFF, 0xFF, 0x87, 0xFF, 0xFE, 0x1F, 0xFF, 0xF8, 0x7F, 0xDF,
-  0xC0, 0xFE, 0x3E, 0x01, 0xF0, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00,
-  0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x80, 0x00, 0x03, 0xFF,
-  0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x3F, 0xF0, 0x00, 0x1F, 0xE0, 0x00,
-  0x7F, 0x80, 0x03, 0xF8, 0x00, 0x01, 0xFC, 0x00, 0x7E, 0x00, 0x00, 0x07,
-  0xE0, 0x07, 0xC0, 0x00, 0x00, 0x3E, 0x00, 0xF8, 0x00, 0x00, 0x01, 0xF0,
-  0x1F, 0x00, 0x1F, 0xC0, 0x0F, 0x81, 0xF0, 0x0F, 0xFF, 0x80, 0xF8, 0x3E,
-  0x01, 0xFF, 0xFC, 0x07, 0xC3, 0xC0, 0x7F, 0xFF, 0xE0, 0x7C, 0x3C, 0x07,
-  0xFF, 0xFF, 0x03, 0xC7, 0xC0, 0xFF, 0xFF, 0xF0, 0x3E, 0x78, 0x1F, 0xF0,
-  0x7F, 0x81, 0xE7, 0x81, 0xFE, 0x03, 0xE0, 0x1E, 0x78, 0x1F, 0xC0, 0x18,
-  0x01, 0xEF, 0x83, 0xFC, 0x00, 0x00, 0x1E, 0xF8, 0x3F, 0xC0, 0x00, 0x01,
-  0xFF, 0x83, 0xFC, 0x00, 0x00, 0x1F, 0xF8, 0x3F, 0xC0, 0x00, 0x01, 0xFF,
-  0x83, 0xFC, 0x00, 0x00, 0x1F, 0xF8, 0x3F, 0xC0, 0x00, 0x01, 0xFF, 0x83,
-  0xFC, 0x00, 0x00, 0x1F, 0xF8, 0x3F, 0xC0, 0x10, 0x01, 0xE7, 0x81, 0xFC,
-  0x01, 0xC0, 0x1E, 0x78, 0x1F, 0xE0, 0x3F, 0x01, 0xE7, 0x81, 0xFF, 0x07,
-  0xF8, 0x1E, 0x7C, 0x0F, 0xFF, 0xFF, 0x83, 0xE3, 0xC0, 0x7F, 0xFF, 0xF0,
-  0x3C, 0x3C, 0x07, 0xFF, 0xFE, 0x07, 0xC3, 0xE0, 0x1F, 0xFF, 0xC0, 0x7C,
-  0x1F, 0x00, 0xFF, 0xF8, 0x0F, 0x81, 0xF0, 0x03, 0xFE, 0x00, 0xF8, 0x0F,
-  0x80, 0x00, 0x00, 0x1F, 0x00, 0x7C, 0x00, 0x00, 0x03, 0xE0, 0x07, 0xE0,
-  0x00, 0x00, 0x7E, 0x00, 0x3F, 0x80, 0x00, 0x1F, 0xC0, 0x01, 0xFE, 0x00,
-  0x07, 0xF8, 0x00, 0x0F, 0xFC, 0x03, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xFF,
-  0xC0, 0x00, 0x01, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x07, 0xFF, 0xFC, 0x00,
-  0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x7F, 0xFC, 0x03,
-  0xFF, 0xF8, 0x1F, 0xFF, 0xF0, 0xFF, 0xFF, 0xC1, 0xF0, 0x3F, 0x83, 0x80,
-  0x7E, 0x04, 0x01, 0xF8, 0x00, 0x07, 0xE0, 0x00, 0x1F, 0x80, 0x7F, 0xFE,
-  0x07, 0xFF, 0xF8, 0x7F, 0xFF, 0xE3, 0xF8, 0x1F, 0x8F, 0xC0, 0x7E, 0x3E,
-  0x01, 0xF8, 0xF8, 0x07, 0xE3, 0xE0, 0x1F, 0x8F, 0xC1, 0xFE, 0x3F, 0xFE,
-  0xFF, 0xFF, 0xFB, 0xFD, 0xFF, 0xCF, 0xF3, 0xFE, 0x1F, 0xC3, 0xF0, 0x1F,
-  0x00, 0x08, 0x00, 0x10, 0x00, 0x60, 0x00, 0xC0, 0x07, 0x80, 0x0F, 0x00,
-  0x3F, 0x00, 0x7E, 0x01, 0xFC, 0x03, 0xF8, 0x0F, 0xF8, 0x1F, 0xF0, 0x7F,
-  0x80, 0xFF, 0x03, 0xFE, 0x07, 0xFC, 0x3F, 0xF0, 0x7F, 0xE1, 0xFF, 0x83,
-  0xFF, 0x0F, 0xFC, 0x1F, 0xF8, 0x3F, 0xE0, 0x7F, 0xC0, 0xFF, 0x01, 0xFE,
-  0x03, 0xF8, 0x07, 0xF0, 0x0F, 0xF0, 0x1F, 0xE0, 0x3F, 0xC0, 0x7F, 0x80,
-  0xFF, 0x81, 0xFF, 0x01, 0xFF, 0x03, 0xFE, 0x03, 0xFE, 0x07, 0xFC, 0x07,
-  0xFC, 0x0F, 0xF8, 0x0F, 0xF8, 0x1F, 0xF0, 0x1F, 0xF0, 0x3F, 0xE0, 0x1F,
-  0xE0, 0x3F, 0xC0, 0x3F, 0x00, 0x7E, 0x00, 0x7C, 0x00, 0xF8, 0x00, 0xE0,
-  0x01, 0xC0, 0x01, 0x80, 0x03, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x7F,
-  0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x1F, 0xC0,
-  0x00, 0x00, 0x7F, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x07, 0xF0, 0x00,
-  0x00, 0x1F, 0xC0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x01, 0xFC, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x7F, 0x00, 0x01, 0xFF, 0xF0, 0x01, 0xFF,
-  0xFC, 0x01, 0xF0, 0x1F, 0x01, 0xE0, 0x03, 0xC1, 0xE0, 0x00, 0xF1, 0xE0,
-  0x00, 0x3C, 0xE3, 0xFE, 0x0E, 0x71, 0xFF, 0x87, 0x70, 0xFF, 0xE1, 0xF8,
-  0x78, 0xF0, 0xFC, 0x3C, 0x38, 0x7E, 0x1E, 0x3C, 0x3F, 0x0F, 0xFE, 0x1F,
-  0x87, 0xFE, 0x0F, 0xC3, 0xFE, 0x07, 0xE1, 0xE7, 0x83, 0xB8, 0xF1, 0xC3,
-  0x9C, 0x78, 0xF1, 0xCF, 0x00, 0x05, 0xE3, 0xC0, 0x01, 0xE0, 0xF0, 0x01,
-  0xE0, 0x3E, 0x03, 0xE0, 0x0F, 0xFF, 0xE0, 0x03, 0xFF, 0xE0, 0x00, 0x3F,
-  0x80, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0xFC, 0x00, 0x1F, 0xFE, 0x00, 0xFF, 0xFC,
-  0x07, 0xFF, 0xF8, 0x3F, 0xFF, 0xF1, 0xFF, 0xFF, 0xE7, 0xF8, 0x7F, 0xBF,
-  0x80, 0x7F, 0xFC, 0x00, 0xFF, 0xF0, 0x03, 0xFF, 0xC0, 0x0F, 0xFE, 0x00,
-  0x1F, 0xF8, 0x00, 0xFF, 0xF0, 0x03, 0xFF, 0xC0, 0x0F, 0xFF, 0x00, 0x3F,
-  0xFE, 0x01, 0xFD, 0xFE, 0x1F, 0xE7, 0xFF, 0xFF, 0x8F, 0xFF, 0xFC, 0x1F,
-  0xFF, 0xE0, 0x3F, 0xFF, 0x00, 0x7F, 0xF8, 0x00, 0x3F, 0x00, 0x00, 0x1F,
-  0xE0, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x07, 0xF8,
-  0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x01, 0xFE, 0x00,
-  0x00, 0x07, 0xF8, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x7F, 0x80, 0x00,
-  0x01, 0xFE, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFC, 0x00, 0x7F, 0x80, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x07, 0xF8,
-  0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x01, 0xFE, 0x00,
-  0x00, 0x07, 0xF8, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x7F, 0x80, 0x00,
-  0x01, 0xFE, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xC0, 0x07, 0xF8, 0x07, 0xFF, 0x83, 0xFF, 0xF1, 0xFF, 0xFE, 0xFF, 0xFF,
-  0xBF, 0x07, 0xFF, 0x81, 0xFC, 0x60, 0x3F, 0x00, 0x1F, 0xC0, 0x07, 0xE0,
-  0x03, 0xF8, 0x01, 0xFC, 0x01, 0xFE, 0x00, 0xFF, 0x00, 0x7F, 0x80, 0x7F,
-  0x80, 0x3F, 0xC0, 0x1F, 0x80, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x03, 0xF8, 0x01, 0xFF, 0xE0, 0xFF, 0xFE,
-  0x3F, 0xFF, 0xE7, 0xFF, 0xFC, 0x7C, 0x3F, 0x86, 0x03, 0xF0, 0x80, 0x7E,
-  0x00, 0x1F, 0xC0, 0x7F, 0xF0, 0x0F, 0xFC, 0x01, 0xFE, 0x00, 0x3F, 0xF0,
-  0x07, 0xFF, 0x80, 0x03, 0xF0, 0x00, 0x3F, 0x10, 0x07, 0xE7, 0x01, 0xFF,
-  0xF8, 0x7F, 0xFF, 0xFF, 0xE7, 0xFF, 0xFC, 0x7F, 0xFF, 0x07, 0xFF, 0xC0,
-  0x1F, 0xC0, 0x02, 0x00, 0x3C, 0x01, 0xF8, 0x1F, 0xF0, 0xFF, 0x0F, 0xF0,
-  0x7F, 0x07, 0xF8, 0x3F, 0x83, 0xF8, 0x1F, 0x81, 0xFC, 0x03, 0xC0, 0x04,
-  0x00, 0xFF, 0x80, 0x07, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xE0, 0x01, 0xFF,
-  0xFF, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0xC0, 0x03, 0xFF, 0xFE,
-  0x00, 0x1F, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0x80, 0x07, 0xFF, 0xFC, 0x00,
-  0x3F, 0xFF, 0xE0, 0x01, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x7F,
-  0xFF, 0xC0, 0x03, 0xFF, 0xFE, 0x00, 0x1F, 0xFF, 0xF0, 0x00, 0xFF, 0xFF,
-  0x80, 0x07, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xE0, 0x01, 0xFF, 0xFF, 0x00,
-  0x0F, 0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0xC0, 0x03, 0xFF, 0xFE, 0x00, 0x1F,
-  0xFF, 0xF0, 0x01, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xFC, 0x00, 0x7F, 0xFF,
-  0xF0, 0x07, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF,
-  0xFB, 0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xDF, 0xF8, 0xFF, 0xFE, 0xFF, 0x87,
-  0xFF, 0xF9, 0xF0, 0x00, 0x3F, 0xC0, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x0F,
-  0xF0, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x1F, 0xE0,
-  0x00, 0x00, 0xFF, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x3F, 0xC0, 0x00,
-  0x01, 0xFE, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00,
-  0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x1F, 0xFF, 0xFF, 0xFF, 0x03, 0xFF, 0xFF,
-  0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0xF1, 0xFF,
-  0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xE0, 0x3F, 0x03, 0xFF, 0xFE, 0x03, 0xF0,
-  0x7F, 0xFF, 0xE0, 0x3F, 0x07, 0xFF, 0xFE, 0x03, 0xF0, 0x7F, 0xFF, 0xE0,
-  0x3F, 0x0F, 0xFF, 0xFE, 0x03, 0xF0, 0xFF, 0xFF, 0xE0, 0x3F, 0x0F, 0xFF,
-  0xFE, 0x03, 0xF0, 0xFF, 0xFF, 0xE0, 0x3F, 0x0F, 0xFF, 0xFE, 0x03, 0xF0,
-  0x7F, 0xFF, 0xE0, 0x3F, 0x07, 0xFF, 0xFE, 0x03, 0xF0, 0x7F, 0xFF, 0xE0,
-  0x3F, 0x03, 0xFF, 0xFE, 0x03, 0xF0, 0x3F, 0xFF, 0xE0, 0x3F, 0x01, 0xFF,
-  0xFE, 0x03, 0xF0, 0x0F, 0xFF, 0xE0, 0x3F, 0x00, 0xFF, 0xFE, 0x03, 0xF0,
-  0x03, 0xFF, 0xE0, 0x3F, 0x00, 0x1F, 0xFE, 0x03, 0xF0, 0x00, 0x3F, 0xE0,
-  0x3F, 0x00, 0x00, 0x7E, 0x03, 0xF0, 0x00, 0x07, 0xE0, 0x3F, 0x00, 0x00,
-  0x7E, 0x03, 0xF0, 0x00, 0x07, 0xE0, 0x3F, 0x00, 0x00, 0x7E, 0x03, 0xF0,
-  0x00, 0x07, 0xE0, 0x3F, 0x00, 0x00, 0x7E, 0x03, 0xF0, 0x00, 0x07, 0xE0,
-  0x3F, 0x00, 0x00, 0x7E, 0x03, 0xF0, 0x00, 0x07, 0xE0, 0x3F, 0x00, 0x00,
-  0x7E, 0x03, 0xF0, 0x00, 0x07, 0xE0, 0x3F, 0x00, 0x00, 0x7E, 0x03, 0xF0,
-  0x00, 0x07, 0xE0, 0x3F, 0x00, 0x00, 0x7E, 0x03, 0xF0, 0x00, 0x07, 0xE0,
-  0x3F, 0x00, 0x00, 0x7E, 0x03, 0xF0, 0x00, 0x07, 0xE0, 0x3F, 0x00, 0x00,
-  0x7E, 0x03, 0xF0, 0x00, 0x07, 0xE0, 0x3F, 0x00, 0x00, 0x7E, 0x03, 0xF0,
-  0x00, 0x07, 0xE0, 0x3F, 0x00, 0x00, 0x7E, 0x03, 0xF0, 0x00, 0x07, 0xE0,
-  0x3F, 0x00, 0x00, 0x7E, 0x03, 0xF0, 0x00, 0x07, 0xE0, 0x3F, 0x00, 0x3F,
-  0x1F, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x8F, 0xC0,
-  0x07, 0x80, 0x07, 0x80, 0x07, 0x80, 0x07, 0x80, 0x0F, 0x00, 0x0F, 0xFC,
-  0x00, 0xFE, 0x00, 0x3F, 0x10, 0x3F, 0x38, 0x7F, 0x7F, 0xFE, 0xFF, 0xFE,
-  0x3F, 0xFC, 0x0F, 0xF0, 0x07, 0xFC, 0x00, 0xFF, 0xC0, 0x0F, 0xFC, 0x01,
-  0xFF, 0xC0, 0x3F, 0xFC, 0x07, 0xEF, 0xC0, 0xFC, 0xFC, 0x07, 0xCF, 0xC0,
-  0x38, 0xFC, 0x01, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x0F, 0xC0, 0x00, 0xFC,
-  0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x0F,
-  0xC0, 0x3F, 0xFF, 0xF3, 0xFF, 0xFF, 0x3F, 0xFF, 0xF3, 0xFF, 0xFF, 0x3F,
-  0xFF, 0xF0, 0x01, 0xFC, 0x00, 0x3F, 0xF8, 0x07, 0xFF, 0xF0, 0x7F, 0xFF,
-  0xC7, 0xFF, 0xFE, 0x3F, 0x83, 0xFB, 0xF8, 0x0F, 0xDF, 0x80, 0x3F, 0xFC,
-  0x01, 0xFF, 0xE0, 0x0F, 0xFF, 0x00, 0x7F, 0xF8, 0x03, 0xFF, 0xC0, 0x1F,
-  0xFE, 0x00, 0xFF, 0xF0, 0x07, 0xFF, 0x80, 0x3F, 0xFC, 0x01, 0xFF, 0xF0,
-  0x1F, 0x9F, 0xC1, 0xFC, 0xFF, 0xFF, 0xC3, 0xFF, 0xFE, 0x0F, 0xFF, 0xE0,
-  0x3F, 0xFE, 0x00, 0x3F, 0x80, 0x20, 0x00, 0x40, 0x00, 0xC0, 0x01, 0x80,
-  0x03, 0xC0, 0x07, 0x80, 0x1F, 0x80, 0x3F, 0x00, 0x7F, 0x00, 0xFE, 0x03,
-  0xFE, 0x07, 0xFC, 0x03, 0xFC, 0x07, 0xF8, 0x0F, 0xF8, 0x1F, 0xF0, 0x1F,
-  0xF8, 0x3F, 0xF0, 0x3F, 0xF0, 0x7F, 0xE0, 0x7F, 0xE0, 0xFF, 0xC0, 0xFF,
-  0x81, 0xFF, 0x01, 0xFE, 0x03, 0xFC, 0x03, 0xF8, 0x07, 0xF0, 0x1F, 0xE0,
-  0x3F, 0xC0, 0x7F, 0x80, 0xFF, 0x03, 0xFE, 0x07, 0xFC, 0x1F, 0xF0, 0x3F,
-  0xE0, 0xFF, 0x81, 0xFF, 0x07, 0xFC, 0x0F, 0xF8, 0x3F, 0xE0, 0x7F, 0xC1,
-  0xFF, 0x03, 0xFE, 0x0F, 0xF0, 0x1F, 0xE0, 0x1F, 0x80, 0x3F, 0x00, 0x7C,
-  0x00, 0xF8, 0x00, 0xE0, 0x01, 0xC0, 0x03, 0x00, 0x06, 0x00, 0x00, 0x07,
-  0xFC, 0x00, 0x00, 0x00, 0xFC, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0x00,
-  0x3F, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x0F, 0xFE, 0x00, 0x00, 0x03, 0xF0,
-  0x03, 0xFF, 0xC0, 0x00, 0x00, 0x7E, 0x00, 0xFD, 0xF8, 0x00, 0x00, 0x1F,
-  0x80, 0x3F, 0x3F, 0x00, 0x00, 0x07, 0xE0, 0x03, 0xE7, 0xE0, 0x00, 0x01,
-  0xF8, 0x00, 0x38, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0x02, 0x1F, 0x80, 0x00,
-  0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x7E, 0x00,
-  0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x1F, 0x80, 0x00, 0x01, 0xF8,
-  0x00, 0x07, 0xE0, 0x00, 0x00, 0x3F, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x07,
-  0xE0, 0x00, 0x7E, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-  0x1F, 0x80, 0x03, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0xFC, 0x00, 0x00,
-  0x1F, 0xFF, 0xF8, 0x3F, 0x80, 0x00, 0x03, 0xFF, 0xFF, 0x07, 0xE0, 0x00,
-  0x00, 0x7F, 0xFF, 0xE1, 0xF8, 0x00, 0xFE, 0x0F, 0xFF, 0xFC, 0x7E, 0x00,
-  0x3F, 0xC0, 0x00, 0x00, 0x1F, 0xC0, 0x0F, 0xF8, 0x00, 0x00, 0x03, 0xF0,
-  0x03, 0xFF, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x3F,
-  0x00, 0x1F, 0xFC, 0x00, 0x00, 0x07, 0xE0, 0x07, 0xDF, 0x80, 0x00, 0x01,
-  0xF8, 0x00, 0xFB, 0xF0, 0x00, 0x00, 0x7E, 0x00, 0x3E, 0x7E, 0x00, 0x00,
-  0x1F, 0x80, 0x0F, 0x8F, 0xC0, 0x00, 0x03, 0xF0, 0x01, 0xE1, 0xF8, 0x00,
-  0x00, 0xFC, 0x00, 0x7C, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x1F, 0x07, 0xE0,
-  0x00, 0x0F, 0xC0, 0x03, 0xC0, 0xFC, 0x00, 0x01, 0xF8, 0x00, 0xFF, 0xFF,
-  0xF0, 0x00, 0x7E, 0x00, 0x1F, 0xFF, 0xFE, 0x00, 0x1F, 0x80, 0x03, 0xFF,
-  0xFF, 0xC0, 0x07, 0xE0, 0x00, 0x7F, 0xFF, 0xF8, 0x00, 0xFC, 0x00, 0x0F,
-  0xFF, 0xFF, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x00,
-  0x00, 0x07, 0xE0, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0xFE, 0x00,
-  0x00, 0x00, 0x1F, 0x80, 0x07, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0x00, 0xFF,
-  0xC0, 0x00, 0x00, 0x1F, 0x80, 0x0F, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x01,
-  0xFF, 0xC0, 0x00, 0x00, 0x7E, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x07, 0xE0,
-  0x07, 0xEF, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0xFC, 0xFC, 0x00, 0x00, 0x1F,
-  0x80, 0x07, 0xCF, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x38, 0xFC, 0x00, 0x00,
-  0x3F, 0x00, 0x01, 0x0F, 0xC0, 0x00, 0x07, 0xE0, 0x00, 0x00, 0xFC, 0x00,
-  0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x1F, 0x80, 0x00, 0x00, 0xFC,
-  0x00, 0x01, 0xF8, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x00, 0x00,
-  0xFC, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x00,
-  0x00, 0xFC, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0x01, 0xF8, 0x00,
-  0x00, 0x3F, 0xFF, 0xF0, 0x3F, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x07, 0xF0,
-  0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x7E, 0x01, 0xFE, 0x03, 0xFF, 0xFF, 0x0F,
-  0xC0, 0x7F, 0xF8, 0x3F, 0xFF, 0xF1, 0xF8, 0x0F, 0xFF, 0xC0, 0x00, 0x00,
-  0x3F, 0x81, 0xFF, 0xFE, 0x00, 0x00, 0x03, 0xF0, 0x3F, 0xFF, 0xE0, 0x00,
-  0x00, 0x7E, 0x03, 0xF0, 0x7F, 0x00, 0x00, 0x0F, 0xC0, 0x3E, 0x07, 0xF0,
-  0x00, 0x00, 0xFC, 0x00, 0x60, 0x3F, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x07,
-  0xF0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x7E, 0x00, 0x00,
-  0x0F, 0xE0, 0x00, 0x07, 0xE0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0xFC, 0x00,
-  0x00, 0x3F, 0xC0, 0x00, 0x1F, 0x80, 0x00, 0x07, 0xF8, 0x00, 0x03, 0xF0,
-  0x00, 0x00, 0xFF, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x07,
-  0xE0, 0x00, 0x07, 0xF8, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xFE, 0x00, 0x00,
-  0x1F, 0x80, 0x00, 0x1F, 0x80, 0x00, 0x01, 0xF8, 0x00, 0x03, 0xFF, 0xFF,
-  0x00, 0x3F, 0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x07, 0xE0, 0x00, 0x03, 0xFF,
-  0xFF, 0x00, 0xFC, 0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x1F, 0xC0, 0x00, 0x03,
-  0xFF, 0xFF, 0x03, 0xF8, 0x00, 0x00, 0x01, 0xF8, 0x03, 0xFF, 0xC0, 0x00,
-  0x00, 0xFC, 0x03, 0xFF, 0xF8, 0x00, 0x00, 0x7E, 0x01, 0xFF, 0xFF, 0x00,
-  0x00, 0x3F, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x0F, 0xC0, 0x0F, 0x87, 0xF0,
-  0x00, 0x07, 0xE0, 0x01, 0x80, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0x40, 0x3F,
-  0x00, 0x01, 0xF8, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x7E, 0x00, 0x00, 0xFF,
-  0xE0, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x1F, 0x80, 0x00, 0x0F,
-  0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xFF, 0x00, 0x03, 0xF0, 0x00, 0x00,
-  0xFF, 0xF0, 0x01, 0xF8, 0x00, 0x00, 0x00, 0xFC, 0x00, 0xFC, 0x00, 0x00,
-  0x00, 0x1F, 0x80, 0x7E, 0x00, 0x00, 0x10, 0x07, 0xE0, 0x1F, 0x80, 0x00,
-  0x0E, 0x03, 0xF8, 0x0F, 0xC0, 0x00, 0x0F, 0xE1, 0xFE, 0x07, 0xE0, 0x00,
-  0x03, 0xFF, 0xFF, 0x03, 0xF8, 0x00, 0x00, 0x7F, 0xFF, 0xC0, 0xFC, 0x00,
-  0x00, 0x0F, 0xFF, 0xE0, 0x7E, 0x00, 0x3F, 0x81, 0xFF, 0xF0, 0x3F, 0x00,
-  0x1F, 0xE0, 0x1F, 0xE0, 0x1F, 0xC0, 0x0F, 0xF8, 0x00, 0x00, 0x07, 0xE0,
-  0x07, 0xFE, 0x00, 0x00, 0x03, 0xF0, 0x01, 0xFF, 0x80, 0x00, 0x01, 0xF8,
-  0x00, 0xFF, 0xE0, 0x00, 0x00, 0x7E, 0x00, 0x7D, 0xF8, 0x00, 0x00, 0x3F,
-  0x00, 0x1F, 0x7E, 0x00, 0x00, 0x1F, 0x80, 0x0F, 0x9F, 0x80, 0x00, 0x0F,
-  0xC0, 0x07, 0xC7, 0xE0, 0x00, 0x03, 0xF0, 0x01, 0xE1, 0xF8, 0x00, 0x01,
-  0xF8, 0x00, 0xF8, 0x7E, 0x00, 0x00, 0xFC, 0x00, 0x7C, 0x1F, 0x80, 0x00,
-  0x7E, 0x00, 0x1E, 0x07, 0xE0, 0x00, 0x1F, 0x80, 0x0F, 0xFF, 0xFF, 0x00,
-  0x0F, 0xC0, 0x03, 0xFF, 0xFF, 0xC0, 0x07, 0xE0, 0x00, 0xFF, 0xFF, 0xF0,
-  0x03, 0xF0, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0xFC, 0x00, 0x0F, 0xFF, 0xFF,
-  0x00, 0x7E, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x1F,
-  0x80, 0x1F, 0x80, 0x00, 0x00, 0x07, 0xE0, 0x0F, 0xE0, 0x00, 0x00, 0x01,
-  0xF8, 0x00, 0x0F, 0xC0, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x3F, 0xF0, 0x00,
-  0x03, 0xFF, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x3F,
-  0xF0, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0xFC, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x1F, 0xE0,
-  0x00, 0x01, 0xFE, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x01, 0xFE, 0x00, 0x00,
-  0x7F, 0xE0, 0x00, 0x1F, 0xFE, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0xFF, 0xFE,
-  0x00, 0x1F, 0xFF, 0xE0, 0x03, 0xFF, 0xC0, 0x00, 0x3F, 0xF0, 0x00, 0x07,
-  0xFC, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0xFF, 0x80,
-  0x00, 0x0F, 0xF8, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x0F, 0xF8, 0x00, 0x40,
-  0xFF, 0x80, 0x07, 0x0F, 0xF8, 0x00, 0x7E, 0xFF, 0x80, 0x0F, 0xF7, 0xFC,
-  0x00, 0xFF, 0x7F, 0xC0, 0x1F, 0xE3, 0xFF, 0x07, 0xFE, 0x3F, 0xFF, 0xFF,
-  0xC1, 0xFF, 0xFF, 0xF8, 0x0F, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0xE0, 0x01,
-  0xFF, 0xF8, 0x00, 0x03, 0xFE, 0x00 };
+#include "fontdata.h"
+
+const uint8_t IBMPlexSans_SemiBold32pt8bPackedData[] PROGMEM = {
+  0x00, 0x01, 0xF0, 0x00, 0x12, 0x86, 0x01, 0x34, 0xC0, 0x6A, 0x81, 0xC0,
+  0x79, 0x80, 0xC0, 0x97, 0x81, 0xC0, 0xA6, 0x01, 0xC7, 0xC0, 0x5B, 0xC0,
+  0x6A, 0xC0, 0x79, 0xC0, 0x79, 0xC0, 0x79, 0xC0, 0x79, 0x02, 0x39, 0x69,
+  0xC0, 0x76, 0xA9, 0x80, 0xC0, 0x77, 0x99, 0x80, 0xC0, 0x87, 0x98, 0x80,
+  0xC0, 0x78, 0x89, 0x81, 0xC0, 0x87, 0x98, 0x89, 0xC0, 0x88, 0x78, 0xC0,
+  0x89, 0x88, 0x81, 0xC0, 0x98, 0x87, 0x80, 0xC0, 0x89, 0x78, 0x80, 0xC0,
+  0x99, 0x77, 0x80, 0xC0, 0x9A, 0x67, 0x01, 0xF0, 0x03, 0x1A, 0xC0, 0x97,
+  0xC0, 0x97, 0xC0, 0x97, 0xC0, 0x97, 0xC0, 0xA6, 0xC0, 0xA6, 0x01, 0xAC,
+  0xC0, 0x78, 0xC0, 0x78, 0x80, 0xC0, 0x78, 0xC0, 0x78, 0x02, 0x58, 0x17,
+  0xC0, 0x77, 0x88, 0xC0, 0x77, 0x88, 0xC0, 0x87, 0x88, 0xC0, 0x77, 0x88,
+  0xC0, 0x78, 0x88, 0xC0, 0x77, 0x88, 0xC0, 0x87, 0x88, 0xC0, 0xA7, 0x88,
+  0xC0, 0x97, 0x88, 0xC0, 0x97, 0x88, 0x01, 0xF0, 0x0F, 0x08, 0x93, 0x01,
+  0xF0, 0x03, 0x1E, 0x84, 0x01, 0xB8, 0xC0, 0x5B, 0xC0, 0x6A, 0xC0, 0x79,
+  0xC0, 0x79, 0xC0, 0x79, 0xC0, 0x79, 0x02, 0x29, 0x6A, 0xC0, 0x76, 0xA9,
+  0xC0, 0x87, 0x98, 0xC0, 0x78, 0x88, 0xC0, 0xA7, 0x88, 0xC0, 0xB8, 0x98,
+  0xC0, 0x97, 0x88, 0x01, 0xF0, 0x16, 0x08, 0xC0, 0x78, 0x81, 0xC0, 0x77,
+  0x80, 0xC0, 0x77, 0xC0, 0x78, 0xC0, 0x77, 0xC0, 0x87, 0xC0, 0x67, 0xC0,
+  0x78, 0xC0, 0x77, 0xC0, 0x76, 0xC0, 0x77, 0xC0, 0x77, 0xC0, 0x77, 0xC0,
+  0x77, 0xC0, 0x67, 0xC0, 0x76, 0xC0, 0x77, 0xC0, 0x77, 0xC0, 0x77, 0xC0,
+  0x77, 0x01, 0xF0, 0x01, 0x1E, 0x85, 0x01, 0xB9, 0xC0, 0x5B, 0xC0, 0x6A,
+  0xC0, 0x69, 0xC0, 0x79, 0xC0, 0x79, 0x02, 0x1A, 0x6A, 0xC0, 0x96, 0xA9,
+  0xC0, 0x97, 0x98, 0xC0, 0xA7, 0x88, 0xC0, 0x97, 0x99, 0x01, 0xF0, 0x16,
+  0x09, 0x81, 0xC0, 0x87, 0xC0, 0x78, 0xC0, 0x87, 0xC0, 0x78, 0xC0, 0x67,
+  0xC0, 0x07, 0xC0, 0x86, 0xC0, 0x86, 0xC0, 0x89, 0xC0, 0x8A, 0xC0, 0x8A,
+  0x01, 0xF0, 0x12, 0x0B, 0xC0, 0xA9, 0xC0, 0x98, 0xC0, 0x99, 0x80, 0xC0,
+  0x98, 0x82, 0x02, 0x50, 0xF0, 0x11, 0x08, 0xC0, 0x79, 0x78, 0xC0, 0x68,
+  0x88, 0xC0, 0x79, 0x78, 0xC0, 0x7A, 0x77, 0xC0, 0x8A, 0x68, 0x01, 0xF0,
+  0x01, 0x1C, 0xC0, 0x97, 0xC0, 0x97, 0xC0, 0xA6, 0xC0, 0xA6, 0xC0, 0xB5,
+  0x01, 0xF0, 0x11, 0x0B, 0x80, 0xC0, 0x78, 0xC0, 0x78, 0x80, 0xC0, 0x78,
+  0x80, 0xC0, 0x78, 0x02, 0xC6, 0x17, 0x80, 0xC0, 0x77, 0x88, 0xC0, 0x87,
+  0x88, 0xC0, 0x78, 0x88, 0xC0, 0x77, 0x88, 0x80, 0xC0, 0x77, 0x88, 0xC0,
+  0x77, 0x88, 0x80, 0xC0, 0x77, 0x88, 0x80, 0xC0, 0x77, 0x88, 0xC0, 0x77,
+  0x88, 0x80, 0xC0, 0x77, 0x88, 0x80, 0xC0, 0x77, 0x88, 0xC0, 0x77, 0x88,
+  0x80, 0xC0, 0x77, 0x88, 0x01, 0xF0, 0x00, 0x22, 0x84, 0x01, 0xF0, 0x14,
+  0x08, 0x87, 0x01, 0xF0, 0x03, 0x1A, 0x80, 0xC0, 0x78, 0x83, 0x01, 0x26,
+  0x82, 0xC0, 0x87, 0x83, 0x02, 0x25, 0x66, 0xC0, 0x78, 0x6B, 0xC0, 0x88,
+  0x6A, 0xC0, 0x88, 0x89, 0xC0, 0x88, 0x79, 0x01, 0xF0, 0x01, 0x1C, 0x02,
+  0x1A, 0x6A, 0xC0, 0x86, 0xA9, 0xC0, 0x97, 0x98, 0x01, 0xF0, 0x15, 0x09,
+  0xC0, 0x99, 0x85, 0x02, 0x50, 0xF0, 0x10, 0x09, 0xC0, 0x79, 0x87, 0xC0,
+  0x68, 0x78, 0xC0, 0x79, 0x88, 0xC0, 0x79, 0x77, 0xC0, 0x8B, 0x68, 0x01,
+  0xF0, 0x01, 0x1B, 0xC0, 0x97, 0xC0, 0x97, 0xC0, 0x96, 0xC0, 0xA7, 0xC0,
+  0xC5, 0x01, 0xF0, 0x0F, 0x0C, 0xC0, 0x76, 0xC0, 0x77, 0xC0, 0x76, 0xC0,
+  0x77, 0xC0, 0x77, 0xC0, 0x77, 0xC0, 0x77, 0xC0, 0x77, 0xC0, 0x77, 0xC0,
+  0x87, 0xC0, 0x77, 0xC0, 0x77, 0xC0, 0x87, 0xC0, 0x78, 0xC0, 0x87, 0x02,
+  0x28, 0x56, 0xC0, 0x87, 0x5B, 0xC0, 0x88, 0x79, 0xC0, 0x77, 0x79, 0xC0,
+  0x88, 0x79, 0xC0, 0x88, 0x89, 0x02, 0x1B, 0x6A, 0xC0, 0x76, 0xA9, 0xC0,
+  0x87, 0x98, 0xC0, 0x88, 0x99, 0xC0, 0x87, 0x88, 0x80, 0xC0, 0x88, 0x98,
+  0x82, 0xC0, 0x98, 0x88, 0xC0, 0x88, 0x78, 0xC0, 0x88, 0x87, 0xC0, 0x89,
+  0x88, 0xC0, 0x98, 0x78, 0xC0, 0x89, 0x77, 0xC0, 0x9A, 0x68, 0x01, 0xF0,
+  0x04, 0x19, 0xC0, 0x97, 0xC0, 0x97, 0xC0, 0x97, 0xC0, 0xA6, 0xC0, 0xB5,
+  0x01, 0xF0, 0x00, 0x1E, 0x84, 0x02, 0x06, 0xF0, 0x0F, 0x08, 0xC0, 0x88,
+  0x78, 0xC0, 0x88, 0x87, 0x80, 0xC0, 0x88, 0x78, 0xC0, 0x88, 0x87, 0xC0,
+  0x88, 0x78, 0x80, 0xC0, 0x88, 0x87, 0x01, 0xF0, 0x12, 0x09, 0xC0, 0x87,
+  0xC0, 0x78, 0x80, 0xC0, 0x87, 0xC0, 0x78, 0xC0, 0x87, 0xC0, 0x78, 0x80,
+  0xC0, 0x87, 0xC0, 0x78, 0xC0, 0x87, 0xC0, 0x78, 0x80, 0xC0, 0x87, 0xC0,
+  0x78, 0xC0, 0x87, 0xC0, 0x78, 0x80, 0xC0, 0x87, 0xC0, 0x78, 0xC0, 0x87,
+  0xC0, 0x78, 0x80, 0xC0, 0x87, 0xC0, 0x78, 0xC0, 0x87, 0xC0, 0x78, 0x80,
+  0x01, 0xB9, 0xC0, 0x5B, 0xC0, 0x6A, 0xC0, 0x79, 0xC0, 0x79, 0xC0, 0x79,
+  0x02, 0x2A, 0x69, 0xC0, 0x86, 0xA9, 0xC0, 0x87, 0x98, 0xC0, 0x78, 0x89,
+  0xC0, 0x87, 0x98, 0x82, 0xC0, 0x88, 0x87, 0xC0, 0x98, 0x88, 0xC0, 0x89,
+  0x78, 0xC0, 0x98, 0x87, 0xC0, 0x89, 0x78, 0xC0, 0x9A, 0x67, 0x01, 0xF0,
+  0x05, 0x16, 0xC0, 0xA6, 0xC0, 0xA6, 0xC0, 0x6A, 0xC0, 0x6A, 0xC0, 0x6A,
+  0x02, 0x2A, 0x6A, 0xC0, 0x86, 0xA8, 0xC0, 0x77, 0x99, 0xC0, 0x87, 0x98,
+  0xC0, 0x78, 0x89, 0x85, 0xC0, 0x99, 0x77, 0xC0, 0x89, 0x78, 0xC0, 0x9A,
+  0x67, 0x01, 0xF0, 0x02, 0x1C, 0xC0, 0x97, 0xC0, 0x97, 0xC0, 0xA6, 0xC0,
+  0xA6, 0xC0, 0xB5, 0x01, 0xB8, 0xC0, 0x5B, 0xC0, 0x7A, 0xC0, 0x69, 0xC0,
+  0x79, 0xC0, 0x79, 0x02, 0x2A, 0x69, 0xC0, 0x86, 0xA9, 0xC0, 0x77, 0x98,
+  0xC0, 0x87, 0x88, 0xC0, 0x78, 0x99, 0x80, 0xC0, 0x87, 0x88, 0xC0, 0x88,
+  0x89, 0x82, 0xC0, 0x89, 0x88, 0x80, 0xC0, 0x88, 0x78, 0xC0, 0x99, 0x88,
+  0xC0, 0x89, 0x78, 0xC0, 0x8A, 0x67, 0x02, 0xF0, 0x02, 0x14, 0x17, 0xC0,
+  0x98, 0x88, 0xC0, 0x97, 0x78, 0xC0, 0x97, 0x87, 0xC0, 0x97, 0x88, 0xC0,
+  0xB5, 0x78, 0x01, 0xF0, 0x15, 0x08, 0xC0, 0x78, 0xC0, 0x87, 0xC0, 0x78,
+  0xC0, 0x77, 0xC0, 0x77, 0xC0, 0x78, 0xC0, 0x77, 0xC0, 0x77, 0xC0, 0x77,
+  0xC0, 0x77, 0xC0, 0x77, 0xC0, 0x77, 0xC0, 0x67, 0xC0, 0x77, 0xC0, 0x67,
+  0x03, 0x07, 0xF0, 0x0F, 0x0A, 0xF0, 0x0F, 0x08, 0x80, 0xC0, 0x89, 0x88,
+  0x88, 0xC0, 0x98, 0x89, 0x77, 0xC0, 0x88, 0x78, 0x88, 0x81, 0xC0, 0x89,
+  0x88, 0x87, 0xC0, 0x98, 0x79, 0x78, 0x81, 0x04, 0x27, 0xB5, 0x25, 0xB6,
+  0xC0, 0x99, 0x88, 0x89, 0x88, 0xC0, 0x88, 0x78, 0x88, 0x78, 0x80, 0xC0,
+  0x88, 0x87, 0x88, 0x88, 0xC0, 0x98, 0x88, 0x99, 0x87, 0xC0, 0x89, 0x78,
+  0x88, 0x88, 0xC0, 0x88, 0x88, 0x88, 0x78, 0xC0, 0x88, 0x87, 0x88, 0x88,
+  0xC0, 0x88, 0x88, 0x99, 0x87, 0xC0, 0x98, 0x78, 0x88, 0x88, 0xC0, 0x89,
+  0x88, 0x88, 0x78, 0xC0, 0x88, 0x87, 0x88, 0x88, 0xC0, 0x88, 0x88, 0x99,
+  0x87, 0xC0, 0x98, 0x78, 0x88, 0x88, 0x80, 0xC0, 0x89, 0x87, 0x88, 0x78,
+  0xC0, 0x88, 0x88, 0x98, 0x87, 0xC0, 0x98, 0x78, 0x89, 0x88, 0x80, 0xC0,
+  0x89, 0x87, 0x88, 0x88, 0xC0, 0x88, 0x88, 0x98, 0x77, 0x03, 0x86, 0x15,
+  0xCD, 0x02, 0x8D, 0xCD, 0xC0, 0x87, 0x88, 0xC0, 0x88, 0x87, 0xC0, 0x88,
+  0x98, 0xC0, 0x98, 0x88, 0x80, 0xC0, 0x87, 0x88, 0xC0, 0x88, 0x97, 0xC0,
+  0x98, 0x88, 0x80, 0x01, 0xA8, 0xC0, 0x5B, 0xC0, 0x6A, 0xC0, 0x79, 0xC0,
+  0x79, 0xC0, 0x78, 0x02, 0x19, 0x69, 0xC0, 0xA6, 0x98, 0xC0, 0x97, 0x99,
+  0xC0, 0x97, 0x88, 0xC0, 0x87, 0x98, 0x01, 0xF0, 0x14, 0x08, 0x82, 0x01,
+  0xF0, 0x09, 0x13, 0xC0, 0x58, 0xC0, 0x68, 0xC0, 0x78, 0xC0, 0x78, 0x02,
+  0x19, 0x97, 0xC0, 0x86, 0x88, 0xC0, 0x78, 0x88, 0xC0, 0x87, 0x88, 0x81,
+  0xC0, 0x89, 0x78, 0xC0, 0x88, 0x78, 0x03, 0x19, 0x53, 0x19, 0x02, 0xF0,
+  0x01, 0x13, 0x19, 0xC0, 0x87, 0x88, 0xC0, 0x98, 0x98, 0xC0, 0x97, 0x98,
+  0xC0, 0x97, 0x98, 0x01, 0x77, 0x01, 0xB8, 0xC0, 0x68, 0xC0, 0x68, 0x80,
+  0xC0, 0x78, 0x80, 0xC0, 0x71, 0x86, 0xC0, 0x3F, 0x84, 0xC0, 0xD1, 0x99,
+  0x01, 0x24, 0xC0, 0x79, 0xC0, 0x79, 0x83, 0xC0, 0x97, 0xC0, 0x97, 0x00,
+  0x83, 0x01, 0x08, 0x9F, 0x01, 0xD7, 0x02, 0x07, 0x3B, 0xC0, 0x88, 0x79,
+  0xC0, 0x88, 0x79, 0xC0, 0x88, 0x89, 0x01, 0xF0, 0x00, 0x1A, 0x02, 0x0A,
+  0x69, 0xC0, 0x87, 0x98, 0xC0, 0x87, 0x98, 0xC0, 0x87, 0x88, 0xC0, 0x88,
+  0x89, 0xC0, 0x88, 0x98, 0x95, 0x01, 0xF0, 0x00, 0x1A, 0x84, 0x02, 0x05,
+  0xE5, 0xA3, 0x01, 0xF0, 0x00, 0x1A, 0x84 };
 
 const GFXglyph IBMPlexSans_SemiBold32pt8bGlyphs[] PROGMEM = {
   {     0,   1,   1,  15,    0,    0 },   // 0x20 ' '
-  {     1,  11,  45,  19,    4,  -43 },   // 0x21 '!'
-  {    63,  21,  20,  30,    4,  -46 },   // 0x22 '"'
-  {   116,  39,  44,  41,    1,  -43 },   // 0x23 '#'
-  {   331,  33,  55,  38,    2,  -48 },   // 0x24 '$'
-  {   558,  54,  46,  60,    3,  -44 },   // 0x25 '%'
-  {   869,  40,  46,  45,    4,  -44 },   // 0x26 '&'
-  {  1099,   8,  20,  16,    4,  -46 },   // 0x27 '''
-  {  1119,  19,  57,  21,    3,  -47 },   // 0x28 '('
-  {  1255,  19,  57,  21,   -1,  -47 },   // 0x29 ')'
-  {  1391,  31,  29,  35,    2,  -46 },   // 0x2A '*'
-  {  1504,  30,  30,  38,    4,  -33 },   // 0x2B '+'
-  {  1617,  13,  18,  19,    2,   -8 },   // 0x2C ','
-  {  1647,  18,   8,  25,    4,  -22 },   // 0x2D '-'
-  {  1665,  11,  10,  19,    4,   -8 },   // 0x2E '.'
-  {  1679,  24,  57,  28,    1,  -46 },   // 0x2F '/'
-  {  1850,  32,  46,  38,    3,  -44 },   // 0x30 '0'
-  {  2034,  33,  44,  38,    3,  -43 },   // 0x31 '1'
-  {  2216,  31,  45,  38,    3,  -44 },   // 0x32 '2'
-  {  2391,  31,  46,  38,    2,  -44 },   // 0x33 '3'
-  {  2570,  34,  44,  38,    2,  -43 },   // 0x34 '4'
-  {  2757,  31,  45,  38,    4,  -43 },   // 0x35 '5'
-  {  2932,  32,  45,  38,    3,  -43 },   // 0x36 '6'
-  {  3112,  30,  44,  38,    4,  -43 },   // 0x37 '7'
-  {  3277,  32,  46,  38,    3,  -44 },   // 0x38 '8'
-  {  3461,  32,  45,  38,    3,  -44 },   // 0x39 '9'
-  {  3641,  11,  34,  20,    5,  -32 },   // 0x3A ':'
-  {  3688,  13,  42,  20,    3,  -32 },   // 0x3B ';'
-  {  3757,  26,  37,  38,    6,  -36 },   // 0x3C '<'
-  {  3878,  30,  20,  38,    4,  -28 },   // 0x3D '='
-  {  3953,  26,  37,  38,    6,  -36 },   // 0x3E '>'
-  {  4074,  28,  46,  31,    1,  -44 },   // 0x3F '?'
-  {  4235,  49,  53,  57,    4,  -44 },   // 0x40 '@'
-  {  4560,  40,  44,  42,    1,  -43 },   // 0x41 'A'
-  {  4780,  34,  44,  42,    5,  -43 },   // 0x42 'B'
-  {  4967,  35,  46,  40,    3,  -44 },   // 0x43 'C'
-  {  5169,  35,  44,  43,    5,  -43 },   // 0x44 'D'
-  {  5362,  29,  44,  38,    5,  -43 },   // 0x45 'E'
-  {  5522,  28,  44,  36,    5,  -43 },   // 0x46 'F'
-  {  5676,  37,  46,  45,    3,  -44 },   // 0x47 'G'
-  {  5889,  35,  44,  45,    5,  -43 },   // 0x48 'H'
-  {  6082,  20,  44,  27,    3,  -43 },   // 0x49 'I'
-  {  6192,  28,  45,  34,    1,  -43 },   // 0x4A 'J'
-  {  6350,  37,  44,  43,    5,  -43 },   // 0x4B 'K'
-  {  6554,  26,  44,  33,    5,  -43 },   // 0x4C 'L'
-  {  6697,  41,  44,  51,    5,  -43 },   // 0x4D 'M'
-  {  6923,  35,  44,  45,    5,  -43 },   // 0x4E 'N'
-  {  7116,  39,  46,  45,    3,  -44 },   // 0x4F 'O'
-  {  7341,  33,  44,  40,    5,  -43 },   // 0x50 'P'
-  {  7523,  39,  56,  45,    3,  -44 },   // 0x51 'Q'
-  {  7796,  34,  44,  42,    5,  -43 },   // 0x52 'R'
-  {  7983,  33,  46,  39,    3,  -44 },   // 0x53 'S'
-  {  8173,  33,  44,  37,    2,  -43 },   // 0x54 'T'
-  {  8355,  33,  45,  43,    5,  -43 },   // 0x55 'U'
-  {  8541,  38,  44,  40,    1,  -43 },   // 0x56 'V'
-  {  8750,  56,  44,  60,    2,  -43 },   // 0x57 'W'
-  {  9058,  39,  44,  41,    1,  -43 },   // 0x58 'X'
-  {  9273,  38,  44,  40,    1,  -43 },   // 0x59 'Y'
-  {  9482,  33,  44,  38,    3,  -43 },   // 0x5A 'Z'
-  {  9664,  13,  57,  21,    5,  -47 },   // 0x5B '['
-  {  9757,  25,  57,  28,    2,  -46 },   // 0x5C '\'
-  {  9936,  13,  57,  21,    3,  -47 },   // 0x5D ']'
-  { 10029,  32,  26,  38,    3,  -43 },   // 0x5E '^'
-  { 10133,  31,   6,  35,    2,    6 },   // 0x5F '_'
-  { 10157,  13,  14,  38,   10,  -50 },   // 0x60 '`'
-  { 10180,  31,  35,  35,    2,  -33 },   // 0x61 'a'
-  { 10316,  30,  48,  38,    5,  -46 },   // 0x62 'b'
-  { 10496,  29,  35,  32,    2,  -33 },   // 0x63 'c'
-  { 10623,  30,  48,  38,    3,  -46 },   // 0x64 'd'
-  { 10803,  31,  35,  35,    2,  -33 },   // 0x65 'e'
-  { 10939,  20,  47,  22,    1,  -46 },   // 0x66 'f'
-  { 11057,  32,  52,  34,    2,  -38 },   // 0x67 'g'
-  { 11265,  28,  47,  37,    5,  -46 },   // 0x68 'h'
-  { 11430,   9,  47,  17,    4,  -46 },   // 0x69 'i'
-  { 11483,  14,  60,  17,   -1,  -46 },   // 0x6A 'j'
-  { 11588,  31,  47,  35,    4,  -46 },   // 0x6B 'k'
-  { 11771,  12,  47,  19,    5,  -46 },   // 0x6C 'l'
-  { 11842,  47,  34,  56,    5,  -33 },   // 0x6D 'm'
-  { 12042,  28,  34,  37,    5,  -33 },   // 0x6E 'n'
-  { 12161,  31,  35,  35,    2,  -33 },   // 0x6F 'o'
-  { 12297,  30,  47,  38,    5,  -33 },   // 0x70 'p'
-  { 12474,  30,  47,  38,    3,  -33 },   // 0x71 'q'
-  { 12651,  19,  33,  25,    5,  -32 },   // 0x72 'r'
-  { 12730,  27,  35,  31,    2,  -33 },   // 0x73 's'
-  { 12849,  20,  42,  24,    2,  -41 },   // 0x74 't'
-  { 12954,  28,  34,  37,    4,  -32 },   // 0x75 'u'
-  { 13073,  31,  33,  33,    1,  -32 },   // 0x76 'v'
-  { 13201,  48,  33,  52,    2,  -32 },   // 0x77 'w'
-  { 13399,  32,  33,  34,    1,  -32 },   // 0x78 'x'
-  { 13531,  31,  46,  33,    1,  -32 },   // 0x79 'y'
-  { 13710,  27,  33,  32,    3,  -32 },   // 0x7A 'z'
-  { 13822,  19,  57,  23,    1,  -47 },   // 0x7B '{'
-  { 13958,   6,  57,  24,    9,  -47 },   // 0x7C '|'
-  { 14001,  19,  57,  23,    3,  -47 },   // 0x7D '}'
-  { 14137,  30,  10,  38,    4,  -23 },   // 0x7E '~'
-  { 14175,  26,  49,  30,    2,  -48 },   // 0x7F
-  { 14335,  26,  49,  30,    2,  -48 },   // 0x80
-  { 14495,  26,  49,  30,    2,  -48 },   // 0x81
-  { 14655,  26,  49,  30,    2,  -48 },   // 0x82
-  { 14815,  26,  49,  30,    2,  -48 },   // 0x83
-  { 14975,  26,  49,  30,    2,  -48 },   // 0x84
-  { 15135,  26,  49,  30,    2,  -48 },   // 0x85
-  { 15295,  26,  49,  30,    2,  -48 },   // 0x86
-  { 15455,  26,  49,  30,    2,  -48 },   // 0x87
-  { 15615,  26,  49,  30,    2,  -48 },   // 0x88
-  { 15775,  26,  49,  30,    2,  -48 },   // 0x89
-  { 15935,  26,  49,  30,    2,  -48 },   // 0x8A
-  { 16095,  26,  49,  30,    2,  -48 },   // 0x8B
-  { 16255,  26,  49,  30,    2,  -48 },   // 0x8C
-  { 16415,  26,  49,  30,    2,  -48 },   // 0x8D
-  { 16575,  26,  49,  30,    2,  -48 },   // 0x8E
-  { 16735,  26,  49,  30,    2,  -48 },   // 0x8F
-  { 16895,  26,  49,  30,    2,  -48 },   // 0x90
-  { 17055,  26,  49,  30,    2,  -48 },   // 0x91
-  { 17215,  26,  49,  30,    2,  -48 },   // 0x92
-  { 17375,  26,  49,  30,    2,  -48 },   // 0x93
-  { 17535,  26,  49,  30,    2,  -48 },   // 0x94
-  { 17695,  26,  49,  30,    2,  -48 },   // 0x95
-  { 17855,  26,  49,  30,    2,  -48 },   // 0x96
-  { 18015,  26,  49,  30,    2,  -48 },   // 0x97
-  { 18175,  26,  49,  30,    2,  -48 },   // 0x98
-  { 18335,  26,  49,  30,    2,  -48 },   // 0x99
-  { 18495,  26,  49,  30,    2,  -48 },   // 0x9A
-  { 18655,  26,  49,  30,    2,  -48 },   // 0x9B
-  { 18815,  26,  49,  30,    2,  -48 },   // 0x9C
-  { 18975,  26,  49,  30,    2,  -48 },   // 0x9D
-  { 19135,  26,  49,  30,    2,  -48 },   // 0x9E
-  { 19295,  26,  49,  30,    2,  -48 },   // 0x9F
-  { 19455,   1,   1,  15,    0,    0 },   // 0xA0
-  { 19456,  11,  45,  19,    4,  -33 },   // 0xA1
-  { 19518,  29,  48,  34,    3,  -39 },   // 0xA2
-  { 19692,  32,  45,  37,    3,  -44 },   // 0xA3
-  { 19872,  37,  38,  39,    1,  -40 },   // 0xA4
-  { 20048,  37,  44,  39,    0,  -43 },   // 0xA5
-  { 20252,   6,  57,  24,    9,  -47 },   // 0xA6
-  { 20295,  28,  55,  36,    4,  -44 },   // 0xA7
-  { 20488,  22,   9,  38,    8,  -46 },   // 0xA8
-  { 20513,  44,  46,  50,    3,  -44 },   // 0xA9
-  { 20766,  22,  24,  27,    3,  -43 },   // 0xAA
-  { 20832,  30,  27,  34,    2,  -30 },   // 0xAB
-  { 20934,  30,  17,  38,    4,  -21 },   // 0xAC
-  { 20998,  18,   8,  25,    4,  -22 },   // 0xAD
-  { 21016,  25,  26,  29,    2,  -44 },   // 0xAE
-  { 21098,  18,   6,  38,   10,  -45 },   // 0xAF
-  { 21112,  22,  24,  30,    4,  -44 },   // 0xB0
-  { 21178,  30,  39,  38,    4,  -38 },   // 0xB1
-  { 21325,  18,  23,  22,    2,  -43 },   // 0xB2
-  { 21377,  19,  24,  22,    1,  -43 },   // 0xB3
-  { 21434,  13,  14,  38,   15,  -50 },   // 0xB4
-  { 21457,  29,  46,  37,    4,  -32 },   // 0xB5
-  { 21624,  36,  53,  42,    2,  -43 },   // 0xB6
-  { 21863,  10,  10,  22,    6,  -23 },   // 0xB7
-  { 21876,  16,  14,  38,   12,   -1 },   // 0xB8
-  { 21904,  20,  23,  22,    1,  -43 },   // 0xB9
-  { 21962,  21,  24,  27,    3,  -43 },   // 0xBA
-  { 22025,  30,  27,  34,    3,  -30 },   // 0xBB
-  { 22127,  51,  44,  53,    1,  -43 },   // 0xBC
-  { 22408,  52,  44,  54,    1,  -43 },   // 0xBD
-  { 22694,  50,  44,  52,    1,  -43 },   // 0xBE
-  { 22969,  28,  46,  31,    2,  -33 } }; // 0xBF
+  {     1,  18,   8,  25,    4,  -22 },   // 0x2D '-'
+  {     6,  11,  10,  19,    4,   -8 },   // 0x2E '.'
+  {    19,  32,  46,  38,    3,  -44 },   // 0x30 '0'
+  {    94,  33,  44,  38,    3,  -43 },   // 0x31 '1'
+  {   148,  31,  45,  38,    3,  -44 },   // 0x32 '2'
+  {   234,  31,  46,  38,    2,  -44 },   // 0x33 '3'
+  {   336,  34,  44,  38,    2,  -43 },   // 0x34 '4'
+  {   410,  31,  45,  38,    4,  -43 },   // 0x35 '5'
+  {   493,  32,  45,  38,    3,  -43 },   // 0x36 '6'
+  {   600,  30,  44,  38,    4,  -43 },   // 0x37 '7'
+  {   684,  32,  46,  38,    3,  -44 },   // 0x38 '8'
+  {   783,  32,  45,  38,    3,  -44 },   // 0x39 '9'
+  {   888,  56,  44,  60,    2,  -43 },   // 0x57 'W'
+  {  1047,  31,  35,  35,    2,  -33 },   // 0x61 'a'
+  {  1133,  20,  47,  22,    1,  -46 },   // 0x66 'f'
+  {  1152,   9,  47,  17,    4,  -46 },   // 0x69 'i'
+  {  1168,  28,  34,  37,    5,  -33 },   // 0x6E 'n'
+  {  1205,  26,  49,  30,    2,  -48 } }; // missing glyph
 
 const GFXfont IBMPlexSans_SemiBold32pt8b PROGMEM = {
-  (uint8_t  *)IBMPlexSans_SemiBold32pt8bBitmaps,
+  (uint8_t  *)IBMPlexSans_SemiBold32pt8bPackedData,
   (GFXglyph *)IBMPlexSans_SemiBold32pt8bGlyphs,
-  0x20, 0xBF, 81 };
+  0, 18, 81 };
+
+const GFXpacked IBMPlexSans_SemiBold32pt8bPacked PROGMEM = {
+  IBMPlexSans_SemiBold32pt8bPackedData,
+  4 };
+
+const GFXrange IBMPlexSans_SemiBold32pt8bRanges[] PROGMEM = {
+  { 0x0020,   1,   0 },
+  { 0x002D,   2,   1 },
+  { 0x0030,  10,   3 },
+  { 0x0057,   1,  13 },
+  { 0x0061,   1,  14 },
+  { 0x0066,   1,  15 },
+  { 0x0069,   1,  16 },
+  { 0x006E,   1,  17 } };
+
+const GFXsubset IBMPlexSans_SemiBold32pt8bSubset PROGMEM = {
+  IBMPlexSans_SemiBold32pt8bRanges,
+  8, 18, 50 };
+
+const GFXkernPair IBMPlexSans_SemiBold32pt8bKernPairs[] PROGMEM = {
+  {   1,  13,  -1 },   // 0x2D '-', 0x57 'W'
+  {   2,  13,  -2 },   // 0x2E '.', 0x57 'W'
+  {   2,  15,  -1 },   // 0x2E '.', 0x66 'f'
+  {  13,   1,  -1 },   // 0x57 'W', 0x2D '-'
+  {  13,   2,  -2 },   // 0x57 'W', 0x2E '.'
+  {  13,  14,  -1 },   // 0x57 'W', 0x61 'a'
+  {  13,  17,  -1 },   // 0x57 'W', 0x6E 'n'
+  {  14,   2,   1 },   // 0x61 'a', 0x2E '.'
+  {  15,   2,  -2 },   // 0x66 'f', 0x2E '.'
+  {  15,  13,   2 },   // 0x66 'f', 0x57 'W'
+  {  15,  16,   1 },   // 0x66 'f', 0x69 'i'
+  {  17,  13,  -1 } }; // 0x6E 'n', 0x57 'W'
+
+const GFXkerning IBMPlexSans_SemiBold32pt8bKerning PROGMEM = {
+  IBMPlexSans_SemiBold32pt8bKernPairs,
+  12 };
 
-// Approx. 24257 bytes
+// Approx. 1511 bytes
+// Bitmaps: 2718 bytes raw, 1219 bytes compressed
 
 
 #endif /* IBMPLEXSANSSEMIBOLD32PT8B_H_ */
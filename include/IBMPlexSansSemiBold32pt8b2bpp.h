@@ -0,0 +1,575 @@
+// Generated by fonts/build.py from manifest.txt, inputs 9fb4247d6a5aa4f5
+#ifndef IBMPLEXSANSSEMIBOLD32PT8B2BPP_H_
+#define IBMPLEXSANSSEMIBOLD32PT8B2BPP_H_
+
+#include <Arduino.h>
+#include <M5Stack.h>
+
+#include "fontdata.h"
+
+const uint8_t IBMPlexSans_SemiBold32pt8b_2bppGreyData[] PROGMEM = {
+  0x7F, 0xFF, 0xFF, 0xFF, 0xF8, 0x7F, 0xFF, 0xFF, 0xFF, 0xF8, 0x7F, 0xFF,
+  0xFF, 0xFF, 0xF8, 0x7F, 0xFF, 0xFF, 0xFF, 0xF8, 0x7F, 0xFF, 0xFF, 0xFF,
+  0xF8, 0x7F, 0xFF, 0xFF, 0xFF, 0xF8, 0x7F, 0xFF, 0xFF, 0xFF, 0xF8, 0x7F,
+  0xFF, 0xFF, 0xFF, 0xF8, 0x06, 0xFE, 0x40, 0x2F, 0xFF, 0xD0, 0x7F, 0xFF,
+  0xF0, 0xBF, 0xFF, 0xF4, 0xBF, 0xFF, 0xF4, 0xBF, 0xFF, 0xF4, 0xBF, 0xFF,
+  0xF4, 0x7F, 0xFF, 0xF0, 0x2F, 0xFF, 0xD0, 0x06, 0xFE, 0x40, 0x00, 0x00,
+  0x01, 0x6F, 0xFE, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xFF,
+  0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00,
+  0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x1F,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0x80, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0,
+  0x00, 0x01, 0xFF, 0xFF, 0xE4, 0x05, 0xFF, 0xFF, 0xF0, 0x00, 0x03, 0xFF,
+  0xFF, 0x40, 0x00, 0x2F, 0xFF, 0xF8, 0x00, 0x07, 0xFF, 0xFE, 0x00, 0x00,
+  0x0B, 0xFF, 0xFC, 0x00, 0x0B, 0xFF, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0xFD,
+  0x00, 0x0F, 0xFF, 0xF4, 0x00, 0x00, 0x02, 0xFF, 0xFE, 0x00, 0x1F, 0xFF,
+  0xF0, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x00, 0x2F, 0xFF, 0xF0, 0x00, 0x00,
+  0x00, 0xFF, 0xFF, 0x40, 0x2F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+  0x80, 0x3F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x80, 0x3F, 0xFF,
+  0xD0, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xC0, 0x7F, 0xFF, 0xD0, 0x00, 0x00,
+  0x00, 0xBF, 0xFF, 0xC0, 0x7F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0xBF, 0xFF,
+  0xC0, 0x7F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xC0, 0x7F, 0xFF,
+  0xD0, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xD0, 0x7F, 0xFF, 0xD0, 0x00, 0x00,
+  0x00, 0xBF, 0xFF, 0xD0, 0x7F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0xBF, 0xFF,
+  0xD0, 0x7F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xD0, 0x7F, 0xFF,
+  0xD0, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xD0, 0x7F, 0xFF, 0xD0, 0x00, 0x00,
+  0x00, 0xBF, 0xFF, 0xD0, 0x7F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0xBF, 0xFF,
+  0xC0, 0x7F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xC0, 0x7F, 0xFF,
+  0xD0, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xC0, 0x3F, 0xFF, 0xD0, 0x00, 0x00,
+  0x00, 0xBF, 0xFF, 0xC0, 0x3F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0xFF,
+  0x80, 0x2F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x2F, 0xFF,
+  0xF0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x40, 0x1F, 0xFF, 0xF0, 0x00, 0x00,
+  0x01, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xF4, 0x00, 0x00, 0x02, 0xFF, 0xFE,
+  0x00, 0x0B, 0xFF, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0xFD, 0x00, 0x07, 0xFF,
+  0xFE, 0x00, 0x00, 0x0B, 0xFF, 0xFC, 0x00, 0x03, 0xFF, 0xFF, 0x40, 0x00,
+  0x2F, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xFF, 0xE4, 0x01, 0xFF, 0xFF, 0xF0,
+  0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x3F,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x00,
+  0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00,
+  0x1B, 0xFF, 0xFF, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x01, 0x6F, 0xFE,
+  0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x2F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF,
+  0xFF, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
+  0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F,
+  0xFF, 0xF9, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xF1, 0xFF,
+  0xFF, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xC1, 0xFF, 0xFF, 0x00, 0x00,
+  0x00, 0x02, 0xFF, 0xFF, 0x41, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xFF,
+  0xFD, 0x01, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xF4, 0x01, 0xFF,
+  0xFF, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xE0, 0x01, 0xFF, 0xFF, 0x00, 0x00,
+  0x00, 0x2F, 0xFF, 0x80, 0x01, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xFE,
+  0x00, 0x01, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x01, 0xFF,
+  0xFF, 0x00, 0x00, 0x00, 0x00, 0x24, 0x00, 0x01, 0xFF, 0xFF, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF,
+  0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF,
+  0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF,
+  0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF,
+  0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF,
+  0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x01, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xF0, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xF0, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x01, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x01, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x06, 0xBF, 0xFA, 0x40, 0x00, 0x00,
+  0x00, 0x01, 0xBF, 0xFF, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF,
+  0xFF, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00,
+  0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x03, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80,
+  0x1F, 0xFF, 0xFE, 0x40, 0x1F, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xF4, 0x00,
+  0x02, 0xFF, 0xFF, 0xD0, 0x7F, 0xFF, 0xD0, 0x00, 0x00, 0xBF, 0xFF, 0xE0,
+  0xBF, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x1B, 0xFF, 0x00, 0x00,
+  0x00, 0x2F, 0xFF, 0xF0, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xF4,
+  0x00, 0x05, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x2F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xF0,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xD0,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFE, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xBF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xD0, 0x00,
+  0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x2F,
+  0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF4, 0x00, 0x00,
+  0x00, 0x00, 0x07, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF,
+  0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xF8, 0x00, 0x00, 0x00,
+  0x00, 0x02, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF,
+  0x40, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xBF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x80,
+  0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x3F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFD, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD,
+  0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x3F, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFD, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD,
+  0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x3F, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x05, 0xAF, 0xFE, 0x94, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x07,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80,
+  0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x0B, 0xFF,
+  0xFF, 0x94, 0x06, 0xFF, 0xFF, 0xF4, 0x00, 0x02, 0xFF, 0xFD, 0x00, 0x00,
+  0x7F, 0xFF, 0xF8, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x1F, 0xFF, 0xFC,
+  0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x0B, 0xFF, 0xFD, 0x00, 0x00, 0x07,
+  0x00, 0x00, 0x00, 0x07, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x07, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFD,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFD, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0B, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xF4,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x06, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF,
+  0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xE4, 0x00,
+  0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0xFF, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF,
+  0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x80,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x2F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0B, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFE,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF,
+  0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x40, 0x00, 0x18,
+  0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x40, 0x00, 0x7E, 0x00, 0x00, 0x00,
+  0x02, 0xFF, 0xFF, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x07, 0xFF, 0xFE,
+  0x00, 0x1F, 0xFF, 0xD0, 0x00, 0x00, 0x0B, 0xFF, 0xFD, 0x00, 0x7F, 0xFF,
+  0xF8, 0x00, 0x00, 0x2F, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xFF, 0x90, 0x06,
+  0xFF, 0xFF, 0xF4, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0,
+  0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0xBF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xF4, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xFF, 0xFF, 0xFE, 0x40, 0x00,
+  0x00, 0x00, 0x00, 0x06, 0xBF, 0xFE, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x2F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F,
+  0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x07, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF,
+  0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFE, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xBF, 0xFD, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xF8,
+  0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xF0, 0xFF, 0xFE, 0x00,
+  0x00, 0x00, 0x00, 0x0B, 0xFF, 0xD0, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00,
+  0x1F, 0xFF, 0x80, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x00,
+  0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0xFF, 0xFE, 0x00,
+  0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x02,
+  0xFF, 0xF4, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xE0, 0x00,
+  0xFF, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0xFF, 0xFE, 0x00,
+  0x00, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x3F,
+  0xFF, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0xFD, 0x00, 0x00,
+  0xFF, 0xFE, 0x00, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xFE, 0x00,
+  0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x0B, 0xFF,
+  0xE0, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x00,
+  0xFF, 0xFE, 0x00, 0x00, 0x2F, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0xFE, 0x00,
+  0x00, 0x7F, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFC,
+  0x00, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x01, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xD0, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x02, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xD0, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x03, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF,
+  0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x07, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF,
+  0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xD0, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF,
+  0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xC0, 0x06, 0xFF, 0xA4,
+  0x00, 0x00, 0x0B, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0x90, 0x00, 0x0B, 0xFF,
+  0xC2, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x0B, 0xFF, 0x87, 0xFF, 0xFF, 0xFF,
+  0xFE, 0x00, 0x0F, 0xFF, 0x9F, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x0F, 0xFF,
+  0xAF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x0F, 0xFF, 0xFF, 0x90, 0x07, 0xFF,
+  0xFF, 0xF0, 0x0F, 0xFF, 0xF8, 0x00, 0x00, 0x7F, 0xFF, 0xF8, 0x06, 0xBF,
+  0xE0, 0x00, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x00, 0x40, 0x00, 0x00, 0x0B,
+  0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFE, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x03, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
+  0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFE, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x02, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
+  0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFE, 0x00, 0x18,
+  0x00, 0x00, 0x00, 0x03, 0xFF, 0xFD, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x07,
+  0xFF, 0xFD, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x0F, 0xFF, 0xFC, 0x1F, 0xFF,
+  0xD0, 0x00, 0x00, 0x2F, 0xFF, 0xF8, 0x7F, 0xFF, 0xF4, 0x00, 0x00, 0xBF,
+  0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0x50, 0x17, 0xFF, 0xFF, 0xD0, 0x1F, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFE, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x2F,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFD,
+  0x00, 0x00, 0x00, 0x00, 0x16, 0xBF, 0xFA, 0x50, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x02, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF,
+  0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFE, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0B, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFE,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xF8, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x01, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
+  0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFE, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF,
+  0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x40, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x07, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF,
+  0xF8, 0x01, 0xBF, 0xE9, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF4, 0x2F, 0xFF,
+  0xFF, 0xD0, 0x00, 0x00, 0x1F, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xF8, 0x00,
+  0x00, 0x2F, 0xFF, 0xD3, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x3F, 0xFF,
+  0xCB, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0xDF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xE0, 0x00, 0x7F, 0xFF, 0xFF, 0x90, 0x06, 0xFF, 0xFF, 0xF4,
+  0x00, 0xBF, 0xFF, 0xFD, 0x00, 0x00, 0x7F, 0xFF, 0xF8, 0x00, 0xBF, 0xFF,
+  0xF4, 0x00, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xE0, 0x00, 0x00,
+  0x07, 0xFF, 0xFD, 0x00, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x03, 0xFF, 0xFE,
+  0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x00, 0xFF, 0xFF,
+  0x80, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00,
+  0x02, 0xFF, 0xFF, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF, 0xFF,
+  0x00, 0xBF, 0xFF, 0x80, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x00, 0x7F, 0xFF,
+  0x80, 0x00, 0x00, 0x02, 0xFF, 0xFE, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x00,
+  0x02, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xD0, 0x00, 0x00, 0x03, 0xFF, 0xFD,
+  0x00, 0x2F, 0xFF, 0xE0, 0x00, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x0F, 0xFF,
+  0xF4, 0x00, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x0B, 0xFF, 0xFD, 0x00, 0x00,
+  0x7F, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0x90, 0x06, 0xFF, 0xFF, 0xD0,
+  0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x7F,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xF8, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x00,
+  0x00, 0x00, 0x00, 0x6F, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x05, 0xAF, 0xFE, 0x90, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFD, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x7F,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFD, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x7F,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x7F, 0xFE, 0x00, 0x00, 0x00,
+  0x07, 0xFF, 0xFC, 0x7F, 0xFE, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF8, 0x7F,
+  0xFE, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF4, 0x7F, 0xFE, 0x00, 0x00, 0x00,
+  0x1F, 0xFF, 0xF0, 0x7F, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xE0, 0x7F,
+  0xFE, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xD0, 0x7F, 0xFE, 0x00, 0x00, 0x00,
+  0xBF, 0xFF, 0x80, 0x7F, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x40, 0x7F,
+  0xFE, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
+  0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFD, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
+  0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xF0, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F,
+  0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xC0, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF,
+  0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFE, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x07, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF,
+  0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF4, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x2F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF,
+  0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xD0, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xBF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+  0x40, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x03, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFD,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xF0,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x7F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xC0,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0xAF, 0xFE, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF,
+  0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8,
+  0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00,
+  0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x02, 0xFF, 0xFF, 0xE4, 0x01, 0xBF, 0xFF,
+  0xF4, 0x00, 0x03, 0xFF, 0xFF, 0x40, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x07,
+  0xFF, 0xFD, 0x00, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x0B, 0xFF, 0xF8, 0x00,
+  0x00, 0x02, 0xFF, 0xFD, 0x00, 0x0B, 0xFF, 0xF4, 0x00, 0x00, 0x01, 0xFF,
+  0xFE, 0x00, 0x0B, 0xFF, 0xF0, 0x00, 0x00, 0x01, 0xFF, 0xFE, 0x00, 0x0B,
+  0xFF, 0xF0, 0x00, 0x00, 0x01, 0xFF, 0xFE, 0x00, 0x0B, 0xFF, 0xF0, 0x00,
+  0x00, 0x01, 0xFF, 0xFE, 0x00, 0x0B, 0xFF, 0xF0, 0x00, 0x00, 0x01, 0xFF,
+  0xFD, 0x00, 0x07, 0xFF, 0xF4, 0x00, 0x00, 0x01, 0xFF, 0xFC, 0x00, 0x03,
+  0xFF, 0xF8, 0x00, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xFD, 0x00,
+  0x00, 0x07, 0xFF, 0xF4, 0x00, 0x00, 0xBF, 0xFF, 0x40, 0x00, 0x1F, 0xFF,
+  0xE0, 0x00, 0x00, 0x3F, 0xFF, 0xE4, 0x01, 0xBF, 0xFF, 0x80, 0x00, 0x00,
+  0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0x40,
+  0x00, 0x00, 0x00, 0x01, 0xBF, 0xFF, 0xFF, 0xFF, 0xE4, 0x00, 0x00, 0x00,
+  0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x40, 0x00, 0x00, 0xBF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x02, 0xFF, 0xFF, 0xE4, 0x01, 0xBF, 0xFF,
+  0xF4, 0x00, 0x07, 0xFF, 0xFE, 0x00, 0x00, 0x0B, 0xFF, 0xFD, 0x00, 0x0F,
+  0xFF, 0xF8, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x00, 0x2F, 0xFF, 0xF0, 0x00,
+  0x00, 0x01, 0xFF, 0xFF, 0x40, 0x2F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0xFF,
+  0xFF, 0x80, 0x3F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x80, 0x3F,
+  0xFF, 0xD0, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xC0, 0x3F, 0xFF, 0xD0, 0x00,
+  0x00, 0x00, 0xBF, 0xFF, 0xC0, 0x3F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0xBF,
+  0xFF, 0xC0, 0x3F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x2F,
+  0xFF, 0xF0, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x80, 0x1F, 0xFF, 0xF8, 0x00,
+  0x00, 0x02, 0xFF, 0xFF, 0x40, 0x0F, 0xFF, 0xFE, 0x00, 0x00, 0x0B, 0xFF,
+  0xFE, 0x00, 0x07, 0xFF, 0xFF, 0xE4, 0x01, 0xBF, 0xFF, 0xFD, 0x00, 0x02,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xBF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0x80, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00,
+  0x00, 0x6F, 0xFF, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x01, 0xAF,
+  0xFE, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xAF, 0xFE, 0x90, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFE, 0x40, 0x00, 0x00, 0x00,
+  0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0x40, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x02,
+  0xFF, 0xFF, 0xE4, 0x05, 0xFF, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xFE, 0x00,
+  0x00, 0x1F, 0xFF, 0xF4, 0x00, 0x0B, 0xFF, 0xFC, 0x00, 0x00, 0x07, 0xFF,
+  0xFC, 0x00, 0x1F, 0xFF, 0xF4, 0x00, 0x00, 0x02, 0xFF, 0xFD, 0x00, 0x2F,
+  0xFF, 0xE0, 0x00, 0x00, 0x01, 0xFF, 0xFE, 0x00, 0x2F, 0xFF, 0xE0, 0x00,
+  0x00, 0x00, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0xFF,
+  0xFF, 0x40, 0x3F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x40, 0x7F,
+  0xFF, 0xD0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x7F, 0xFF, 0xD0, 0x00,
+  0x00, 0x00, 0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0xFF,
+  0xFF, 0x80, 0x3F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x3F,
+  0xFF, 0xE0, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x80, 0x2F, 0xFF, 0xF4, 0x00,
+  0x00, 0x02, 0xFF, 0xFF, 0x80, 0x1F, 0xFF, 0xFC, 0x00, 0x00, 0x07, 0xFF,
+  0xFF, 0x80, 0x0F, 0xFF, 0xFE, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x40, 0x0B,
+  0xFF, 0xFF, 0xE4, 0x05, 0xFF, 0xFF, 0xFF, 0x40, 0x03, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFD, 0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0xFF,
+  0xFE, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xE2, 0xFF, 0xFE, 0x00, 0x00,
+  0x1F, 0xFF, 0xFF, 0xFF, 0x83, 0xFF, 0xFD, 0x00, 0x00, 0x02, 0xFF, 0xFF,
+  0xFE, 0x07, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x1A, 0xFF, 0x90, 0x0F, 0xFF,
+  0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xF0, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xBF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF,
+  0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x2F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xE0,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F,
+  0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xF4, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x2F, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF,
+  0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xE0, 0x00, 0x00,
+  0x00, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xE0, 0x00,
+  0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x3F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0xFF,
+  0xFF, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x2F, 0xFF, 0xD0, 0x00,
+  0x00, 0x01, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x40, 0x2F,
+  0xFF, 0xE0, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0xBF,
+  0xFF, 0x40, 0x1F, 0xFF, 0xF0, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xF8, 0x00,
+  0x00, 0x00, 0xBF, 0xFF, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x03, 0xFF,
+  0xFF, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xF4, 0x00,
+  0x00, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0xFE, 0x00, 0x0B,
+  0xFF, 0xF4, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x01, 0xFF,
+  0xFD, 0x00, 0x07, 0xFF, 0xF8, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFE, 0x00,
+  0x00, 0x02, 0xFF, 0xFC, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x0F, 0xFF,
+  0xBF, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x03, 0xFF, 0xFC, 0x00,
+  0x00, 0x0F, 0xFF, 0x6F, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x02,
+  0xFF, 0xFD, 0x00, 0x00, 0x1F, 0xFF, 0x2F, 0xFF, 0x40, 0x00, 0x07, 0xFF,
+  0xF4, 0x00, 0x01, 0xFF, 0xFE, 0x00, 0x00, 0x2F, 0xFF, 0x1F, 0xFF, 0x80,
+  0x00, 0x0B, 0xFF, 0xF0, 0x00, 0x01, 0xFF, 0xFE, 0x00, 0x00, 0x3F, 0xFE,
+  0x0F, 0xFF, 0x80, 0x00, 0x0B, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0x00,
+  0x00, 0x3F, 0xFD, 0x0F, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x00,
+  0xBF, 0xFF, 0x00, 0x00, 0x7F, 0xFD, 0x0B, 0xFF, 0xD0, 0x00, 0x0F, 0xFF,
+  0xD0, 0x00, 0x00, 0xBF, 0xFF, 0x40, 0x00, 0xBF, 0xFC, 0x07, 0xFF, 0xE0,
+  0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0xBF, 0xF8,
+  0x07, 0xFF, 0xE0, 0x00, 0x2F, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xFF, 0x80,
+  0x00, 0xFF, 0xF4, 0x03, 0xFF, 0xF0, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0x00,
+  0x3F, 0xFF, 0xC0, 0x01, 0xFF, 0xF4, 0x02, 0xFF, 0xF4, 0x00, 0x3F, 0xFF,
+  0x40, 0x00, 0x00, 0x2F, 0xFF, 0xC0, 0x02, 0xFF, 0xF0, 0x01, 0xFF, 0xF4,
+  0x00, 0x7F, 0xFF, 0x40, 0x00, 0x00, 0x1F, 0xFF, 0xD0, 0x02, 0xFF, 0xE0,
+  0x01, 0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xE0,
+  0x03, 0xFF, 0xD0, 0x00, 0xFF, 0xFC, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x00,
+  0x0F, 0xFF, 0xE0, 0x07, 0xFF, 0xD0, 0x00, 0xBF, 0xFD, 0x00, 0xBF, 0xFD,
+  0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF0, 0x07, 0xFF, 0xC0, 0x00, 0xBF, 0xFD,
+  0x00, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xF4, 0x0B, 0xFF, 0x80,
+  0x00, 0x7F, 0xFE, 0x01, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xF4,
+  0x0F, 0xFF, 0x80, 0x00, 0x3F, 0xFF, 0x01, 0xFF, 0xF8, 0x00, 0x00, 0x00,
+  0x03, 0xFF, 0xF8, 0x0F, 0xFF, 0x40, 0x00, 0x2F, 0xFF, 0x02, 0xFF, 0xF8,
+  0x00, 0x00, 0x00, 0x02, 0xFF, 0xF8, 0x1F, 0xFF, 0x00, 0x00, 0x2F, 0xFF,
+  0x43, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFC, 0x2F, 0xFE, 0x00,
+  0x00, 0x1F, 0xFF, 0x83, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFD,
+  0x3F, 0xFE, 0x00, 0x00, 0x0F, 0xFF, 0x87, 0xFF, 0xE0, 0x00, 0x00, 0x00,
+  0x00, 0xFF, 0xFD, 0x3F, 0xFD, 0x00, 0x00, 0x0F, 0xFF, 0xC7, 0xFF, 0xE0,
+  0x00, 0x00, 0x00, 0x00, 0xBF, 0xFE, 0x7F, 0xFC, 0x00, 0x00, 0x0B, 0xFF,
+  0xDB, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFE, 0xBF, 0xF8, 0x00,
+  0x00, 0x07, 0xFF, 0xDF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF,
+  0xFF, 0xF8, 0x00, 0x00, 0x03, 0xFF, 0xEF, 0xFF, 0xC0, 0x00, 0x00, 0x00,
+  0x00, 0x3F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x80,
+  0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x02, 0xFF,
+  0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xF0, 0x00,
+  0x00, 0x01, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF,
+  0xFF, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x1F, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xBF,
+  0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xC0, 0x00,
+  0x00, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF,
+  0xFF, 0x80, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x07, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF8, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x1A, 0xFF, 0xE9, 0x00, 0x00, 0x00, 0x00, 0x06,
+  0xFF, 0xFF, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xFE,
+  0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x03, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xF4, 0x00, 0x0F, 0xFF, 0xF9, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x03, 0xFF,
+  0xD0, 0x00, 0x0B, 0xFF, 0xFD, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x03, 0xFF,
+  0xFE, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x00, 0x00, 0x04,
+  0x00, 0x00, 0x01, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+  0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+  0xFF, 0x00, 0x00, 0x00, 0x6B, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x1B,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x0F, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x2F, 0xFF, 0xF9, 0x40, 0x00, 0xFF,
+  0xFF, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x7F, 0xFF,
+  0x80, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x00, 0xFF,
+  0xFF, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xBF, 0xFF,
+  0x80, 0x00, 0x01, 0xFF, 0xFF, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x02, 0xFF,
+  0xFF, 0x00, 0x7F, 0xFF, 0xD0, 0x00, 0x0B, 0xFF, 0xFF, 0x00, 0x7F, 0xFF,
+  0xF9, 0x01, 0x7F, 0xBF, 0xFF, 0xFD, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F,
+  0xFF, 0xFD, 0x1F, 0xFF, 0xFF, 0xFF, 0xFE, 0x2F, 0xFF, 0xFD, 0x0B, 0xFF,
+  0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFD, 0x02, 0xFF, 0xFF, 0xFF, 0xF0, 0x07,
+  0xFF, 0xFD, 0x00, 0x7F, 0xFF, 0xFF, 0x80, 0x00, 0xBF, 0xFD, 0x00, 0x06,
+  0xBF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0x00,
+  0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0x00,
+  0x00, 0x07, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x00,
+  0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x1F, 0xFF, 0xD0, 0x00, 0x00,
+  0x00, 0x2F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xD0, 0x00, 0x00,
+  0x00, 0x2F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xD0, 0x00, 0x00,
+  0x00, 0x2F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xD0, 0x00, 0x00,
+  0x00, 0x2F, 0xFF, 0xD0, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
+  0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
+  0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
+  0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x2F, 0xFF, 0xD0, 0x00, 0x00,
+  0x00, 0x2F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xD0, 0x00, 0x00,
+  0x00, 0x2F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xD0, 0x00, 0x00,
+  0x00, 0x2F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xD0, 0x00, 0x00,
+  0x00, 0x2F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xD0, 0x00, 0x00,
+  0x00, 0x2F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xD0, 0x00, 0x00,
+  0x00, 0x2F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xD0, 0x00, 0x00,
+  0x00, 0x2F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xD0, 0x00, 0x00,
+  0x00, 0x2F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xD0, 0x00, 0x00,
+  0x00, 0x2F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xD0, 0x00, 0x00,
+  0x00, 0x2F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xD0, 0x00, 0x00,
+  0x00, 0x2F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xD0, 0x00, 0x00,
+  0x00, 0x2F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xD0, 0x00, 0x00,
+  0x00, 0x2F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xD0, 0x00, 0x00,
+  0x06, 0xFE, 0x40, 0x1F, 0xFF, 0xE0, 0x2F, 0xFF, 0xF4, 0x3F, 0xFF, 0xF4,
+  0x3F, 0xFF, 0xF4, 0x3F, 0xFF, 0xF4, 0x2F, 0xFF, 0xF4, 0x1F, 0xFF, 0xE0,
+  0x06, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xE0, 0x1F, 0xFF, 0xE0,
+  0x1F, 0xFF, 0xE0, 0x1F, 0xFF, 0xE0, 0x1F, 0xFF, 0xE0, 0x1F, 0xFF, 0xE0,
+  0x1F, 0xFF, 0xE0, 0x1F, 0xFF, 0xE0, 0x1F, 0xFF, 0xE0, 0x1F, 0xFF, 0xE0,
+  0x1F, 0xFF, 0xE0, 0x1F, 0xFF, 0xE0, 0x1F, 0xFF, 0xE0, 0x1F, 0xFF, 0xE0,
+  0x1F, 0xFF, 0xE0, 0x1F, 0xFF, 0xE0, 0x1F, 0xFF, 0xE0, 0x1F, 0xFF, 0xE0,
+  0x1F, 0xFF, 0xE0, 0x1F, 0xFF, 0xE0, 0x1F, 0xFF, 0xE0, 0x1F, 0xFF, 0xE0,
+  0x1F, 0xFF, 0xE0, 0x1F, 0xFF, 0xE0, 0x1F, 0xFF, 0xE0, 0x1F, 0xFF, 0xE0,
+  0x1F, 0xFF, 0xE0, 0x1F, 0xFF, 0xE0, 0x1F, 0xFF, 0xE0, 0x1F, 0xFF, 0xE0,
+  0x1F, 0xFF, 0xE0, 0x1F, 0xFF, 0xE0, 0x1F, 0xFF, 0xE0, 0x00, 0x00, 0x00,
+  0x06, 0xFF, 0xA4, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0xBF, 0xFF, 0xFE, 0x00,
+  0x00, 0x7F, 0xFF, 0x82, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x7F, 0xFF, 0x8B,
+  0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x7F, 0xFF, 0x9F, 0xFF, 0xFF, 0xFF, 0xF8,
+  0x00, 0x7F, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x7F, 0xFF, 0xFF,
+  0x90, 0x1F, 0xFF, 0xFE, 0x00, 0x7F, 0xFF, 0xF8, 0x00, 0x02, 0xFF, 0xFF,
+  0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x01, 0xFF, 0xFF, 0x40, 0x7F, 0xFF, 0xC0,
+  0x00, 0x00, 0xBF, 0xFF, 0x40, 0x7F, 0xFF, 0x80, 0x00, 0x00, 0xBF, 0xFF,
+  0x80, 0x7F, 0xFF, 0x80, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x7F, 0xFF, 0x80,
+  0x00, 0x00, 0x7F, 0xFF, 0x80, 0x7F, 0xFF, 0x80, 0x00, 0x00, 0x7F, 0xFF,
+  0x80, 0x7F, 0xFF, 0x80, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x7F, 0xFF, 0x80,
+  0x00, 0x00, 0x7F, 0xFF, 0x80, 0x7F, 0xFF, 0x80, 0x00, 0x00, 0x7F, 0xFF,
+  0x80, 0x7F, 0xFF, 0x80, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x7F, 0xFF, 0x80,
+  0x00, 0x00, 0x7F, 0xFF, 0x80, 0x7F, 0xFF, 0x80, 0x00, 0x00, 0x7F, 0xFF,
+  0x80, 0x7F, 0xFF, 0x80, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x7F, 0xFF, 0x80,
+  0x00, 0x00, 0x7F, 0xFF, 0x80, 0x7F, 0xFF, 0x80, 0x00, 0x00, 0x7F, 0xFF,
+  0x80, 0x7F, 0xFF, 0x80, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x7F, 0xFF, 0x80,
+  0x00, 0x00, 0x7F, 0xFF, 0x80, 0x7F, 0xFF, 0x80, 0x00, 0x00, 0x7F, 0xFF,
+  0x80, 0x7F, 0xFF, 0x80, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x7F, 0xFF, 0x80,
+  0x00, 0x00, 0x7F, 0xFF, 0x80, 0x7F, 0xFF, 0x80, 0x00, 0x00, 0x7F, 0xFF,
+  0x80, 0x7F, 0xFF, 0x80, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x7F, 0xFF, 0x80,
+  0x00, 0x00, 0x7F, 0xFF, 0x80, 0x7F, 0xFF, 0x80, 0x00, 0x00, 0x7F, 0xFF,
+  0x80, 0x7F, 0xFF, 0x80, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x7F, 0xFF, 0x80,
+  0x00, 0x00, 0x7F, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF,
+  0xE0, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0xBF,
+  0xE0, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0xFF, 0xE0, 0x00, 0x00,
+  0x00, 0xBF, 0xE0, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0xFF, 0xE0,
+  0x00, 0x00, 0x00, 0xBF, 0xE0, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0xE0,
+  0xFF, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0xFF, 0xE0, 0x00, 0x00, 0x00,
+  0xBF, 0xE0, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0xFF, 0xE0, 0x00,
+  0x00, 0x00, 0xBF, 0xE0, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0xFF,
+  0xE0, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0xBF,
+  0xE0, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0xFF, 0xE0, 0x00, 0x00,
+  0x00, 0xBF, 0xE0, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0xFF, 0xE0,
+  0x00, 0x00, 0x00, 0xBF, 0xE0, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0xE0,
+  0xFF, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0xFF, 0xE0, 0x00, 0x00, 0x00,
+  0xBF, 0xE0, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0xFF, 0xE0, 0x00,
+  0x00, 0x00, 0xBF, 0xE0, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0xFF,
+  0xE0, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0xBF,
+  0xE0, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0xFF, 0xE0, 0x00, 0x00,
+  0x00, 0xBF, 0xE0, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0xFF, 0xE0,
+  0x00, 0x00, 0x00, 0xBF, 0xE0, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0xE0,
+  0xFF, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0xFF, 0xE0, 0x00, 0x00, 0x00,
+  0xBF, 0xE0, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0xFF, 0xE0, 0x00,
+  0x00, 0x00, 0xBF, 0xE0, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0xFF,
+  0xE0, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0 };
+
+const GFXglyph IBMPlexSans_SemiBold32pt8b_2bppGlyphs[] PROGMEM = {
+  {     0,   0,   0,  15,    0,    1 },   // 0x20 ' '
+  {     0,  19,   8,  25,    3,  -22 },   // 0x2D '-'
+  {    40,  11,  10,  19,    4,   -8 },   // 0x2E '.'
+  {    70,  34,  46,  38,    2,  -44 },   // 0x30 '0'
+  {   484,  35,  44,  38,    2,  -43 },   // 0x31 '1'
+  {   880,  32,  45,  38,    3,  -44 },   // 0x32 '2'
+  {  1240,  33,  46,  38,    1,  -44 },   // 0x33 '3'
+  {  1654,  34,  44,  38,    2,  -43 },   // 0x34 '4'
+  {  2050,  32,  45,  38,    3,  -43 },   // 0x35 '5'
+  {  2410,  33,  45,  38,    3,  -43 },   // 0x36 '6'
+  {  2815,  32,  44,  38,    3,  -43 },   // 0x37 '7'
+  {  3167,  33,  46,  38,    2,  -44 },   // 0x38 '8'
+  {  3581,  33,  45,  38,    2,  -44 },   // 0x39 '9'
+  {  3986,  58,  44,  60,    1,  -43 },   // 0x57 'W'
+  {  4646,  32,  35,  35,    2,  -33 },   // 0x61 'a'
+  {  4926,  21,  47,  22,    1,  -46 },   // 0x66 'f'
+  {  5208,  11,  47,  17,    3,  -46 },   // 0x69 'i'
+  {  5349,  29,  34,  37,    4,  -33 },   // 0x6E 'n'
+  {  5621,  26,  49,  30,    2,  -48 } }; // missing glyph
+
+const GFXfont IBMPlexSans_SemiBold32pt8b_2bpp PROGMEM = {
+  (uint8_t  *)IBMPlexSans_SemiBold32pt8b_2bppGreyData,
+  (GFXglyph *)IBMPlexSans_SemiBold32pt8b_2bppGlyphs,
+  0, 18, 81 };
+
+const GFXgreys IBMPlexSans_SemiBold32pt8b_2bppGreys PROGMEM = {
+  IBMPlexSans_SemiBold32pt8b_2bppGreyData,
+  2 };
+
+const GFXrange IBMPlexSans_SemiBold32pt8b_2bppRanges[] PROGMEM = {
+  { 0x0020,   1,   0 },
+  { 0x002D,   2,   1 },
+  { 0x0030,  10,   3 },
+  { 0x0057,   1,  13 },
+  { 0x0061,   1,  14 },
+  { 0x0066,   1,  15 },
+  { 0x0069,   1,  16 },
+  { 0x006E,   1,  17 } };
+
+const GFXsubset IBMPlexSans_SemiBold32pt8b_2bppSubset PROGMEM = {
+  IBMPlexSans_SemiBold32pt8b_2bppRanges,
+  8, 18, 51 };
+
+const GFXkernPair IBMPlexSans_SemiBold32pt8b_2bppKernPairs[] PROGMEM = {
+  {   1,  13,  -1 },   // 0x2D '-', 0x57 'W'
+  {   2,  13,  -2 },   // 0x2E '.', 0x57 'W'
+  {   2,  15,  -1 },   // 0x2E '.', 0x66 'f'
+  {  13,   1,  -1 },   // 0x57 'W', 0x2D '-'
+  {  13,   2,  -2 },   // 0x57 'W', 0x2E '.'
+  {  13,  14,  -1 },   // 0x57 'W', 0x61 'a'
+  {  13,  17,  -1 },   // 0x57 'W', 0x6E 'n'
+  {  14,   2,   1 },   // 0x61 'a', 0x2E '.'
+  {  15,   2,  -2 },   // 0x66 'f', 0x2E '.'
+  {  15,  13,   2 },   // 0x66 'f', 0x57 'W'
+  {  15,  16,   1 },   // 0x66 'f', 0x69 'i'
+  {  17,  13,  -1 } }; // 0x6E 'n', 0x57 'W'
+
+const GFXkerning IBMPlexSans_SemiBold32pt8b_2bppKerning PROGMEM = {
+  IBMPlexSans_SemiBold32pt8b_2bppKernPairs,
+  12 };
+
+// Approx. 6256 bytes
+// Bitmaps: 2829 bytes at 1 bit, 5964 bytes at 2 bits per pixel
+
+
+#endif /* IBMPLEXSANSSEMIBOLD32PT8B2BPP_H_ */
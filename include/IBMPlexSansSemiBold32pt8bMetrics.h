@@ -0,0 +1,45 @@
+// Generated by fonts/build.py from manifest.txt, inputs 02c56aa2415bbdb4
+#ifndef IBMPLEXSANSSEMIBOLD32PT8BMETRICS_H_
+#define IBMPLEXSANSSEMIBOLD32PT8BMETRICS_H_
+
+#include "fontdata.h"
+
+constexpr uint8_t IBMPlexSans_SemiBold32pt8bAdvances[] = {
+  0x0F, 0x13, 0x1E, 0x29, 0x26, 0x3C, 0x2D, 0x10, 0x15, 0x15, 0x23, 0x26,
+  0x13, 0x19, 0x13, 0x1C, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+  0x26, 0x26, 0x14, 0x14, 0x26, 0x26, 0x26, 0x1F, 0x39, 0x2A, 0x2A, 0x28,
+  0x2B, 0x26, 0x24, 0x2D, 0x2D, 0x1B, 0x22, 0x2B, 0x21, 0x33, 0x2D, 0x2D,
+  0x28, 0x2D, 0x2A, 0x27, 0x25, 0x2B, 0x28, 0x3C, 0x29, 0x28, 0x26, 0x15,
+  0x1C, 0x15, 0x26, 0x23, 0x26, 0x23, 0x26, 0x20, 0x26, 0x23, 0x16, 0x22,
+  0x25, 0x11, 0x11, 0x23, 0x13, 0x38, 0x25, 0x23, 0x26, 0x26, 0x19, 0x1F,
+  0x18, 0x25, 0x21, 0x34, 0x22, 0x21, 0x20, 0x17, 0x18, 0x17, 0x26, 0x1E,
+  0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E,
+  0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E,
+  0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x0F, 0x13, 0x22, 0x25,
+  0x27, 0x27, 0x18, 0x24, 0x26, 0x32, 0x1B, 0x22, 0x26, 0x19, 0x1D, 0x26,
+  0x1E, 0x26, 0x16, 0x16, 0x26, 0x25, 0x2A, 0x16, 0x26, 0x16, 0x1B, 0x22,
+  0x35, 0x36, 0x34, 0x1F };
+
+constexpr int8_t IBMPlexSans_SemiBold32pt8bInkRights[] = {
+     1,   15,   25,   40,   35,   57,   44,   12,   22,   18,   33,   34,
+    15,   22,   15,   25,   35,   36,   34,   33,   36,   35,   35,   34,
+    35,   35,   16,   16,   32,   34,   32,   29,   53,   41,   39,   38,
+    40,   34,   33,   40,   40,   23,   29,   42,   31,   46,   40,   42,
+    38,   42,   39,   36,   35,   38,   39,   58,   40,   39,   36,   18,
+    27,   16,   35,   33,   23,   33,   35,   31,   33,   33,   21,   34,
+    33,   13,   13,   35,   17,   52,   33,   33,   35,   33,   24,   29,
+    22,   32,   32,   50,   33,   32,   30,   20,   15,   22,   34,   28,
+    28,   28,   28,   28,   28,   28,   28,   28,   28,   28,   28,   28,
+    28,   28,   28,   28,   28,   28,   28,   28,   28,   28,   28,   28,
+    28,   28,   28,   28,   28,   28,   28,   28,    1,   15,   32,   35,
+    38,   37,   15,   32,   30,   47,   25,   32,   34,   22,   27,   28,
+    26,   34,   20,   20,   28,   33,   38,   16,   28,   21,   24,   33,
+    52,   53,   51,   30 };
+
+constexpr GFXmetrics IBMPlexSans_SemiBold32pt8bMetrics = {
+  0x20, 0xBF,
+  IBMPlexSans_SemiBold32pt8bAdvances,
+  IBMPlexSans_SemiBold32pt8bInkRights,
+  81, 50, 14, 38, true };
+
+#endif /* IBMPLEXSANSSEMIBOLD32PT8BMETRICS_H_ */
@@ -1,3091 +1,204 @@
+// Generated by fonts/build.py from manifest.txt, inputs e7cfd9af00f3262f
 #ifndef IBMPLEXSANSSEMIBOLD40PT8B_H_
 #define IBMPLEXSANSSEMIBOLD40PT8B_H_
 
 #include <Arduino.h>
 #include <M5Stack.h>
 
-const uint8_t IBMPlexSans_SemiBold40pt8bBitmaps[] PROGMEM = {
-  0x00, 0x7F, 0xE7, 0xFE, 0x7F, 0xE7, 0xFE, 0x7F, 0xE7, 0xFE, 0x7F, 0xE7,
-  0xFE, 0x7F, 0xE7, 0xFE, 0x7F, 0xE7, 0xFE, 0x7F, 0xE7, 0xFE, 0x7F, 0xE7,
-  0xFE, 0x7F, 0xE7, 0xFE, 0x7F, 0xE7, 0xFE, 0x3F, 0xE3, 0xFC, 0x3F, 0xC3,
-  0xFC, 0x3F, 0xC3, 0xFC, 0x3F, 0xC1, 0xFC, 0x1F, 0x81, 0xF8, 0x1F, 0x81,
-  0xF8, 0x1F, 0x81, 0xF8, 0x0F, 0x80, 0xF8, 0x0F, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x1F, 0x87, 0xFE, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0xFE, 0x1F, 0x80,
-  0xFF, 0x80, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xE0, 0x3F, 0xFF, 0xF0, 0x1F,
-  0xFF, 0xF8, 0x0F, 0xFF, 0xFC, 0x07, 0xFF, 0xFE, 0x03, 0xFF, 0xFF, 0x01,
-  0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xE0, 0x3F, 0xFF, 0xF0,
-  0x1F, 0xFF, 0xF8, 0x0F, 0xFF, 0xFC, 0x07, 0xFF, 0xFE, 0x03, 0xFF, 0xFF,
-  0x01, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xE0, 0x3F, 0xFF,
-  0xF0, 0x1F, 0xFF, 0xF8, 0x0F, 0xFF, 0xFC, 0x07, 0xFF, 0xFE, 0x03, 0xFF,
-  0xFF, 0x01, 0xFF, 0x00, 0x01, 0xFC, 0x00, 0x3F, 0x80, 0x00, 0x03, 0xF8,
-  0x00, 0x7F, 0x00, 0x00, 0x07, 0xF0, 0x00, 0xFE, 0x00, 0x00, 0x0F, 0xC0,
-  0x01, 0xF8, 0x00, 0x00, 0x1F, 0x80, 0x03, 0xF0, 0x00, 0x00, 0x7F, 0x00,
-  0x0F, 0xE0, 0x00, 0x00, 0xFE, 0x00, 0x1F, 0xC0, 0x00, 0x01, 0xFC, 0x00,
-  0x3F, 0x80, 0x00, 0x03, 0xF8, 0x00, 0x7F, 0x00, 0x00, 0x07, 0xE0, 0x00,
-  0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x01, 0xF8, 0x00, 0x00, 0x3F, 0x80, 0x07,
-  0xF0, 0x00, 0x00, 0x7F, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0xFE, 0x00, 0x1F,
-  0xC0, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFC, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xF0, 0x00, 0xFC, 0x00, 0x1F, 0x80, 0x00, 0x01, 0xF8, 0x00, 0x3F, 0x00,
-  0x00, 0x07, 0xF0, 0x00, 0xFE, 0x00, 0x00, 0x0F, 0xE0, 0x01, 0xFC, 0x00,
-  0x00, 0x1F, 0xC0, 0x03, 0xF8, 0x00, 0x00, 0x3F, 0x80, 0x07, 0xF0, 0x00,
-  0x00, 0x7E, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x1F, 0x80, 0x00,
-  0x03, 0xF8, 0x00, 0x7F, 0x00, 0x00, 0x07, 0xF0, 0x00, 0xFE, 0x00, 0x00,
-  0x0F, 0xE0, 0x01, 0xFC, 0x00, 0x00, 0x1F, 0xC0, 0x03, 0xF8, 0x00, 0x00,
-  0x3F, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x7E, 0x00, 0x0F, 0xC0, 0x03, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0xFE,
-  0x00, 0x1F, 0xC0, 0x00, 0x01, 0xFC, 0x00, 0x3F, 0x80, 0x00, 0x03, 0xF8,
-  0x00, 0x7F, 0x00, 0x00, 0x07, 0xF0, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0,
-  0x01, 0xF8, 0x00, 0x00, 0x3F, 0x80, 0x07, 0xF0, 0x00, 0x00, 0x7F, 0x00,
-  0x0F, 0xE0, 0x00, 0x00, 0xFE, 0x00, 0x1F, 0xC0, 0x00, 0x01, 0xFC, 0x00,
-  0x3F, 0x80, 0x00, 0x03, 0xF0, 0x00, 0x7E, 0x00, 0x00, 0x07, 0xE0, 0x00,
-  0xFC, 0x00, 0x00, 0x1F, 0xC0, 0x03, 0xF8, 0x00, 0x00, 0x3F, 0x80, 0x07,
-  0xF0, 0x00, 0x00, 0x7F, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x7F,
-  0x80, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00,
-  0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00,
-  0x7F, 0x80, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x03, 0xFF, 0xF0,
-  0x00, 0x00, 0x1F, 0xFF, 0xFE, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x80, 0x01,
-  0xFF, 0xFF, 0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xFF,
-  0xFF, 0xF8, 0x0F, 0xFF, 0xFF, 0xFF, 0xFC, 0x1F, 0xFF, 0xFF, 0xFF, 0xFE,
-  0x1F, 0xFF, 0x3F, 0x3F, 0xFE, 0x3F, 0xFC, 0x3F, 0x0F, 0xF8, 0x3F, 0xF0,
-  0x3F, 0x03, 0xF0, 0x3F, 0xF0, 0x3F, 0x01, 0xE0, 0x3F, 0xE0, 0x3F, 0x00,
-  0xC0, 0x3F, 0xE0, 0x3F, 0x00, 0x00, 0x3F, 0xE0, 0x3F, 0x00, 0x00, 0x3F,
-  0xE0, 0x3F, 0x00, 0x00, 0x3F, 0xE0, 0x3F, 0x00, 0x00, 0x3F, 0xF0, 0x3F,
-  0x00, 0x00, 0x3F, 0xF8, 0x3F, 0x00, 0x00, 0x3F, 0xFC, 0x3F, 0x00, 0x00,
-  0x1F, 0xFF, 0xBF, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x00, 0x00, 0x0F, 0xFF,
-  0xFF, 0xC0, 0x00, 0x07, 0xFF, 0xFF, 0xF8, 0x00, 0x03, 0xFF, 0xFF, 0xFF,
-  0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0xFF, 0xE0, 0x00,
-  0x1F, 0xFF, 0xFF, 0xF0, 0x00, 0x07, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x7F,
-  0xFF, 0xFC, 0x00, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x00, 0x3F, 0x3F, 0xFE,
-  0x00, 0x00, 0x3F, 0x0F, 0xFF, 0x00, 0x00, 0x3F, 0x07, 0xFF, 0x00, 0x00,
-  0x3F, 0x03, 0xFF, 0x00, 0x00, 0x3F, 0x03, 0xFF, 0x00, 0x00, 0x3F, 0x01,
-  0xFF, 0x00, 0x00, 0x3F, 0x01, 0xFF, 0x00, 0x00, 0x3F, 0x01, 0xFF, 0x06,
-  0x00, 0x3F, 0x01, 0xFF, 0x0F, 0x00, 0x3F, 0x03, 0xFF, 0x1F, 0x80, 0x3F,
-  0x03, 0xFF, 0x3F, 0xE0, 0x3F, 0x07, 0xFE, 0x7F, 0xF8, 0x3F, 0x1F, 0xFE,
-  0xFF, 0xFE, 0x3F, 0x7F, 0xFC, 0x7F, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF,
-  0xFF, 0xFF, 0xF8, 0x1F, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0xFF,
-  0xE0, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
-  0x3F, 0xFF, 0xFC, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x7F,
-  0x80, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00,
-  0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00,
-  0x7F, 0x80, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x3F, 0xC0, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF0,
-  0x00, 0x1F, 0xFF, 0xF0, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x07, 0xFF, 0xFF,
-  0x00, 0x00, 0x01, 0xFF, 0x00, 0x01, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x7F,
-  0xC0, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x0F, 0xFC,
-  0x3F, 0xF0, 0x00, 0x03, 0xFE, 0x00, 0x01, 0xFE, 0x03, 0xFE, 0x00, 0x00,
-  0xFF, 0x80, 0x00, 0x7F, 0xC0, 0x3F, 0xC0, 0x00, 0x1F, 0xF0, 0x00, 0x0F,
-  0xF0, 0x07, 0xFC, 0x00, 0x07, 0xFC, 0x00, 0x01, 0xFE, 0x00, 0xFF, 0x80,
-  0x01, 0xFF, 0x00, 0x00, 0x3F, 0xC0, 0x0F, 0xF0, 0x00, 0x7F, 0xE0, 0x00,
-  0x0F, 0xF8, 0x01, 0xFE, 0x00, 0x0F, 0xF8, 0x00, 0x01, 0xFF, 0x00, 0x3F,
-  0xC0, 0x03, 0xFE, 0x00, 0x00, 0x3F, 0xE0, 0x07, 0xF8, 0x00, 0xFF, 0x80,
-  0x00, 0x07, 0xFC, 0x00, 0xFF, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0xFF, 0x80,
-  0x1F, 0xE0, 0x07, 0xFC, 0x00, 0x00, 0x1F, 0xF0, 0x03, 0xFC, 0x01, 0xFF,
-  0x00, 0x00, 0x03, 0xFE, 0x00, 0x7F, 0x80, 0x3F, 0xE0, 0x00, 0x00, 0x3F,
-  0xC0, 0x0F, 0xF0, 0x0F, 0xF8, 0x00, 0x00, 0x07, 0xF8, 0x03, 0xFE, 0x03,
-  0xFE, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x7F, 0xC0, 0x7F, 0xC0, 0x00, 0x00,
-  0x1F, 0xF0, 0x0F, 0xF0, 0x1F, 0xF0, 0x00, 0x00, 0x01, 0xFE, 0x03, 0xFE,
-  0x07, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0xFF, 0xC1, 0xFF, 0x00, 0x00,
-  0x00, 0x03, 0xFF, 0xFF, 0xF0, 0x3F, 0xE0, 0x0F, 0xF0, 0x00, 0x7F, 0xFF,
-  0xFC, 0x0F, 0xF8, 0x0F, 0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0x03, 0xFE, 0x03,
-  0xFF, 0xFE, 0x00, 0x7F, 0xFF, 0xC0, 0x7F, 0xC0, 0xFF, 0xFF, 0xE0, 0x03,
-  0xFF, 0xF0, 0x1F, 0xF0, 0x3F, 0xFF, 0xFE, 0x00, 0x1F, 0xF0, 0x07, 0xFC,
-  0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0x83, 0xFF, 0x0F, 0xFC,
-  0x00, 0x00, 0x00, 0x3F, 0xE0, 0x7F, 0xC0, 0x7F, 0x80, 0x00, 0x00, 0x0F,
-  0xF8, 0x0F, 0xF0, 0x0F, 0xF8, 0x00, 0x00, 0x03, 0xFF, 0x03, 0xFE, 0x01,
-  0xFF, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x7F, 0xC0, 0x1F, 0xE0, 0x00, 0x00,
-  0x1F, 0xF0, 0x0F, 0xF0, 0x03, 0xFC, 0x00, 0x00, 0x07, 0xFC, 0x01, 0xFE,
-  0x00, 0x7F, 0xC0, 0x00, 0x00, 0xFF, 0x80, 0x3F, 0xC0, 0x0F, 0xF8, 0x00,
-  0x00, 0x3F, 0xE0, 0x07, 0xF8, 0x01, 0xFF, 0x00, 0x00, 0x0F, 0xF8, 0x00,
-  0xFF, 0x00, 0x3F, 0xE0, 0x00, 0x01, 0xFF, 0x00, 0x1F, 0xE0, 0x07, 0xFC,
-  0x00, 0x00, 0x7F, 0xC0, 0x03, 0xFC, 0x00, 0xFF, 0x80, 0x00, 0x1F, 0xF0,
-  0x00, 0x7F, 0x80, 0x1F, 0xF0, 0x00, 0x07, 0xFE, 0x00, 0x0F, 0xF0, 0x03,
-  0xFC, 0x00, 0x00, 0xFF, 0x80, 0x01, 0xFF, 0x00, 0x7F, 0x80, 0x00, 0x3F,
-  0xE0, 0x00, 0x3F, 0xE0, 0x1F, 0xF0, 0x00, 0x0F, 0xF8, 0x00, 0x03, 0xFC,
-  0x03, 0xFE, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x7F, 0xC0, 0x7F, 0x80, 0x00,
-  0x7F, 0xC0, 0x00, 0x0F, 0xFC, 0x3F, 0xF0, 0x00, 0x1F, 0xF0, 0x00, 0x00,
-  0xFF, 0xFF, 0xFC, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x80,
-  0x00, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0x3F, 0xE0, 0x00,
-  0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xFC,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0xFF,
-  0x80, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFF,
-  0xFF, 0xC0, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0xFF,
-  0xFF, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x3F,
-  0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x07,
-  0xFF, 0x83, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0xC0, 0x3F, 0xF8, 0x00, 0x00,
-  0x7F, 0xE0, 0x07, 0xFE, 0x00, 0x00, 0x1F, 0xF0, 0x01, 0xFF, 0x80, 0x00,
-  0x0F, 0xFC, 0x00, 0x3F, 0xE0, 0x00, 0x03, 0xFF, 0x00, 0x0F, 0xF8, 0x00,
-  0x00, 0x7F, 0xC0, 0x07, 0xFE, 0x00, 0x00, 0x1F, 0xF0, 0x01, 0xFF, 0x80,
-  0x00, 0x07, 0xFE, 0x00, 0x7F, 0xC0, 0x00, 0x01, 0xFF, 0x80, 0x3F, 0xF0,
-  0x00, 0x00, 0x3F, 0xF0, 0x1F, 0xF8, 0x00, 0x00, 0x0F, 0xFE, 0x0F, 0xFE,
-  0x00, 0x00, 0x01, 0xFF, 0xC7, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF,
-  0x80, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x01, 0xFF, 0xFF,
-  0xE0, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFF,
-  0xF0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0xFF, 0xF0, 0x03, 0xFF,
-  0xFC, 0x00, 0x3F, 0xFC, 0x01, 0xFF, 0xFF, 0x80, 0x1F, 0xFF, 0x01, 0xFF,
-  0xFF, 0xF0, 0x07, 0xFF, 0xC0, 0xFF, 0xFF, 0xFE, 0x01, 0xFF, 0xF0, 0x7F,
-  0xFB, 0xFF, 0xC0, 0x7F, 0xFC, 0x3F, 0xFC, 0x7F, 0xF8, 0x1F, 0xFF, 0x0F,
-  0xFE, 0x0F, 0xFF, 0x07, 0xFF, 0xC7, 0xFF, 0x03, 0xFF, 0xE3, 0xFE, 0x01,
-  0xFF, 0x80, 0x7F, 0xFC, 0xFF, 0x00, 0xFF, 0xC0, 0x0F, 0xFF, 0xBF, 0xC0,
-  0x3F, 0xF0, 0x01, 0xFF, 0xFF, 0xF0, 0x0F, 0xFC, 0x00, 0x3F, 0xFF, 0xFC,
-  0x03, 0xFF, 0x00, 0x07, 0xFF, 0xFE, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0xFF,
-  0x80, 0x3F, 0xF0, 0x00, 0x1F, 0xFF, 0xC0, 0x0F, 0xFC, 0x00, 0x03, 0xFF,
-  0xF0, 0x03, 0xFF, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0xFF, 0xE0, 0x00, 0x0F,
-  0xFF, 0x00, 0x3F, 0xFC, 0x00, 0x07, 0xFF, 0xE0, 0x07, 0xFF, 0x80, 0x07,
-  0xFF, 0xFC, 0x01, 0xFF, 0xF8, 0x07, 0xFF, 0xFF, 0x80, 0x7F, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x01, 0xFF, 0xFF,
-  0xFF, 0xFB, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0xFC, 0x7F, 0xF8, 0x07, 0xFF,
-  0xFF, 0xFC, 0x1F, 0xFF, 0x00, 0x7F, 0xFF, 0xFC, 0x03, 0xFF, 0xE0, 0x07,
-  0xFF, 0xFC, 0x00, 0x7F, 0xFC, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0x00, 0x07, 0xFE, 0x00, 0x1F, 0xF0, 0x00, 0x7F, 0xC0, 0x01,
-  0xFF, 0x80, 0x07, 0xFE, 0x00, 0x0F, 0xF8, 0x00, 0x3F, 0xE0, 0x00, 0xFF,
-  0xC0, 0x01, 0xFF, 0x00, 0x07, 0xFC, 0x00, 0x1F, 0xF8, 0x00, 0x3F, 0xE0,
-  0x00, 0xFF, 0xC0, 0x01, 0xFF, 0x00, 0x03, 0xFE, 0x00, 0x0F, 0xF8, 0x00,
-  0x1F, 0xF0, 0x00, 0x7F, 0xE0, 0x00, 0xFF, 0x80, 0x01, 0xFF, 0x00, 0x03,
-  0xFE, 0x00, 0x0F, 0xF8, 0x00, 0x1F, 0xF0, 0x00, 0x3F, 0xE0, 0x00, 0x7F,
-  0xC0, 0x00, 0xFF, 0x80, 0x03, 0xFE, 0x00, 0x07, 0xFC, 0x00, 0x0F, 0xF8,
-  0x00, 0x1F, 0xF0, 0x00, 0x3F, 0xE0, 0x00, 0x7F, 0xC0, 0x00, 0xFF, 0x80,
-  0x01, 0xFF, 0x00, 0x03, 0xFE, 0x00, 0x07, 0xFC, 0x00, 0x0F, 0xF8, 0x00,
-  0x1F, 0xF0, 0x00, 0x3F, 0xE0, 0x00, 0x7F, 0xC0, 0x00, 0xFF, 0x80, 0x01,
-  0xFF, 0x00, 0x03, 0xFE, 0x00, 0x07, 0xFC, 0x00, 0x07, 0xFC, 0x00, 0x0F,
-  0xF8, 0x00, 0x1F, 0xF0, 0x00, 0x3F, 0xE0, 0x00, 0x7F, 0xC0, 0x00, 0x7F,
-  0xC0, 0x00, 0xFF, 0x80, 0x01, 0xFF, 0x00, 0x01, 0xFF, 0x00, 0x03, 0xFE,
-  0x00, 0x07, 0xFC, 0x00, 0x07, 0xFC, 0x00, 0x0F, 0xF8, 0x00, 0x1F, 0xF8,
-  0x00, 0x1F, 0xF0, 0x00, 0x3F, 0xF0, 0x00, 0x3F, 0xE0, 0x00, 0x3F, 0xE0,
-  0x00, 0x7F, 0xC0, 0x00, 0x7F, 0xC0, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0xC0,
-  0x00, 0xFF, 0xC0, 0x00, 0xFF, 0x80, 0x00, 0xFF, 0x80, 0x00, 0xFF, 0xC0,
-  0xFF, 0xC0, 0x00, 0x7F, 0xC0, 0x00, 0x7F, 0xC0, 0x00, 0xFF, 0xC0, 0x00,
-  0xFF, 0xC0, 0x00, 0xFF, 0x80, 0x00, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x01,
-  0xFF, 0x00, 0x01, 0xFF, 0x00, 0x03, 0xFE, 0x00, 0x03, 0xFE, 0x00, 0x07,
-  0xFC, 0x00, 0x07, 0xFC, 0x00, 0x0F, 0xF8, 0x00, 0x0F, 0xF8, 0x00, 0x1F,
-  0xF0, 0x00, 0x3F, 0xE0, 0x00, 0x3F, 0xE0, 0x00, 0x7F, 0xC0, 0x00, 0xFF,
-  0x80, 0x00, 0xFF, 0x80, 0x01, 0xFF, 0x00, 0x03, 0xFE, 0x00, 0x07, 0xFC,
-  0x00, 0x0F, 0xF8, 0x00, 0x0F, 0xF8, 0x00, 0x1F, 0xF0, 0x00, 0x3F, 0xE0,
-  0x00, 0x7F, 0xC0, 0x00, 0xFF, 0x80, 0x01, 0xFF, 0x00, 0x03, 0xFE, 0x00,
-  0x07, 0xFC, 0x00, 0x0F, 0xF8, 0x00, 0x1F, 0xF0, 0x00, 0x3F, 0xE0, 0x00,
-  0x7F, 0xC0, 0x00, 0xFF, 0x80, 0x01, 0xFF, 0x00, 0x03, 0xFE, 0x00, 0x07,
-  0xFC, 0x00, 0x0F, 0xF8, 0x00, 0x1F, 0xF0, 0x00, 0x7F, 0xC0, 0x00, 0xFF,
-  0x80, 0x01, 0xFF, 0x00, 0x03, 0xFE, 0x00, 0x07, 0xFC, 0x00, 0x1F, 0xF0,
-  0x00, 0x3F, 0xE0, 0x00, 0x7F, 0xC0, 0x01, 0xFF, 0x00, 0x03, 0xFE, 0x00,
-  0x07, 0xFC, 0x00, 0x1F, 0xF0, 0x00, 0x3F, 0xE0, 0x00, 0xFF, 0x80, 0x01,
-  0xFF, 0x00, 0x07, 0xFE, 0x00, 0x0F, 0xF8, 0x00, 0x3F, 0xE0, 0x00, 0xFF,
-  0xC0, 0x01, 0xFF, 0x00, 0x07, 0xFC, 0x00, 0x1F, 0xF8, 0x00, 0x7F, 0xE0,
-  0x00, 0xFF, 0x80, 0x03, 0xFE, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x01,
-  0xFF, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00,
-  0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00,
-  0x3F, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0x80,
-  0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x30, 0x01, 0xFC, 0x00, 0x60, 0xFC,
-  0x03, 0xF8, 0x07, 0xE1, 0xFE, 0x07, 0xF0, 0x3F, 0xC3, 0xFF, 0x8F, 0xE3,
-  0xFF, 0x8F, 0xFF, 0xDF, 0xDF, 0xFF, 0x9F, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F,
-  0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x1F, 0xFF, 0xFF,
-  0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00,
-  0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x03, 0xFF,
-  0xF8, 0x00, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x00, 0x3F, 0xEF, 0xF8, 0x00,
-  0x00, 0x7F, 0xDF, 0xF0, 0x00, 0x01, 0xFF, 0x1F, 0xF0, 0x00, 0x07, 0xFE,
-  0x1F, 0xF0, 0x00, 0x1F, 0xF8, 0x3F, 0xF0, 0x00, 0x7F, 0xE0, 0x3F, 0xF0,
-  0x01, 0xFF, 0xC0, 0x3F, 0xF0, 0x03, 0xFF, 0x00, 0x7F, 0xE0, 0x03, 0xFC,
-  0x00, 0x7F, 0x80, 0x01, 0xF8, 0x00, 0x7C, 0x00, 0x01, 0xE0, 0x00, 0xF0,
-  0x00, 0x00, 0x80, 0x00, 0x80, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00,
-  0x1F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xFC, 0x00,
-  0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x0F,
-  0xF8, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00,
-  0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xFC,
-  0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00,
-  0x0F, 0xF8, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x03, 0xFE,
-  0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00,
-  0x07, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x01, 0xFF, 0x00,
-  0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x03,
-  0xFE, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00,
-  0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x01, 0xFF,
-  0x00, 0x00, 0x07, 0xF0, 0x1F, 0xF0, 0x7F, 0xF0, 0xFF, 0xE3, 0xFF, 0xE7,
-  0xFF, 0xCF, 0xFF, 0x9F, 0xFF, 0x3F, 0xFE, 0x3F, 0xFC, 0x7F, 0xF0, 0x7F,
-  0xE0, 0x7F, 0xC0, 0x3F, 0x80, 0xFE, 0x01, 0xFC, 0x07, 0xF0, 0x0F, 0xE0,
-  0x3F, 0x80, 0xFE, 0x03, 0xF8, 0x0F, 0xF0, 0x3F, 0x80, 0x00, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFC, 0x1F, 0xC1, 0xFF, 0x1F, 0xFC, 0xFF, 0xEF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0x9F, 0xFC, 0x7F, 0xC1, 0xFC,
-  0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x0F,
-  0xF0, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0xFF,
-  0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x0F, 0xF0,
-  0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0xFF, 0x00,
-  0x00, 0x01, 0xFE, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x0F, 0xF0, 0x00,
-  0x00, 0x1F, 0xE0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0xFF, 0x00, 0x00,
-  0x01, 0xFE, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00,
-  0x1F, 0xE0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x01,
-  0xFE, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x1F,
-  0xE0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x01, 0xFE,
-  0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x1F, 0xE0,
-  0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x01, 0xFE, 0x00,
-  0x00, 0x03, 0xFC, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x1F, 0xE0, 0x00,
-  0x00, 0x3F, 0xC0, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x01, 0xFE, 0x00, 0x00,
-  0x03, 0xFC, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00,
-  0x3F, 0xC0, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x03,
-  0xFC, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x3F,
-  0xC0, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x03, 0xFC,
-  0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x3F, 0xC0,
-  0x00, 0x00, 0x7F, 0x80, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x03, 0xFC, 0x00,
-  0x00, 0x07, 0xF8, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x3F, 0xC0, 0x00,
-  0x00, 0x7F, 0x80, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00,
-  0x07, 0xF8, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
-  0xC0, 0x00, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x80,
-  0x00, 0x0F, 0xFF, 0xFF, 0xE0, 0x00, 0x0F, 0xFF, 0xFF, 0xF8, 0x00, 0x0F,
-  0xFF, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xFF,
-  0xFF, 0xE0, 0x0F, 0xFF, 0xFF, 0xFF, 0xF8, 0x07, 0xFF, 0xC0, 0x7F, 0xFC,
-  0x07, 0xFF, 0x80, 0x0F, 0xFF, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x83, 0xFF,
-  0x80, 0x00, 0xFF, 0xC1, 0xFF, 0xC0, 0x00, 0x7F, 0xF0, 0xFF, 0xC0, 0x00,
-  0x1F, 0xF8, 0x7F, 0xE0, 0x00, 0x0F, 0xFC, 0x7F, 0xF0, 0x00, 0x07, 0xFF,
-  0x3F, 0xF8, 0x00, 0x03, 0xFF, 0x9F, 0xFC, 0x00, 0x00, 0xFF, 0xCF, 0xFC,
-  0x00, 0x00, 0x7F, 0xE7, 0xFE, 0x00, 0x00, 0x3F, 0xF3, 0xFF, 0x00, 0x00,
-  0x1F, 0xFB, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0x07, 0xFF,
-  0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x01, 0xFF, 0xFF, 0xF8,
-  0x00, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x7F, 0xFF, 0xFE, 0x00, 0x00,
-  0x3F, 0xFF, 0xFF, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x80, 0x00, 0x0F, 0xFF,
-  0xFF, 0xC0, 0x00, 0x07, 0xFF, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xFF, 0xF0,
-  0x00, 0x01, 0xFF, 0xDF, 0xF8, 0x00, 0x00, 0xFF, 0xCF, 0xFC, 0x00, 0x00,
-  0x7F, 0xE7, 0xFE, 0x00, 0x00, 0x3F, 0xF3, 0xFF, 0x00, 0x00, 0x1F, 0xF9,
-  0xFF, 0xC0, 0x00, 0x1F, 0xFC, 0xFF, 0xE0, 0x00, 0x0F, 0xFE, 0x3F, 0xF0,
-  0x00, 0x07, 0xFE, 0x1F, 0xF8, 0x00, 0x03, 0xFF, 0x0F, 0xFE, 0x00, 0x03,
-  0xFF, 0x87, 0xFF, 0x00, 0x01, 0xFF, 0x81, 0xFF, 0xC0, 0x01, 0xFF, 0xC0,
-  0xFF, 0xF0, 0x01, 0xFF, 0xE0, 0x3F, 0xFE, 0x03, 0xFF, 0xE0, 0x1F, 0xFF,
-  0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0xFF, 0xF0, 0x01, 0xFF, 0xFF, 0xFF,
-  0xF0, 0x00, 0x7F, 0xFF, 0xFF, 0xF0, 0x00, 0x1F, 0xFF, 0xFF, 0xF0, 0x00,
-  0x07, 0xFF, 0xFF, 0xF0, 0x00, 0x01, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x3F,
-  0xFF, 0xE0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xF8,
-  0x00, 0x00, 0x03, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00,
-  0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x00, 0x1F,
-  0xFF, 0xFE, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x80, 0x00, 0x07, 0xFF, 0x7F,
-  0xE0, 0x00, 0x01, 0xFF, 0xDF, 0xF8, 0x00, 0x00, 0xFF, 0xE7, 0xFE, 0x00,
-  0x00, 0x7F, 0xF1, 0xFF, 0x80, 0x00, 0x3F, 0xF8, 0x7F, 0xE0, 0x00, 0x1F,
-  0xFC, 0x1F, 0xF8, 0x00, 0x0F, 0xFE, 0x07, 0xFE, 0x00, 0x07, 0xFF, 0x01,
-  0xFF, 0x80, 0x01, 0xFF, 0x80, 0x7F, 0xE0, 0x00, 0xFF, 0xE0, 0x1F, 0xF8,
-  0x00, 0x0F, 0xF0, 0x07, 0xFE, 0x00, 0x01, 0xF8, 0x01, 0xFF, 0x80, 0x00,
-  0x1C, 0x00, 0x7F, 0xE0, 0x00, 0x02, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00,
-  0x07, 0xFE, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x7F,
-  0xE0, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00,
-  0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00,
-  0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x01,
-  0xFF, 0x80, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0xF8,
-  0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00,
-  0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00,
-  0x07, 0xFE, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x7F,
-  0xE0, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00,
-  0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00,
-  0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC,
-  0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xFF,
-  0xE0, 0x00, 0x01, 0xFF, 0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0xFF, 0xF0, 0x00,
-  0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF,
-  0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0xE0,
-  0x7F, 0xFC, 0x07, 0xFF, 0xE1, 0xFF, 0xE0, 0x03, 0xFF, 0xC3, 0xFF, 0x80,
-  0x03, 0xFF, 0xCF, 0xFE, 0x00, 0x07, 0xFF, 0x9F, 0xF8, 0x00, 0x07, 0xFF,
-  0x0F, 0xF0, 0x00, 0x0F, 0xFE, 0x03, 0xC0, 0x00, 0x1F, 0xFC, 0x01, 0x80,
-  0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0xFF,
-  0xE0, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00,
-  0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x3F,
-  0xF8, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00,
-  0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0xFF,
-  0xF8, 0x00, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00,
-  0x00, 0x3F, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x07, 0xFF,
-  0xE0, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00,
-  0x01, 0xFF, 0xF0, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xFF,
-  0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00,
-  0x0F, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xF0,
-  0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00,
-  0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF,
-  0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x01, 0xFF,
-  0xC0, 0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x01, 0xFF, 0xFF, 0xF8, 0x00,
-  0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF,
-  0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF, 0xFC,
-  0x3F, 0xFF, 0x01, 0xFF, 0xF8, 0x3F, 0xF8, 0x00, 0xFF, 0xF8, 0x3F, 0xC0,
-  0x00, 0xFF, 0xF0, 0x3F, 0x00, 0x00, 0xFF, 0xE0, 0x3C, 0x00, 0x01, 0xFF,
-  0xC0, 0x30, 0x00, 0x03, 0xFF, 0x80, 0x20, 0x00, 0x03, 0xFF, 0x00, 0x00,
-  0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x3F,
-  0xF8, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00,
-  0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x7F,
-  0xF8, 0x00, 0x03, 0xFF, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xFF, 0x80, 0x00,
-  0x0F, 0xFF, 0xFC, 0x00, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xFF,
-  0xE0, 0x00, 0x00, 0x7F, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0xF8, 0x00,
-  0x01, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x00,
-  0x7F, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0xF0,
-  0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00,
-  0x00, 0xFF, 0xC0, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF,
-  0x00, 0x00, 0x00, 0x07, 0xFE, 0x06, 0x00, 0x00, 0x1F, 0xFC, 0x1E, 0x00,
-  0x00, 0x3F, 0xF8, 0x7E, 0x00, 0x00, 0x7F, 0xF3, 0xFC, 0x00, 0x01, 0xFF,
-  0xEF, 0xFE, 0x00, 0x07, 0xFF, 0xBF, 0xFE, 0x00, 0x1F, 0xFF, 0x3F, 0xFF,
-  0x00, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0xF8, 0x7F, 0xFF, 0xFF, 0xFF,
-  0xE0, 0x7F, 0xFF, 0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xFF, 0xFE, 0x00, 0x3F,
-  0xFF, 0xFF, 0xF8, 0x00, 0x1F, 0xFF, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0xFE,
-  0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00,
-  0x00, 0x07, 0xFF, 0xE0, 0x00, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x03,
-  0xFF, 0xF8, 0x00, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0xFE,
-  0x00, 0x00, 0x01, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00,
-  0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x7F,
-  0xBF, 0xF0, 0x00, 0x00, 0x7F, 0xDF, 0xF8, 0x00, 0x00, 0x3F, 0xCF, 0xFC,
-  0x00, 0x00, 0x3F, 0xE7, 0xFE, 0x00, 0x00, 0x3F, 0xE3, 0xFF, 0x00, 0x00,
-  0x1F, 0xE1, 0xFF, 0x80, 0x00, 0x1F, 0xF0, 0xFF, 0xC0, 0x00, 0x1F, 0xF0,
-  0x7F, 0xE0, 0x00, 0x0F, 0xF8, 0x3F, 0xF0, 0x00, 0x0F, 0xF8, 0x1F, 0xF8,
-  0x00, 0x07, 0xF8, 0x0F, 0xFC, 0x00, 0x07, 0xFC, 0x07, 0xFE, 0x00, 0x07,
-  0xFC, 0x03, 0xFF, 0x00, 0x03, 0xFE, 0x01, 0xFF, 0x80, 0x03, 0xFE, 0x00,
-  0xFF, 0xC0, 0x01, 0xFE, 0x00, 0x7F, 0xE0, 0x01, 0xFF, 0x00, 0x3F, 0xF0,
-  0x01, 0xFF, 0x00, 0x1F, 0xF8, 0x00, 0xFF, 0x80, 0x0F, 0xFC, 0x00, 0xFF,
-  0x80, 0x07, 0xFE, 0x00, 0xFF, 0x80, 0x03, 0xFF, 0x00, 0x7F, 0xC0, 0x01,
-  0xFF, 0x80, 0x7F, 0xC0, 0x00, 0xFF, 0xC0, 0x3F, 0xE0, 0x00, 0x7F, 0xE0,
-  0x3F, 0xE0, 0x00, 0x3F, 0xF0, 0x1F, 0xE0, 0x00, 0x1F, 0xF8, 0x0F, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x07,
-  0xFE, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80,
-  0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00,
-  0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x0F,
-  0xFC, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xF0,
-  0x1F, 0xFF, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF,
-  0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0xFF, 0xFE,
-  0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0xFF, 0xF8, 0x0F, 0xFF,
-  0xFF, 0xFF, 0xF0, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00,
-  0x00, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFC,
-  0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00,
-  0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x7F,
-  0x80, 0x00, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x01, 0xFE, 0x0F, 0xFF,
-  0xC0, 0x03, 0xFC, 0x3F, 0xFF, 0xE0, 0x07, 0xF8, 0xFF, 0xFF, 0xE0, 0x0F,
-  0xF3, 0xFF, 0xFF, 0xE0, 0x1F, 0xEF, 0xFF, 0xFF, 0xE0, 0x7F, 0xDF, 0xFF,
-  0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xE1, 0xFF, 0xF8, 0x0F, 0xFF, 0xC3,
-  0xFF, 0xC0, 0x07, 0xFF, 0xC7, 0xFE, 0x00, 0x07, 0xFF, 0x80, 0x78, 0x00,
-  0x07, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFE,
-  0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00,
-  0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0xFF,
-  0xC0, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xFF, 0x01, 0x00,
-  0x00, 0x0F, 0xFE, 0x0F, 0x00, 0x00, 0x1F, 0xFC, 0x3F, 0x00, 0x00, 0x7F,
-  0xF0, 0xFF, 0x00, 0x00, 0xFF, 0xE7, 0xFF, 0x00, 0x03, 0xFF, 0xDF, 0xFF,
-  0x00, 0x0F, 0xFF, 0x1F, 0xFF, 0xC0, 0x7F, 0xFE, 0x1F, 0xFF, 0xFF, 0xFF,
-  0xF8, 0x1F, 0xFF, 0xFF, 0xFF, 0xE0, 0x1F, 0xFF, 0xFF, 0xFF, 0x80, 0x1F,
-  0xFF, 0xFF, 0xFE, 0x00, 0x1F, 0xFF, 0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0xFF,
-  0xC0, 0x00, 0x07, 0xFF, 0xFE, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00,
-  0x00, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x03,
-  0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xFE, 0x00,
-  0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0x0F,
-  0xFF, 0x80, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00,
-  0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x00, 0x1F,
-  0xFE, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00,
-  0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x1F,
-  0xFC, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00,
-  0x00, 0x01, 0xFF, 0x80, 0xFF, 0x00, 0x07, 0xFF, 0x0F, 0xFF, 0xC0, 0x0F,
-  0xFC, 0x3F, 0xFF, 0xC0, 0x3F, 0xF9, 0xFF, 0xFF, 0xE0, 0x7F, 0xF7, 0xFF,
-  0xFF, 0xE0, 0xFF, 0xCF, 0xFF, 0xFF, 0xE1, 0xFF, 0xBF, 0xFF, 0xFF, 0xE7,
-  0xFF, 0x7F, 0xFF, 0xFF, 0xCF, 0xFF, 0xF0, 0x1F, 0xFF, 0xDF, 0xFF, 0x80,
-  0x0F, 0xFF, 0xBF, 0xFE, 0x00, 0x07, 0xFF, 0xFF, 0xF8, 0x00, 0x0F, 0xFF,
-  0xFF, 0xE0, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0xFF, 0x80,
-  0x00, 0x1F, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x00, 0x7F,
-  0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xFF, 0xF0,
-  0x00, 0x03, 0xFF, 0x7F, 0xE0, 0x00, 0x07, 0xFE, 0xFF, 0xC0, 0x00, 0x1F,
-  0xFD, 0xFF, 0x80, 0x00, 0x3F, 0xF9, 0xFF, 0x80, 0x00, 0xFF, 0xE3, 0xFF,
-  0x80, 0x01, 0xFF, 0xC7, 0xFF, 0x80, 0x0F, 0xFF, 0x07, 0xFF, 0xC0, 0x7F,
-  0xFE, 0x07, 0xFF, 0xFF, 0xFF, 0xF8, 0x0F, 0xFF, 0xFF, 0xFF, 0xE0, 0x0F,
-  0xFF, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xFF, 0xFE, 0x00, 0x07, 0xFF, 0xFF,
-  0xF8, 0x00, 0x07, 0xFF, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xFE, 0x00, 0x00,
-  0x00, 0x7F, 0xE0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x1F, 0xFF, 0xF8,
-  0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0xFE, 0x00, 0x00, 0x7F,
-  0xEF, 0xF0, 0x00, 0x07, 0xFF, 0x7F, 0x80, 0x00, 0x3F, 0xF3, 0xFC, 0x00,
-  0x01, 0xFF, 0x9F, 0xE0, 0x00, 0x1F, 0xFC, 0xFF, 0x00, 0x00, 0xFF, 0xC7,
-  0xF8, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x07,
-  0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00,
-  0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFE,
-  0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00,
-  0x3F, 0xF8, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x1F, 0xFC, 0x00,
-  0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x7F,
-  0xF0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00,
-  0x01, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xE0,
-  0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x03,
-  0xFF, 0x80, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00,
-  0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x07, 0xFE,
-  0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00,
-  0x1F, 0xF8, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFC, 0x00,
-  0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x7F,
-  0xF0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x7F, 0xFF, 0xF0,
-  0x00, 0x03, 0xFF, 0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0xFF, 0xF8, 0x00, 0x7F,
-  0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0xFF,
-  0xF8, 0x0F, 0xFF, 0xFF, 0xFF, 0xF8, 0x3F, 0xFF, 0x01, 0xFF, 0xF8, 0x7F,
-  0xF8, 0x00, 0xFF, 0xF0, 0xFF, 0xC0, 0x00, 0xFF, 0xE3, 0xFF, 0x80, 0x00,
-  0xFF, 0xE7, 0xFE, 0x00, 0x00, 0xFF, 0xCF, 0xFC, 0x00, 0x01, 0xFF, 0x9F,
-  0xF8, 0x00, 0x03, 0xFF, 0x3F, 0xF0, 0x00, 0x07, 0xFE, 0x7F, 0xE0, 0x00,
-  0x0F, 0xFC, 0x7F, 0xC0, 0x00, 0x1F, 0xF0, 0xFF, 0x80, 0x00, 0x3F, 0xE1,
-  0xFF, 0x80, 0x00, 0xFF, 0xC1, 0xFF, 0x00, 0x03, 0xFF, 0x01, 0xFF, 0x80,
-  0x0F, 0xFC, 0x03, 0xFF, 0xC0, 0x7F, 0xF0, 0x01, 0xFF, 0xFF, 0xFF, 0xC0,
-  0x01, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xFF,
-  0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0xF8,
-  0x00, 0xFF, 0xFF, 0xFF, 0xF8, 0x07, 0xFF, 0xFF, 0xFF, 0xFC, 0x1F, 0xFF,
-  0x80, 0xFF, 0xF8, 0x3F, 0xF8, 0x00, 0x3F, 0xF8, 0xFF, 0xE0, 0x00, 0x3F,
-  0xF9, 0xFF, 0x80, 0x00, 0x3F, 0xF7, 0xFF, 0x00, 0x00, 0x7F, 0xFF, 0xFE,
-  0x00, 0x00, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x01,
-  0xFF, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0xFF,
-  0x80, 0x00, 0x0F, 0xFF, 0xFF, 0x80, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x00,
-  0x7F, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xEF, 0xFE, 0x00, 0x03, 0xFF, 0x9F,
-  0xFE, 0x00, 0x0F, 0xFF, 0x3F, 0xFF, 0x80, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF,
-  0xFF, 0xF8, 0x3F, 0xFF, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xFF, 0xFF, 0x80,
-  0x3F, 0xFF, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0x00, 0x1F, 0xFF,
-  0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0xFE, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00,
-  0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x01, 0xFF,
-  0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0xF8,
-  0x00, 0xFF, 0xFF, 0xFF, 0xF8, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF,
-  0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0x01, 0xFF, 0xF0, 0x7F, 0xF8, 0x00, 0xFF,
-  0xE1, 0xFF, 0xC0, 0x00, 0xFF, 0xE3, 0xFF, 0x80, 0x00, 0xFF, 0xCF, 0xFE,
-  0x00, 0x00, 0xFF, 0xDF, 0xFC, 0x00, 0x01, 0xFF, 0xBF, 0xF0, 0x00, 0x03,
-  0xFF, 0x7F, 0xE0, 0x00, 0x07, 0xFF, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0xFF,
-  0x80, 0x00, 0x1F, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x00,
-  0x7F, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x01, 0xFF, 0xFF,
-  0xF8, 0x00, 0x03, 0xFF, 0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0xFF, 0xF0, 0x00,
-  0x3F, 0xFE, 0xFF, 0xF8, 0x00, 0xFF, 0xFD, 0xFF, 0xFC, 0x07, 0xFF, 0xF9,
-  0xFF, 0xFF, 0xFF, 0x7F, 0xF3, 0xFF, 0xFF, 0xFE, 0xFF, 0xC3, 0xFF, 0xFF,
-  0xF9, 0xFF, 0x83, 0xFF, 0xFF, 0xF7, 0xFF, 0x03, 0xFF, 0xFF, 0xCF, 0xFE,
-  0x03, 0xFF, 0xFF, 0x1F, 0xF8, 0x01, 0xFF, 0xF8, 0x7F, 0xF0, 0x00, 0x7F,
-  0xC0, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xFF,
-  0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00,
-  0x00, 0xFF, 0xE0, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xFF,
-  0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00,
-  0x03, 0xFF, 0xE0, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xFE,
-  0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00,
-  0x0F, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x01, 0xFF, 0xF8,
-  0x00, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x00,
-  0xFF, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xC1, 0xFF, 0x1F, 0xFC, 0xFF, 0xEF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0x9F, 0xFC, 0x7F,
-  0xC1, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x07, 0xFC, 0x7F, 0xF3, 0xFF,
-  0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xFE, 0x7F, 0xF1,
-  0xFF, 0x07, 0xF0, 0x07, 0xF0, 0x1F, 0xF0, 0x7F, 0xF0, 0xFF, 0xE3, 0xFF,
-  0xE7, 0xFF, 0xCF, 0xFF, 0x9F, 0xFF, 0x3F, 0xFE, 0x3F, 0xF8, 0x7F, 0xF0,
-  0x7F, 0xC0, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-  0xFC, 0x07, 0xFC, 0x1F, 0xFC, 0x3F, 0xF8, 0xFF, 0xF9, 0xFF, 0xF3, 0xFF,
-  0xE7, 0xFF, 0xCF, 0xFF, 0x8F, 0xFF, 0x1F, 0xFC, 0x1F, 0xF8, 0x1F, 0xF0,
-  0x0F, 0xE0, 0x3F, 0x80, 0x7F, 0x01, 0xFC, 0x03, 0xF8, 0x0F, 0xE0, 0x3F,
-  0x80, 0xFE, 0x03, 0xFC, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00,
-  0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x01, 0xF0, 0x00,
-  0x00, 0x0F, 0xE0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x01, 0xFF, 0x80, 0x00,
-  0x0F, 0xFF, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x01, 0xFF, 0xFC, 0x00, 0x0F,
-  0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xC0, 0x01, 0xFF, 0xFE, 0x00, 0x07, 0xFF,
-  0xF0, 0x00, 0x3F, 0xFF, 0xC0, 0x01, 0xFF, 0xFE, 0x00, 0x07, 0xFF, 0xF0,
-  0x00, 0x3F, 0xFF, 0xC0, 0x00, 0xFF, 0xFE, 0x00, 0x07, 0xFF, 0xF0, 0x00,
-  0x0F, 0xFF, 0xC0, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00,
-  0x7F, 0xE0, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x03,
-  0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xFC, 0x00, 0x01, 0xFF, 0xFE, 0x00, 0x00,
-  0xFF, 0xFE, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x00,
-  0x3F, 0xFF, 0x80, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0xE0, 0x00,
-  0x1F, 0xFF, 0xE0, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xC0, 0x00,
-  0x07, 0xFF, 0x80, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00,
-  0x01, 0xFC, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00,
-  0x00, 0x60, 0x00, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xF8, 0x80, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x03, 0xC0, 0x00,
-  0x00, 0x07, 0xC0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x1F, 0xF0, 0x00,
-  0x00, 0x3F, 0xF0, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0xFF, 0xF8, 0x00,
-  0x01, 0xFF, 0xFC, 0x00, 0x01, 0xFF, 0xFE, 0x00, 0x01, 0xFF, 0xFE, 0x00,
-  0x00, 0xFF, 0xFF, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0x7F, 0xFF, 0x80,
-  0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0xE0,
-  0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x07, 0xFF, 0xE0,
-  0x00, 0x03, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x07, 0xFF, 0x00,
-  0x00, 0x1F, 0xFE, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x07, 0xFF, 0xF8, 0x00,
-  0x1F, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xF8, 0x00, 0x1F,
-  0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x1F, 0xFF,
-  0xE0, 0x00, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0xE0,
-  0x00, 0x1F, 0xFF, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x7F, 0xE0, 0x00,
-  0x00, 0xFF, 0x80, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00,
-  0x07, 0x80, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x07, 0xFF,
-  0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0xFC, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x1F,
-  0xFF, 0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0xFF, 0xC1, 0xFF, 0xFF, 0xFF, 0xFC,
-  0x3F, 0xFC, 0x0F, 0xFF, 0x8F, 0xFE, 0x00, 0x7F, 0xF9, 0xFF, 0x80, 0x07,
-  0xFF, 0x7F, 0xE0, 0x00, 0x7F, 0xE7, 0xFC, 0x00, 0x0F, 0xFE, 0x3F, 0x00,
-  0x01, 0xFF, 0xC0, 0xE0, 0x00, 0x3F, 0xF8, 0x08, 0x00, 0x07, 0xFF, 0x00,
-  0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x03, 0xFF,
-  0x80, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x03,
-  0xFF, 0x80, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00,
-  0x7F, 0xFF, 0x00, 0x01, 0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xF0, 0x00,
-  0x07, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x1F, 0xFF, 0x80,
-  0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x0F, 0xF8,
-  0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x07,
-  0xFC, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF8,
-  0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x0F,
-  0xFF, 0x00, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00,
-  0x07, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x1F, 0xFF, 0x00,
-  0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x03, 0xFE,
-  0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F,
-  0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00,
-  0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xF8, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x0F, 0xFF, 0xE0, 0x00, 0x03,
-  0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x3F,
-  0xF8, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x01, 0xFF, 0x00,
-  0x00, 0x00, 0x03, 0xFE, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0xE0,
-  0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x7F, 0x80, 0x00, 0x00,
-  0x00, 0x07, 0xF8, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0xFE,
-  0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x1F, 0xC0, 0x00, 0xFE, 0x00, 0x00,
-  0x1F, 0xC1, 0xFC, 0x00, 0x3F, 0xF8, 0xFF, 0x01, 0xFC, 0x3F, 0x80, 0x0F,
-  0xFF, 0xCF, 0xF0, 0x0F, 0xE3, 0xF8, 0x01, 0xFF, 0xFE, 0xFF, 0x00, 0xFE,
-  0x3F, 0x00, 0x3F, 0xFF, 0xEF, 0xF0, 0x07, 0xE7, 0xF0, 0x03, 0xFF, 0xFF,
-  0xFF, 0x00, 0x7F, 0x7F, 0x00, 0x7F, 0xE0, 0x7F, 0xF0, 0x07, 0xF7, 0xE0,
-  0x07, 0xFC, 0x03, 0xFF, 0x00, 0x7F, 0xFE, 0x00, 0xFF, 0x80, 0x1F, 0xF0,
-  0x03, 0xFF, 0xE0, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x3F, 0xFE, 0x00, 0xFF,
-  0x00, 0x0F, 0xF0, 0x03, 0xFF, 0xE0, 0x1F, 0xE0, 0x00, 0xFF, 0x00, 0x3F,
-  0xFE, 0x01, 0xFE, 0x00, 0x0F, 0xF0, 0x03, 0xFF, 0xE0, 0x1F, 0xE0, 0x00,
-  0xFF, 0x00, 0x3F, 0xFC, 0x01, 0xFE, 0x00, 0x0F, 0xF0, 0x03, 0xFF, 0xC0,
-  0x1F, 0xE0, 0x00, 0xFF, 0x00, 0x3F, 0xFC, 0x01, 0xFE, 0x00, 0x0F, 0xF0,
-  0x03, 0xFF, 0xC0, 0x1F, 0xE0, 0x00, 0xFF, 0x00, 0x3F, 0xFC, 0x01, 0xFE,
-  0x00, 0x0F, 0xF0, 0x03, 0xFF, 0xE0, 0x1F, 0xE0, 0x00, 0xFF, 0x00, 0x7F,
-  0xFE, 0x01, 0xFE, 0x00, 0x0F, 0xF0, 0x07, 0xFF, 0xE0, 0x1F, 0xE0, 0x00,
-  0xFF, 0x00, 0x7F, 0xFE, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x07, 0xEF, 0xE0,
-  0x0F, 0xF0, 0x00, 0xFF, 0x00, 0xFE, 0x7E, 0x00, 0xFF, 0x80, 0x1F, 0xF0,
-  0x0F, 0xE7, 0xE0, 0x07, 0xFC, 0x03, 0xFF, 0x01, 0xFC, 0x7F, 0x00, 0x7F,
-  0xE0, 0x77, 0xF8, 0x3F, 0xC7, 0xF0, 0x03, 0xFF, 0xFF, 0x7F, 0xFF, 0xF8,
-  0x3F, 0x00, 0x3F, 0xFF, 0xF3, 0xFF, 0xFF, 0x03, 0xF8, 0x01, 0xFF, 0xFE,
-  0x3F, 0xFF, 0xE0, 0x3F, 0x80, 0x0F, 0xFF, 0xC1, 0xFF, 0xFC, 0x01, 0xFC,
-  0x00, 0x3F, 0xF8, 0x0F, 0xFF, 0x80, 0x1F, 0xE0, 0x00, 0xFE, 0x00, 0x3F,
-  0xC0, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
-  0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF,
-  0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00,
-  0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF,
-  0xFF, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00,
-  0x00, 0x0F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00,
-  0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xF0, 0x00,
-  0x00, 0x00, 0x01, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x80,
-  0x00, 0x00, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFC,
-  0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
-  0xC0, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0xF7,
-  0xFE, 0x00, 0x00, 0x00, 0x07, 0xFC, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF,
-  0x3F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0x8F, 0xFC, 0x00, 0x00, 0x00, 0x3F,
-  0xE1, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x7F, 0xE0, 0x00, 0x00, 0x07,
-  0xFC, 0x1F, 0xF8, 0x00, 0x00, 0x01, 0xFF, 0x03, 0xFE, 0x00, 0x00, 0x00,
-  0xFF, 0xC0, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xE0, 0x3F, 0xF0, 0x00, 0x00,
-  0x0F, 0xF8, 0x07, 0xFC, 0x00, 0x00, 0x07, 0xFE, 0x01, 0xFF, 0x80, 0x00,
-  0x01, 0xFF, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x7F, 0xC0, 0x0F, 0xF8, 0x00,
-  0x00, 0x3F, 0xF0, 0x03, 0xFF, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0xFF, 0xC0,
-  0x00, 0x03, 0xFE, 0x00, 0x1F, 0xF0, 0x00, 0x01, 0xFF, 0x80, 0x07, 0xFE,
-  0x00, 0x00, 0x7F, 0xC0, 0x01, 0xFF, 0x80, 0x00, 0x1F, 0xF0, 0x00, 0x3F,
-  0xE0, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xFC, 0x00, 0x03, 0xFF, 0xFF, 0xFF,
-  0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0xFF,
-  0xFF, 0xF8, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x07, 0xFF, 0xFF,
-  0xFF, 0xFF, 0x80, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x1F, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xE0, 0x07, 0xFE, 0x00, 0x00, 0x1F, 0xF8, 0x01, 0xFF,
-  0x80, 0x00, 0x07, 0xFE, 0x00, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0xC0, 0x3F,
-  0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x0F, 0xFC, 0x00, 0x00, 0x0F, 0xFC, 0x07,
-  0xFF, 0x00, 0x00, 0x03, 0xFF, 0x81, 0xFF, 0x80, 0x00, 0x00, 0x7F, 0xE0,
-  0x7F, 0xE0, 0x00, 0x00, 0x1F, 0xF8, 0x3F, 0xF8, 0x00, 0x00, 0x07, 0xFF,
-  0x0F, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0xC3, 0xFF, 0x00, 0x00, 0x00, 0x3F,
-  0xF1, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFE, 0x7F, 0xE0, 0x00, 0x00, 0x03,
-  0xFF, 0xBF, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0xFF, 0xFF, 0xFF, 0xF8,
-  0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xFF, 0xFF, 0xF0, 0x1F,
-  0xFF, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0xE1, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 0xE0, 0x00, 0x3F, 0xFF, 0x3F,
-  0xF0, 0x00, 0x07, 0xFF, 0x9F, 0xF8, 0x00, 0x01, 0xFF, 0xCF, 0xFC, 0x00,
-  0x00, 0xFF, 0xE7, 0xFE, 0x00, 0x00, 0x7F, 0xF3, 0xFF, 0x00, 0x00, 0x3F,
-  0xF9, 0xFF, 0x80, 0x00, 0x1F, 0xFC, 0xFF, 0xC0, 0x00, 0x0F, 0xFE, 0x7F,
-  0xE0, 0x00, 0x07, 0xFF, 0x3F, 0xF0, 0x00, 0x03, 0xFF, 0x1F, 0xF8, 0x00,
-  0x01, 0xFF, 0x8F, 0xFC, 0x00, 0x01, 0xFF, 0xC7, 0xFE, 0x00, 0x03, 0xFF,
-  0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0xC1, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF,
-  0xFF, 0xFF, 0xFF, 0x80, 0x7F, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFF,
-  0xFF, 0xF0, 0x1F, 0xFF, 0xFF, 0xFF, 0xFE, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF,
-  0x87, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0xFF,
-  0x80, 0x00, 0x3F, 0xFC, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0x7F, 0xE0, 0x00,
-  0x01, 0xFF, 0xBF, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x7F,
-  0xFF, 0xFC, 0x00, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x00, 0x1F, 0xFF, 0xFF,
-  0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x80, 0x00, 0x07, 0xFF, 0xFF, 0xC0, 0x00,
-  0x03, 0xFF, 0xFF, 0xE0, 0x00, 0x01, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xFF,
-  0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xEF, 0xFC, 0x00, 0x01, 0xFF, 0xF7, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFF, 0xFC,
-  0x3F, 0xFF, 0xFF, 0xFF, 0xFC, 0x1F, 0xFF, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF,
-  0xFF, 0xFF, 0xF8, 0x07, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x3F,
-  0xF8, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x00, 0x0F, 0xFF, 0xFF,
-  0xE0, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFC,
-  0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xE0, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
-  0x3F, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x7F,
-  0xFF, 0x01, 0xFF, 0xFC, 0x0F, 0xFF, 0x80, 0x03, 0xFF, 0xC0, 0xFF, 0xF0,
-  0x00, 0x1F, 0xFE, 0x1F, 0xFE, 0x00, 0x00, 0xFF, 0xE1, 0xFF, 0xC0, 0x00,
-  0x07, 0xF8, 0x3F, 0xF8, 0x00, 0x00, 0x7F, 0x03, 0xFF, 0x80, 0x00, 0x03,
-  0xC0, 0x3F, 0xF0, 0x00, 0x00, 0x30, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x00,
-  0x7F, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x7F,
-  0xE0, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0,
-  0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00,
-  0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00,
-  0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00,
-  0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x0F,
-  0xFE, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xFE,
-  0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00,
-  0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00,
-  0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x10, 0x07, 0xFF, 0x00, 0x00, 0x01,
-  0x80, 0x3F, 0xF8, 0x00, 0x00, 0x3E, 0x03, 0xFF, 0x80, 0x00, 0x03, 0xF8,
-  0x3F, 0xFC, 0x00, 0x00, 0x7F, 0xC1, 0xFF, 0xE0, 0x00, 0x0F, 0xFE, 0x1F,
-  0xFF, 0x00, 0x01, 0xFF, 0xE0, 0xFF, 0xF8, 0x00, 0x3F, 0xFC, 0x0F, 0xFF,
-  0xF0, 0x1F, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0xFF, 0xF8, 0x03, 0xFF, 0xFF,
-  0xFF, 0xFF, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xFF,
-  0xFC, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x3F, 0xFF, 0xFF, 0xF0,
-  0x00, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x00,
-  0x00, 0x03, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x1F, 0xFF,
-  0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0xFF,
-  0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xC0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x1F, 0xF8, 0x00, 0x3F, 0xFF, 0x83, 0xFF,
-  0x00, 0x00, 0xFF, 0xF8, 0x7F, 0xE0, 0x00, 0x0F, 0xFF, 0x8F, 0xFC, 0x00,
-  0x00, 0x7F, 0xF1, 0xFF, 0x80, 0x00, 0x0F, 0xFE, 0x3F, 0xF0, 0x00, 0x00,
-  0xFF, 0xE7, 0xFE, 0x00, 0x00, 0x0F, 0xFC, 0xFF, 0xC0, 0x00, 0x01, 0xFF,
-  0xDF, 0xF8, 0x00, 0x00, 0x3F, 0xFB, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0x7F,
-  0xE0, 0x00, 0x00, 0x7F, 0xEF, 0xFC, 0x00, 0x00, 0x0F, 0xFD, 0xFF, 0x80,
-  0x00, 0x01, 0xFF, 0xBF, 0xF0, 0x00, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x00,
-  0x07, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x1F,
-  0xFF, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x7F, 0xFF,
-  0xFC, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0xFF, 0xF0,
-  0x00, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xC0, 0x00,
-  0x00, 0xFF, 0xDF, 0xF8, 0x00, 0x00, 0x1F, 0xFB, 0xFF, 0x00, 0x00, 0x03,
-  0xFF, 0x7F, 0xE0, 0x00, 0x00, 0xFF, 0xEF, 0xFC, 0x00, 0x00, 0x1F, 0xFD,
-  0xFF, 0x80, 0x00, 0x03, 0xFF, 0xBF, 0xF0, 0x00, 0x00, 0x7F, 0xE7, 0xFE,
-  0x00, 0x00, 0x1F, 0xFC, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0x1F, 0xF8, 0x00,
-  0x00, 0xFF, 0xE3, 0xFF, 0x00, 0x00, 0x7F, 0xFC, 0x7F, 0xE0, 0x00, 0x1F,
-  0xFF, 0x0F, 0xFC, 0x00, 0x1F, 0xFF, 0xC1, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8,
-  0x3F, 0xFF, 0xFF, 0xFF, 0xFE, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xE0, 0x1F, 0xFF, 0xFF, 0xFF, 0xF8, 0x03, 0xFF, 0xFF,
-  0xFF, 0xFC, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xFF,
-  0x00, 0x01, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x0F, 0xFE, 0x00,
-  0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0xFF,
-  0xE0, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00,
-  0x0F, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x0F, 0xFE, 0x00,
-  0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0xFF,
-  0xFF, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF,
-  0x8F, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF,
-  0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF,
-  0xFF, 0xFF, 0xFF, 0x8F, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00,
-  0x0F, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x0F, 0xFE, 0x00,
-  0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0xFF,
-  0xE0, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00,
-  0x0F, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x0F, 0xFE, 0x00,
-  0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x7F,
-  0xF0, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00,
-  0x3F, 0xF8, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00,
-  0x00, 0x1F, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x7F, 0xF0,
-  0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x3F,
-  0xFF, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF,
-  0x1F, 0xFF, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF,
-  0xFF, 0x8F, 0xFF, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF,
-  0xFF, 0xFF, 0xC7, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x1F,
-  0xFC, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00,
-  0x0F, 0xFE, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xF8, 0x00,
-  0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x1F, 0xFC,
-  0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x0F,
-  0xFE, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00,
-  0x07, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x1F, 0xFC, 0x00,
-  0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x0F, 0xFE,
-  0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC,
-  0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF,
-  0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFE,
-  0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xF8,
-  0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0,
-  0x1F, 0xFF, 0xC0, 0x1F, 0xFF, 0xC0, 0x7F, 0xFC, 0x00, 0x1F, 0xFF, 0x03,
-  0xFF, 0xC0, 0x00, 0x1F, 0xFE, 0x1F, 0xFE, 0x00, 0x00, 0x3F, 0xF0, 0x7F,
-  0xF0, 0x00, 0x00, 0x7F, 0x81, 0xFF, 0x80, 0x00, 0x01, 0xF8, 0x0F, 0xFE,
-  0x00, 0x00, 0x03, 0x80, 0x3F, 0xF0, 0x00, 0x00, 0x08, 0x00, 0xFF, 0xC0,
-  0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00,
-  0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00,
-  0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00,
-  0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0xFF,
-  0xFF, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x0F, 0xFF,
-  0xFF, 0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF,
-  0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0xFF,
-  0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0xFD, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xF7,
-  0xFE, 0x00, 0x00, 0x00, 0xFF, 0xDF, 0xF8, 0x00, 0x00, 0x03, 0xFF, 0x7F,
-  0xF0, 0x00, 0x00, 0x0F, 0xFD, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xF7, 0xFF,
-  0x00, 0x00, 0x00, 0xFF, 0xCF, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0x3F, 0xF8,
-  0x00, 0x00, 0x0F, 0xFC, 0xFF, 0xE0, 0x00, 0x00, 0x7F, 0xF1, 0xFF, 0xC0,
-  0x00, 0x01, 0xFF, 0xC7, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0x0F, 0xFF, 0x00,
-  0x00, 0x7F, 0xFC, 0x3F, 0xFF, 0x00, 0x07, 0xFF, 0xF0, 0x7F, 0xFF, 0x80,
-  0x7F, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0xFF, 0xDF, 0xF0, 0x0F, 0xFF, 0xFF, 0xFE,
-  0x7F, 0xC0, 0x1F, 0xFF, 0xFF, 0xF9, 0xFF, 0x00, 0x1F, 0xFF, 0xFF, 0xC7,
-  0xFC, 0x00, 0x3F, 0xFF, 0xFC, 0x1F, 0xF0, 0x00, 0x1F, 0xFF, 0xE0, 0x7F,
-  0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x7F, 0xFF,
-  0xFE, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x7F, 0xFF, 0xFE,
-  0x00, 0x00, 0x07, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x7F, 0xFF, 0xFE, 0x00,
-  0x00, 0x07, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x7F, 0xFF, 0xFE, 0x00, 0x00,
-  0x07, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x7F, 0xFF, 0xFE, 0x00, 0x00, 0x07,
-  0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x7F, 0xFF, 0xFE, 0x00, 0x00, 0x07, 0xFF,
-  0xFF, 0xE0, 0x00, 0x00, 0x7F, 0xFF, 0xFE, 0x00, 0x00, 0x07, 0xFF, 0xFF,
-  0xE0, 0x00, 0x00, 0x7F, 0xFF, 0xFE, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xE0,
-  0x00, 0x00, 0x7F, 0xFF, 0xFE, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xE0, 0x00,
-  0x00, 0x7F, 0xFF, 0xFE, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xE0, 0x00, 0x00,
-  0x7F, 0xFF, 0xFE, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00,
-  0x07, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x7F, 0xFF, 0xFE, 0x00, 0x00, 0x07,
-  0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x7F, 0xFF, 0xFE, 0x00, 0x00, 0x07, 0xFF,
-  0xFF, 0xE0, 0x00, 0x00, 0x7F, 0xFF, 0xFE, 0x00, 0x00, 0x07, 0xFF, 0xFF,
-  0xE0, 0x00, 0x00, 0x7F, 0xFF, 0xFE, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xE0,
-  0x00, 0x00, 0x7F, 0xFF, 0xFE, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xE0, 0x00,
-  0x00, 0x7F, 0xFF, 0xFE, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xE0, 0x00, 0x00,
-  0x7F, 0xFF, 0xFE, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x7F,
-  0xFF, 0xFE, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x7F, 0xFF,
-  0xFE, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x7F, 0xFF, 0xFE,
-  0x00, 0x00, 0x07, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x7F, 0xFF, 0xFE, 0x00,
-  0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xE0, 0x00, 0x7F,
-  0xF0, 0x00, 0x3F, 0xF8, 0x00, 0x1F, 0xFC, 0x00, 0x0F, 0xFE, 0x00, 0x07,
-  0xFF, 0x00, 0x03, 0xFF, 0x80, 0x01, 0xFF, 0xC0, 0x00, 0xFF, 0xE0, 0x00,
-  0x7F, 0xF0, 0x00, 0x3F, 0xF8, 0x00, 0x1F, 0xFC, 0x00, 0x0F, 0xFE, 0x00,
-  0x07, 0xFF, 0x00, 0x03, 0xFF, 0x80, 0x01, 0xFF, 0xC0, 0x00, 0xFF, 0xE0,
-  0x00, 0x7F, 0xF0, 0x00, 0x3F, 0xF8, 0x00, 0x1F, 0xFC, 0x00, 0x0F, 0xFE,
-  0x00, 0x07, 0xFF, 0x00, 0x03, 0xFF, 0x80, 0x01, 0xFF, 0xC0, 0x00, 0xFF,
-  0xE0, 0x00, 0x7F, 0xF0, 0x00, 0x3F, 0xF8, 0x00, 0x1F, 0xFC, 0x00, 0x0F,
-  0xFE, 0x00, 0x07, 0xFF, 0x00, 0x03, 0xFF, 0x80, 0x01, 0xFF, 0xC0, 0x00,
-  0xFF, 0xE0, 0x00, 0x7F, 0xF0, 0x00, 0x3F, 0xF8, 0x00, 0x1F, 0xFC, 0x07,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xFF,
-  0xFC, 0x07, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xF0, 0x1F, 0xFF,
-  0xFF, 0xFE, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0xF8, 0x0F,
-  0xFF, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x1F, 0xFC,
-  0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x0F,
-  0xFE, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00,
-  0x07, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x1F, 0xFC, 0x00,
-  0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x0F, 0xFE,
-  0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x07,
-  0xFF, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00,
-  0x03, 0xFF, 0x80, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x0F, 0xFE, 0x00,
-  0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x07, 0xFF,
-  0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x03,
-  0xFF, 0x80, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00,
-  0x01, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xF8, 0x1E, 0x00, 0x07, 0xFF, 0x7F,
-  0xC0, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x1F, 0xF9, 0xFF, 0x80, 0x03, 0xFF,
-  0x3F, 0xF8, 0x00, 0xFF, 0xE7, 0xFF, 0x80, 0x3F, 0xFC, 0x7F, 0xF8, 0x1F,
-  0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xF8, 0x1F, 0xFF,
-  0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0xFF, 0xC0, 0x1F, 0xFF, 0xFF, 0xF0, 0x01,
-  0xFF, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0x00,
-  0x00, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xF3, 0xFF,
-  0x80, 0x00, 0x07, 0xFF, 0x8F, 0xFE, 0x00, 0x00, 0x3F, 0xFC, 0x3F, 0xF8,
-  0x00, 0x01, 0xFF, 0xE0, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0x03, 0xFF, 0x80,
-  0x00, 0x3F, 0xFC, 0x0F, 0xFE, 0x00, 0x01, 0xFF, 0xE0, 0x3F, 0xF8, 0x00,
-  0x0F, 0xFF, 0x00, 0xFF, 0xE0, 0x00, 0x7F, 0xF8, 0x03, 0xFF, 0x80, 0x01,
-  0xFF, 0xC0, 0x0F, 0xFE, 0x00, 0x0F, 0xFE, 0x00, 0x3F, 0xF8, 0x00, 0x7F,
-  0xF8, 0x00, 0xFF, 0xE0, 0x03, 0xFF, 0xC0, 0x03, 0xFF, 0x80, 0x1F, 0xFE,
-  0x00, 0x0F, 0xFE, 0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xF8, 0x03, 0xFF, 0x80,
-  0x00, 0xFF, 0xE0, 0x1F, 0xFC, 0x00, 0x03, 0xFF, 0x80, 0xFF, 0xF0, 0x00,
-  0x0F, 0xFE, 0x07, 0xFF, 0x80, 0x00, 0x3F, 0xF8, 0x1F, 0xFC, 0x00, 0x00,
-  0xFF, 0xE0, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0x87, 0xFF, 0x00, 0x00, 0x0F,
-  0xFE, 0x3F, 0xF8, 0x00, 0x00, 0x3F, 0xF9, 0xFF, 0xF0, 0x00, 0x00, 0xFF,
-  0xE7, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xBF, 0xFF, 0x80, 0x00, 0x0F, 0xFF,
-  0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFF,
-  0xFF, 0xF8, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0xF9,
-  0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xC7, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0x0F,
-  0xFF, 0x00, 0x03, 0xFF, 0xF8, 0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0xC0, 0x7F,
-  0xF8, 0x00, 0x3F, 0xFE, 0x00, 0xFF, 0xF0, 0x00, 0xFF, 0xF0, 0x03, 0xFF,
-  0xC0, 0x03, 0xFF, 0x80, 0x07, 0xFF, 0x80, 0x0F, 0xFE, 0x00, 0x0F, 0xFF,
-  0x00, 0x3F, 0xF8, 0x00, 0x3F, 0xFC, 0x00, 0xFF, 0xE0, 0x00, 0x7F, 0xF8,
-  0x03, 0xFF, 0x80, 0x00, 0xFF, 0xF0, 0x0F, 0xFE, 0x00, 0x03, 0xFF, 0xC0,
-  0x3F, 0xF8, 0x00, 0x07, 0xFF, 0x80, 0xFF, 0xE0, 0x00, 0x0F, 0xFF, 0x03,
-  0xFF, 0x80, 0x00, 0x3F, 0xFC, 0x0F, 0xFE, 0x00, 0x00, 0x7F, 0xF8, 0x3F,
-  0xF8, 0x00, 0x01, 0xFF, 0xF0, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xC3, 0xFF,
-  0x80, 0x00, 0x07, 0xFF, 0x8F, 0xFE, 0x00, 0x00, 0x1F, 0xFE, 0x3F, 0xF8,
-  0x00, 0x00, 0x3F, 0xFC, 0xFF, 0xE0, 0x00, 0x00, 0x7F, 0xFB, 0xFF, 0x80,
-  0x00, 0x01, 0xFF, 0xF0, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x03,
-  0xFF, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x1F,
-  0xF8, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0xFF,
-  0xC0, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x07, 0xFE,
-  0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x3F, 0xF0,
-  0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0x80,
-  0x00, 0x03, 0xFF, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x0F, 0xFC, 0x00,
-  0x00, 0x1F, 0xF8, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x7F, 0xE0, 0x00,
-  0x00, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x03, 0xFF, 0x00, 0x00,
-  0x07, 0xFE, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00,
-  0x3F, 0xF0, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x01,
-  0xFF, 0x80, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x0F,
-  0xFC, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x7F,
-  0xE0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x03, 0xFF,
-  0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x1F, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xE0,
-  0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
-  0x80, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x1F, 0xFF, 0xFF,
-  0xFC, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0xFF,
-  0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x7F, 0xFF,
-  0xFF, 0xFF, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x0F, 0xFF,
-  0xFF, 0xFF, 0xF8, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x01, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x3F,
-  0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xFF, 0xFE, 0xFF, 0xC0, 0x07,
-  0xFD, 0xFF, 0xFF, 0xBF, 0xF0, 0x03, 0xFF, 0x7F, 0xFF, 0xE7, 0xFE, 0x00,
-  0xFF, 0x9F, 0xFF, 0xF9, 0xFF, 0x80, 0x7F, 0xE7, 0xFF, 0xFE, 0x3F, 0xF0,
-  0x1F, 0xF1, 0xFF, 0xFF, 0x8F, 0xFC, 0x0F, 0xFC, 0x7F, 0xFF, 0xE1, 0xFF,
-  0x83, 0xFE, 0x1F, 0xFF, 0xF8, 0x7F, 0xE1, 0xFF, 0x87, 0xFF, 0xFE, 0x0F,
-  0xFC, 0x7F, 0xC1, 0xFF, 0xFF, 0x83, 0xFF, 0x3F, 0xF0, 0x7F, 0xFF, 0xE0,
-  0x7F, 0xEF, 0xF8, 0x1F, 0xFF, 0xF8, 0x1F, 0xFF, 0xFE, 0x07, 0xFF, 0xFE,
-  0x03, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF,
-  0xE0, 0x1F, 0xFF, 0xE0, 0x1F, 0xFF, 0xF8, 0x03, 0xFF, 0xF0, 0x07, 0xFF,
-  0xFE, 0x00, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0x80, 0x1F, 0xFE, 0x00, 0x7F,
-  0xFF, 0xE0, 0x07, 0xFF, 0x80, 0x1F, 0xFF, 0xF8, 0x00, 0xFF, 0xC0, 0x07,
-  0xFF, 0xFE, 0x00, 0x3F, 0xF0, 0x01, 0xFF, 0xFF, 0x80, 0x07, 0xF8, 0x00,
-  0x7F, 0xFF, 0xE0, 0x01, 0xFE, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x3F, 0x00,
-  0x07, 0xFF, 0xFE, 0x00, 0x07, 0xC0, 0x01, 0xFF, 0xFF, 0x80, 0x01, 0xE0,
-  0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x30, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x0C,
-  0x00, 0x07, 0xFF, 0xFE, 0x00, 0x02, 0x00, 0x01, 0xFF, 0xFF, 0x80, 0x00,
-  0x00, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xF8, 0x00,
-  0x00, 0x00, 0x07, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x80,
-  0x00, 0x00, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xF8,
-  0x00, 0x00, 0x00, 0x07, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF,
-  0x80, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0xF0,
-  0xFF, 0xF0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x00, 0x03, 0xFF, 0xFF,
-  0xF8, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xFF, 0xFC,
-  0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x00,
-  0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x80, 0x00,
-  0x3F, 0xFF, 0xFF, 0xF8, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x3F,
-  0xFF, 0xFF, 0xFC, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x3F, 0xFF,
-  0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xFF,
-  0xFF, 0x80, 0x03, 0xFF, 0xFF, 0xDF, 0xF8, 0x00, 0x3F, 0xFF, 0xFD, 0xFF,
-  0xC0, 0x03, 0xFF, 0xFF, 0xCF, 0xFE, 0x00, 0x3F, 0xFF, 0xFC, 0xFF, 0xE0,
-  0x03, 0xFF, 0xFF, 0xC7, 0xFF, 0x00, 0x3F, 0xFF, 0xFC, 0x3F, 0xF0, 0x03,
-  0xFF, 0xFF, 0xC3, 0xFF, 0x80, 0x3F, 0xFF, 0xFC, 0x1F, 0xFC, 0x03, 0xFF,
-  0xFF, 0xC1, 0xFF, 0xC0, 0x3F, 0xFF, 0xFC, 0x0F, 0xFE, 0x03, 0xFF, 0xFF,
-  0xC0, 0xFF, 0xE0, 0x3F, 0xFF, 0xFC, 0x07, 0xFF, 0x03, 0xFF, 0xFF, 0xC0,
-  0x7F, 0xF8, 0x3F, 0xFF, 0xFC, 0x03, 0xFF, 0x83, 0xFF, 0xFF, 0xC0, 0x3F,
-  0xFC, 0x3F, 0xFF, 0xFC, 0x01, 0xFF, 0xC3, 0xFF, 0xFF, 0xC0, 0x0F, 0xFE,
-  0x3F, 0xFF, 0xFC, 0x00, 0xFF, 0xE3, 0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0x3F,
-  0xFF, 0xFC, 0x00, 0x7F, 0xF3, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xBF, 0xFF,
-  0xFC, 0x00, 0x1F, 0xFB, 0xFF, 0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0xFF, 0xFC,
-  0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xFC, 0x00,
-  0x07, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xFF, 0xFC, 0x00, 0x03,
-  0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0x01, 0xFF,
-  0xFF, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xFF,
-  0xFF, 0xC0, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x3F, 0xFF, 0xFF,
-  0xC0, 0x00, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xC0,
-  0x00, 0x01, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x1F,
-  0xF8, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xFF,
-  0xFF, 0xE0, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x3F, 0xFF,
-  0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xFF,
-  0xFF, 0xFF, 0x80, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0xF0, 0x0F, 0xFF, 0xE0, 0x0F, 0xFF, 0xC0,
-  0x03, 0xFF, 0xF0, 0x0F, 0xFF, 0x00, 0x00, 0xFF, 0xF0, 0x1F, 0xFE, 0x00,
-  0x00, 0x7F, 0xF8, 0x1F, 0xFC, 0x00, 0x00, 0x3F, 0xF8, 0x3F, 0xF8, 0x00,
-  0x00, 0x1F, 0xFC, 0x3F, 0xF8, 0x00, 0x00, 0x1F, 0xFC, 0x3F, 0xF0, 0x00,
-  0x00, 0x0F, 0xFC, 0x3F, 0xF0, 0x00, 0x00, 0x0F, 0xFC, 0x7F, 0xF0, 0x00,
-  0x00, 0x0F, 0xFE, 0x7F, 0xF0, 0x00, 0x00, 0x0F, 0xFE, 0x7F, 0xE0, 0x00,
-  0x00, 0x07, 0xFE, 0x7F, 0xE0, 0x00, 0x00, 0x07, 0xFE, 0x7F, 0xE0, 0x00,
-  0x00, 0x07, 0xFE, 0xFF, 0xE0, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xE0, 0x00,
-  0x00, 0x07, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xE0, 0x00,
-  0x00, 0x07, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xE0, 0x00,
-  0x00, 0x07, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xE0, 0x00,
-  0x00, 0x07, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xE0, 0x00,
-  0x00, 0x07, 0xFF, 0x7F, 0xE0, 0x00, 0x00, 0x07, 0xFE, 0x7F, 0xE0, 0x00,
-  0x00, 0x07, 0xFE, 0x7F, 0xE0, 0x00, 0x00, 0x07, 0xFE, 0x7F, 0xF0, 0x00,
-  0x00, 0x0F, 0xFE, 0x7F, 0xF0, 0x00, 0x00, 0x0F, 0xFE, 0x3F, 0xF0, 0x00,
-  0x00, 0x0F, 0xFC, 0x3F, 0xF0, 0x00, 0x00, 0x0F, 0xFC, 0x3F, 0xF8, 0x00,
-  0x00, 0x1F, 0xFC, 0x3F, 0xF8, 0x00, 0x00, 0x1F, 0xFC, 0x1F, 0xFC, 0x00,
-  0x00, 0x3F, 0xF8, 0x1F, 0xFE, 0x00, 0x00, 0x7F, 0xF8, 0x0F, 0xFF, 0x00,
-  0x00, 0xFF, 0xF0, 0x0F, 0xFF, 0xC0, 0x03, 0xFF, 0xF0, 0x07, 0xFF, 0xF0,
-  0x0F, 0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF,
-  0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x1F, 0xFF,
-  0xFF, 0xF8, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x01, 0xFF,
-  0xFF, 0x80, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
-  0xF8, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xFF, 0xFF, 0xF0,
-  0x1F, 0xFF, 0xFF, 0xFF, 0xFE, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0x87, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x7F, 0xF0, 0x00, 0x0F, 0xFF,
-  0xBF, 0xF8, 0x00, 0x01, 0xFF, 0xDF, 0xFC, 0x00, 0x00, 0xFF, 0xEF, 0xFE,
-  0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x80, 0x00,
-  0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0xFF, 0xE0, 0x00, 0x03, 0xFF,
-  0xFF, 0xF0, 0x00, 0x01, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0xFC,
-  0x00, 0x00, 0x7F, 0xFF, 0xFE, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x00,
-  0x3F, 0xFB, 0xFF, 0x80, 0x00, 0x1F, 0xFD, 0xFF, 0xC0, 0x00, 0x3F, 0xFE,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF,
-  0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0xFF,
-  0xFF, 0x87, 0xFF, 0xFF, 0xFF, 0xFF, 0x83, 0xFF, 0xFF, 0xFF, 0xFF, 0x01,
-  0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x7F, 0xF0,
-  0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00,
-  0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x03,
-  0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xE0,
-  0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00,
-  0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x07,
-  0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF, 0xC0,
-  0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00,
-  0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x0F,
-  0xFE, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x1F, 0xF8, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x07,
-  0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x3F,
-  0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x01, 0xFF,
-  0xFF, 0xFF, 0xFF, 0x80, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0xF0, 0x0F, 0xFF, 0xE0, 0x0F, 0xFF,
-  0xC0, 0x03, 0xFF, 0xF0, 0x0F, 0xFF, 0x00, 0x00, 0xFF, 0xF0, 0x1F, 0xFE,
-  0x00, 0x00, 0x7F, 0xF8, 0x1F, 0xFC, 0x00, 0x00, 0x3F, 0xF8, 0x1F, 0xF8,
-  0x00, 0x00, 0x1F, 0xF8, 0x3F, 0xF8, 0x00, 0x00, 0x1F, 0xFC, 0x3F, 0xF0,
-  0x00, 0x00, 0x0F, 0xFC, 0x3F, 0xF0, 0x00, 0x00, 0x0F, 0xFC, 0x7F, 0xF0,
-  0x00, 0x00, 0x0F, 0xFE, 0x7F, 0xF0, 0x00, 0x00, 0x0F, 0xFE, 0x7F, 0xE0,
-  0x00, 0x00, 0x07, 0xFE, 0x7F, 0xE0, 0x00, 0x00, 0x07, 0xFE, 0x7F, 0xE0,
-  0x00, 0x00, 0x07, 0xFE, 0xFF, 0xE0, 0x00, 0x00, 0x07, 0xFE, 0xFF, 0xE0,
-  0x00, 0x00, 0x07, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xE0,
-  0x00, 0x00, 0x07, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xE0,
-  0x00, 0x00, 0x07, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xE0,
-  0x00, 0x00, 0x07, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xE0,
-  0x00, 0x00, 0x07, 0xFF, 0x7F, 0xE0, 0x00, 0x00, 0x07, 0xFE, 0x7F, 0xE0,
-  0x00, 0x00, 0x07, 0xFE, 0x7F, 0xE0, 0x00, 0x00, 0x07, 0xFE, 0x7F, 0xF0,
-  0x00, 0x00, 0x0F, 0xFE, 0x7F, 0xF0, 0x00, 0x00, 0x0F, 0xFE, 0x7F, 0xF0,
-  0x00, 0x00, 0x0F, 0xFE, 0x3F, 0xF0, 0x00, 0x00, 0x0F, 0xFC, 0x3F, 0xF8,
-  0x00, 0x00, 0x1F, 0xFC, 0x3F, 0xF8, 0x00, 0x00, 0x1F, 0xFC, 0x1F, 0xFC,
-  0x00, 0x00, 0x3F, 0xF8, 0x1F, 0xFE, 0x00, 0x00, 0x7F, 0xF8, 0x0F, 0xFF,
-  0x00, 0x00, 0xFF, 0xF0, 0x0F, 0xFF, 0xC0, 0x03, 0xFF, 0xF0, 0x07, 0xFF,
-  0xF0, 0x0F, 0xFF, 0xE0, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x03, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xFF,
-  0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x1F,
-  0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x03,
-  0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x00, 0x00,
-  0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00,
-  0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00,
-  0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x00, 0x00,
-  0x0F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x00, 0x00,
-  0x07, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x00, 0x00,
-  0x03, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x00,
-  0x00, 0x3F, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFF,
-  0xFF, 0xE0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFE, 0x3F, 0xF8, 0x00, 0x07, 0xFF, 0xCF, 0xFE, 0x00, 0x00,
-  0x7F, 0xF3, 0xFF, 0x80, 0x00, 0x0F, 0xFE, 0xFF, 0xE0, 0x00, 0x03, 0xFF,
-  0xBF, 0xF8, 0x00, 0x00, 0xFF, 0xEF, 0xFE, 0x00, 0x00, 0x3F, 0xFB, 0xFF,
-  0x80, 0x00, 0x0F, 0xFE, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xBF, 0xF8, 0x00,
-  0x00, 0xFF, 0xEF, 0xFE, 0x00, 0x00, 0x3F, 0xFB, 0xFF, 0x80, 0x00, 0x0F,
-  0xFE, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xBF, 0xF8, 0x00, 0x00, 0xFF, 0xEF,
-  0xFE, 0x00, 0x00, 0x7F, 0xF3, 0xFF, 0x80, 0x00, 0x7F, 0xFC, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8,
-  0x3F, 0xFF, 0xFF, 0xFF, 0xF8, 0x0F, 0xFF, 0xFF, 0xFF, 0xFC, 0x03, 0xFF,
-  0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x3F, 0xF8, 0x01,
-  0xFF, 0xC0, 0x0F, 0xFE, 0x00, 0x7F, 0xF0, 0x03, 0xFF, 0x80, 0x0F, 0xFE,
-  0x00, 0xFF, 0xE0, 0x03, 0xFF, 0x80, 0x3F, 0xF8, 0x00, 0x7F, 0xF0, 0x0F,
-  0xFE, 0x00, 0x1F, 0xFC, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0xFF, 0xE0,
-  0x00, 0xFF, 0xE0, 0x3F, 0xF8, 0x00, 0x1F, 0xFC, 0x0F, 0xFE, 0x00, 0x07,
-  0xFF, 0x03, 0xFF, 0x80, 0x00, 0xFF, 0xE0, 0xFF, 0xE0, 0x00, 0x3F, 0xF8,
-  0x3F, 0xF8, 0x00, 0x07, 0xFF, 0x0F, 0xFE, 0x00, 0x01, 0xFF, 0xC3, 0xFF,
-  0x80, 0x00, 0x3F, 0xF8, 0xFF, 0xE0, 0x00, 0x0F, 0xFE, 0x3F, 0xF8, 0x00,
-  0x01, 0xFF, 0xCF, 0xFE, 0x00, 0x00, 0x7F, 0xF3, 0xFF, 0x80, 0x00, 0x1F,
-  0xFE, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xBF, 0xF8, 0x00, 0x00, 0xFF, 0xF0,
-  0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x00, 0x00, 0x0F,
-  0xFF, 0xFF, 0xE0, 0x00, 0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xFF,
-  0xFF, 0x80, 0x1F, 0xFF, 0xFF, 0xFF, 0xE0, 0x1F, 0xFF, 0xFF, 0xFF, 0xF8,
-  0x1F, 0xFF, 0xFF, 0xFF, 0xFE, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF,
-  0xC0, 0x3F, 0xFF, 0x07, 0xFF, 0x80, 0x03, 0xFF, 0x07, 0xFF, 0x00, 0x00,
-  0x7F, 0x03, 0xFF, 0x80, 0x00, 0x1E, 0x01, 0xFF, 0x80, 0x00, 0x06, 0x00,
-  0xFF, 0xC0, 0x00, 0x02, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xF0,
-  0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00,
-  0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0x00,
-  0xFF, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xF0, 0x00, 0x00, 0x1F, 0xFF,
-  0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x03, 0xFF, 0xFF, 0xFF,
-  0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0xFE, 0x00,
-  0x07, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x1F,
-  0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x01, 0xFF,
-  0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF, 0xC0,
-  0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00,
-  0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x03,
-  0xFF, 0x02, 0x00, 0x00, 0x01, 0xFF, 0x81, 0x80, 0x00, 0x01, 0xFF, 0xC1,
-  0xE0, 0x00, 0x00, 0xFF, 0xE1, 0xFC, 0x00, 0x00, 0x7F, 0xE1, 0xFF, 0x00,
-  0x00, 0x7F, 0xF1, 0xFF, 0xE0, 0x00, 0x7F, 0xF9, 0xFF, 0xFE, 0x01, 0xFF,
-  0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0xFC, 0x0F,
-  0xFF, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF,
-  0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0x03, 0xFF, 0xFF, 0xF8,
-  0x00, 0x00, 0x7F, 0xFF, 0xF0, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xFF,
-  0xE0, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00,
-  0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00,
-  0x07, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF,
-  0xC0, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00,
-  0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00,
-  0x0F, 0xFE, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF,
-  0x80, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00,
-  0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00,
-  0x1F, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x07, 0xFF,
-  0x00, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00,
-  0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00,
-  0x3F, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFE,
-  0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00,
-  0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00,
-  0x7F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0xFC,
-  0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00,
-  0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00,
-  0xFF, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xF8,
-  0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00,
-  0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 0xFF, 0xFC,
-  0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x00,
-  0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x00, 0x0F,
-  0xFF, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xFF,
-  0xF0, 0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x00,
-  0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x00,
-  0x3F, 0xFF, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x00, 0x03, 0xFF,
-  0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 0xFF, 0xFC,
-  0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x00,
-  0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x00, 0x0F,
-  0xFF, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xFF,
-  0xF0, 0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x00,
-  0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x00,
-  0x3F, 0xFF, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x00, 0x03, 0xFF,
-  0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 0xFF, 0xFC,
-  0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x00,
-  0x00, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x7F, 0xFF, 0xFE, 0x00, 0x00, 0x1F,
-  0xF9, 0xFF, 0x80, 0x00, 0x07, 0xFE, 0x7F, 0xE0, 0x00, 0x01, 0xFF, 0x9F,
-  0xFC, 0x00, 0x00, 0xFF, 0xE7, 0xFF, 0x00, 0x00, 0x3F, 0xF8, 0xFF, 0xE0,
-  0x00, 0x1F, 0xFC, 0x3F, 0xFE, 0x00, 0x1F, 0xFF, 0x0F, 0xFF, 0xE0, 0x1F,
-  0xFF, 0xC1, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x7F, 0xFF, 0xFF, 0xFF, 0xF8,
-  0x0F, 0xFF, 0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x3F,
-  0xFF, 0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x7F, 0xFF,
-  0xFF, 0x80, 0x00, 0x07, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xFE, 0x00,
-  0x00, 0xFF, 0xE0, 0x00, 0x00, 0x07, 0xFF, 0x7F, 0xE0, 0x00, 0x00, 0x07,
-  0xFE, 0x7F, 0xF0, 0x00, 0x00, 0x07, 0xFE, 0x3F, 0xF0, 0x00, 0x00, 0x0F,
-  0xFC, 0x3F, 0xF0, 0x00, 0x00, 0x0F, 0xFC, 0x3F, 0xF8, 0x00, 0x00, 0x0F,
-  0xFC, 0x1F, 0xF8, 0x00, 0x00, 0x1F, 0xFC, 0x1F, 0xF8, 0x00, 0x00, 0x1F,
-  0xF8, 0x1F, 0xFC, 0x00, 0x00, 0x1F, 0xF8, 0x1F, 0xFC, 0x00, 0x00, 0x3F,
-  0xF8, 0x0F, 0xFC, 0x00, 0x00, 0x3F, 0xF0, 0x0F, 0xFE, 0x00, 0x00, 0x3F,
-  0xF0, 0x0F, 0xFE, 0x00, 0x00, 0x7F, 0xF0, 0x07, 0xFE, 0x00, 0x00, 0x7F,
-  0xE0, 0x07, 0xFF, 0x00, 0x00, 0x7F, 0xE0, 0x07, 0xFF, 0x00, 0x00, 0xFF,
-  0xE0, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0xC0, 0x03, 0xFF, 0x00, 0x00, 0xFF,
-  0xC0, 0x03, 0xFF, 0x80, 0x00, 0xFF, 0xC0, 0x01, 0xFF, 0x80, 0x01, 0xFF,
-  0x80, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0xC0, 0x01, 0xFF,
-  0x80, 0x00, 0xFF, 0xC0, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0xC0, 0x03, 0xFF,
-  0x00, 0x00, 0xFF, 0xE0, 0x03, 0xFF, 0x00, 0x00, 0x7F, 0xE0, 0x07, 0xFE,
-  0x00, 0x00, 0x7F, 0xE0, 0x07, 0xFE, 0x00, 0x00, 0x7F, 0xF0, 0x07, 0xFE,
-  0x00, 0x00, 0x3F, 0xF0, 0x0F, 0xFC, 0x00, 0x00, 0x3F, 0xF0, 0x0F, 0xFC,
-  0x00, 0x00, 0x3F, 0xF0, 0x0F, 0xFC, 0x00, 0x00, 0x1F, 0xF8, 0x0F, 0xF8,
-  0x00, 0x00, 0x1F, 0xF8, 0x1F, 0xF8, 0x00, 0x00, 0x1F, 0xF8, 0x1F, 0xF8,
-  0x00, 0x00, 0x0F, 0xF8, 0x1F, 0xF0, 0x00, 0x00, 0x0F, 0xFC, 0x1F, 0xF0,
-  0x00, 0x00, 0x0F, 0xFC, 0x3F, 0xF0, 0x00, 0x00, 0x07, 0xFC, 0x3F, 0xE0,
-  0x00, 0x00, 0x07, 0xFE, 0x3F, 0xE0, 0x00, 0x00, 0x07, 0xFE, 0x3F, 0xE0,
-  0x00, 0x00, 0x03, 0xFE, 0x7F, 0xC0, 0x00, 0x00, 0x03, 0xFE, 0x7F, 0xC0,
-  0x00, 0x00, 0x03, 0xFF, 0x7F, 0xC0, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x80,
-  0x00, 0x00, 0x01, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x80,
-  0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00,
-  0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFE, 0x00,
-  0x00, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFE, 0x00,
-  0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00,
-  0x00, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0xFF, 0x80,
-  0x00, 0x1F, 0xFE, 0x00, 0x00, 0x3F, 0xF7, 0xFE, 0x00, 0x00, 0x7F, 0xF8,
-  0x00, 0x00, 0xFF, 0x9F, 0xF8, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x07, 0xFE,
-  0x7F, 0xE0, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x1F, 0xF9, 0xFF, 0x80, 0x00,
-  0x3F, 0xFF, 0x00, 0x00, 0x7F, 0xE3, 0xFF, 0x00, 0x00, 0xFF, 0xFC, 0x00,
-  0x01, 0xFF, 0x0F, 0xFC, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x0F, 0xFC, 0x3F,
-  0xF0, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x3F, 0xF0, 0xFF, 0xC0, 0x00, 0x7F,
-  0xFF, 0x80, 0x00, 0xFF, 0xC3, 0xFF, 0x80, 0x01, 0xFF, 0xFE, 0x00, 0x03,
-  0xFE, 0x07, 0xFE, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x0F, 0xF8, 0x1F, 0xF8,
-  0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x7F, 0xE0, 0x7F, 0xE0, 0x00, 0xFF, 0x7F,
-  0xC0, 0x01, 0xFF, 0x81, 0xFF, 0x80, 0x03, 0xFC, 0xFF, 0x00, 0x07, 0xFC,
-  0x03, 0xFF, 0x00, 0x0F, 0xF3, 0xFE, 0x00, 0x1F, 0xF0, 0x0F, 0xFC, 0x00,
-  0x7F, 0xCF, 0xF8, 0x00, 0x7F, 0xC0, 0x3F, 0xF0, 0x01, 0xFE, 0x3F, 0xE0,
-  0x03, 0xFF, 0x00, 0xFF, 0xC0, 0x07, 0xF8, 0x7F, 0x80, 0x0F, 0xF8, 0x01,
-  0xFF, 0x00, 0x1F, 0xE1, 0xFF, 0x00, 0x3F, 0xE0, 0x07, 0xFE, 0x00, 0xFF,
-  0x87, 0xFC, 0x00, 0xFF, 0x80, 0x1F, 0xF8, 0x03, 0xFC, 0x1F, 0xF0, 0x07,
-  0xFE, 0x00, 0x7F, 0xE0, 0x0F, 0xF0, 0x3F, 0xC0, 0x1F, 0xF8, 0x00, 0xFF,
-  0x80, 0x3F, 0xC0, 0xFF, 0x00, 0x7F, 0xC0, 0x03, 0xFE, 0x00, 0xFF, 0x03,
-  0xFE, 0x01, 0xFF, 0x00, 0x0F, 0xFC, 0x07, 0xF8, 0x0F, 0xF8, 0x07, 0xFC,
-  0x00, 0x3F, 0xF0, 0x1F, 0xE0, 0x1F, 0xE0, 0x3F, 0xF0, 0x00, 0xFF, 0xC0,
-  0x7F, 0x80, 0x7F, 0x80, 0xFF, 0x80, 0x01, 0xFF, 0x01, 0xFE, 0x01, 0xFF,
-  0x03, 0xFE, 0x00, 0x07, 0xFC, 0x0F, 0xF0, 0x07, 0xFC, 0x0F, 0xF8, 0x00,
-  0x1F, 0xF8, 0x3F, 0xC0, 0x0F, 0xF0, 0x3F, 0xE0, 0x00, 0x7F, 0xE0, 0xFF,
-  0x00, 0x3F, 0xC1, 0xFF, 0x00, 0x00, 0xFF, 0x83, 0xFC, 0x00, 0xFF, 0x87,
-  0xFC, 0x00, 0x03, 0xFE, 0x1F, 0xE0, 0x03, 0xFE, 0x1F, 0xF0, 0x00, 0x0F,
-  0xF8, 0x7F, 0x80, 0x07, 0xF8, 0x7F, 0xC0, 0x00, 0x3F, 0xF1, 0xFE, 0x00,
-  0x1F, 0xE1, 0xFE, 0x00, 0x00, 0x7F, 0xC7, 0xF8, 0x00, 0x7F, 0xCF, 0xF8,
-  0x00, 0x01, 0xFF, 0x3F, 0xC0, 0x01, 0xFF, 0x3F, 0xE0, 0x00, 0x07, 0xFC,
-  0xFF, 0x00, 0x07, 0xFC, 0xFF, 0x80, 0x00, 0x1F, 0xF3, 0xFC, 0x00, 0x0F,
-  0xF3, 0xFC, 0x00, 0x00, 0x7F, 0xEF, 0xF0, 0x00, 0x3F, 0xCF, 0xF0, 0x00,
-  0x00, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xFE,
-  0x00, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x07, 0xFF,
-  0xF8, 0x00, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x00,
-  0x7F, 0xFF, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0xFC, 0x00,
-  0x01, 0xFF, 0xFE, 0x00, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xF0,
-  0x00, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x3F,
-  0xFE, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00,
-  0xFF, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x01, 0xFF, 0xF0, 0x00,
-  0x00, 0x0F, 0xFF, 0x80, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x00, 0x1F, 0xFE,
-  0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x0F, 0xFF,
-  0x1F, 0xFE, 0x00, 0x00, 0x07, 0xFF, 0x07, 0xFF, 0x80, 0x00, 0x07, 0xFF,
-  0x03, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0x80, 0xFF, 0xF0, 0x00, 0x03, 0xFF,
-  0x80, 0x3F, 0xF8, 0x00, 0x03, 0xFF, 0x80, 0x1F, 0xFE, 0x00, 0x01, 0xFF,
-  0xC0, 0x07, 0xFF, 0x80, 0x01, 0xFF, 0xC0, 0x01, 0xFF, 0xC0, 0x01, 0xFF,
-  0xC0, 0x00, 0xFF, 0xF0, 0x00, 0xFF, 0xE0, 0x00, 0x3F, 0xF8, 0x00, 0xFF,
-  0xE0, 0x00, 0x1F, 0xFE, 0x00, 0x7F, 0xE0, 0x00, 0x07, 0xFF, 0x80, 0x7F,
-  0xF0, 0x00, 0x01, 0xFF, 0xC0, 0x7F, 0xF0, 0x00, 0x00, 0xFF, 0xF0, 0x3F,
-  0xF0, 0x00, 0x00, 0x3F, 0xF8, 0x3F, 0xF8, 0x00, 0x00, 0x0F, 0xFE, 0x1F,
-  0xF8, 0x00, 0x00, 0x07, 0xFF, 0x9F, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0xDF,
-  0xFC, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xFF,
-  0xFE, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xFF,
-  0xFE, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x7F,
-  0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F,
-  0xFF, 0x80, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x07,
-  0xFF, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x07,
-  0xFF, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x03,
-  0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x01,
-  0xFF, 0x9F, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0xCF, 0xFF, 0x00, 0x00, 0x01,
-  0xFF, 0xC3, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0xC0, 0xFF, 0xE0, 0x00, 0x00,
-  0xFF, 0xE0, 0x7F, 0xF8, 0x00, 0x00, 0x7F, 0xE0, 0x1F, 0xFC, 0x00, 0x00,
-  0x7F, 0xF0, 0x07, 0xFF, 0x00, 0x00, 0x7F, 0xF0, 0x03, 0xFF, 0xC0, 0x00,
-  0x3F, 0xF0, 0x00, 0xFF, 0xE0, 0x00, 0x3F, 0xF8, 0x00, 0x7F, 0xF8, 0x00,
-  0x3F, 0xF8, 0x00, 0x1F, 0xFE, 0x00, 0x1F, 0xFC, 0x00, 0x0F, 0xFF, 0x00,
-  0x1F, 0xFC, 0x00, 0x03, 0xFF, 0xC0, 0x1F, 0xFC, 0x00, 0x00, 0xFF, 0xE0,
-  0x0F, 0xFE, 0x00, 0x00, 0x7F, 0xF8, 0x0F, 0xFE, 0x00, 0x00, 0x1F, 0xFE,
-  0x07, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0x07, 0xFF, 0x00, 0x00, 0x03, 0xFF,
-  0xC7, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xF7, 0xFF, 0x80, 0x00, 0x00, 0x7F,
-  0xFC, 0xFF, 0xE0, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x3F,
-  0xFD, 0xFF, 0xE0, 0x00, 0x00, 0x7F, 0xF1, 0xFF, 0xC0, 0x00, 0x01, 0xFF,
-  0xC3, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0x83, 0xFF, 0x80, 0x00, 0x0F, 0xFE,
-  0x07, 0xFF, 0x80, 0x00, 0x1F, 0xFC, 0x07, 0xFF, 0x00, 0x00, 0x7F, 0xF0,
-  0x0F, 0xFF, 0x00, 0x00, 0xFF, 0xE0, 0x0F, 0xFE, 0x00, 0x03, 0xFF, 0x80,
-  0x0F, 0xFE, 0x00, 0x07, 0xFE, 0x00, 0x1F, 0xFC, 0x00, 0x1F, 0xFC, 0x00,
-  0x1F, 0xFC, 0x00, 0x7F, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0xFF, 0xE0, 0x00,
-  0x3F, 0xF8, 0x03, 0xFF, 0x80, 0x00, 0x7F, 0xF8, 0x07, 0xFF, 0x00, 0x00,
-  0x7F, 0xF0, 0x1F, 0xFC, 0x00, 0x00, 0x7F, 0xF0, 0x3F, 0xF0, 0x00, 0x00,
-  0xFF, 0xE0, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xE1, 0xFF, 0x80, 0x00, 0x01,
-  0xFF, 0xC7, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0xCF, 0xFC, 0x00, 0x00, 0x03,
-  0xFF, 0xBF, 0xF8, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x07,
-  0xFF, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x07,
-  0xFF, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x0F,
-  0xFF, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x1F,
-  0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x3F,
-  0xF8, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF,
-  0xE0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xFF,
-  0x80, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE,
-  0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF8,
-  0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0,
-  0x00, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x80,
-  0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00,
-  0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00,
-  0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00,
-  0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00,
-  0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF,
-  0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFF, 0xFE,
-  0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00,
-  0x00, 0x07, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x00, 0x03,
-  0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0xC0,
-  0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00,
-  0x01, 0xFF, 0xE0, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x01, 0xFF,
-  0xE0, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00,
-  0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00,
-  0xFF, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0xF0,
-  0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00,
-  0x00, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x3F,
-  0xFC, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00,
-  0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00,
-  0x1F, 0xFE, 0x00, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x00, 0x1F, 0xFE,
-  0x00, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00,
-  0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x0F,
-  0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF,
-  0x81, 0xFF, 0x03, 0xFE, 0x07, 0xFC, 0x0F, 0xF8, 0x1F, 0xF0, 0x3F, 0xE0,
-  0x7F, 0xC0, 0xFF, 0x81, 0xFF, 0x03, 0xFE, 0x07, 0xFC, 0x0F, 0xF8, 0x1F,
-  0xF0, 0x3F, 0xE0, 0x7F, 0xC0, 0xFF, 0x81, 0xFF, 0x03, 0xFE, 0x07, 0xFC,
-  0x0F, 0xF8, 0x1F, 0xF0, 0x3F, 0xE0, 0x7F, 0xC0, 0xFF, 0x81, 0xFF, 0x03,
-  0xFE, 0x07, 0xFC, 0x0F, 0xF8, 0x1F, 0xF0, 0x3F, 0xE0, 0x7F, 0xC0, 0xFF,
-  0x81, 0xFF, 0x03, 0xFE, 0x07, 0xFC, 0x0F, 0xF8, 0x1F, 0xF0, 0x3F, 0xE0,
-  0x7F, 0xC0, 0xFF, 0x81, 0xFF, 0x03, 0xFE, 0x07, 0xFC, 0x0F, 0xF8, 0x1F,
-  0xF0, 0x3F, 0xE0, 0x7F, 0xC0, 0xFF, 0x81, 0xFF, 0x03, 0xFE, 0x07, 0xFC,
-  0x0F, 0xF8, 0x1F, 0xF0, 0x3F, 0xE0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0x00, 0x00, 0x01,
-  0xFF, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x07,
-  0xFC, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x1F,
-  0xF0, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x7F,
-  0xC0, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x01, 0xFF,
-  0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x07, 0xF8,
-  0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x1F, 0xE0,
-  0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x7F, 0x80,
-  0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x01, 0xFE, 0x00,
-  0x00, 0x03, 0xFE, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x07, 0xF8, 0x00,
-  0x00, 0x0F, 0xF8, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x1F, 0xE0, 0x00,
-  0x00, 0x3F, 0xE0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x7F, 0x80, 0x00,
-  0x00, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00,
-  0x03, 0xFE, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00,
-  0x0F, 0xF0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00,
-  0x3F, 0xC0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00,
-  0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x03,
-  0xFC, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x0F,
-  0xF0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x3F,
-  0xC0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0xFF,
-  0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x03, 0xFC,
-  0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x0F, 0xF0,
-  0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x3F, 0xC0,
-  0x00, 0x00, 0x7F, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x81, 0xFF, 0x03, 0xFE, 0x07, 0xFC, 0x0F,
-  0xF8, 0x1F, 0xF0, 0x3F, 0xE0, 0x7F, 0xC0, 0xFF, 0x81, 0xFF, 0x03, 0xFE,
-  0x07, 0xFC, 0x0F, 0xF8, 0x1F, 0xF0, 0x3F, 0xE0, 0x7F, 0xC0, 0xFF, 0x81,
-  0xFF, 0x03, 0xFE, 0x07, 0xFC, 0x0F, 0xF8, 0x1F, 0xF0, 0x3F, 0xE0, 0x7F,
-  0xC0, 0xFF, 0x81, 0xFF, 0x03, 0xFE, 0x07, 0xFC, 0x0F, 0xF8, 0x1F, 0xF0,
-  0x3F, 0xE0, 0x7F, 0xC0, 0xFF, 0x81, 0xFF, 0x03, 0xFE, 0x07, 0xFC, 0x0F,
-  0xF8, 0x1F, 0xF0, 0x3F, 0xE0, 0x7F, 0xC0, 0xFF, 0x81, 0xFF, 0x03, 0xFE,
-  0x07, 0xFC, 0x0F, 0xF8, 0x1F, 0xF0, 0x3F, 0xE0, 0x7F, 0xC0, 0xFF, 0x81,
-  0xFF, 0x03, 0xFE, 0x07, 0xFC, 0x0F, 0xF8, 0x1F, 0xF0, 0x3F, 0xE0, 0x7F,
-  0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xFF,
-  0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00,
-  0x00, 0x7F, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0xFC, 0x00, 0x00, 0x03, 0xFF,
-  0xF8, 0x00, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x00, 0x1F, 0xFF, 0xF0, 0x00,
-  0x00, 0x7F, 0xFF, 0xF0, 0x00, 0x01, 0xFF, 0xFF, 0xF0, 0x00, 0x03, 0xFF,
-  0x7F, 0xE0, 0x00, 0x0F, 0xFC, 0x7F, 0xE0, 0x00, 0x1F, 0xF0, 0xFF, 0xC0,
-  0x00, 0x7F, 0xE0, 0xFF, 0xC0, 0x00, 0xFF, 0x81, 0xFF, 0x80, 0x03, 0xFF,
-  0x01, 0xFF, 0x80, 0x07, 0xFC, 0x03, 0xFF, 0x00, 0x1F, 0xF8, 0x03, 0xFF,
-  0x00, 0x3F, 0xE0, 0x07, 0xFF, 0x00, 0xFF, 0xC0, 0x07, 0xFE, 0x03, 0xFF,
-  0x00, 0x07, 0xFE, 0x07, 0xFE, 0x00, 0x0F, 0xFC, 0x1F, 0xF8, 0x00, 0x0F,
-  0xFC, 0x3F, 0xE0, 0x00, 0x1F, 0xF8, 0xFF, 0xC0, 0x00, 0x1F, 0xF9, 0xFF,
-  0x00, 0x00, 0x3F, 0xF7, 0xFE, 0x00, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x00,
-  0x7F, 0xEF, 0xF0, 0x00, 0x00, 0x7F, 0x07, 0xC0, 0x00, 0x00, 0xF8, 0x03,
-  0x80, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0x80, 0x1F, 0x00, 0xFF,
-  0x07, 0xFE, 0x0F, 0xFE, 0x0F, 0xFC, 0x0F, 0xFC, 0x1F, 0xF8, 0x1F, 0xF8,
-  0x1F, 0xF0, 0x1F, 0xF0, 0x3F, 0xE0, 0x3F, 0xE0, 0x3F, 0xC0, 0x3F, 0x80,
-  0x7C, 0x00, 0x60, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x00,
-  0x00, 0x1F, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x0F, 0xFF,
-  0xFF, 0xFE, 0x00, 0x7F, 0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xFF, 0xF0,
-  0x0F, 0xFF, 0xFF, 0xFF, 0xE0, 0x3F, 0xF8, 0x0F, 0xFF, 0x80, 0x3F, 0x80,
-  0x0F, 0xFF, 0x00, 0x7C, 0x00, 0x1F, 0xFC, 0x00, 0xE0, 0x00, 0x3F, 0xF0,
-  0x01, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00,
-  0x0F, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xC0,
-  0x00, 0x00, 0x03, 0xFF, 0x00, 0x01, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF,
-  0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0xFF, 0x01,
-  0xFF, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF, 0xF0, 0x3F, 0xFC, 0x00,
-  0xFF, 0xC1, 0xFF, 0xC0, 0x03, 0xFF, 0x07, 0xFE, 0x00, 0x0F, 0xFC, 0x3F,
-  0xF0, 0x00, 0x3F, 0xF0, 0xFF, 0xC0, 0x00, 0xFF, 0xC3, 0xFF, 0x00, 0x03,
-  0xFF, 0x0F, 0xFC, 0x00, 0x0F, 0xFC, 0x3F, 0xF0, 0x00, 0x3F, 0xF0, 0xFF,
-  0xE0, 0x01, 0xFF, 0xC3, 0xFF, 0x80, 0x0F, 0xFF, 0x0F, 0xFF, 0x80, 0xFF,
-  0xFF, 0xDF, 0xFF, 0xFF, 0xEF, 0xFF, 0x7F, 0xFF, 0xFF, 0x3F, 0xFC, 0xFF,
-  0xFF, 0xFC, 0xFF, 0xF3, 0xFF, 0xFF, 0xE1, 0xFF, 0xC7, 0xFF, 0xFF, 0x07,
-  0xFF, 0x0F, 0xFF, 0xF8, 0x0F, 0xFC, 0x0F, 0xFF, 0xC0, 0x0F, 0xF0, 0x07,
-  0xF8, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00,
-  0x00, 0x3F, 0xF0, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xFC,
-  0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00,
-  0x1F, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xFE, 0x00,
-  0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x0F,
-  0xFC, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00,
-  0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x3F, 0xC0, 0x07, 0xFE,
-  0x0F, 0xFF, 0x80, 0x3F, 0xF0, 0xFF, 0xFF, 0x01, 0xFF, 0x8F, 0xFF, 0xFC,
-  0x0F, 0xFC, 0xFF, 0xFF, 0xF0, 0x7F, 0xEF, 0xFF, 0xFF, 0xC3, 0xFF, 0x7F,
-  0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFE, 0x07, 0xFF, 0xE7,
-  0xFF, 0xC0, 0x0F, 0xFF, 0x3F, 0xF8, 0x00, 0x3F, 0xFD, 0xFF, 0xC0, 0x00,
-  0xFF, 0xEF, 0xFC, 0x00, 0x03, 0xFF, 0x7F, 0xE0, 0x00, 0x1F, 0xFF, 0xFF,
-  0x00, 0x00, 0xFF, 0xFF, 0xF8, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0x1F,
-  0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x07, 0xFF, 0xFF, 0x80,
-  0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x01, 0xFF, 0xFF, 0xE0, 0x00, 0x0F, 0xFF,
-  0xFF, 0x00, 0x00, 0x7F, 0xFF, 0xF8, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x00,
-  0x1F, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x07, 0xFF, 0xFF,
-  0x80, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x01, 0xFF, 0xFF, 0xE0, 0x00, 0x1F,
-  0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xDF, 0xFC, 0x00, 0x0F, 0xFE, 0xFF, 0xE0,
-  0x00, 0xFF, 0xF7, 0xFF, 0xC0, 0x0F, 0xFF, 0x3F, 0xFF, 0x81, 0xFF, 0xF9,
-  0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0xFD, 0xFF, 0xFF, 0xFC, 0x7F, 0xEF, 0xFF,
-  0xFF, 0xC3, 0xFF, 0x3F, 0xFF, 0xFC, 0x1F, 0xF8, 0xFF, 0xFF, 0xC0, 0xFF,
-  0xC3, 0xFF, 0xFC, 0x07, 0xFE, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xF0,
-  0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x01, 0xFF,
-  0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xFF, 0xE0, 0x0F,
-  0xFF, 0xFF, 0xFE, 0x03, 0xFF, 0xFF, 0xFF, 0xE0, 0x7F, 0xFF, 0xFF, 0xFC,
-  0x1F, 0xFF, 0x03, 0xFF, 0xC7, 0xFF, 0x80, 0x1F, 0xF8, 0xFF, 0xE0, 0x01,
-  0xFF, 0x9F, 0xF8, 0x00, 0x1F, 0x87, 0xFE, 0x00, 0x03, 0xC0, 0xFF, 0xC0,
-  0x00, 0x60, 0x1F, 0xF8, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0xFF,
-  0xE0, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00,
-  0x7F, 0xE0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00,
-  0x00, 0x3F, 0xF0, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xC0,
-  0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x3F,
-  0xF0, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x30,
-  0x1F, 0xF8, 0x00, 0x0F, 0x81, 0xFF, 0x80, 0x01, 0xFC, 0x3F, 0xF8, 0x00,
-  0x7F, 0xE7, 0xFF, 0x80, 0x1F, 0xFC, 0x7F, 0xFC, 0x0F, 0xFF, 0x07, 0xFF,
-  0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xF8, 0x0F, 0xFF, 0xFF, 0xFE, 0x00,
-  0xFF, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xFF, 0xE0, 0x00, 0x7F, 0xFF, 0xF8,
-  0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xFE,
-  0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00,
-  0x0F, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x03, 0xFF, 0x00,
-  0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x07,
-  0xFE, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00,
-  0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x03, 0xFF,
-  0x00, 0x1F, 0xE0, 0x1F, 0xF8, 0x07, 0xFF, 0xE0, 0xFF, 0xC0, 0x7F, 0xFF,
-  0x87, 0xFE, 0x07, 0xFF, 0xFE, 0x3F, 0xF0, 0x7F, 0xFF, 0xF9, 0xFF, 0x87,
-  0xFF, 0xFF, 0xEF, 0xFC, 0x7F, 0xFF, 0xFF, 0x7F, 0xE7, 0xFF, 0xFF, 0xFF,
-  0xFF, 0x3F, 0xFF, 0x03, 0xFF, 0xF9, 0xFF, 0xE0, 0x07, 0xFF, 0xDF, 0xFE,
-  0x00, 0x1F, 0xFE, 0xFF, 0xE0, 0x00, 0x7F, 0xF7, 0xFE, 0x00, 0x01, 0xFF,
-  0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x00, 0x7F, 0xFF, 0xF8, 0x00,
-  0x03, 0xFF, 0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFF,
-  0xF0, 0x00, 0x07, 0xFF, 0xFF, 0x80, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x01,
-  0xFF, 0xFF, 0xE0, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x00, 0x7F, 0xFF, 0xF8,
-  0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0xFE, 0x00, 0x00, 0xFF,
-  0xFF, 0xF0, 0x00, 0x07, 0xFF, 0xFF, 0x80, 0x00, 0x3F, 0xFF, 0xFC, 0x00,
-  0x01, 0xFF, 0xFF, 0xF0, 0x00, 0x0F, 0xFD, 0xFF, 0x80, 0x00, 0x7F, 0xEF,
-  0xFE, 0x00, 0x07, 0xFF, 0x7F, 0xF8, 0x00, 0x3F, 0xF9, 0xFF, 0xE0, 0x07,
-  0xFF, 0xCF, 0xFF, 0xC0, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFF, 0xF1, 0xFF,
-  0xFF, 0xFD, 0xFF, 0x87, 0xFF, 0xFF, 0xEF, 0xFC, 0x1F, 0xFF, 0xFE, 0x7F,
-  0xE0, 0x7F, 0xFF, 0xE3, 0xFF, 0x01, 0xFF, 0xFE, 0x1F, 0xF8, 0x07, 0xFF,
-  0xE0, 0xFF, 0xC0, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00,
-  0x00, 0x7F, 0xFF, 0x80, 0x00, 0x07, 0xFF, 0xFF, 0x80, 0x00, 0x3F, 0xFF,
-  0xFF, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xFE, 0x00,
-  0x7F, 0xFF, 0xFF, 0xF8, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x1F, 0xFF, 0x03,
-  0xFF, 0xE0, 0x7F, 0xF0, 0x03, 0xFF, 0x83, 0xFF, 0x80, 0x07, 0xFF, 0x0F,
-  0xFC, 0x00, 0x0F, 0xFC, 0x3F, 0xF0, 0x00, 0x3F, 0xF9, 0xFF, 0x80, 0x00,
-  0x7F, 0xE7, 0xFE, 0x00, 0x01, 0xFF, 0x9F, 0xF8, 0x00, 0x07, 0xFE, 0x7F,
-  0xE0, 0x00, 0x1F, 0xFB, 0xFF, 0x80, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xFE,
-  0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00,
-  0x01, 0xFF, 0x80, 0x00, 0x08, 0x03, 0xFF, 0x00, 0x00, 0x30, 0x0F, 0xFE,
-  0x00, 0x01, 0xE0, 0x3F, 0xF8, 0x00, 0x0F, 0xC0, 0x7F, 0xF8, 0x00, 0x7F,
-  0x81, 0xFF, 0xF8, 0x0F, 0xFE, 0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x07, 0xFF,
-  0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 0xFF, 0xFF, 0x80, 0x1F, 0xFF, 0xFF, 0xF8,
-  0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0xFE, 0x00, 0x00, 0x7F,
-  0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00,
-  0x3F, 0xFF, 0x00, 0x7F, 0xFF, 0x00, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0x01,
-  0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0x03, 0xFF, 0x00, 0x03,
-  0xFF, 0x00, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0x00, 0x03,
-  0xFF, 0x00, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0x00, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x03,
-  0xFF, 0x00, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0x00, 0x03,
-  0xFF, 0x00, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0x00, 0x03,
-  0xFF, 0x00, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0x00, 0x03,
-  0xFF, 0x00, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0x00, 0x03,
-  0xFF, 0x00, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0x00, 0x03,
-  0xFF, 0x00, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0x00, 0x03,
-  0xFF, 0x00, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0x00, 0x03,
-  0xFF, 0x00, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0x00, 0x03,
-  0xFF, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x07, 0xFF,
-  0x00, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00,
-  0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x0F, 0xFE,
-  0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0xFC, 0x00, 0x7F, 0xFF, 0xFC, 0x00,
-  0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xFF,
-  0xFF, 0xFF, 0xF0, 0x00, 0x7F, 0xFF, 0xFF, 0xFC, 0x00, 0x7F, 0xF8, 0x0F,
-  0xFE, 0x00, 0x3F, 0xF0, 0x01, 0xFF, 0x80, 0x3F, 0xF0, 0x00, 0x7F, 0xC0,
-  0x1F, 0xF8, 0x00, 0x3F, 0xF0, 0x0F, 0xF8, 0x00, 0x1F, 0xF8, 0x07, 0xFC,
-  0x00, 0x07, 0xFC, 0x03, 0xFE, 0x00, 0x03, 0xFE, 0x01, 0xFF, 0x00, 0x01,
-  0xFF, 0x00, 0xFF, 0x80, 0x00, 0xFF, 0x80, 0x7F, 0xC0, 0x00, 0x7F, 0xC0,
-  0x3F, 0xE0, 0x00, 0x7F, 0xE0, 0x1F, 0xF8, 0x00, 0x3F, 0xF0, 0x0F, 0xFC,
-  0x00, 0x1F, 0xF8, 0x03, 0xFF, 0x00, 0x1F, 0xF8, 0x01, 0xFF, 0xE0, 0x3F,
-  0xFC, 0x00, 0x7F, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xFC, 0x00,
-  0x0F, 0xFF, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x7F,
-  0xFF, 0xFC, 0x00, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x00, 0x7E, 0xFF, 0xE0,
-  0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00,
-  0xFE, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0,
-  0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF,
-  0x80, 0x07, 0xFF, 0xFF, 0xFF, 0xF8, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF,
-  0xFF, 0xFF, 0xF8, 0x01, 0xFF, 0xFF, 0xFF, 0xFE, 0x07, 0xFF, 0xFF, 0xFF,
-  0xFF, 0x0F, 0xE0, 0x00, 0x07, 0xFF, 0x8F, 0xE0, 0x00, 0x00, 0xFF, 0xEF,
-  0xF0, 0x00, 0x00, 0x3F, 0xF7, 0xF0, 0x00, 0x00, 0x1F, 0xFB, 0xF8, 0x00,
-  0x00, 0x0F, 0xFF, 0xFE, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x00, 0x00, 0x03,
-  0xFE, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0x3F, 0xF8, 0x00, 0x0F, 0xFF, 0x9F,
-  0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x1F, 0xFF, 0xFF, 0xFF,
-  0x00, 0x03, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00,
-  0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00,
-  0x00, 0x7F, 0xE0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0x80,
-  0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0xFF,
-  0xC0, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00,
-  0x7F, 0xE0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00,
-  0x00, 0x3F, 0xF0, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xC0,
-  0x3F, 0xC0, 0x1F, 0xF8, 0x3F, 0xFE, 0x03, 0xFF, 0x0F, 0xFF, 0xF0, 0x7F,
-  0xE3, 0xFF, 0xFF, 0x0F, 0xFC, 0xFF, 0xFF, 0xF1, 0xFF, 0xBF, 0xFF, 0xFE,
-  0x3F, 0xF7, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFE, 0x07,
-  0xFF, 0xDF, 0xFF, 0x00, 0x7F, 0xFB, 0xFF, 0x80, 0x07, 0xFF, 0x7F, 0xF0,
-  0x00, 0x7F, 0xEF, 0xFC, 0x00, 0x0F, 0xFD, 0xFF, 0x80, 0x01, 0xFF, 0xFF,
-  0xF0, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0x7F,
-  0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xFF, 0xE0, 0x00,
-  0x3F, 0xFF, 0xFC, 0x00, 0x07, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xF0,
-  0x00, 0x1F, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xFF,
-  0xF8, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xFF, 0xE0, 0x00, 0x3F,
-  0xFF, 0xFC, 0x00, 0x07, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xF0, 0x00,
-  0x1F, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0xF8,
-  0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xFF, 0xE0, 0x00, 0x3F, 0xFF,
-  0xFC, 0x00, 0x07, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x1F,
-  0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0xF8, 0x00,
-  0x0F, 0xFC, 0x1F, 0x87, 0xFE, 0x7F, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0x7F, 0xE7, 0xFE, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x07, 0xFE, 0x7F, 0xE7, 0xFE, 0x7F, 0xE7, 0xFE, 0x7F,
-  0xE7, 0xFE, 0x7F, 0xE7, 0xFE, 0x7F, 0xE7, 0xFE, 0x7F, 0xE7, 0xFE, 0x7F,
-  0xE7, 0xFE, 0x7F, 0xE7, 0xFE, 0x7F, 0xE7, 0xFE, 0x7F, 0xE7, 0xFE, 0x7F,
-  0xE7, 0xFE, 0x7F, 0xE7, 0xFE, 0x7F, 0xE7, 0xFE, 0x7F, 0xE7, 0xFE, 0x7F,
-  0xE7, 0xFE, 0x7F, 0xE7, 0xFE, 0x7F, 0xE7, 0xFE, 0x7F, 0xE7, 0xFE, 0x7F,
-  0xE7, 0xFE, 0x7F, 0xE7, 0xFE, 0x00, 0xFC, 0x01, 0xFF, 0x80, 0xFF, 0xC0,
-  0xFF, 0xF0, 0x7F, 0xF8, 0x3F, 0xFC, 0x1F, 0xFE, 0x0F, 0xFF, 0x03, 0xFF,
-  0x01, 0xFF, 0x80, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0xFF, 0xC0, 0x7F, 0xE0,
-  0x3F, 0xF0, 0x1F, 0xF8, 0x0F, 0xFC, 0x07, 0xFE, 0x03, 0xFF, 0x01, 0xFF,
-  0x80, 0xFF, 0xC0, 0x7F, 0xE0, 0x3F, 0xF0, 0x1F, 0xF8, 0x0F, 0xFC, 0x07,
-  0xFE, 0x03, 0xFF, 0x01, 0xFF, 0x80, 0xFF, 0xC0, 0x7F, 0xE0, 0x3F, 0xF0,
-  0x1F, 0xF8, 0x0F, 0xFC, 0x07, 0xFE, 0x03, 0xFF, 0x01, 0xFF, 0x80, 0xFF,
-  0xC0, 0x7F, 0xE0, 0x3F, 0xF0, 0x1F, 0xF8, 0x0F, 0xFC, 0x07, 0xFE, 0x03,
-  0xFF, 0x01, 0xFF, 0x80, 0xFF, 0xC0, 0x7F, 0xE0, 0x3F, 0xF0, 0x1F, 0xF8,
-  0x0F, 0xFC, 0x07, 0xFE, 0x03, 0xFF, 0x01, 0xFF, 0x80, 0xFF, 0xC0, 0x7F,
-  0xE0, 0x3F, 0xF0, 0x1F, 0xF8, 0x0F, 0xFC, 0x07, 0xFE, 0x03, 0xFF, 0x01,
-  0xFF, 0xBF, 0xFF, 0xDF, 0xFF, 0xCF, 0xFF, 0xE7, 0xFF, 0xF3, 0xFF, 0xF1,
-  0xFF, 0xF0, 0xFF, 0xF0, 0x7F, 0xE0, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x03,
-  0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00,
-  0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x0F,
-  0xFC, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00,
-  0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x3F,
-  0xF0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00,
-  0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0xFF,
-  0xC0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0xCF, 0xFC, 0x00, 0x1F,
-  0xFE, 0x3F, 0xF0, 0x00, 0x7F, 0xF0, 0xFF, 0xC0, 0x03, 0xFF, 0x83, 0xFF,
-  0x00, 0x1F, 0xFC, 0x0F, 0xFC, 0x00, 0xFF, 0xE0, 0x3F, 0xF0, 0x07, 0xFF,
-  0x00, 0xFF, 0xC0, 0x3F, 0xF8, 0x03, 0xFF, 0x01, 0xFF, 0xE0, 0x0F, 0xFC,
-  0x0F, 0xFF, 0x00, 0x3F, 0xF0, 0x3F, 0xF8, 0x00, 0xFF, 0xC1, 0xFF, 0xC0,
-  0x03, 0xFF, 0x0F, 0xFE, 0x00, 0x0F, 0xFC, 0x7F, 0xF0, 0x00, 0x3F, 0xF1,
-  0xFF, 0x80, 0x00, 0xFF, 0xCF, 0xFC, 0x00, 0x03, 0xFF, 0x7F, 0xF0, 0x00,
-  0x0F, 0xFD, 0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF,
-  0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xFF, 0xF8, 0x00,
-  0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFC, 0xFF, 0xE0, 0x03, 0xFF, 0xE3,
-  0xFF, 0x80, 0x0F, 0xFF, 0x87, 0xFF, 0x00, 0x3F, 0xFC, 0x1F, 0xFE, 0x00,
-  0xFF, 0xE0, 0x3F, 0xF8, 0x03, 0xFF, 0x00, 0x7F, 0xF0, 0x0F, 0xFC, 0x01,
-  0xFF, 0xC0, 0x3F, 0xF0, 0x03, 0xFF, 0x80, 0xFF, 0xC0, 0x0F, 0xFF, 0x03,
-  0xFF, 0x00, 0x1F, 0xFC, 0x0F, 0xFC, 0x00, 0x7F, 0xF8, 0x3F, 0xF0, 0x00,
-  0xFF, 0xF0, 0xFF, 0xC0, 0x01, 0xFF, 0xC3, 0xFF, 0x00, 0x07, 0xFF, 0x8F,
-  0xFC, 0x00, 0x0F, 0xFE, 0x3F, 0xF0, 0x00, 0x3F, 0xFC, 0xFF, 0xC0, 0x00,
-  0x7F, 0xFB, 0xFF, 0x00, 0x01, 0xFF, 0xF0, 0xFF, 0xC1, 0xFF, 0x83, 0xFF,
-  0x07, 0xFE, 0x0F, 0xFC, 0x1F, 0xF8, 0x3F, 0xF0, 0x7F, 0xE0, 0xFF, 0xC1,
-  0xFF, 0x83, 0xFF, 0x07, 0xFE, 0x0F, 0xFC, 0x1F, 0xF8, 0x3F, 0xF0, 0x7F,
-  0xE0, 0xFF, 0xC1, 0xFF, 0x83, 0xFF, 0x07, 0xFE, 0x0F, 0xFC, 0x1F, 0xF8,
-  0x3F, 0xF0, 0x7F, 0xE0, 0xFF, 0xC1, 0xFF, 0x83, 0xFF, 0x07, 0xFE, 0x0F,
-  0xFC, 0x1F, 0xF8, 0x3F, 0xF0, 0x7F, 0xE0, 0xFF, 0xC1, 0xFF, 0x83, 0xFF,
-  0x07, 0xFE, 0x0F, 0xFC, 0x1F, 0xF8, 0x3F, 0xF0, 0x7F, 0xE0, 0xFF, 0xC1,
-  0xFF, 0x83, 0xFF, 0x07, 0xFE, 0x0F, 0xFC, 0x1F, 0xF8, 0x3F, 0xF0, 0x7F,
-  0xE0, 0xFF, 0xC1, 0xFF, 0x83, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF,
-  0xDF, 0xFF, 0x9F, 0xFF, 0x0F, 0xFE, 0x07, 0xFC, 0x00, 0x00, 0x7F, 0x80,
-  0x00, 0x7F, 0x80, 0x3F, 0xF0, 0x7F, 0xF8, 0x00, 0x7F, 0xFC, 0x0F, 0xFC,
-  0x7F, 0xFF, 0x80, 0x7F, 0xFF, 0x83, 0xFF, 0x3F, 0xFF, 0xF0, 0x3F, 0xFF,
-  0xF0, 0xFF, 0xCF, 0xFF, 0xFE, 0x1F, 0xFF, 0xFE, 0x3F, 0xF7, 0xFF, 0xFF,
-  0xCF, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xF3, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFC, 0x0F, 0xFF, 0xFC, 0x0F,
-  0xFF, 0xBF, 0xFC, 0x01, 0xFF, 0xFC, 0x00, 0xFF, 0xEF, 0xFE, 0x00, 0x3F,
-  0xFE, 0x00, 0x3F, 0xFB, 0xFF, 0x00, 0x07, 0xFF, 0x80, 0x07, 0xFE, 0xFF,
-  0xC0, 0x01, 0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0xF0, 0x00, 0x7F, 0xF0, 0x00,
-  0x7F, 0xFF, 0xFC, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x03,
-  0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0xFF,
-  0xF0, 0x00, 0x3F, 0xF0, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x0F, 0xFC, 0x00,
-  0x0F, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x00,
-  0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xF0, 0x00, 0x3F, 0xFF,
-  0xFC, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0x00,
-  0x03, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xF0, 0x00,
-  0x3F, 0xF0, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xFF,
-  0xFF, 0x00, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xC0,
-  0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xF0, 0x00, 0x3F, 0xFF, 0xFC, 0x00,
-  0x0F, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0x00, 0x03, 0xFF,
-  0xFF, 0xC0, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xF0,
-  0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0x00,
-  0x03, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xC0, 0x00, 0xFF,
-  0xFF, 0xF0, 0x00, 0x3F, 0xF0, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x0F, 0xFC,
-  0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xC0,
-  0x00, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xF0, 0x00, 0x3F,
-  0xF0, 0x00, 0x00, 0x3F, 0xC0, 0x1F, 0xF8, 0x3F, 0xFE, 0x03, 0xFF, 0x0F,
-  0xFF, 0xF0, 0x7F, 0xE3, 0xFF, 0xFF, 0x0F, 0xFC, 0xFF, 0xFF, 0xF1, 0xFF,
-  0xBF, 0xFF, 0xFE, 0x3F, 0xF7, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xFF, 0xFC,
-  0xFF, 0xFE, 0x07, 0xFF, 0xDF, 0xFF, 0x00, 0x7F, 0xFB, 0xFF, 0x80, 0x07,
-  0xFF, 0x7F, 0xF0, 0x00, 0x7F, 0xEF, 0xFC, 0x00, 0x0F, 0xFD, 0xFF, 0x80,
-  0x01, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFF,
-  0xC0, 0x00, 0x7F, 0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x01, 0xFF,
-  0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x07, 0xFF, 0xFF, 0x80, 0x00,
-  0xFF, 0xFF, 0xF0, 0x00, 0x1F, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xC0,
-  0x00, 0x7F, 0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xFF,
-  0xE0, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x07, 0xFF, 0xFF, 0x80, 0x00, 0xFF,
-  0xFF, 0xF0, 0x00, 0x1F, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x00,
-  0x7F, 0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xFF, 0xE0,
-  0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x07, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF,
-  0xF0, 0x00, 0x1F, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0x7F,
-  0xFF, 0xF8, 0x00, 0x0F, 0xFC, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x7F,
-  0xFF, 0x80, 0x00, 0x07, 0xFF, 0xFF, 0x80, 0x00, 0x3F, 0xFF, 0xFF, 0x00,
-  0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x1F, 0xFF, 0xFF, 0xFE, 0x00, 0x7F, 0xFF,
-  0xFF, 0xF8, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x1F, 0xFF, 0x03, 0xFF, 0xE0,
-  0x7F, 0xF0, 0x03, 0xFF, 0x83, 0xFF, 0x80, 0x07, 0xFF, 0x0F, 0xFC, 0x00,
-  0x0F, 0xFC, 0x7F, 0xE0, 0x00, 0x3F, 0xF9, 0xFF, 0x80, 0x00, 0x7F, 0xE7,
-  0xFE, 0x00, 0x01, 0xFF, 0x9F, 0xF8, 0x00, 0x07, 0xFE, 0xFF, 0xE0, 0x00,
-  0x1F, 0xFF, 0xFF, 0x80, 0x00, 0x7F, 0xFF, 0xFE, 0x00, 0x01, 0xFF, 0xFF,
-  0xF8, 0x00, 0x07, 0xFF, 0xFF, 0xE0, 0x00, 0x1F, 0xFF, 0xFF, 0x80, 0x00,
-  0x7F, 0xFF, 0xFE, 0x00, 0x01, 0xFF, 0xFF, 0xF8, 0x00, 0x07, 0xFF, 0xFF,
-  0xE0, 0x00, 0x1F, 0xFF, 0xFF, 0x80, 0x00, 0x7F, 0xFF, 0xFE, 0x00, 0x01,
-  0xFF, 0x9F, 0xF8, 0x00, 0x07, 0xFE, 0x7F, 0xE0, 0x00, 0x1F, 0xF9, 0xFF,
-  0x80, 0x00, 0x7F, 0xE7, 0xFE, 0x00, 0x03, 0xFF, 0x8F, 0xFC, 0x00, 0x0F,
-  0xFC, 0x3F, 0xF8, 0x00, 0x7F, 0xF0, 0x7F, 0xF0, 0x03, 0xFF, 0x81, 0xFF,
-  0xF0, 0x3F, 0xFE, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0xFF,
-  0x80, 0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xE0, 0x00, 0x3F,
-  0xFF, 0xFF, 0x00, 0x00, 0x7F, 0xFF, 0xF8, 0x00, 0x00, 0x7F, 0xFF, 0x80,
-  0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x07, 0xFE,
-  0x0F, 0xFF, 0x80, 0x3F, 0xF0, 0xFF, 0xFF, 0x01, 0xFF, 0x8F, 0xFF, 0xFC,
-  0x0F, 0xFC, 0xFF, 0xFF, 0xF0, 0x7F, 0xEF, 0xFF, 0xFF, 0xC3, 0xFF, 0x7F,
-  0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFE, 0x07, 0xFF, 0xE7,
-  0xFF, 0xC0, 0x0F, 0xFF, 0x3F, 0xF8, 0x00, 0x3F, 0xFD, 0xFF, 0xC0, 0x00,
-  0xFF, 0xEF, 0xFC, 0x00, 0x03, 0xFF, 0x7F, 0xE0, 0x00, 0x1F, 0xFF, 0xFF,
-  0x00, 0x00, 0xFF, 0xFF, 0xF8, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0x1F,
-  0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x07, 0xFF, 0xFF, 0x80,
-  0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x01, 0xFF, 0xFF, 0xE0, 0x00, 0x0F, 0xFF,
-  0xFF, 0x00, 0x00, 0x7F, 0xFF, 0xF8, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x00,
-  0x1F, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x07, 0xFF, 0xFF,
-  0x80, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x01, 0xFF, 0xFF, 0xE0, 0x00, 0x1F,
-  0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xDF, 0xFC, 0x00, 0x0F, 0xFE, 0xFF, 0xE0,
-  0x00, 0xFF, 0xF7, 0xFF, 0xC0, 0x0F, 0xFF, 0x3F, 0xFF, 0x81, 0xFF, 0xF9,
-  0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0xFD, 0xFF, 0xFF, 0xFC, 0x7F, 0xEF, 0xFF,
-  0xFF, 0xC3, 0xFF, 0x3F, 0xFF, 0xFC, 0x1F, 0xF8, 0xFF, 0xFF, 0xC0, 0xFF,
-  0xC3, 0xFF, 0xFC, 0x07, 0xFE, 0x0F, 0xFF, 0xC0, 0x3F, 0xF0, 0x0F, 0xF0,
-  0x01, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xE0,
-  0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00,
-  0xFF, 0xC0, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00,
-  0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x7F,
-  0xE0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00,
-  0x00, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x1F, 0xE0, 0x00, 0x00, 0x07, 0xFF, 0xE0, 0xFF, 0xC0, 0x7F, 0xFF, 0x87,
-  0xFE, 0x07, 0xFF, 0xFE, 0x3F, 0xF0, 0x7F, 0xFF, 0xF9, 0xFF, 0x87, 0xFF,
-  0xFF, 0xEF, 0xFC, 0x7F, 0xFF, 0xFF, 0x7F, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF,
-  0x3F, 0xFF, 0x03, 0xFF, 0xF9, 0xFF, 0xE0, 0x07, 0xFF, 0xDF, 0xFE, 0x00,
-  0x1F, 0xFE, 0xFF, 0xE0, 0x00, 0x7F, 0xF7, 0xFE, 0x00, 0x01, 0xFF, 0xFF,
-  0xF0, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x00, 0x7F, 0xFF, 0xF8, 0x00, 0x03,
-  0xFF, 0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0xF0,
-  0x00, 0x07, 0xFF, 0xFF, 0x80, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x01, 0xFF,
-  0xFF, 0xE0, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x00, 0x7F, 0xFF, 0xF8, 0x00,
-  0x03, 0xFF, 0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFF,
-  0xF0, 0x00, 0x07, 0xFF, 0xFF, 0x80, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x01,
-  0xFF, 0xFF, 0xF0, 0x00, 0x0F, 0xFD, 0xFF, 0x80, 0x00, 0x7F, 0xEF, 0xFE,
-  0x00, 0x07, 0xFF, 0x7F, 0xF8, 0x00, 0x3F, 0xF9, 0xFF, 0xE0, 0x07, 0xFF,
-  0xCF, 0xFF, 0xC0, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF,
-  0xFD, 0xFF, 0x87, 0xFF, 0xFF, 0xEF, 0xFC, 0x1F, 0xFF, 0xFE, 0x7F, 0xE0,
-  0x7F, 0xFF, 0xE3, 0xFF, 0x01, 0xFF, 0xFE, 0x1F, 0xF8, 0x07, 0xFF, 0xE0,
-  0xFF, 0xC0, 0x07, 0xF8, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00,
-  0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x7F,
-  0xE0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00,
-  0x00, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xF0,
-  0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00,
-  0x7F, 0xE0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00,
-  0x00, 0x00, 0xFF, 0xC0, 0xFF, 0xC0, 0x7F, 0xFF, 0x83, 0xFF, 0xFF, 0x0F,
-  0xFF, 0xFE, 0x3F, 0xFF, 0xFC, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xF7, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xE0, 0x07,
-  0xFF, 0x00, 0x0F, 0xFE, 0x00, 0x1F, 0xF8, 0x00, 0x3F, 0xF0, 0x00, 0x7F,
-  0xE0, 0x00, 0xFF, 0xC0, 0x01, 0xFF, 0x80, 0x03, 0xFF, 0x00, 0x07, 0xFE,
-  0x00, 0x0F, 0xFC, 0x00, 0x1F, 0xF8, 0x00, 0x3F, 0xF0, 0x00, 0x7F, 0xE0,
-  0x00, 0xFF, 0xC0, 0x01, 0xFF, 0x80, 0x03, 0xFF, 0x00, 0x07, 0xFE, 0x00,
-  0x0F, 0xFC, 0x00, 0x1F, 0xF8, 0x00, 0x3F, 0xF0, 0x00, 0x7F, 0xE0, 0x00,
-  0xFF, 0xC0, 0x01, 0xFF, 0x80, 0x03, 0xFF, 0x00, 0x07, 0xFE, 0x00, 0x0F,
-  0xFC, 0x00, 0x1F, 0xF8, 0x00, 0x3F, 0xF0, 0x00, 0x7F, 0xE0, 0x00, 0xFF,
-  0xC0, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x1F, 0xFF, 0xF0, 0x00, 0x1F,
-  0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0xFE, 0x03,
-  0xFF, 0xFF, 0xFF, 0xC1, 0xFF, 0xFF, 0xFF, 0xF8, 0x7F, 0xFF, 0xFF, 0xFC,
-  0x3F, 0xFC, 0x07, 0xFE, 0x0F, 0xFC, 0x00, 0x7F, 0x03, 0xFF, 0x00, 0x07,
-  0x80, 0xFF, 0x80, 0x00, 0xC0, 0x3F, 0xE0, 0x00, 0x00, 0x0F, 0xF8, 0x00,
-  0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x3F, 0xFE,
-  0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xFF, 0xFC, 0x00, 0x7F,
-  0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xFF, 0x80,
-  0x3F, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xFF,
-  0x80, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x07,
-  0xFF, 0x00, 0x00, 0x00, 0xFF, 0xC1, 0x00, 0x00, 0x3F, 0xF0, 0x60, 0x00,
-  0x0F, 0xFC, 0x3C, 0x00, 0x03, 0xFF, 0x1F, 0xC0, 0x00, 0xFF, 0xCF, 0xF8,
-  0x00, 0x7F, 0xE7, 0xFF, 0xC0, 0x7F, 0xFB, 0xFF, 0xFF, 0xFF, 0xFC, 0x7F,
-  0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0x81, 0xFF, 0xFF, 0xFF, 0xC0,
-  0x1F, 0xFF, 0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0xF0,
-  0x00, 0x00, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0x00, 0x01, 0xFF, 0x00, 0x01,
-  0xFF, 0x00, 0x01, 0xFF, 0x00, 0x01, 0xFF, 0x00, 0x01, 0xFF, 0x00, 0x01,
-  0xFF, 0x00, 0x01, 0xFF, 0x00, 0x01, 0xFF, 0x00, 0x03, 0xFF, 0x00, 0x07,
-  0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0x00, 0x03,
-  0xFF, 0x00, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0x00, 0x03,
-  0xFF, 0x00, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0x00, 0x03,
-  0xFF, 0x00, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0x00, 0x03,
-  0xFF, 0x00, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0x00, 0x03,
-  0xFF, 0x00, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0x00, 0x03,
-  0xFF, 0x00, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0x01,
-  0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0x00,
-  0x3F, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0xF8, 0x00,
-  0x0F, 0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0xFC,
-  0x00, 0x07, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x1F, 0xFF,
-  0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0xF8, 0x00, 0x0F,
-  0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0xFC, 0x00,
-  0x07, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x1F, 0xFF, 0xFE,
-  0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0xF8, 0x00, 0x0F, 0xFF,
-  0xFF, 0x00, 0x01, 0xFF, 0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x07,
-  0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x1F, 0xFF, 0xFE, 0x00,
-  0x03, 0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0xFF,
-  0x00, 0x01, 0xFF, 0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x07, 0xFE,
-  0xFF, 0xC0, 0x00, 0xFF, 0xDF, 0xF8, 0x00, 0x3F, 0xFB, 0xFF, 0x80, 0x07,
-  0xFF, 0x7F, 0xF8, 0x03, 0xFF, 0xEF, 0xFF, 0x81, 0xFF, 0xFC, 0xFF, 0xFF,
-  0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xBF, 0xF1, 0xFF, 0xFF, 0xF7, 0xFE, 0x3F,
-  0xFF, 0xFC, 0xFF, 0xC3, 0xFF, 0xFF, 0x1F, 0xF8, 0x3F, 0xFF, 0xC3, 0xFF,
-  0x01, 0xFF, 0xF0, 0x7F, 0xE0, 0x0F, 0xF8, 0x00, 0x00, 0xFF, 0xC0, 0x00,
-  0x07, 0xFF, 0xFF, 0x80, 0x00, 0x0F, 0xFD, 0xFF, 0x80, 0x00, 0x1F, 0xF3,
-  0xFF, 0x00, 0x00, 0x7F, 0xE7, 0xFE, 0x00, 0x00, 0xFF, 0xC7, 0xFE, 0x00,
-  0x01, 0xFF, 0x0F, 0xFC, 0x00, 0x03, 0xFE, 0x1F, 0xF8, 0x00, 0x0F, 0xFC,
-  0x1F, 0xF8, 0x00, 0x1F, 0xF0, 0x3F, 0xF0, 0x00, 0x3F, 0xE0, 0x7F, 0xE0,
-  0x00, 0xFF, 0xC0, 0x7F, 0xE0, 0x01, 0xFF, 0x00, 0xFF, 0xC0, 0x03, 0xFE,
-  0x01, 0xFF, 0x80, 0x0F, 0xFC, 0x01, 0xFF, 0x00, 0x1F, 0xF0, 0x03, 0xFF,
-  0x00, 0x3F, 0xE0, 0x07, 0xFE, 0x00, 0xFF, 0xC0, 0x07, 0xFC, 0x01, 0xFF,
-  0x00, 0x0F, 0xFC, 0x03, 0xFE, 0x00, 0x1F, 0xF8, 0x07, 0xFC, 0x00, 0x1F,
-  0xF0, 0x1F, 0xF0, 0x00, 0x3F, 0xF0, 0x3F, 0xE0, 0x00, 0x7F, 0xE0, 0x7F,
-  0xC0, 0x00, 0x7F, 0xC1, 0xFF, 0x00, 0x00, 0xFF, 0x83, 0xFE, 0x00, 0x01,
-  0xFF, 0x87, 0xFC, 0x00, 0x01, 0xFF, 0x0F, 0xF0, 0x00, 0x03, 0xFE, 0x3F,
-  0xE0, 0x00, 0x07, 0xFC, 0x7F, 0xC0, 0x00, 0x07, 0xFC, 0xFF, 0x00, 0x00,
-  0x0F, 0xF9, 0xFE, 0x00, 0x00, 0x1F, 0xF7, 0xFC, 0x00, 0x00, 0x1F, 0xFF,
-  0xF0, 0x00, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x00, 0x7F, 0xFF, 0xC0, 0x00,
-  0x00, 0x7F, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x01, 0xFF,
-  0xFC, 0x00, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0xE0, 0x00,
-  0x00, 0x07, 0xFF, 0xC0, 0x00, 0xFF, 0xC0, 0x00, 0x7F, 0xE0, 0x00, 0x1F,
-  0xFF, 0xFC, 0x00, 0x07, 0xFE, 0x00, 0x01, 0xFF, 0x7F, 0xC0, 0x00, 0x7F,
-  0xE0, 0x00, 0x3F, 0xF7, 0xFC, 0x00, 0x07, 0xFF, 0x00, 0x03, 0xFE, 0x7F,
-  0xE0, 0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xE7, 0xFE, 0x00, 0x0F, 0xFF, 0x00,
-  0x03, 0xFE, 0x3F, 0xE0, 0x00, 0xFF, 0xF8, 0x00, 0x7F, 0xC3, 0xFE, 0x00,
-  0x1F, 0xFF, 0x80, 0x07, 0xFC, 0x3F, 0xF0, 0x01, 0xFF, 0xF8, 0x00, 0x7F,
-  0xC3, 0xFF, 0x00, 0x1F, 0xFF, 0x80, 0x07, 0xFC, 0x1F, 0xF0, 0x01, 0xFF,
-  0xFC, 0x00, 0xFF, 0x81, 0xFF, 0x00, 0x3F, 0xFF, 0xC0, 0x0F, 0xF8, 0x1F,
-  0xF8, 0x03, 0xFF, 0xFC, 0x00, 0xFF, 0x80, 0xFF, 0x80, 0x3F, 0x9F, 0xE0,
-  0x0F, 0xF8, 0x0F, 0xF8, 0x03, 0xF9, 0xFE, 0x01, 0xFF, 0x00, 0xFF, 0x80,
-  0x7F, 0x9F, 0xE0, 0x1F, 0xF0, 0x0F, 0xF8, 0x07, 0xF9, 0xFE, 0x01, 0xFF,
-  0x00, 0x7F, 0xC0, 0x7F, 0x0F, 0xF0, 0x1F, 0xE0, 0x07, 0xFC, 0x0F, 0xF0,
-  0xFF, 0x01, 0xFE, 0x00, 0x7F, 0xC0, 0xFF, 0x0F, 0xF0, 0x3F, 0xE0, 0x07,
-  0xFC, 0x0F, 0xE0, 0xFF, 0x83, 0xFE, 0x00, 0x3F, 0xE0, 0xFE, 0x07, 0xF8,
-  0x3F, 0xC0, 0x03, 0xFE, 0x1F, 0xE0, 0x7F, 0x83, 0xFC, 0x00, 0x3F, 0xE1,
-  0xFE, 0x07, 0xF8, 0x7F, 0xC0, 0x01, 0xFE, 0x1F, 0xC0, 0x3F, 0xC7, 0xFC,
-  0x00, 0x1F, 0xF1, 0xFC, 0x03, 0xFC, 0x7F, 0x80, 0x01, 0xFF, 0x3F, 0xC0,
-  0x3F, 0xC7, 0xF8, 0x00, 0x1F, 0xF3, 0xFC, 0x03, 0xFC, 0xFF, 0x80, 0x00,
-  0xFF, 0x3F, 0x80, 0x1F, 0xEF, 0xF0, 0x00, 0x0F, 0xF7, 0xF8, 0x01, 0xFE,
-  0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x1F, 0xEF, 0xF0, 0x00, 0x0F, 0xFF,
-  0xF0, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x0F, 0xFF, 0xE0,
-  0x00, 0x07, 0xFF, 0xF0, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x7F, 0xFF, 0x00,
-  0x0F, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x7F, 0xFE, 0x00, 0x00,
-  0x3F, 0xFE, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x7F,
-  0xFC, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x01, 0xFF,
-  0xC0, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x03, 0xFF, 0x80,
-  0x00, 0x7F, 0xF0, 0x00, 0x07, 0xFF, 0x3F, 0xF8, 0x00, 0x0F, 0xFE, 0x3F,
-  0xFC, 0x00, 0x0F, 0xFC, 0x1F, 0xFC, 0x00, 0x1F, 0xF8, 0x0F, 0xFE, 0x00,
-  0x3F, 0xF8, 0x0F, 0xFE, 0x00, 0x3F, 0xF0, 0x07, 0xFF, 0x00, 0x7F, 0xE0,
-  0x03, 0xFF, 0x80, 0xFF, 0xE0, 0x03, 0xFF, 0x80, 0xFF, 0xC0, 0x01, 0xFF,
-  0xC1, 0xFF, 0x80, 0x00, 0xFF, 0xC1, 0xFF, 0x80, 0x00, 0xFF, 0xE3, 0xFF,
-  0x00, 0x00, 0x7F, 0xF7, 0xFE, 0x00, 0x00, 0x3F, 0xF7, 0xFE, 0x00, 0x00,
-  0x3F, 0xFF, 0xFC, 0x00, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x00, 0x0F, 0xFF,
-  0xF0, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x07, 0xFF, 0xE0, 0x00,
-  0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x07,
-  0xFF, 0xE0, 0x00, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x00, 0x0F, 0xFF, 0xF0,
-  0x00, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x00,
-  0x3F, 0xFF, 0xFC, 0x00, 0x00, 0x7F, 0xEF, 0xFE, 0x00, 0x00, 0x7F, 0xC7,
-  0xFE, 0x00, 0x00, 0xFF, 0xC7, 0xFF, 0x00, 0x01, 0xFF, 0x83, 0xFF, 0x80,
-  0x01, 0xFF, 0x81, 0xFF, 0x80, 0x03, 0xFF, 0x01, 0xFF, 0xC0, 0x07, 0xFE,
-  0x00, 0xFF, 0xE0, 0x07, 0xFE, 0x00, 0xFF, 0xE0, 0x0F, 0xFC, 0x00, 0x7F,
-  0xF0, 0x1F, 0xFC, 0x00, 0x3F, 0xF8, 0x1F, 0xF8, 0x00, 0x3F, 0xF8, 0x3F,
-  0xF0, 0x00, 0x1F, 0xFC, 0x7F, 0xF0, 0x00, 0x1F, 0xFE, 0xFF, 0xE0, 0x00,
-  0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00, 0x0F, 0xFD,
-  0xFF, 0x00, 0x00, 0x1F, 0xF3, 0xFF, 0x00, 0x00, 0x3F, 0xE7, 0xFE, 0x00,
-  0x00, 0xFF, 0xC7, 0xFC, 0x00, 0x01, 0xFF, 0x0F, 0xFC, 0x00, 0x03, 0xFE,
-  0x1F, 0xF8, 0x00, 0x0F, 0xFC, 0x1F, 0xF0, 0x00, 0x1F, 0xF0, 0x3F, 0xF0,
-  0x00, 0x3F, 0xE0, 0x7F, 0xE0, 0x00, 0xFF, 0xC0, 0x7F, 0xC0, 0x01, 0xFF,
-  0x00, 0xFF, 0xC0, 0x03, 0xFE, 0x01, 0xFF, 0x80, 0x0F, 0xFC, 0x01, 0xFF,
-  0x00, 0x1F, 0xF0, 0x03, 0xFF, 0x00, 0x3F, 0xE0, 0x07, 0xFE, 0x00, 0xFF,
-  0xC0, 0x07, 0xFC, 0x01, 0xFF, 0x00, 0x0F, 0xFC, 0x03, 0xFE, 0x00, 0x1F,
-  0xF8, 0x0F, 0xFC, 0x00, 0x1F, 0xF0, 0x1F, 0xF0, 0x00, 0x3F, 0xF0, 0x3F,
-  0xE0, 0x00, 0x7F, 0xE0, 0x7F, 0xC0, 0x00, 0x7F, 0xC1, 0xFF, 0x00, 0x00,
-  0xFF, 0x83, 0xFE, 0x00, 0x01, 0xFF, 0x87, 0xFC, 0x00, 0x01, 0xFF, 0x1F,
-  0xF0, 0x00, 0x03, 0xFE, 0x3F, 0xE0, 0x00, 0x07, 0xFC, 0x7F, 0xC0, 0x00,
-  0x07, 0xFC, 0xFF, 0x00, 0x00, 0x0F, 0xFB, 0xFE, 0x00, 0x00, 0x1F, 0xF7,
-  0xFC, 0x00, 0x00, 0x1F, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 0xFF, 0xE0, 0x00,
-  0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0x00, 0xFF,
-  0xFE, 0x00, 0x00, 0x01, 0xFF, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0xF0, 0x00,
-  0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x00, 0x07,
-  0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00,
-  0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x01,
-  0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00,
-  0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x00, 0x1F, 0xFF, 0xF0, 0x00, 0x00, 0x3F,
-  0xFF, 0xE0, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0xFE, 0x00,
-  0x00, 0x01, 0xFF, 0xF8, 0x00, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0x07,
-  0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x07,
-  0xFF, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x07,
-  0xFF, 0x80, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x03,
-  0xFF, 0x80, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x03,
-  0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x01,
-  0xFF, 0xC0, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x01,
-  0xFF, 0xE0, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00,
-  0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00,
-  0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x0F, 0xFE, 0x00, 0x7F, 0xFC,
-  0x01, 0xFF, 0xF8, 0x03, 0xFF, 0xF0, 0x0F, 0xFF, 0xE0, 0x1F, 0xFF, 0xC0,
-  0x3F, 0xFF, 0x80, 0x7F, 0xC0, 0x00, 0xFF, 0x80, 0x01, 0xFF, 0x00, 0x03,
-  0xFE, 0x00, 0x07, 0xFC, 0x00, 0x0F, 0xF8, 0x00, 0x1F, 0xF0, 0x00, 0x3F,
-  0xE0, 0x00, 0x7F, 0xC0, 0x00, 0xFF, 0x80, 0x01, 0xFF, 0x00, 0x03, 0xFE,
-  0x00, 0x07, 0xFC, 0x00, 0x0F, 0xF8, 0x00, 0x1F, 0xF0, 0x00, 0x3F, 0xE0,
-  0x00, 0x7F, 0xC0, 0x00, 0xFF, 0x80, 0x01, 0xFF, 0x00, 0x07, 0xFE, 0x00,
-  0x0F, 0xFC, 0x00, 0x3F, 0xF0, 0x01, 0xFF, 0xE0, 0x3F, 0xFF, 0x80, 0x7F,
-  0xFE, 0x00, 0xFF, 0xF8, 0x01, 0xFF, 0xC0, 0x03, 0xFE, 0x00, 0x07, 0xFF,
-  0x00, 0x0F, 0xFF, 0x80, 0x1F, 0xFF, 0x80, 0x3F, 0xFF, 0x80, 0x07, 0xFF,
-  0x00, 0x07, 0xFF, 0x00, 0x03, 0xFE, 0x00, 0x07, 0xFE, 0x00, 0x07, 0xFC,
-  0x00, 0x0F, 0xF8, 0x00, 0x1F, 0xF0, 0x00, 0x3F, 0xE0, 0x00, 0x7F, 0xC0,
-  0x00, 0xFF, 0x80, 0x01, 0xFF, 0x00, 0x03, 0xFE, 0x00, 0x07, 0xFC, 0x00,
-  0x0F, 0xF8, 0x00, 0x1F, 0xF0, 0x00, 0x3F, 0xE0, 0x00, 0x7F, 0xC0, 0x00,
-  0xFF, 0x80, 0x01, 0xFF, 0x00, 0x03, 0xFE, 0x00, 0x07, 0xFC, 0x00, 0x0F,
-  0xF8, 0x00, 0x1F, 0xF0, 0x00, 0x3F, 0xE0, 0x00, 0x7F, 0xFF, 0x00, 0xFF,
-  0xFE, 0x01, 0xFF, 0xFC, 0x01, 0xFF, 0xF8, 0x03, 0xFF, 0xF0, 0x03, 0xFF,
-  0xE0, 0x01, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF,
-  0xE0, 0x01, 0xFF, 0xF0, 0x03, 0xFF, 0xF0, 0x07, 0xFF, 0xE0, 0x0F, 0xFF,
-  0xE0, 0x1F, 0xFF, 0xC0, 0x3F, 0xFF, 0x80, 0x01, 0xFF, 0x00, 0x03, 0xFE,
-  0x00, 0x07, 0xFC, 0x00, 0x0F, 0xF8, 0x00, 0x1F, 0xF0, 0x00, 0x3F, 0xE0,
-  0x00, 0x7F, 0xC0, 0x00, 0xFF, 0x80, 0x01, 0xFF, 0x00, 0x03, 0xFE, 0x00,
-  0x07, 0xFC, 0x00, 0x0F, 0xF8, 0x00, 0x1F, 0xF0, 0x00, 0x3F, 0xE0, 0x00,
-  0x7F, 0xC0, 0x00, 0xFF, 0x80, 0x01, 0xFF, 0x00, 0x03, 0xFE, 0x00, 0x07,
-  0xFC, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xF8, 0x00, 0x1F, 0xFC, 0x00, 0x3F,
-  0xFC, 0x00, 0x3F, 0xFF, 0x80, 0x3F, 0xFF, 0x00, 0x3F, 0xFE, 0x00, 0x1F,
-  0xFC, 0x00, 0x0F, 0xF8, 0x00, 0x7F, 0xF0, 0x03, 0xFF, 0xE0, 0x0F, 0xFF,
-  0xC0, 0x3F, 0xFF, 0x80, 0x7F, 0xF0, 0x01, 0xFF, 0xC0, 0x03, 0xFE, 0x00,
-  0x0F, 0xFC, 0x00, 0x1F, 0xF0, 0x00, 0x3F, 0xE0, 0x00, 0x7F, 0xC0, 0x00,
-  0xFF, 0x80, 0x01, 0xFF, 0x00, 0x03, 0xFE, 0x00, 0x07, 0xFC, 0x00, 0x0F,
-  0xF8, 0x00, 0x1F, 0xF0, 0x00, 0x3F, 0xE0, 0x00, 0x7F, 0xC0, 0x00, 0xFF,
-  0x80, 0x01, 0xFF, 0x00, 0x03, 0xFE, 0x00, 0x07, 0xFC, 0x00, 0x0F, 0xF8,
-  0x00, 0x1F, 0xF0, 0x00, 0x3F, 0xE0, 0x00, 0x7F, 0xC0, 0x00, 0xFF, 0x80,
-  0x7F, 0xFF, 0x00, 0xFF, 0xFE, 0x01, 0xFF, 0xFC, 0x03, 0xFF, 0xF0, 0x07,
-  0xFF, 0xE0, 0x0F, 0xFF, 0x80, 0x1F, 0xFC, 0x00, 0x00, 0x03, 0xFE, 0x00,
-  0x00, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x81,
-  0xFF, 0xFF, 0xE0, 0x03, 0x87, 0xFF, 0xFF, 0xF8, 0x0F, 0x9F, 0xFF, 0xFF,
-  0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xFF, 0xFE,
-  0x3E, 0x03, 0xFF, 0xFF, 0xFE, 0x38, 0x00, 0xFF, 0xFF, 0xF0, 0x40, 0x00,
-  0x7F, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xF0,
-  0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0xFF,
-  0xF8, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x07, 0xFF,
-  0xC0, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x3F, 0xFE,
-  0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xF0,
-  0x00, 0x03, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0x80,
-  0x00, 0x1F, 0xFF, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x7F, 0xFC, 0x00,
-  0x00, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xE0, 0x00,
-  0x07, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0x00, 0x00,
-  0x3F, 0xFE, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x01,
-  0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x0F,
-  0xFF, 0x80, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x7F,
-  0xFC, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x03, 0xFF,
-  0xE0, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x1F, 0xFF,
-  0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0xFF, 0xF8,
-  0x00, 0x01, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xC0,
-  0x00, 0x0F, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFE, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x01,
-  0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x0F,
-  0xFF, 0x80, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x7F,
-  0xFC, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x03, 0xFF,
-  0xE0, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x1F, 0xFF,
-  0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0xFF, 0xF8,
-  0x00, 0x01, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xC0,
-  0x00, 0x0F, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x3F, 0xFE, 0x00,
-  0x00, 0x7F, 0xFC, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xF0, 0x00,
-  0x03, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0x80, 0x00,
-  0x1F, 0xFF, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00,
-  0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x07,
-  0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x3F,
-  0xFE, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x01, 0xFF,
-  0xF0, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x0F, 0xFF,
-  0x80, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00,
-  0x00, 0x7F, 0xFC, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xF0, 0x00,
-  0x03, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0x80, 0x00,
-  0x1F, 0xFF, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00,
-  0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x07,
-  0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x3F,
-  0xFE, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x01, 0xFF,
-  0xF0, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x0F, 0xFF,
-  0x80, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x7F, 0xFC,
-  0x00, 0x00, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xE0,
-  0x00, 0x07, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0x00,
-  0x00, 0x3F, 0xFE, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0xFF, 0xF8, 0x00,
-  0x01, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xC0, 0x00,
-  0x0F, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00,
-  0x7F, 0xFC, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x03,
-  0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x1F,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x7F, 0xFC,
-  0x00, 0x00, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xE0,
-  0x00, 0x07, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0x00,
-  0x00, 0x3F, 0xFE, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0xFF, 0xF8, 0x00,
-  0x01, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xC0, 0x00,
-  0x0F, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00,
-  0x7F, 0xFC, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x03,
-  0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x1F,
-  0xFF, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0xFF,
-  0xF8, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x07, 0xFF,
-  0xC0, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x3F, 0xFE,
-  0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xF0,
-  0x00, 0x03, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0x80,
-  0x00, 0x1F, 0xFF, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x7F, 0xFC, 0x00,
-  0x00, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xE0, 0x00,
-  0x07, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0xFF,
-  0xF8, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x07, 0xFF,
-  0xC0, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x3F, 0xFE,
-  0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xF0,
-  0x00, 0x03, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0x80,
-  0x00, 0x1F, 0xFF, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x7F, 0xFC, 0x00,
-  0x00, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xE0, 0x00,
-  0x07, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0x00, 0x00,
-  0x3F, 0xFE, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x01,
-  0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x0F,
-  0xFF, 0x80, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x7F,
-  0xFC, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x03, 0xFF,
-  0xE0, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x1F, 0xFF,
-  0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0xFF, 0xF8,
-  0x00, 0x01, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xC0,
-  0x00, 0x0F, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFE, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x01,
-  0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x0F,
-  0xFF, 0x80, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x7F,
-  0xFC, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x03, 0xFF,
-  0xE0, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x1F, 0xFF,
-  0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0xFF, 0xF8,
-  0x00, 0x01, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xC0,
-  0x00, 0x0F, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x3F, 0xFE, 0x00,
-  0x00, 0x7F, 0xFC, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xF0, 0x00,
-  0x03, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0x80, 0x00,
-  0x1F, 0xFF, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00,
-  0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x07,
-  0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x3F,
-  0xFE, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x01, 0xFF,
-  0xF0, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x0F, 0xFF,
-  0x80, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00,
-  0x00, 0x7F, 0xFC, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xF0, 0x00,
-  0x03, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0x80, 0x00,
-  0x1F, 0xFF, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00,
-  0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x07,
-  0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x3F,
-  0xFE, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x01, 0xFF,
-  0xF0, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x0F, 0xFF,
-  0x80, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x7F, 0xFC,
-  0x00, 0x00, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xE0,
-  0x00, 0x07, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0x00,
-  0x00, 0x3F, 0xFE, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0xFF, 0xF8, 0x00,
-  0x01, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xC0, 0x00,
-  0x0F, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00,
-  0x7F, 0xFC, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x03,
-  0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x1F,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x7F, 0xFC,
-  0x00, 0x00, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xE0,
-  0x00, 0x07, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0x00,
-  0x00, 0x3F, 0xFE, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0xFF, 0xF8, 0x00,
-  0x01, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xC0, 0x00,
-  0x0F, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00,
-  0x7F, 0xFC, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x03,
-  0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x1F,
-  0xFF, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0xFF,
-  0xF8, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x07, 0xFF,
-  0xC0, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x3F, 0xFE,
-  0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xF0,
-  0x00, 0x03, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0x80,
-  0x00, 0x1F, 0xFF, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x7F, 0xFC, 0x00,
-  0x00, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xE0, 0x00,
-  0x07, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0xFF,
-  0xF8, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x07, 0xFF,
-  0xC0, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x3F, 0xFE,
-  0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xF0,
-  0x00, 0x03, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0x80,
-  0x00, 0x1F, 0xFF, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x7F, 0xFC, 0x00,
-  0x00, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xE0, 0x00,
-  0x07, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0x00, 0x00,
-  0x3F, 0xFE, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x01,
-  0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x0F,
-  0xFF, 0x80, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x7F,
-  0xFC, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x03, 0xFF,
-  0xE0, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x1F, 0xFF,
-  0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0xFF, 0xF8,
-  0x00, 0x01, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xC0,
-  0x00, 0x0F, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFE, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x01,
-  0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x0F,
-  0xFF, 0x80, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x7F,
-  0xFC, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x03, 0xFF,
-  0xE0, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x1F, 0xFF,
-  0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0xFF, 0xF8,
-  0x00, 0x01, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xC0,
-  0x00, 0x0F, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x3F, 0xFE, 0x00,
-  0x00, 0x7F, 0xFC, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xF0, 0x00,
-  0x03, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0x80, 0x00,
-  0x1F, 0xFF, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00,
-  0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x07,
-  0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x3F,
-  0xFE, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x01, 0xFF,
-  0xF0, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x0F, 0xFF,
-  0x80, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00,
-  0x00, 0x7F, 0xFC, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xF0, 0x00,
-  0x03, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0x80, 0x00,
-  0x1F, 0xFF, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00,
-  0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x07,
-  0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x3F,
-  0xFE, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x01, 0xFF,
-  0xF0, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x0F, 0xFF,
-  0x80, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x7F, 0xFC,
-  0x00, 0x00, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xE0,
-  0x00, 0x07, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0x00,
-  0x00, 0x3F, 0xFE, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0xFF, 0xF8, 0x00,
-  0x01, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xC0, 0x00,
-  0x0F, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00,
-  0x7F, 0xFC, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x03,
-  0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x1F,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x7F, 0xFC,
-  0x00, 0x00, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xE0,
-  0x00, 0x07, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0x00,
-  0x00, 0x3F, 0xFE, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0xFF, 0xF8, 0x00,
-  0x01, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xC0, 0x00,
-  0x0F, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00,
-  0x7F, 0xFC, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x03,
-  0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x1F,
-  0xFF, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0xFF,
-  0xF8, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x07, 0xFF,
-  0xC0, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x3F, 0xFE,
-  0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xF0,
-  0x00, 0x03, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0x80,
-  0x00, 0x1F, 0xFF, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x7F, 0xFC, 0x00,
-  0x00, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xE0, 0x00,
-  0x07, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0xFF,
-  0xF8, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x07, 0xFF,
-  0xC0, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x3F, 0xFE,
-  0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xF0,
-  0x00, 0x03, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0x80,
-  0x00, 0x1F, 0xFF, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x7F, 0xFC, 0x00,
-  0x00, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xE0, 0x00,
-  0x07, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0x00, 0x00,
-  0x3F, 0xFE, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x01,
-  0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x0F,
-  0xFF, 0x80, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x7F,
-  0xFC, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x03, 0xFF,
-  0xE0, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x1F, 0xFF,
-  0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0xFF, 0xF8,
-  0x00, 0x01, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xC0,
-  0x00, 0x0F, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFE, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x01,
-  0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x0F,
-  0xFF, 0x80, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x7F,
-  0xFC, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x03, 0xFF,
-  0xE0, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x1F, 0xFF,
-  0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0xFF, 0xF8,
-  0x00, 0x01, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xC0,
-  0x00, 0x0F, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x3F, 0xFE, 0x00,
-  0x00, 0x7F, 0xFC, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xF0, 0x00,
-  0x03, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0x80, 0x00,
-  0x1F, 0xFF, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00,
-  0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x07,
-  0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x3F,
-  0xFE, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x01, 0xFF,
-  0xF0, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x0F, 0xFF,
-  0x80, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00,
-  0x00, 0x7F, 0xFC, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xF0, 0x00,
-  0x03, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0x80, 0x00,
-  0x1F, 0xFF, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00,
-  0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x07,
-  0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x3F,
-  0xFE, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x01, 0xFF,
-  0xF0, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x0F, 0xFF,
-  0x80, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x7F, 0xFC,
-  0x00, 0x00, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xE0,
-  0x00, 0x07, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0x00,
-  0x00, 0x3F, 0xFE, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0xFF, 0xF8, 0x00,
-  0x01, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xC0, 0x00,
-  0x0F, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00,
-  0x7F, 0xFC, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x03,
-  0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x1F,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x7F, 0xFC,
-  0x00, 0x00, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xE0,
-  0x00, 0x07, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0x00,
-  0x00, 0x3F, 0xFE, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0xFF, 0xF8, 0x00,
-  0x01, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xC0, 0x00,
-  0x0F, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00,
-  0x7F, 0xFC, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x03,
-  0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x1F,
-  0xFF, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0xFF,
-  0xF8, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x07, 0xFF,
-  0xC0, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x3F, 0xFE,
-  0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xF0,
-  0x00, 0x03, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0x80,
-  0x00, 0x1F, 0xFF, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x7F, 0xFC, 0x00,
-  0x00, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xE0, 0x00,
-  0x07, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0xFF,
-  0xF8, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x07, 0xFF,
-  0xC0, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x3F, 0xFE,
-  0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xF0,
-  0x00, 0x03, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0x80,
-  0x00, 0x1F, 0xFF, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x7F, 0xFC, 0x00,
-  0x00, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xE0, 0x00,
-  0x07, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0x00, 0x00,
-  0x3F, 0xFE, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x01,
-  0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x0F,
-  0xFF, 0x80, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x7F,
-  0xFC, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x03, 0xFF,
-  0xE0, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x1F, 0xFF,
-  0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0xFF, 0xF8,
-  0x00, 0x01, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xC0,
-  0x00, 0x0F, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFE, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x01,
-  0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x0F,
-  0xFF, 0x80, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x7F,
-  0xFC, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x03, 0xFF,
-  0xE0, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x1F, 0xFF,
-  0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0xFF, 0xF8,
-  0x00, 0x01, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xC0,
-  0x00, 0x0F, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x3F, 0xFE, 0x00,
-  0x00, 0x7F, 0xFC, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xF0, 0x00,
-  0x03, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0x80, 0x00,
-  0x1F, 0xFF, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00,
-  0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x07,
-  0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x3F,
-  0xFE, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x01, 0xFF,
-  0xF0, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x0F, 0xFF,
-  0x80, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00,
-  0x00, 0x7F, 0xFC, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xF0, 0x00,
-  0x03, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0x80, 0x00,
-  0x1F, 0xFF, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00,
-  0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x07,
-  0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x3F,
-  0xFE, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x01, 0xFF,
-  0xF0, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x0F, 0xFF,
-  0x80, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x7F, 0xFC,
-  0x00, 0x00, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xE0,
-  0x00, 0x07, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0x00,
-  0x00, 0x3F, 0xFE, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0xFF, 0xF8, 0x00,
-  0x01, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xC0, 0x00,
-  0x0F, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00,
-  0x7F, 0xFC, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x03,
-  0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x1F,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x7F, 0xFC,
-  0x00, 0x00, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xE0,
-  0x00, 0x07, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0x00,
-  0x00, 0x3F, 0xFE, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0xFF, 0xF8, 0x00,
-  0x01, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xC0, 0x00,
-  0x0F, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00,
-  0x7F, 0xFC, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x03,
-  0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x1F,
-  0xFF, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0xFF,
-  0xF8, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x07, 0xFF,
-  0xC0, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x3F, 0xFE,
-  0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xF0,
-  0x00, 0x03, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0x80,
-  0x00, 0x1F, 0xFF, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x7F, 0xFC, 0x00,
-  0x00, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xE0, 0x00,
-  0x07, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0xFF,
-  0xF8, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x07, 0xFF,
-  0xC0, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x3F, 0xFE,
-  0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xF0,
-  0x00, 0x03, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0x80,
-  0x00, 0x1F, 0xFF, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x7F, 0xFC, 0x00,
-  0x00, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xE0, 0x00,
-  0x07, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0x00, 0x00,
-  0x3F, 0xFE, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x01,
-  0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x0F,
-  0xFF, 0x80, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x7F,
-  0xFC, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x03, 0xFF,
-  0xE0, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x1F, 0xFF,
-  0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0xFF, 0xF8,
-  0x00, 0x01, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xC0,
-  0x00, 0x0F, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFE, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x01,
-  0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x0F,
-  0xFF, 0x80, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x7F,
-  0xFC, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x03, 0xFF,
-  0xE0, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x1F, 0xFF,
-  0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0xFF, 0xF8,
-  0x00, 0x01, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xC0,
-  0x00, 0x0F, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x3F, 0xFE, 0x00,
-  0x00, 0x7F, 0xFC, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xF0, 0x00,
-  0x03, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0x80, 0x00,
-  0x1F, 0xFF, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00,
-  0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x07,
-  0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x3F,
-  0xFE, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x01, 0xFF,
-  0xF0, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x0F, 0xFF,
-  0x80, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00,
-  0x00, 0x7F, 0xFC, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xF0, 0x00,
-  0x03, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0x80, 0x00,
-  0x1F, 0xFF, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00,
-  0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x07,
-  0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x3F,
-  0xFE, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x01, 0xFF,
-  0xF0, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x0F, 0xFF,
-  0x80, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x7F, 0xFC,
-  0x00, 0x00, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xE0,
-  0x00, 0x07, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0x00,
-  0x00, 0x3F, 0xFE, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0xFF, 0xF8, 0x00,
-  0x01, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xC0, 0x00,
-  0x0F, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00,
-  0x7F, 0xFC, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x03,
-  0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x1F,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x7F, 0xFC,
-  0x00, 0x00, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xE0,
-  0x00, 0x07, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0x00,
-  0x00, 0x3F, 0xFE, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0xFF, 0xF8, 0x00,
-  0x01, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xC0, 0x00,
-  0x0F, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00,
-  0x7F, 0xFC, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x03,
-  0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x1F,
-  0xFF, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0xFF,
-  0xF8, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x07, 0xFF,
-  0xC0, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x3F, 0xFE,
-  0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xF0,
-  0x00, 0x03, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0x80,
-  0x00, 0x1F, 0xFF, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x7F, 0xFC, 0x00,
-  0x00, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xE0, 0x00,
-  0x07, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0xFF,
-  0xF8, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x07, 0xFF,
-  0xC0, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x3F, 0xFE,
-  0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xF0,
-  0x00, 0x03, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0x80,
-  0x00, 0x1F, 0xFF, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x7F, 0xFC, 0x00,
-  0x00, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xE0, 0x00,
-  0x07, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0x00, 0x00,
-  0x3F, 0xFE, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x01,
-  0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x0F,
-  0xFF, 0x80, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x7F,
-  0xFC, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x03, 0xFF,
-  0xE0, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x1F, 0xFF,
-  0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0xFF, 0xF8,
-  0x00, 0x01, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xC0,
-  0x00, 0x0F, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFE, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x01,
-  0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x0F,
-  0xFF, 0x80, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x7F,
-  0xFC, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x03, 0xFF,
-  0xE0, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x1F, 0xFF,
-  0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0xFF, 0xF8,
-  0x00, 0x01, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xC0,
-  0x00, 0x0F, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x3F, 0xFE, 0x00,
-  0x00, 0x7F, 0xFC, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xF0, 0x00,
-  0x03, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0x80, 0x00,
-  0x1F, 0xFF, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00,
-  0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x07,
-  0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x3F,
-  0xFE, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x01, 0xFF,
-  0xF0, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x0F, 0xFF,
-  0x80, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00,
-  0x00, 0x7F, 0xFC, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xF0, 0x00,
-  0x03, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0x80, 0x00,
-  0x1F, 0xFF, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00,
-  0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x07,
-  0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x3F,
-  0xFE, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x01, 0xFF,
-  0xF0, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x0F, 0xFF,
-  0x80, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x7F, 0xFC,
-  0x00, 0x00, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xE0,
-  0x00, 0x07, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0x00,
-  0x00, 0x3F, 0xFE, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0xFF, 0xF8, 0x00,
-  0x01, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xC0, 0x00,
-  0x0F, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00,
-  0x7F, 0xFC, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x03,
-  0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x1F,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x7F, 0xFC,
-  0x00, 0x00, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xE0,
-  0x00, 0x07, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0x00,
-  0x00, 0x3F, 0xFE, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0xFF, 0xF8, 0x00,
-  0x01, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xC0, 0x00,
-  0x0F, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00,
-  0x7F, 0xFC, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x03,
-  0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x1F,
-  0xFF, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0xFF,
-  0xF8, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x07, 0xFF,
-  0xC0, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x3F, 0xFE,
-  0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xF0,
-  0x00, 0x03, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0x80,
-  0x00, 0x1F, 0xFF, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x7F, 0xFC, 0x00,
-  0x00, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xE0, 0x00,
-  0x07, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0xFF,
-  0xF8, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x07, 0xFF,
-  0xC0, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x3F, 0xFE,
-  0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xF0,
-  0x00, 0x03, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0x80,
-  0x00, 0x1F, 0xFF, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x7F, 0xFC, 0x00,
-  0x00, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xE0, 0x00,
-  0x07, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0x00, 0x00,
-  0x3F, 0xFE, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x01,
-  0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x0F,
-  0xFF, 0x80, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x7F,
-  0xFC, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x03, 0xFF,
-  0xE0, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x1F, 0xFF,
-  0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0xFF, 0xF8,
-  0x00, 0x01, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xC0,
-  0x00, 0x0F, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFE, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x01,
-  0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x0F,
-  0xFF, 0x80, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x7F,
-  0xFC, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x03, 0xFF,
-  0xE0, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x1F, 0xFF,
-  0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0xFF, 0xF8,
-  0x00, 0x01, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xC0,
-  0x00, 0x0F, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x3F, 0xFE, 0x00,
-  0x00, 0x7F, 0xFC, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xF0, 0x00,
-  0x03, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0x80, 0x00,
-  0x1F, 0xFF, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00,
-  0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x07,
-  0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x3F,
-  0xFE, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x01, 0xFF,
-  0xF0, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x0F, 0xFF,
-  0x80, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00,
-  0x00, 0x7F, 0xFC, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xF0, 0x00,
-  0x03, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0x80, 0x00,
-  0x1F, 0xFF, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00,
-  0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x07,
-  0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x3F,
-  0xFE, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x01, 0xFF,
-  0xF0, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x0F, 0xFF,
-  0x80, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x7F, 0xFC,
-  0x00, 0x00, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xE0,
-  0x00, 0x07, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0x00,
-  0x00, 0x3F, 0xFE, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0xFF, 0xF8, 0x00,
-  0x01, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xC0, 0x00,
-  0x0F, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00,
-  0x7F, 0xFC, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x03,
-  0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x1F,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x7F, 0xFC,
-  0x00, 0x00, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xE0,
-  0x00, 0x07, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0x00,
-  0x00, 0x3F, 0xFE, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0xFF, 0xF8, 0x00,
-  0x01, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xC0, 0x00,
-  0x0F, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00,
-  0x7F, 0xFC, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x03,
-  0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x1F,
-  0xFF, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0xFF,
-  0xF8, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x07, 0xFF,
-  0xC0, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x3F, 0xFE,
-  0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xF0,
-  0x00, 0x03, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0x80,
-  0x00, 0x1F, 0xFF, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x7F, 0xFC, 0x00,
-  0x00, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xE0, 0x00,
-  0x07, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0xFF,
-  0xF8, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x07, 0xFF,
-  0xC0, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x3F, 0xFE,
-  0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xF0,
-  0x00, 0x03, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0x80,
-  0x00, 0x1F, 0xFF, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x7F, 0xFC, 0x00,
-  0x00, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xE0, 0x00,
-  0x07, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0x00, 0x00,
-  0x3F, 0xFE, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x01,
-  0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x0F,
-  0xFF, 0x80, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x7F,
-  0xFC, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x03, 0xFF,
-  0xE0, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x1F, 0xFF,
-  0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0xFF, 0xF8,
-  0x00, 0x01, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xC0,
-  0x00, 0x0F, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x1F,
-  0x87, 0xFE, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xE7, 0xFE, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x0F, 0x00, 0xF0, 0x1F, 0x01, 0xF8, 0x1F, 0x81, 0xF8, 0x1F,
-  0x81, 0xF8, 0x1F, 0x83, 0xF8, 0x3F, 0xC3, 0xFC, 0x3F, 0xC3, 0xFC, 0x3F,
-  0xC3, 0xFC, 0x7F, 0xC7, 0xFE, 0x7F, 0xE7, 0xFE, 0x7F, 0xE7, 0xFE, 0x7F,
-  0xE7, 0xFE, 0x7F, 0xE7, 0xFE, 0x7F, 0xE7, 0xFE, 0x7F, 0xE7, 0xFE, 0x7F,
-  0xE7, 0xFE, 0x7F, 0xE7, 0xFE, 0x7F, 0xE7, 0xFE, 0x7F, 0xE7, 0xFE, 0x00,
-  0x01, 0xFE, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x01, 0xFE, 0x00,
-  0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x1F,
-  0xE0, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00,
-  0x07, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0xFF, 0x00, 0x00, 0x7F, 0xFF, 0xFC,
-  0x00, 0x1F, 0xFF, 0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x7F, 0xFF,
-  0xFF, 0xF8, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFE, 0x1F,
-  0xFE, 0xFC, 0xFF, 0xE1, 0xFF, 0x8F, 0xC7, 0xFF, 0x3F, 0xF0, 0xFC, 0x3F,
-  0xC3, 0xFF, 0x0F, 0xC1, 0xF0, 0x7F, 0xE0, 0xFC, 0x0C, 0x07, 0xFE, 0x0F,
-  0xC1, 0x00, 0x7F, 0xC0, 0xFC, 0x00, 0x07, 0xFC, 0x0F, 0xC0, 0x00, 0x7F,
-  0xC0, 0xFC, 0x00, 0x0F, 0xFC, 0x0F, 0xC0, 0x00, 0xFF, 0xC0, 0xFC, 0x00,
-  0x0F, 0xFC, 0x0F, 0xC0, 0x00, 0xFF, 0xC0, 0xFC, 0x00, 0x0F, 0xFC, 0x0F,
-  0xC0, 0x00, 0xFF, 0xC0, 0xFC, 0x00, 0x0F, 0xFC, 0x0F, 0xC0, 0x00, 0xFF,
-  0xC0, 0xFC, 0x00, 0x07, 0xFC, 0x0F, 0xC0, 0x00, 0x7F, 0xC0, 0xFC, 0x00,
-  0x07, 0xFC, 0x0F, 0xC0, 0x00, 0x7F, 0xE0, 0xFC, 0x04, 0x07, 0xFE, 0x0F,
-  0xC0, 0xE0, 0x3F, 0xF0, 0xFC, 0x0F, 0x83, 0xFF, 0x0F, 0xC1, 0xFE, 0x1F,
-  0xF8, 0xFC, 0x3F, 0xF1, 0xFF, 0xEF, 0xCF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF,
-  0xE0, 0xFF, 0xFF, 0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0xFF, 0x80, 0x3F, 0xFF,
-  0xFF, 0xF8, 0x01, 0xFF, 0xFF, 0xFE, 0x00, 0x07, 0xFF, 0xFF, 0xC0, 0x00,
-  0x1F, 0xFF, 0xF0, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x01, 0xFE, 0x00,
-  0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x1F,
-  0xE0, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00,
-  0x01, 0xFE, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xF0,
-  0x00, 0x00, 0x01, 0xFF, 0xFF, 0x80, 0x00, 0x03, 0xFF, 0xFF, 0xF0, 0x00,
-  0x07, 0xFF, 0xFF, 0xFC, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0x80, 0x07, 0xFF,
-  0xFF, 0xFF, 0xE0, 0x07, 0xFF, 0xFF, 0xFF, 0xF8, 0x07, 0xFF, 0xFF, 0xFF,
-  0xFE, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0xFF, 0xF8, 0x0F, 0xFF, 0xC1,
-  0xFF, 0xF0, 0x01, 0xFF, 0x80, 0xFF, 0xE0, 0x00, 0x7F, 0x80, 0xFF, 0xF0,
-  0x00, 0x0F, 0x80, 0x7F, 0xF0, 0x00, 0x07, 0x00, 0x3F, 0xF8, 0x00, 0x01,
-  0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x07,
-  0xFE, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80,
-  0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00,
-  0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x07,
-  0xFF, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xFF,
-  0xFF, 0xC0, 0x1F, 0xFF, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 0xFF, 0xFF, 0xF0,
-  0x07, 0xFF, 0xFF, 0xFF, 0xF8, 0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x01, 0xFF,
-  0xFF, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xF0,
-  0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00,
-  0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x01,
-  0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0xC0,
-  0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00,
-  0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF,
-  0xC0, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF,
-  0xFF, 0xFE, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF,
-  0x87, 0xFF, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0xE1, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x7F, 0xFF, 0xFF,
-  0xFF, 0xFC, 0x04, 0x00, 0x00, 0x00, 0x00, 0x40, 0x1C, 0x00, 0x00, 0x00,
-  0x01, 0xC0, 0x7C, 0x00, 0x00, 0x00, 0x07, 0xC1, 0xFC, 0x00, 0x00, 0x00,
-  0x1F, 0xC7, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xDF, 0xFC, 0x07, 0xFF, 0x01,
-  0xFF, 0xDF, 0xFC, 0x7F, 0xFF, 0xC7, 0xFF, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFC, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xC0, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFC,
-  0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xFE, 0x03, 0xFF, 0xE0,
-  0x00, 0x7F, 0xF0, 0x01, 0xFF, 0xC0, 0x01, 0xFF, 0xC0, 0x01, 0xFF, 0xC0,
-  0x03, 0xFF, 0x00, 0x01, 0xFF, 0x80, 0x07, 0xFE, 0x00, 0x03, 0xFF, 0x00,
-  0x0F, 0xF8, 0x00, 0x07, 0xFE, 0x00, 0x3F, 0xF0, 0x00, 0x07, 0xFE, 0x00,
-  0x7F, 0xE0, 0x00, 0x0F, 0xFC, 0x00, 0xFF, 0xC0, 0x00, 0x1F, 0xF8, 0x01,
-  0xFF, 0x80, 0x00, 0x3F, 0xF0, 0x03, 0xFF, 0x00, 0x00, 0x7F, 0xE0, 0x07,
-  0xFE, 0x00, 0x00, 0xFF, 0xC0, 0x0F, 0xFC, 0x00, 0x01, 0xFF, 0x80, 0x1F,
-  0xF8, 0x00, 0x03, 0xFF, 0x00, 0x3F, 0xF0, 0x00, 0x07, 0xFE, 0x00, 0x3F,
-  0xF0, 0x00, 0x1F, 0xF8, 0x00, 0x7F, 0xE0, 0x00, 0x3F, 0xF0, 0x00, 0xFF,
-  0xC0, 0x00, 0x7F, 0xE0, 0x01, 0xFF, 0xC0, 0x01, 0xFF, 0xC0, 0x01, 0xFF,
-  0xC0, 0x07, 0xFF, 0x00, 0x03, 0xFF, 0xE0, 0x3F, 0xFE, 0x00, 0x07, 0xFF,
-  0xFF, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x7F, 0xFF,
-  0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x07, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFC, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 0xF1, 0xFF,
-  0xFF, 0x1F, 0xFD, 0xFF, 0xC0, 0x3F, 0xE0, 0x1F, 0xFD, 0xFF, 0x00, 0x00,
-  0x00, 0x1F, 0xF1, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xC1, 0xF0, 0x00, 0x00,
-  0x00, 0x1F, 0x01, 0xC0, 0x00, 0x00, 0x00, 0x1C, 0x01, 0x00, 0x00, 0x00,
-  0x00, 0x10, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x1F, 0xFD, 0xFF, 0xE0, 0x00,
-  0x00, 0xFF, 0xE7, 0xFF, 0x80, 0x00, 0x03, 0xFF, 0x8F, 0xFF, 0x00, 0x00,
-  0x1F, 0xFC, 0x1F, 0xFC, 0x00, 0x00, 0x7F, 0xF0, 0x7F, 0xF8, 0x00, 0x03,
-  0xFF, 0x80, 0xFF, 0xE0, 0x00, 0x0F, 0xFE, 0x03, 0xFF, 0xC0, 0x00, 0x7F,
-  0xF0, 0x07, 0xFF, 0x00, 0x01, 0xFF, 0x80, 0x1F, 0xFE, 0x00, 0x0F, 0xFE,
-  0x00, 0x3F, 0xF8, 0x00, 0x3F, 0xF0, 0x00, 0xFF, 0xF0, 0x01, 0xFF, 0xC0,
-  0x01, 0xFF, 0xC0, 0x07, 0xFE, 0x00, 0x07, 0xFF, 0x80, 0x3F, 0xF8, 0x00,
-  0x0F, 0xFE, 0x01, 0xFF, 0xC0, 0x00, 0x1F, 0xFC, 0x07, 0xFF, 0x00, 0x00,
-  0x7F, 0xF0, 0x3F, 0xF8, 0x00, 0x00, 0xFF, 0xE0, 0xFF, 0xC0, 0x00, 0x03,
-  0xFF, 0x87, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0x1F, 0xF8, 0x00, 0x00, 0x1F,
-  0xFE, 0xFF, 0xE0, 0x00, 0x00, 0x3F, 0xFB, 0xFF, 0x00, 0x00, 0x00, 0xFF,
-  0xFF, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x07, 0xFF,
-  0xFF, 0x80, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x7F, 0xFF, 0xFF,
-  0xFF, 0xF8, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x07, 0xFF, 0xFF, 0xFF,
-  0xFF, 0x80, 0x1F, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x7F, 0xFF, 0xFF, 0xFF,
-  0xF8, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00,
-  0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00,
-  0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00,
-  0x1F, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xF8, 0x01,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x1F,
-  0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00,
-  0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00,
-  0xFF, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F,
-  0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF,
-  0xC0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC,
-  0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0,
-  0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x07, 0xFF,
-  0x00, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0xFF,
-  0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0xFF, 0xF0, 0x1F, 0xFF, 0xFF, 0xFF, 0x03,
-  0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xF8, 0x1F, 0xFC, 0x03, 0xFE,
-  0x07, 0xFE, 0x00, 0x0F, 0x80, 0xFF, 0x80, 0x00, 0x60, 0x1F, 0xF0, 0x00,
-  0x08, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x0F, 0xF8,
-  0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x03,
-  0xFF, 0xE0, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x07, 0xFF, 0xFF, 0x00,
-  0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0xE0, 0x00, 0xFF, 0xFF,
-  0xFF, 0x00, 0x07, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0x80, 0x7F,
-  0xFF, 0xFF, 0xF0, 0x1F, 0x8F, 0xFF, 0xFF, 0x0F, 0xE0, 0x1F, 0xFF, 0xF3,
-  0xF8, 0x00, 0x3F, 0xFE, 0xFF, 0x00, 0x01, 0xFF, 0xDF, 0xC0, 0x00, 0x1F,
-  0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xE0, 0x00,
-  0x03, 0xFF, 0xFE, 0x00, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0xFC,
-  0x00, 0x01, 0xFD, 0xFF, 0xC0, 0x00, 0x7F, 0x3F, 0xFE, 0x00, 0x0F, 0xE3,
-  0xFF, 0xFC, 0x03, 0xF8, 0x7F, 0xFF, 0xF8, 0xFC, 0x07, 0xFF, 0xFF, 0xFE,
-  0x00, 0x7F, 0xFF, 0xFF, 0x80, 0x07, 0xFF, 0xFF, 0xF0, 0x00, 0x7F, 0xFF,
-  0xFF, 0x80, 0x03, 0xFF, 0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x00,
-  0x3F, 0xFF, 0xF0, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0xE0,
-  0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x0F,
-  0xF8, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x10, 0x00,
-  0x07, 0xFC, 0x03, 0x00, 0x01, 0xFF, 0x80, 0xF8, 0x00, 0x7F, 0xE0, 0x3F,
-  0xE0, 0x3F, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF, 0x83, 0xFF, 0xFF, 0xFF, 0xE0,
-  0x7F, 0xFF, 0xFF, 0xF8, 0x07, 0xFF, 0xFF, 0xFE, 0x00, 0x7F, 0xFF, 0xFF,
-  0x80, 0x07, 0xFF, 0xFF, 0xE0, 0x00, 0x1F, 0xFF, 0xF0, 0x00, 0x00, 0x7F,
-  0xE0, 0x00, 0x00, 0x3F, 0x00, 0x1F, 0x8F, 0xF8, 0x0F, 0xFB, 0xFF, 0x01,
-  0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 0xFE, 0x0F, 0xFF, 0xFF, 0xC1, 0xFF, 0xFF,
-  0xF8, 0x3F, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0xC0, 0x7F, 0xEF, 0xF8, 0x0F,
-  0xF8, 0xFC, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00,
-  0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00,
-  0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF,
-  0xFC, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0x00,
-  0x00, 0x7F, 0xE0, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0xFF, 0x80, 0x03, 0xFC,
-  0x00, 0x00, 0x01, 0xFE, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x07, 0xF0, 0x01,
-  0xFC, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x7F,
-  0x01, 0xFC, 0x00, 0x1F, 0xE0, 0x01, 0xF8, 0x0F, 0xC0, 0x07, 0xFF, 0xE0,
-  0x07, 0xE0, 0xFC, 0x00, 0xFF, 0xFF, 0xC0, 0x1F, 0x07, 0xE0, 0x0F, 0xFF,
-  0xFF, 0x00, 0xFC, 0x3E, 0x00, 0xFF, 0xFF, 0xFC, 0x03, 0xE3, 0xF0, 0x0F,
-  0xFF, 0xFF, 0xF0, 0x1F, 0x9F, 0x00, 0xFF, 0xFF, 0xFF, 0x80, 0xFC, 0xF8,
-  0x07, 0xFE, 0x07, 0xFE, 0x03, 0xEF, 0xC0, 0x7F, 0xE0, 0x1F, 0xE0, 0x1F,
-  0xFE, 0x03, 0xFE, 0x00, 0x7C, 0x00, 0xFF, 0xE0, 0x1F, 0xF0, 0x01, 0x80,
-  0x07, 0xFF, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x0F, 0xF8, 0x00,
-  0x00, 0x00, 0xFF, 0xC0, 0x7F, 0xC0, 0x00, 0x00, 0x07, 0xFE, 0x03, 0xFE,
-  0x00, 0x00, 0x00, 0x3F, 0xF0, 0x1F, 0xF0, 0x00, 0x00, 0x01, 0xFF, 0x80,
-  0xFF, 0x80, 0x00, 0x00, 0x0F, 0xFC, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x7F,
-  0xE0, 0x3F, 0xE0, 0x00, 0x00, 0x03, 0xFF, 0x01, 0xFF, 0x00, 0x00, 0x00,
-  0x1F, 0xF8, 0x0F, 0xF8, 0x00, 0x40, 0x00, 0xFF, 0xC0, 0x3F, 0xE0, 0x03,
-  0x80, 0x0F, 0xFF, 0x01, 0xFF, 0x00, 0x3F, 0x00, 0x7F, 0xF8, 0x0F, 0xFC,
-  0x03, 0xFE, 0x03, 0xF7, 0xC0, 0x3F, 0xF0, 0x3F, 0xF8, 0x1F, 0x3E, 0x01,
-  0xFF, 0xFF, 0xFF, 0x81, 0xF9, 0xF8, 0x07, 0xFF, 0xFF, 0xF8, 0x0F, 0xC7,
-  0xC0, 0x1F, 0xFF, 0xFF, 0x80, 0x7C, 0x3F, 0x00, 0x7F, 0xFF, 0xF8, 0x07,
-  0xE1, 0xF8, 0x01, 0xFF, 0xFF, 0x80, 0x3E, 0x07, 0xE0, 0x03, 0xFF, 0xF0,
-  0x03, 0xF0, 0x3F, 0x80, 0x03, 0xFE, 0x00, 0x3F, 0x00, 0xFE, 0x00, 0x00,
-  0x00, 0x03, 0xF8, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x0F, 0xE0,
-  0x00, 0x00, 0x03, 0xF8, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x3F, 0xC0, 0x01,
-  0xFF, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x07, 0xFE, 0x00, 0x00, 0xFF, 0xC0,
-  0x00, 0x1F, 0xFF, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF,
-  0x80, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x01, 0xFF, 0xFF,
-  0xFE, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00,
-  0xFF, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x7F,
-  0xFF, 0xC0, 0x1F, 0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFC,
-  0x3F, 0xC0, 0xFF, 0x81, 0xE0, 0x0F, 0xF0, 0x18, 0x00, 0xFE, 0x01, 0x00,
-  0x1F, 0xE0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x0F, 0xF0,
-  0x03, 0xFF, 0xFE, 0x03, 0xFF, 0xFF, 0xC1, 0xFF, 0xFF, 0xF8, 0x7F, 0xFF,
-  0xFF, 0x1F, 0xF0, 0x1F, 0xE3, 0xF8, 0x03, 0xFC, 0x7F, 0x00, 0x7F, 0x8F,
-  0xE0, 0x0F, 0xF1, 0xFC, 0x01, 0xFE, 0x3F, 0x80, 0x3F, 0xC7, 0xF0, 0x0F,
-  0xF8, 0xFF, 0x03, 0xFF, 0xFF, 0xFF, 0xEF, 0xFD, 0xFF, 0xFD, 0xFF, 0x9F,
-  0xFF, 0x1F, 0xF1, 0xFF, 0xC1, 0xFE, 0x0F, 0xE0, 0x07, 0xC0, 0x00, 0x02,
-  0x00, 0x00, 0x80, 0x00, 0xC0, 0x00, 0x30, 0x00, 0x7C, 0x00, 0x1F, 0x00,
-  0x1F, 0x80, 0x07, 0xE0, 0x07, 0xF0, 0x01, 0xFC, 0x01, 0xFF, 0x00, 0x7F,
-  0xC0, 0x7F, 0xE0, 0x1F, 0xF8, 0x1F, 0xF8, 0x07, 0xFE, 0x0F, 0xFE, 0x03,
-  0xFF, 0x83, 0xFF, 0x80, 0xFF, 0xE0, 0xFF, 0xF0, 0x3F, 0xFC, 0x3F, 0xFC,
-  0x0F, 0xFF, 0x0F, 0xFF, 0x03, 0xFF, 0xC1, 0xFF, 0xC0, 0x7F, 0xF0, 0x3F,
-  0xF0, 0x0F, 0xFC, 0x07, 0xFC, 0x01, 0xFF, 0x00, 0xFF, 0x00, 0x3F, 0xC0,
-  0x1F, 0xE0, 0x07, 0xF8, 0x03, 0xFE, 0x00, 0xFF, 0x80, 0x7F, 0xE0, 0x1F,
-  0xF8, 0x0F, 0xFE, 0x03, 0xFF, 0x81, 0xFF, 0xE0, 0x7F, 0xF8, 0x1F, 0xFE,
-  0x07, 0xFF, 0x81, 0xFF, 0xE0, 0x7F, 0xF8, 0x1F, 0xFC, 0x07, 0xFF, 0x00,
-  0xFF, 0xC0, 0x3F, 0xF0, 0x0F, 0xFC, 0x03, 0xFF, 0x00, 0xFF, 0xC0, 0x3F,
-  0xF0, 0x0F, 0xF8, 0x03, 0xFE, 0x00, 0xFE, 0x00, 0x3F, 0x80, 0x0F, 0xC0,
-  0x03, 0xF0, 0x00, 0x78, 0x00, 0x1E, 0x00, 0x06, 0x00, 0x01, 0x80, 0x00,
-  0x40, 0x00, 0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00,
-  0x7F, 0xC0, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00,
-  0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x3F,
-  0xE0, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00,
-  0x00, 0x7F, 0xC0, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x1F, 0xF0,
-  0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xFC, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFC, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x07, 0xFF,
-  0xFC, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0xFF, 0x01, 0xFE, 0x03, 0xF0, 0x00,
-  0x7C, 0x07, 0xC0, 0x00, 0x7C, 0x1F, 0x00, 0x00, 0x7C, 0x3C, 0x7F, 0xE0,
-  0x78, 0xF0, 0xFF, 0xF0, 0x79, 0xE1, 0xFF, 0xF0, 0xF7, 0x83, 0xFF, 0xE0,
-  0xFF, 0x07, 0x83, 0xC1, 0xFE, 0x0F, 0x07, 0xC3, 0xFC, 0x1E, 0x0F, 0x07,
-  0xF8, 0x3C, 0x1E, 0x0F, 0xF0, 0x7F, 0xFC, 0x1F, 0xE0, 0xFF, 0xF0, 0x3F,
-  0xC1, 0xFF, 0xC0, 0x7F, 0x83, 0xFF, 0x80, 0xFF, 0x07, 0x8F, 0x81, 0xEF,
-  0x0F, 0x0F, 0x07, 0x9E, 0x1E, 0x1F, 0x0F, 0x1E, 0x3C, 0x1F, 0x3C, 0x3E,
-  0x00, 0x00, 0xF8, 0x3E, 0x00, 0x03, 0xE0, 0x7E, 0x00, 0x0F, 0x80, 0x7F,
-  0x80, 0xFF, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x1F,
-  0xFF, 0x00, 0x00, 0x07, 0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0x80, 0x00, 0x1F, 0xC0, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0xFF,
-  0xFF, 0x80, 0x0F, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xF8, 0x0F, 0xFF, 0xFF,
-  0xE0, 0x7F, 0xFF, 0xFF, 0x07, 0xFE, 0x0F, 0xFC, 0x3F, 0xC0, 0x1F, 0xE3,
-  0xFC, 0x00, 0x7F, 0x9F, 0xE0, 0x03, 0xFC, 0xFE, 0x00, 0x0F, 0xE7, 0xF0,
-  0x00, 0x7F, 0x7F, 0x80, 0x03, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xE0, 0x00,
-  0xFF, 0x7F, 0x00, 0x07, 0xF3, 0xF8, 0x00, 0x3F, 0x9F, 0xE0, 0x03, 0xFC,
-  0xFF, 0x00, 0x1F, 0xE3, 0xFC, 0x01, 0xFE, 0x1F, 0xF8, 0x3F, 0xF0, 0x7F,
-  0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xF8, 0x0F, 0xFF, 0xFF, 0x80, 0x3F, 0xFF,
-  0xF8, 0x00, 0xFF, 0xFF, 0x80, 0x01, 0xFF, 0xF0, 0x00, 0x01, 0xFC, 0x00,
-  0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00,
-  0xFF, 0x80, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00,
-  0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x7F,
-  0xC0, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00,
-  0x00, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xE0,
-  0x00, 0x00, 0x01, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0xF8, 0x00, 0x00,
-  0x00, 0x7F, 0xC0, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x1F, 0xF0,
-  0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00,
-  0x3F, 0xE0, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00,
-  0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x1F,
-  0xF0, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8,
-  0x01, 0xFF, 0x00, 0x0F, 0xFF, 0x80, 0x7F, 0xFF, 0xC1, 0xFF, 0xFF, 0x83,
-  0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0xBF, 0xE1, 0xFF, 0x7F, 0x01, 0xFE, 0x1E,
-  0x01, 0xFC, 0x08, 0x03, 0xF8, 0x00, 0x07, 0xF0, 0x00, 0x1F, 0xE0, 0x00,
-  0x7F, 0x80, 0x01, 0xFF, 0x00, 0x07, 0xFC, 0x00, 0x1F, 0xF0, 0x00, 0x7F,
-  0xC0, 0x03, 0xFF, 0x00, 0x0F, 0xFC, 0x00, 0x3F, 0xE0, 0x00, 0xFF, 0x80,
-  0x07, 0xFC, 0x00, 0x1F, 0xE0, 0x00, 0x3F, 0xFF, 0xFF, 0x7F, 0xFF, 0xFE,
-  0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xE0,
-  0x01, 0xFF, 0x00, 0x0F, 0xFF, 0xC0, 0x7F, 0xFF, 0xE1, 0xFF, 0xFF, 0xE7,
-  0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xCF, 0xE0, 0xFF, 0x8F, 0x00, 0xFF, 0x0C,
-  0x01, 0xFE, 0x00, 0x03, 0xFC, 0x00, 0x0F, 0xF0, 0x07, 0xFF, 0xC0, 0x0F,
-  0xFF, 0x00, 0x1F, 0xF0, 0x00, 0x3F, 0xF8, 0x00, 0x7F, 0xFC, 0x00, 0xFF,
-  0xFC, 0x00, 0x07, 0xFC, 0x00, 0x07, 0xF8, 0x00, 0x07, 0xF0, 0x80, 0x0F,
-  0xE3, 0x80, 0x1F, 0xCF, 0x80, 0x7F, 0xFF, 0xC1, 0xFF, 0xFF, 0xFF, 0xFE,
-  0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0x80, 0x7F, 0xFE, 0x00,
-  0x3F, 0xE0, 0x00, 0x03, 0x80, 0x07, 0xC0, 0x1F, 0xE0, 0x3F, 0xF0, 0xFF,
-  0xE1, 0xFF, 0x87, 0xFE, 0x0F, 0xFC, 0x3F, 0xF0, 0x7F, 0xC1, 0xFF, 0x03,
-  0xFE, 0x0F, 0xF8, 0x1F, 0xE0, 0x3F, 0x80, 0x1F, 0x00, 0x0C, 0x00, 0xFF,
-  0xC0, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x0F, 0xFF,
-  0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x3F,
-  0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x00,
-  0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0x00,
-  0x03, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xFC,
-  0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF,
-  0xF0, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x03, 0xFF,
-  0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x0F,
-  0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xF0, 0x00,
-  0x3F, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xC0,
-  0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xFF,
-  0x80, 0x07, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0x03, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFD, 0xFF, 0xE3,
-  0xFF, 0xFF, 0x3F, 0xF0, 0xFF, 0xFF, 0xC7, 0xF0, 0x00, 0x0F, 0xF8, 0x00,
-  0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xE0,
-  0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0xFF,
-  0xC0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x03,
-  0xFF, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00,
-  0x0F, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00,
-  0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0xFF,
-  0xFF, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF,
-  0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF,
-  0xFF, 0x01, 0xFE, 0x07, 0xFF, 0xFF, 0xF0, 0x1F, 0xE0, 0x7F, 0xFF, 0xFF,
-  0x01, 0xFE, 0x0F, 0xFF, 0xFF, 0xF0, 0x1F, 0xE0, 0xFF, 0xFF, 0xFF, 0x01,
-  0xFE, 0x0F, 0xFF, 0xFF, 0xF0, 0x1F, 0xE0, 0xFF, 0xFF, 0xFF, 0x01, 0xFE,
-  0x0F, 0xFF, 0xFF, 0xF0, 0x1F, 0xE0, 0xFF, 0xFF, 0xFF, 0x01, 0xFE, 0x0F,
-  0xFF, 0xFF, 0xF0, 0x1F, 0xE0, 0xFF, 0xFF, 0xFF, 0x01, 0xFE, 0x0F, 0xFF,
-  0xFF, 0xF0, 0x1F, 0xE0, 0xFF, 0xFF, 0xFF, 0x01, 0xFE, 0x0F, 0xFF, 0xFF,
-  0xF0, 0x1F, 0xE0, 0x7F, 0xFF, 0xFF, 0x01, 0xFE, 0x07, 0xFF, 0xFF, 0xF0,
-  0x1F, 0xE0, 0x3F, 0xFF, 0xFF, 0x01, 0xFE, 0x03, 0xFF, 0xFF, 0xF0, 0x1F,
-  0xE0, 0x1F, 0xFF, 0xFF, 0x01, 0xFE, 0x00, 0xFF, 0xFF, 0xF0, 0x1F, 0xE0,
-  0x07, 0xFF, 0xFF, 0x01, 0xFE, 0x00, 0x3F, 0xFF, 0xF0, 0x1F, 0xE0, 0x01,
-  0xFF, 0xFF, 0x01, 0xFE, 0x00, 0x07, 0xFF, 0xF0, 0x1F, 0xE0, 0x00, 0x0F,
-  0xFF, 0x01, 0xFE, 0x00, 0x00, 0x0F, 0xF0, 0x1F, 0xE0, 0x00, 0x00, 0xFF,
-  0x01, 0xFE, 0x00, 0x00, 0x0F, 0xF0, 0x1F, 0xE0, 0x00, 0x00, 0xFF, 0x01,
-  0xFE, 0x00, 0x00, 0x0F, 0xF0, 0x1F, 0xE0, 0x00, 0x00, 0xFF, 0x01, 0xFE,
-  0x00, 0x00, 0x0F, 0xF0, 0x1F, 0xE0, 0x00, 0x00, 0xFF, 0x01, 0xFE, 0x00,
-  0x00, 0x0F, 0xF0, 0x1F, 0xE0, 0x00, 0x00, 0xFF, 0x01, 0xFE, 0x00, 0x00,
-  0x0F, 0xF0, 0x1F, 0xE0, 0x00, 0x00, 0xFF, 0x01, 0xFE, 0x00, 0x00, 0x0F,
-  0xF0, 0x1F, 0xE0, 0x00, 0x00, 0xFF, 0x01, 0xFE, 0x00, 0x00, 0x0F, 0xF0,
-  0x1F, 0xE0, 0x00, 0x00, 0xFF, 0x01, 0xFE, 0x00, 0x00, 0x0F, 0xF0, 0x1F,
-  0xE0, 0x00, 0x00, 0xFF, 0x01, 0xFE, 0x00, 0x00, 0x0F, 0xF0, 0x1F, 0xE0,
-  0x00, 0x00, 0xFF, 0x01, 0xFE, 0x00, 0x00, 0x0F, 0xF0, 0x1F, 0xE0, 0x00,
-  0x00, 0xFF, 0x01, 0xFE, 0x00, 0x00, 0x0F, 0xF0, 0x1F, 0xE0, 0x00, 0x00,
-  0xFF, 0x01, 0xFE, 0x00, 0x00, 0x0F, 0xF0, 0x1F, 0xE0, 0x00, 0x00, 0xFF,
-  0x01, 0xFE, 0x00, 0x00, 0x0F, 0xF0, 0x1F, 0xE0, 0x00, 0x00, 0xFF, 0x01,
-  0xFE, 0x00, 0x00, 0x0F, 0xF0, 0x1F, 0xE0, 0x00, 0x00, 0xFF, 0x01, 0xFE,
-  0x00, 0x00, 0x0F, 0xF0, 0x1F, 0xE0, 0x00, 0x00, 0xFF, 0x01, 0xFE, 0x00,
-  0x00, 0x0F, 0xF0, 0x1F, 0xE0, 0x1F, 0xC1, 0xFF, 0x1F, 0xFC, 0xFF, 0xEF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0x9F, 0xFC, 0x7F,
-  0xC1, 0xFC, 0x00, 0x03, 0xE0, 0x00, 0x7C, 0x00, 0x0F, 0x80, 0x01, 0xF0,
-  0x00, 0x3C, 0x00, 0x0F, 0x80, 0x01, 0xFF, 0xC0, 0x3F, 0xFE, 0x00, 0x7F,
-  0xE0, 0x03, 0xFC, 0x00, 0x3F, 0x8C, 0x07, 0xF3, 0xC1, 0xFE, 0xFF, 0xFF,
-  0xDF, 0xFF, 0xF7, 0xFF, 0xFE, 0x1F, 0xFF, 0x00, 0xFF, 0x80, 0x01, 0xFF,
-  0xC0, 0x03, 0xFF, 0xC0, 0x07, 0xFF, 0xC0, 0x0F, 0xFF, 0xC0, 0x0F, 0xFF,
-  0xC0, 0x1F, 0xFF, 0xC0, 0x3F, 0x9F, 0xC0, 0x7F, 0x9F, 0xC0, 0xFF, 0x1F,
-  0xC0, 0x7E, 0x1F, 0xC0, 0x1C, 0x1F, 0xC0, 0x08, 0x1F, 0xC0, 0x00, 0x1F,
-  0xC0, 0x00, 0x1F, 0xC0, 0x00, 0x1F, 0xC0, 0x00, 0x1F, 0xC0, 0x00, 0x1F,
-  0xC0, 0x00, 0x1F, 0xC0, 0x00, 0x1F, 0xC0, 0x00, 0x1F, 0xC0, 0x00, 0x1F,
-  0xC0, 0x00, 0x1F, 0xC0, 0x1F, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0x1F, 0xFF,
-  0xFF, 0x1F, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0x00, 0x7F,
-  0xC0, 0x00, 0x3F, 0xFE, 0x00, 0x1F, 0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0x01,
-  0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 0xFF, 0x0F, 0xF8, 0x3F, 0xE3, 0xFC, 0x01,
-  0xFE, 0x7F, 0x00, 0x1F, 0xCF, 0xE0, 0x03, 0xFB, 0xFC, 0x00, 0x7F, 0xFF,
-  0x80, 0x0F, 0xFF, 0xF0, 0x00, 0xFF, 0xFE, 0x00, 0x1F, 0xFF, 0xC0, 0x03,
-  0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0x00, 0x0F, 0xFF, 0xE0, 0x03, 0xFF, 0xFC,
-  0x00, 0x7F, 0xBF, 0x80, 0x0F, 0xE7, 0xF0, 0x01, 0xFC, 0xFF, 0x00, 0x7F,
-  0x8F, 0xF8, 0x3F, 0xE1, 0xFF, 0xFF, 0xFC, 0x1F, 0xFF, 0xFF, 0x01, 0xFF,
-  0xFF, 0xC0, 0x1F, 0xFF, 0xF0, 0x00, 0xFF, 0xF8, 0x00, 0x07, 0xFC, 0x00,
-  0x20, 0x00, 0x08, 0x00, 0x06, 0x00, 0x01, 0x80, 0x01, 0xF0, 0x00, 0x7C,
-  0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x0F, 0xF0, 0x03, 0xFC, 0x01, 0xFF, 0x00,
-  0x7F, 0xC0, 0x3F, 0xF0, 0x0F, 0xFC, 0x03, 0xFF, 0x00, 0xFF, 0xC0, 0x3F,
-  0xF8, 0x0F, 0xFE, 0x03, 0xFF, 0x80, 0xFF, 0xE0, 0x7F, 0xF8, 0x1F, 0xFE,
-  0x07, 0xFF, 0x81, 0xFF, 0xE0, 0x7F, 0xF8, 0x1F, 0xFE, 0x07, 0xFF, 0x01,
-  0xFF, 0xC0, 0x7F, 0xE0, 0x1F, 0xF8, 0x07, 0xFC, 0x01, 0xFF, 0x00, 0x7F,
-  0x80, 0x1F, 0xE0, 0x0F, 0xF0, 0x03, 0xFC, 0x03, 0xFE, 0x00, 0xFF, 0x80,
-  0xFF, 0xC0, 0x3F, 0xF0, 0x3F, 0xF8, 0x0F, 0xFE, 0x0F, 0xFF, 0x03, 0xFF,
-  0xC3, 0xFF, 0xC0, 0xFF, 0xF0, 0xFF, 0xF0, 0x3F, 0xFC, 0x1F, 0xFC, 0x07,
-  0xFF, 0x07, 0xFE, 0x01, 0xFF, 0x81, 0xFF, 0x80, 0x7F, 0xE0, 0x7F, 0xE0,
-  0x1F, 0xF8, 0x0F, 0xF8, 0x03, 0xFE, 0x00, 0xFE, 0x00, 0x3F, 0x80, 0x1F,
-  0x80, 0x07, 0xE0, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x30, 0x00, 0x0C, 0x00,
-  0x04, 0x00, 0x01, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x7F,
-  0x80, 0x07, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x1F, 0xFF, 0x00,
-  0x00, 0x00, 0x07, 0xF8, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xE0,
-  0x00, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x03, 0xFF, 0xF8, 0x00,
-  0x00, 0x00, 0xFF, 0x00, 0x0F, 0xE7, 0xF0, 0x00, 0x00, 0x03, 0xFC, 0x00,
-  0x3F, 0xCF, 0xE0, 0x00, 0x00, 0x07, 0xF0, 0x00, 0xFF, 0x1F, 0xC0, 0x00,
-  0x00, 0x1F, 0xC0, 0x00, 0xFC, 0x3F, 0x80, 0x00, 0x00, 0x7F, 0x80, 0x00,
-  0x70, 0x7F, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x40, 0xFE, 0x00, 0x00,
-  0x03, 0xF8, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00,
-  0x03, 0xF8, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00,
-  0xFF, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00,
-  0x1F, 0xC0, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x1F,
-  0xE0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00,
-  0xFE, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x03, 0xF8,
-  0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x07, 0xFF,
-  0xFF, 0xC0, 0x3F, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x80, 0x7F, 0x00,
-  0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xFF,
-  0xFE, 0x07, 0xF8, 0x00, 0x3F, 0xE0, 0x7F, 0xFF, 0xFC, 0x1F, 0xE0, 0x00,
-  0xFF, 0xC0, 0xFF, 0xFF, 0xF8, 0x3F, 0x80, 0x01, 0xFF, 0x80, 0x00, 0x00,
-  0x00, 0xFE, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x1F,
-  0xFE, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00,
-  0x1F, 0xC0, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x03, 0xF7,
-  0xF0, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x0F, 0xEF, 0xE0, 0x00, 0x00, 0x07,
-  0xF8, 0x00, 0x1F, 0x9F, 0xC0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x7E, 0x3F,
-  0x80, 0x00, 0x00, 0x3F, 0x80, 0x01, 0xF8, 0x7F, 0x00, 0x00, 0x00, 0xFF,
-  0x00, 0x03, 0xE0, 0xFE, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x0F, 0xC1, 0xFC,
-  0x00, 0x00, 0x07, 0xF0, 0x00, 0x3F, 0x03, 0xF8, 0x00, 0x00, 0x1F, 0xC0,
-  0x00, 0x7C, 0x07, 0xF0, 0x00, 0x00, 0x7F, 0x80, 0x01, 0xF0, 0x0F, 0xE0,
-  0x00, 0x01, 0xFE, 0x00, 0x07, 0xFF, 0xFF, 0xF8, 0x00, 0x03, 0xF8, 0x00,
-  0x0F, 0xFF, 0xFF, 0xF0, 0x00, 0x0F, 0xE0, 0x00, 0x1F, 0xFF, 0xFF, 0xE0,
-  0x00, 0x3F, 0xC0, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0x00, 0x00,
-  0x7F, 0xFF, 0xFF, 0x80, 0x01, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00,
-  0x07, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x1F, 0xE0, 0x00, 0x00,
-  0x00, 0x0F, 0xE0, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00,
-  0xFE, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x03, 0xF8, 0x00, 0x00, 0x00,
-  0x00, 0x7F, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x01,
-  0xFF, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x03, 0xFF, 0xC0, 0x00, 0x00,
-  0x00, 0xFF, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x0F,
-  0xFF, 0xC0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x00,
-  0x03, 0xF8, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x3F,
-  0x9F, 0xC0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x7F, 0x9F, 0xC0, 0x00, 0x00,
-  0x0F, 0xE0, 0x00, 0xFF, 0x1F, 0xC0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x7E,
-  0x1F, 0xC0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x1C, 0x1F, 0xC0, 0x00, 0x00,
-  0x7F, 0x80, 0x00, 0x08, 0x1F, 0xC0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00,
-  0x1F, 0xC0, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x01,
-  0xFE, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00,
-  0x1F, 0xC0, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x07,
-  0xF0, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00,
-  0x1F, 0xC0, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x1F,
-  0xC0, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00,
-  0x1F, 0xC0, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x00, 0xFF,
-  0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x1F,
-  0xFF, 0xFF, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x03, 0xFC,
-  0x00, 0xFF, 0x80, 0x1F, 0xFF, 0xFF, 0x07, 0xF8, 0x03, 0xFF, 0xE0, 0x1F,
-  0xFF, 0xFF, 0x07, 0xF0, 0x0F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xE0,
-  0x1F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x1F, 0xFF, 0xFC, 0x00,
-  0x00, 0x00, 0x3F, 0xC0, 0x3F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0x80,
-  0x7F, 0xC3, 0xFE, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x7F, 0x01, 0xFE, 0x00,
-  0x00, 0x00, 0xFF, 0x00, 0x0F, 0x00, 0xFE, 0x00, 0x00, 0x01, 0xFE, 0x00,
-  0x02, 0x00, 0xFE, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0xFE, 0x00,
-  0x00, 0x03, 0xF8, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x07, 0xF8, 0x00,
-  0x00, 0x03, 0xFC, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x07, 0xFC, 0x00,
-  0x00, 0x0F, 0xE0, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x1F, 0xC0, 0x00,
-  0x00, 0x1F, 0xF0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x3F, 0xE0, 0x00,
-  0x00, 0x7F, 0x80, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x7F, 0x00, 0x00,
-  0x01, 0xFF, 0x80, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00,
-  0x01, 0xFE, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00,
-  0x1F, 0xF0, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00,
-  0x07, 0xF0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0x00,
-  0x3F, 0xFF, 0xFF, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x00,
-  0x1F, 0xC0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x3F, 0x80, 0x00, 0x00,
-  0x3F, 0xFF, 0xFF, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x01,
-  0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x00,
-  0x03, 0xFC, 0x01, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x1F, 0xE0, 0x0F, 0xFF,
-  0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x00, 0x03,
-  0xF8, 0x01, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x1F, 0xC0, 0x03, 0xF8, 0x3F,
-  0xE0, 0x00, 0x00, 0xFF, 0x00, 0x07, 0x80, 0x7F, 0x80, 0x00, 0x07, 0xF8,
-  0x00, 0x0C, 0x01, 0xFE, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x07, 0xF8,
-  0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x07, 0xF8, 0x00,
-  0x00, 0x3F, 0xFE, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0xFF, 0xF0, 0x00,
-  0x00, 0xFE, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00,
-  0x0F, 0xFE, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x01,
-  0xFE, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00,
-  0x0F, 0xF8, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x01, 0xFE,
-  0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x0F, 0xF0, 0x00, 0x00, 0x08, 0x00,
-  0xFE, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x70, 0x03, 0xF8, 0x01, 0xFC, 0x00,
-  0x00, 0x03, 0xE0, 0x1F, 0xE0, 0x0F, 0xF0, 0x00, 0x00, 0x3F, 0xE0, 0xFF,
-  0x80, 0x7F, 0x80, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0x01, 0xFC, 0x00, 0x00,
-  0x01, 0xFF, 0xFF, 0xF0, 0x0F, 0xE0, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x80,
-  0x7F, 0x80, 0x03, 0xFE, 0x07, 0xFF, 0xFC, 0x03, 0xFC, 0x00, 0x1F, 0xF8,
-  0x07, 0xFF, 0xE0, 0x0F, 0xE0, 0x00, 0x7F, 0xE0, 0x07, 0xFC, 0x00, 0x7F,
-  0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x1F, 0xFE, 0x00,
-  0x00, 0x00, 0x1F, 0xE0, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0x00,
-  0x03, 0xFF, 0xE0, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x1F, 0xBF, 0x80, 0x00,
-  0x00, 0x1F, 0xE0, 0x00, 0xFE, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x03,
-  0xF3, 0xF8, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x1F, 0x8F, 0xE0, 0x00, 0x00,
-  0x1F, 0xC0, 0x00, 0xFC, 0x3F, 0x80, 0x00, 0x00, 0xFF, 0x00, 0x03, 0xE0,
-  0xFE, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x1F, 0x83, 0xF8, 0x00, 0x00, 0x1F,
-  0xC0, 0x00, 0xFC, 0x0F, 0xE0, 0x00, 0x00, 0xFE, 0x00, 0x03, 0xE0, 0x3F,
-  0x80, 0x00, 0x07, 0xF8, 0x00, 0x1F, 0x00, 0xFE, 0x00, 0x00, 0x3F, 0xC0,
-  0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xFC,
-  0x00, 0x07, 0xF0, 0x00, 0x0F, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xC0, 0x00,
-  0x3F, 0xFF, 0xFF, 0xC0, 0x01, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00,
-  0x07, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0x80, 0x00, 0x00,
-  0x00, 0x3F, 0x80, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x0F,
-  0xF0, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00,
-  0x0F, 0xE0, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x0F, 0xF0,
-  0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00,
-  0x7F, 0xE0, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00,
-  0x00, 0x7F, 0xF8, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0xE0,
-  0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x00, 0xFF,
-  0xF0, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00,
-  0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x3F,
-  0xF0, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00,
-  0x1F, 0xF8, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00,
-  0x00, 0xFF, 0xFC, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x3F, 0xFF, 0xF0,
-  0x00, 0x0F, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFE,
-  0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x00, 0xFF,
-  0xE0, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00,
-  0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00,
-  0x00, 0xFF, 0xE0, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x02, 0x03, 0xFF, 0x80,
-  0x00, 0xF0, 0x3F, 0xF0, 0x00, 0x1F, 0xC7, 0xFE, 0x00, 0x03, 0xFE, 0xFF,
-  0xE0, 0x00, 0xFF, 0xDF, 0xFC, 0x00, 0x3F, 0xF9, 0xFF, 0xC0, 0x0F, 0xFE,
-  0x3F, 0xFE, 0x07, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 0xFF,
-  0xFC, 0x07, 0xFF, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x07, 0xFF,
-  0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x01, 0xFF, 0xFE, 0x00, 0x00,
-  0x07, 0xFE, 0x00, 0x00 };
+#include "fontdata.h"
+
+const uint8_t IBMPlexSans_SemiBold40pt8bPackedData[] PROGMEM = {
+  0x00, 0x01, 0xF0, 0x00, 0x17, 0x88, 0x01, 0x36, 0xC0, 0x79, 0xC0, 0x79,
+  0x80, 0xC0, 0x79, 0x83, 0xC0, 0x97, 0x80, 0xC0, 0x97, 0xC0, 0x97, 0x01,
+  0xF0, 0x10, 0x0A, 0xC0, 0x4B, 0xC0, 0x6A, 0xC0, 0x79, 0xC0, 0x79, 0xC0,
+  0x79, 0xC0, 0x79, 0xC0, 0x79, 0xC0, 0x79, 0x02, 0x4C, 0x7C, 0xC0, 0x76,
+  0xA9, 0xC0, 0x87, 0x98, 0xC0, 0x77, 0x98, 0xC0, 0x88, 0x89, 0xC0, 0x87,
+  0x98, 0x80, 0xC0, 0x78, 0x89, 0x80, 0xC0, 0x88, 0x98, 0xC0, 0x87, 0x88,
+  0x81, 0xC0, 0x78, 0x89, 0x8A, 0xC0, 0x98, 0x87, 0x82, 0xC0, 0x89, 0x78,
+  0x80, 0xC0, 0x98, 0x87, 0x80, 0xC0, 0x89, 0x78, 0xC0, 0x88, 0x87, 0xC0,
+  0x99, 0x78, 0xC0, 0x89, 0x78, 0xC0, 0x9A, 0x67, 0x01, 0xF0, 0x04, 0x21,
+  0xC0, 0x97, 0xC0, 0x97, 0xC0, 0x97, 0xC0, 0x97, 0xC0, 0x97, 0xC0, 0x97,
+  0xC0, 0xA6, 0xC0, 0xB4, 0x01, 0xDF, 0xC0, 0x78, 0x80, 0xC0, 0x78, 0xC0,
+  0x78, 0xC0, 0x78, 0xC0, 0x78, 0x02, 0x7A, 0x19, 0x80, 0xC0, 0x77, 0x88,
+  0xC0, 0x77, 0x88, 0xC0, 0x77, 0x88, 0xC0, 0x77, 0x88, 0xC0, 0x77, 0x88,
+  0xC0, 0x77, 0x88, 0xC0, 0x87, 0x88, 0xC0, 0x78, 0x88, 0xC0, 0xA7, 0x88,
+  0xC0, 0x97, 0x88, 0xC0, 0xA7, 0x88, 0xC0, 0x97, 0x88, 0x01, 0xF0, 0x13,
+  0x0A, 0x97, 0x01, 0xF0, 0x04, 0x26, 0x86, 0x01, 0xE9, 0xC0, 0x5C, 0xC0,
+  0x6A, 0xC0, 0x69, 0xC0, 0x79, 0xC0, 0x79, 0xC0, 0x79, 0xC0, 0x79, 0xC0,
+  0x78, 0x02, 0x2C, 0x7D, 0xC0, 0x76, 0xA8, 0xC0, 0x87, 0x99, 0xC0, 0x77,
+  0x88, 0xC0, 0x87, 0x98, 0xC0, 0xA8, 0x88, 0xC0, 0xB7, 0x88, 0xC0, 0xA8,
+  0x88, 0x01, 0xF0, 0x1A, 0x0B, 0x82, 0xC0, 0x87, 0xC0, 0x78, 0x80, 0xC0,
+  0x77, 0xC0, 0x78, 0xC0, 0x77, 0xC0, 0x77, 0xC0, 0x78, 0xC0, 0x77, 0xC0,
+  0x77, 0xC0, 0x77, 0xC0, 0x77, 0xC0, 0x67, 0xC0, 0x77, 0xC0, 0x76, 0xC0,
+  0x77, 0xC0, 0x77, 0xC0, 0x77, 0xC0, 0x66, 0xC0, 0x77, 0xC0, 0x77, 0xC0,
+  0x77, 0xC0, 0x76, 0xC0, 0x77, 0xC0, 0x77, 0x01, 0xF0, 0x01, 0x26, 0x87,
+  0x01, 0xF0, 0x0F, 0x0B, 0xC0, 0x4B, 0xC0, 0x6A, 0xC0, 0x6A, 0xC0, 0x79,
+  0xC0, 0x79, 0xC0, 0x79, 0xC0, 0x79, 0x02, 0x2D, 0x7D, 0xC0, 0x96, 0xA9,
+  0xC0, 0x96, 0x98, 0xC0, 0x97, 0x98, 0xC0, 0x97, 0x88, 0xC0, 0x97, 0x88,
+  0xC0, 0x98, 0x98, 0x01, 0xF0, 0x1C, 0x0A, 0x80, 0xC0, 0x78, 0x80, 0xC0,
+  0x87, 0xC0, 0x78, 0xC0, 0x77, 0xC0, 0x67, 0x01, 0xF0, 0x0D, 0x15, 0xC0,
+  0x87, 0xC0, 0x86, 0xC0, 0x85, 0xC0, 0x8A, 0xC0, 0x8B, 0xC0, 0x89, 0xC0,
+  0x89, 0x01, 0xF0, 0x17, 0x0D, 0xC0, 0xA9, 0xC0, 0xA9, 0x80, 0xC0, 0x99,
+  0x80, 0xC0, 0x98, 0x82, 0x02, 0x61, 0xF0, 0x14, 0x0B, 0xC0, 0x79, 0x88,
+  0xC0, 0x79, 0x88, 0xC0, 0x68, 0x78, 0xC0, 0x7A, 0x77, 0xC0, 0x79, 0x78,
+  0xC0, 0x9A, 0x67, 0x01, 0xF0, 0x02, 0x23, 0xC0, 0x87, 0xC0, 0x97, 0xC0,
+  0xA7, 0xC0, 0x97, 0xC0, 0xA6, 0xC0, 0xA6, 0xC0, 0xC4, 0x01, 0xF0, 0x15,
+  0x0D, 0xC0, 0x78, 0x80, 0xC0, 0x78, 0xC0, 0x78, 0x80, 0xC0, 0x78, 0x80,
+  0xC0, 0x78, 0xC0, 0x78, 0x02, 0xF0, 0x0F, 0x08, 0x19, 0xC0, 0x78, 0x88,
+  0xC0, 0x87, 0x88, 0xC0, 0x78, 0x88, 0xC0, 0x77, 0x88, 0xC0, 0x87, 0x88,
+  0xC0, 0x78, 0x88, 0xC0, 0x77, 0x88, 0x80, 0xC0, 0x77, 0x88, 0xC0, 0x87,
+  0x88, 0xC0, 0x78, 0x88, 0xC0, 0x77, 0x88, 0x80, 0xC0, 0x77, 0x88, 0xC0,
+  0x87, 0x88, 0xC0, 0x78, 0x88, 0xC0, 0x77, 0x88, 0x80, 0xC0, 0x77, 0x88,
+  0xC0, 0x77, 0x88, 0x80, 0xC0, 0x77, 0x88, 0x80, 0xC0, 0x77, 0x88, 0xC0,
+  0x87, 0x88, 0x01, 0xF0, 0x00, 0x29, 0x86, 0x01, 0xF0, 0x18, 0x0A, 0x88,
+  0x01, 0xF0, 0x04, 0x20, 0x87, 0x01, 0x47, 0xC0, 0x78, 0x81, 0xC0, 0x87,
+  0x84, 0x02, 0x37, 0x87, 0xC0, 0x88, 0x5B, 0xC0, 0x88, 0x7A, 0xC0, 0x88,
+  0x79, 0xC0, 0x88, 0x79, 0xC0, 0x88, 0x79, 0xC0, 0x78, 0x89, 0x01, 0xF0,
+  0x02, 0x23, 0x02, 0x2D, 0x7D, 0xC0, 0x86, 0xA9, 0xC0, 0x86, 0x98, 0xC0,
+  0xD7, 0x98, 0x01, 0xF0, 0x1B, 0x0C, 0xC0, 0x98, 0x81, 0xC0, 0x98, 0x81,
+  0xC0, 0x78, 0x80, 0x02, 0x70, 0xF0, 0x14, 0x0B, 0xC0, 0x69, 0x88, 0xC0,
+  0x79, 0x77, 0xC0, 0x79, 0x88, 0xC0, 0x69, 0x78, 0xC0, 0x79, 0x77, 0xC0,
+  0x9B, 0x68, 0x01, 0xF0, 0x02, 0x22, 0xC0, 0x97, 0xC0, 0x97, 0xC0, 0x97,
+  0xC0, 0x97, 0xC0, 0xA6, 0xC0, 0xA6, 0xC0, 0xB4, 0x01, 0xF0, 0x13, 0x0E,
+  0xC0, 0x66, 0xC0, 0x77, 0xC0, 0x77, 0xC0, 0x76, 0xC0, 0x77, 0xC0, 0x77,
+  0xC0, 0x77, 0xC0, 0x77, 0xC0, 0x77, 0xC0, 0x77, 0xC0, 0x87, 0xC0, 0x77,
+  0xC0, 0x77, 0xC0, 0x87, 0xC0, 0x77, 0xC0, 0x78, 0xC0, 0x87, 0xC0, 0x77,
+  0x80, 0x02, 0x39, 0x77, 0xC0, 0x78, 0x5B, 0xC0, 0x87, 0x79, 0xC0, 0x78,
+  0x6A, 0xC0, 0x88, 0x79, 0xC0, 0x87, 0x89, 0xC0, 0x88, 0x79, 0xC0, 0x78,
+  0x88, 0x02, 0x0F, 0x7E, 0xC0, 0x86, 0xA8, 0xC0, 0x87, 0xA9, 0xC0, 0x87,
+  0x88, 0xC0, 0x87, 0x98, 0x80, 0xC0, 0x88, 0x98, 0x84, 0xC0, 0x98, 0x88,
+  0xC0, 0x88, 0x78, 0x80, 0xC0, 0x99, 0x77, 0xC0, 0x89, 0x88, 0xC0, 0x89,
+  0x67, 0xC0, 0x9A, 0x68, 0x01, 0xF0, 0x04, 0x20, 0xC0, 0x87, 0xC0, 0x97,
+  0xC0, 0x97, 0xC0, 0xA7, 0xC0, 0x96, 0xC0, 0xA6, 0xC0, 0xC5, 0x01, 0xF0,
+  0x00, 0x25, 0x86, 0x02, 0x07, 0xF0, 0x13, 0x0A, 0x80, 0xC0, 0x88, 0x78,
+  0xC0, 0x88, 0x87, 0xC0, 0x88, 0x78, 0xC0, 0x88, 0x87, 0x80, 0xC0, 0x88,
+  0x78, 0xC0, 0x88, 0x87, 0xC0, 0x88, 0x78, 0x01, 0xF0, 0x17, 0x0A, 0xC0,
+  0x78, 0x80, 0xC0, 0x87, 0xC0, 0x78, 0xC0, 0x87, 0xC0, 0x78, 0x80, 0xC0,
+  0x87, 0xC0, 0x78, 0xC0, 0x87, 0xC0, 0x78, 0x80, 0xC0, 0x87, 0xC0, 0x78,
+  0xC0, 0x87, 0xC0, 0x78, 0x80, 0xC0, 0x77, 0x80, 0xC0, 0x87, 0xC0, 0x78,
+  0x80, 0xC0, 0x77, 0x80, 0xC0, 0x87, 0xC0, 0x78, 0xC0, 0x87, 0xC0, 0x78,
+  0x80, 0xC0, 0x87, 0xC0, 0x78, 0xC0, 0x87, 0xC0, 0x78, 0x80, 0xC0, 0x77,
+  0x01, 0xEA, 0xC0, 0x4C, 0xC0, 0x6A, 0xC0, 0x79, 0xC0, 0x6A, 0xC0, 0x79,
+  0xC0, 0x78, 0xC0, 0x89, 0x02, 0x2D, 0x7D, 0xC0, 0x86, 0xA8, 0xC0, 0x86,
+  0x98, 0xC0, 0x78, 0x99, 0xC0, 0x87, 0x98, 0x83, 0xC0, 0x98, 0x87, 0x80,
+  0xC0, 0x89, 0x78, 0xC0, 0x98, 0x77, 0xC0, 0x9A, 0x77, 0xC0, 0x8A, 0x67,
+  0x01, 0xF0, 0x06, 0x1B, 0xC0, 0x97, 0xC0, 0xA6, 0xC0, 0x97, 0xC0, 0x6A,
+  0xC0, 0x6A, 0xC0, 0x79, 0xC0, 0x6A, 0x02, 0x2D, 0x7C, 0xC0, 0x85, 0xB9,
+  0xC0, 0x77, 0x99, 0xC0, 0x87, 0x98, 0xC0, 0x78, 0x89, 0x80, 0xC0, 0x87,
+  0x98, 0x83, 0xC0, 0x89, 0x78, 0x81, 0xC0, 0x99, 0x77, 0xC0, 0x89, 0x78,
+  0xC0, 0x8B, 0x58, 0x01, 0xF0, 0x02, 0x23, 0xC0, 0x97, 0xC0, 0x97, 0xC0,
+  0x97, 0xC0, 0x97, 0xC0, 0xA6, 0xC0, 0xA6, 0xC0, 0xC4, 0x01, 0xE9, 0xC0,
+  0x5C, 0xC0, 0x6A, 0xC0, 0x69, 0xC0, 0x7A, 0xC0, 0x79, 0xC0, 0x78, 0xC0,
+  0x79, 0x02, 0x2D, 0x7C, 0xC0, 0x86, 0xA8, 0xC0, 0x76, 0x99, 0xC0, 0x88,
+  0x98, 0xC0, 0x77, 0x99, 0x80, 0xC0, 0x87, 0x88, 0xC0, 0x88, 0x89, 0x84,
+  0xC0, 0x89, 0x88, 0x80, 0xC0, 0x89, 0x78, 0xC0, 0x88, 0x78, 0xC0, 0x9A,
+  0x78, 0xC0, 0x8A, 0x68, 0x02, 0xF0, 0x02, 0x19, 0x1A, 0xC0, 0x88, 0x87,
+  0xC0, 0x97, 0x88, 0xC0, 0x98, 0x78, 0xC0, 0x97, 0x88, 0xC0, 0x97, 0x87,
+  0xC0, 0xA6, 0x78, 0xC0, 0xB6, 0x87, 0x01, 0xF0, 0x19, 0x0B, 0x80, 0xC0,
+  0x77, 0xC0, 0x78, 0xC0, 0x87, 0xC0, 0x77, 0xC0, 0x78, 0xC0, 0x77, 0xC0,
+  0x77, 0xC0, 0x78, 0xC0, 0x77, 0xC0, 0x77, 0xC0, 0x77, 0xC0, 0x77, 0xC0,
+  0x77, 0xC0, 0x77, 0xC0, 0x67, 0xC0, 0x77, 0xC0, 0x77, 0xC0, 0x66, 0x01,
+  0xF0, 0x12, 0x0B, 0xC0, 0x5C, 0xC0, 0x5A, 0xC0, 0x79, 0xC0, 0x6A, 0xC0,
+  0x79, 0xC0, 0x79, 0xC0, 0x78, 0xC0, 0x79, 0x02, 0x5E, 0x7E, 0xC0, 0x75,
+  0xB8, 0xC0, 0x87, 0x99, 0xC0, 0x77, 0x98, 0xC0, 0x87, 0x96, 0xC0, 0x77,
+  0x87, 0xC0, 0x88, 0x96, 0xC0, 0x87, 0x86, 0x01, 0x1A, 0x80, 0xC0, 0x87,
+  0x80, 0xC0, 0x78, 0x8C, 0xC0, 0x98, 0x81, 0x02, 0x1A, 0xF0, 0x17, 0x01,
+  0xC0, 0x88, 0x89, 0xC0, 0x99, 0x7A, 0xC0, 0x88, 0x8A, 0xC0, 0x89, 0x79,
+  0xC0, 0x99, 0x79, 0xC0, 0x89, 0x78, 0xC0, 0x99, 0x77, 0xC0, 0x8B, 0x58,
+  0x01, 0xF0, 0x05, 0x24, 0xC0, 0x97, 0xC0, 0x97, 0xC0, 0x97, 0xC0, 0x97,
+  0xC0, 0x97, 0xC0, 0xA6, 0xC0, 0xA6, 0xC0, 0xC5, 0x01, 0xCA, 0xC0, 0x5B,
+  0xC0, 0x6A, 0xC0, 0x7A, 0xC0, 0x69, 0xC0, 0x79, 0x80, 0xC0, 0x79, 0x02,
+  0x2A, 0x7C, 0xC0, 0xA6, 0xA9, 0xC0, 0x97, 0x98, 0xC0, 0x97, 0x98, 0xC0,
+  0x97, 0x88, 0x01, 0xF0, 0x18, 0x0A, 0x83, 0x01, 0xF0, 0x0B, 0x17, 0xC0,
+  0x58, 0xC0, 0x68, 0xC0, 0x68, 0xC0, 0x78, 0xC0, 0x78, 0x02, 0x2B, 0xA9,
+  0xC0, 0x76, 0x88, 0xC0, 0x87, 0x88, 0xC0, 0x77, 0x88, 0x83, 0xC0, 0x89,
+  0x78, 0xC0, 0x88, 0x78, 0xC0, 0x8A, 0x6C, 0x02, 0xF0, 0x01, 0x18, 0x1B,
+  0xC0, 0x87, 0x88, 0xC0, 0x98, 0x88, 0xC0, 0x87, 0x98, 0xC0, 0x97, 0x88,
+  0xC0, 0x97, 0x98, 0xC0, 0xA7, 0xA8, 0x01, 0x97, 0x01, 0xDA, 0xC0, 0x58,
+  0xC0, 0x78, 0xC0, 0x78, 0xC0, 0x78, 0x80, 0xC0, 0x78, 0x80, 0xC0, 0x80,
+  0x87, 0x01, 0xF0, 0x00, 0x18, 0x86, 0xC0, 0xE0, 0x9F, 0x01, 0x35, 0xC0,
+  0x6A, 0x80, 0xC0, 0x79, 0x83, 0xC0, 0x97, 0x80, 0xC0, 0xA6, 0x00, 0x84,
+  0x01, 0x19, 0xA7, 0x01, 0x09, 0xB0, 0xC0, 0x8D, 0x81, 0xC0, 0x98, 0x80,
+  0xC0, 0x98, 0xC0, 0xA8, 0xC0, 0xA8, 0x01, 0xF0, 0x12, 0x08, 0x02, 0x09,
+  0x5C, 0xC0, 0x88, 0x7A, 0xC0, 0x88, 0x79, 0xC0, 0x88, 0x79, 0xC0, 0x88,
+  0x78, 0xC0, 0x88, 0x89, 0x01, 0xF0, 0x00, 0x21, 0x02, 0x0E, 0x6C, 0xC0,
+  0x86, 0x98, 0xC0, 0x86, 0x98, 0xC0, 0x88, 0x98, 0xC0, 0x87, 0x88, 0xC0,
+  0x88, 0x89, 0x80, 0xC0, 0x88, 0x98, 0x99, 0x01, 0xB6, 0xC0, 0x5B, 0xC0,
+  0x6A, 0xC0, 0x79, 0xC0, 0x79, 0xC0, 0x79, 0x80, 0x02, 0x29, 0x59, 0xC0,
+  0x86, 0xA8, 0xC0, 0x77, 0x99, 0x80, 0xC0, 0x87, 0x98, 0x80, 0xC0, 0x78,
+  0x89, 0x81, 0xC0, 0x98, 0x87, 0x80, 0xC0, 0x89, 0x78, 0x80, 0xC0, 0x99,
+  0x77, 0xC0, 0x8A, 0x68, 0x01, 0xF0, 0x03, 0x17, 0x80, 0xC0, 0x97, 0xC0,
+  0x97, 0xC0, 0x97, 0xC0, 0xA6, 0xC0, 0xB5, 0x01, 0xF0, 0x00, 0x1F, 0x85,
+  0x02, 0x05, 0xF0, 0x12, 0x07, 0xAD, 0x01, 0xF0, 0x00, 0x1F, 0x85 };
 
 const GFXglyph IBMPlexSans_SemiBold40pt8bGlyphs[] PROGMEM = {
   {     0,   1,   1,  18,    0,    0 },   // 0x20 ' '
-  {     1,  12,  55,  24,    6,  -53 },   // 0x21 '!'
-  {    84,  25,  24,  37,    6,  -57 },   // 0x22 '"'
-  {   159,  47,  54,  51,    2,  -53 },   // 0x23 '#'
-  {   477,  40,  67,  47,    3,  -60 },   // 0x24 '$'
-  {   812,  67,  56,  75,    4,  -54 },   // 0x25 '%'
-  {  1281,  50,  56,  56,    5,  -54 },   // 0x26 '&'
-  {  1631,   9,  24,  20,    6,  -57 },   // 0x27 '''
-  {  1658,  23,  70,  26,    4,  -58 },   // 0x28 '('
-  {  1860,  23,  70,  26,   -1,  -58 },   // 0x29 ')'
-  {  2062,  39,  36,  43,    2,  -57 },   // 0x2A '*'
-  {  2238,  37,  38,  47,    5,  -42 },   // 0x2B '+'
-  {  2414,  15,  23,  23,    3,  -11 },   // 0x2C ','
-  {  2458,  23,  10,  31,    4,  -28 },   // 0x2D '-'
-  {  2487,  13,  13,  23,    5,  -11 },   // 0x2E '.'
-  {  2509,  31,  70,  34,    0,  -57 },   // 0x2F '/'
-  {  2781,  41,  56,  47,    3,  -54 },   // 0x30 '0'
-  {  3068,  42,  54,  47,    3,  -53 },   // 0x31 '1'
-  {  3352,  39,  55,  47,    4,  -54 },   // 0x32 '2'
-  {  3621,  39,  56,  47,    2,  -54 },   // 0x33 '3'
-  {  3894,  41,  54,  47,    3,  -53 },   // 0x34 '4'
-  {  4171,  39,  55,  47,    4,  -53 },   // 0x35 '5'
-  {  4440,  39,  55,  47,    4,  -53 },   // 0x36 '6'
-  {  4709,  37,  54,  47,    5,  -53 },   // 0x37 '7'
-  {  4959,  39,  56,  47,    4,  -54 },   // 0x38 '8'
-  {  5232,  39,  55,  47,    4,  -54 },   // 0x39 '9'
-  {  5501,  13,  43,  25,    6,  -41 },   // 0x3A ':'
-  {  5571,  15,  53,  25,    4,  -41 },   // 0x3B ';'
-  {  5671,  31,  46,  47,    8,  -45 },   // 0x3C '<'
-  {  5850,  37,  25,  47,    5,  -35 },   // 0x3D '='
-  {  5966,  31,  46,  47,    8,  -45 },   // 0x3E '>'
-  {  6145,  35,  56,  38,    1,  -54 },   // 0x3F '?'
-  {  6390,  60,  64,  70,    5,  -54 },   // 0x40 '@'
-  {  6870,  50,  54,  52,    1,  -53 },   // 0x41 'A'
-  {  7208,  41,  54,  52,    7,  -53 },   // 0x42 'B'
-  {  7485,  44,  56,  50,    4,  -54 },   // 0x43 'C'
-  {  7793,  43,  54,  54,    7,  -53 },   // 0x44 'D'
-  {  8084,  36,  54,  47,    6,  -53 },   // 0x45 'E'
-  {  8327,  35,  54,  45,    6,  -53 },   // 0x46 'F'
-  {  8564,  46,  56,  56,    4,  -54 },   // 0x47 'G'
-  {  8886,  44,  54,  56,    6,  -53 },   // 0x48 'H'
-  {  9183,  25,  54,  33,    4,  -53 },   // 0x49 'I'
-  {  9352,  35,  55,  43,    2,  -53 },   // 0x4A 'J'
-  {  9593,  46,  54,  53,    6,  -53 },   // 0x4B 'K'
-  {  9904,  31,  54,  41,    7,  -53 },   // 0x4C 'L'
-  { 10114,  50,  54,  64,    7,  -53 },   // 0x4D 'M'
-  { 10452,  44,  54,  56,    6,  -53 },   // 0x4E 'N'
-  { 10749,  48,  56,  56,    4,  -54 },   // 0x4F 'O'
-  { 11085,  41,  54,  50,    6,  -53 },   // 0x50 'P'
-  { 11362,  48,  69,  56,    4,  -54 },   // 0x51 'Q'
-  { 11776,  42,  54,  52,    6,  -53 },   // 0x52 'R'
-  { 12060,  41,  56,  48,    3,  -54 },   // 0x53 'S'
-  { 12347,  41,  54,  45,    2,  -53 },   // 0x54 'T'
-  { 12624,  42,  55,  54,    6,  -53 },   // 0x55 'U'
-  { 12913,  48,  54,  50,    1,  -53 },   // 0x56 'V'
-  { 13237,  70,  54,  74,    2,  -53 },   // 0x57 'W'
-  { 13710,  49,  54,  51,    1,  -53 },   // 0x58 'X'
-  { 14041,  47,  54,  49,    1,  -53 },   // 0x59 'Y'
-  { 14359,  41,  54,  47,    3,  -53 },   // 0x5A 'Z'
-  { 14636,  15,  70,  26,    7,  -58 },   // 0x5B '['
-  { 14768,  31,  70,  34,    3,  -57 },   // 0x5C '\'
-  { 15040,  15,  70,  26,    4,  -58 },   // 0x5D ']'
-  { 15172,  39,  32,  47,    4,  -53 },   // 0x5E '^'
-  { 15328,  39,   8,  44,    2,    7 },   // 0x5F '_'
-  { 15367,  15,  17,  47,   13,  -61 },   // 0x60 '`'
-  { 15399,  38,  43,  44,    3,  -41 },   // 0x61 'a'
-  { 15604,  37,  59,  47,    6,  -57 },   // 0x62 'b'
-  { 15877,  35,  43,  40,    3,  -41 },   // 0x63 'c'
-  { 16066,  37,  59,  47,    4,  -57 },   // 0x64 'd'
-  { 16339,  38,  43,  44,    3,  -41 },   // 0x65 'e'
-  { 16544,  24,  58,  27,    2,  -57 },   // 0x66 'f'
-  { 16718,  41,  65,  43,    2,  -47 },   // 0x67 'g'
-  { 17052,  35,  58,  46,    6,  -57 },   // 0x68 'h'
-  { 17306,  12,  58,  22,    5,  -57 },   // 0x69 'i'
-  { 17393,  17,  74,  22,    0,  -57 },   // 0x6A 'j'
-  { 17551,  38,  58,  44,    6,  -57 },   // 0x6B 'k'
-  { 17827,  15,  58,  23,    6,  -57 },   // 0x6C 'l'
-  { 17936,  58,  42,  69,    6,  -41 },   // 0x6D 'm'
-  { 18241,  35,  42,  46,    6,  -41 },   // 0x6E 'n'
-  { 18425,  38,  43,  44,    3,  -41 },   // 0x6F 'o'
-  { 18630,  37,  58,  47,    6,  -41 },   // 0x70 'p'
-  { 18899,  37,  58,  47,    4,  -41 },   // 0x71 'q'
-  { 19168,  23,  41,  31,    6,  -40 },   // 0x72 'r'
-  { 19286,  34,  43,  39,    2,  -41 },   // 0x73 's'
-  { 19469,  24,  52,  29,    2,  -51 },   // 0x74 't'
-  { 19625,  35,  42,  46,    5,  -40 },   // 0x75 'u'
-  { 19809,  39,  41,  41,    1,  -40 },   // 0x76 'v'
-  { 20009,  60,  41,  64,    2,  -40 },   // 0x77 'w'
-  { 20317,  40,  41,  42,    1,  -40 },   // 0x78 'x'
-  { 20522,  39,  57,  41,    1,  -40 },   // 0x79 'y'
-  { 20800,  33,  41,  39,    3,  -40 },   // 0x7A 'z'
-  { 20970,  23,  70,  28,    1,  -58 },   // 0x7B '{'
-  { 21172,   9,  70,  29,   10,  -58 },   // 0x7C '|'
-  { 21251,  23,  70,  28,    4,  -58 },   // 0x7D '}'
-  { 21453,  39,  13,  47,    4,  -29 },   // 0x7E '~'
-  { 21517,  31,  61,  37,    3,  -60 },   // 0x7F
-  { 21754,  31,  61,  37,    3,  -60 },   // 0x80
-  { 21991,  31,  61,  37,    3,  -60 },   // 0x81
-  { 22228,  31,  61,  37,    3,  -60 },   // 0x82
-  { 22465,  31,  61,  37,    3,  -60 },   // 0x83
-  { 22702,  31,  61,  37,    3,  -60 },   // 0x84
-  { 22939,  31,  61,  37,    3,  -60 },   // 0x85
-  { 23176,  31,  61,  37,    3,  -60 },   // 0x86
-  { 23413,  31,  61,  37,    3,  -60 },   // 0x87
-  { 23650,  31,  61,  37,    3,  -60 },   // 0x88
-  { 23887,  31,  61,  37,    3,  -60 },   // 0x89
-  { 24124,  31,  61,  37,    3,  -60 },   // 0x8A
-  { 24361,  31,  61,  37,    3,  -60 },   // 0x8B
-  { 24598,  31,  61,  37,    3,  -60 },   // 0x8C
-  { 24835,  31,  61,  37,    3,  -60 },   // 0x8D
-  { 25072,  31,  61,  37,    3,  -60 },   // 0x8E
-  { 25309,  31,  61,  37,    3,  -60 },   // 0x8F
-  { 25546,  31,  61,  37,    3,  -60 },   // 0x90
-  { 25783,  31,  61,  37,    3,  -60 },   // 0x91
-  { 26020,  31,  61,  37,    3,  -60 },   // 0x92
-  { 26257,  31,  61,  37,    3,  -60 },   // 0x93
-  { 26494,  31,  61,  37,    3,  -60 },   // 0x94
-  { 26731,  31,  61,  37,    3,  -60 },   // 0x95
-  { 26968,  31,  61,  37,    3,  -60 },   // 0x96
-  { 27205,  31,  61,  37,    3,  -60 },   // 0x97
-  { 27442,  31,  61,  37,    3,  -60 },   // 0x98
-  { 27679,  31,  61,  37,    3,  -60 },   // 0x99
-  { 27916,  31,  61,  37,    3,  -60 },   // 0x9A
-  { 28153,  31,  61,  37,    3,  -60 },   // 0x9B
-  { 28390,  31,  61,  37,    3,  -60 },   // 0x9C
-  { 28627,  31,  61,  37,    3,  -60 },   // 0x9D
-  { 28864,  31,  61,  37,    3,  -60 },   // 0x9E
-  { 29101,  31,  61,  37,    3,  -60 },   // 0x9F
-  { 29338,   1,   1,  18,    0,    0 },   // 0xA0
-  { 29339,  12,  56,  24,    6,  -41 },   // 0xA1
-  { 29423,  36,  58,  42,    3,  -48 },   // 0xA2
-  { 29684,  41,  55,  46,    3,  -54 },   // 0xA3
-  { 29966,  47,  47,  49,    1,  -50 },   // 0xA4
-  { 30243,  46,  54,  48,    0,  -53 },   // 0xA5
-  { 30554,   9,  70,  29,   10,  -58 },   // 0xA6
-  { 30633,  35,  67,  45,    5,  -54 },   // 0xA7
-  { 30927,  27,  11,  47,   10,  -57 },   // 0xA8
-  { 30965,  53,  56,  61,    4,  -54 },   // 0xA9
-  { 31336,  27,  30,  34,    4,  -54 },   // 0xAA
-  { 31438,  35,  34,  43,    3,  -37 },   // 0xAB
-  { 31587,  37,  22,  47,    5,  -27 },   // 0xAC
-  { 31689,  23,  10,  31,    4,  -28 },   // 0xAD
-  { 31718,  31,  32,  37,    3,  -54 },   // 0xAE
-  { 31842,  23,   7,  47,   12,  -55 },   // 0xAF
-  { 31863,  29,  29,  37,    4,  -54 },   // 0xB0
-  { 31969,  37,  49,  47,    5,  -48 },   // 0xB1
-  { 32196,  23,  29,  27,    2,  -54 },   // 0xB2
-  { 32280,  23,  30,  27,    1,  -54 },   // 0xB3
-  { 32367,  15,  17,  47,   19,  -61 },   // 0xB4
-  { 32399,  34,  57,  46,    6,  -40 },   // 0xB5
-  { 32642,  44,  66,  52,    3,  -53 },   // 0xB6
-  { 33005,  13,  13,  27,    7,  -29 },   // 0xB7
-  { 33027,  19,  18,  47,   15,   -1 },   // 0xB8
-  { 33070,  24,  28,  27,    1,  -53 },   // 0xB9
-  { 33154,  27,  29,  33,    3,  -54 },   // 0xBA
-  { 33252,  35,  34,  43,    4,  -37 },   // 0xBB
-  { 33401,  63,  54,  66,    1,  -53 },   // 0xBC
-  { 33827,  64,  54,  67,    1,  -53 },   // 0xBD
-  { 34259,  62,  55,  65,    1,  -54 },   // 0xBE
-  { 34686,  35,  57,  38,    2,  -41 } }; // 0xBF
+  {     1,  23,  10,  31,    4,  -28 },   // 0x2D '-'
+  {     6,  13,  13,  23,    5,  -11 },   // 0x2E '.'
+  {    23,  41,  56,  47,    3,  -54 },   // 0x30 '0'
+  {   124,  42,  54,  47,    3,  -53 },   // 0x31 '1'
+  {   187,  39,  55,  47,    4,  -54 },   // 0x32 '2'
+  {   288,  39,  56,  47,    2,  -54 },   // 0x33 '3'
+  {   417,  41,  54,  47,    3,  -53 },   // 0x34 '4'
+  {   516,  39,  55,  47,    4,  -53 },   // 0x35 '5'
+  {   620,  39,  55,  47,    4,  -53 },   // 0x36 '6'
+  {   742,  37,  54,  47,    5,  -53 },   // 0x37 '7'
+  {   840,  39,  56,  47,    4,  -54 },   // 0x38 '8'
+  {   957,  39,  55,  47,    4,  -54 },   // 0x39 '9'
+  {  1079,  44,  56,  50,    4,  -54 },   // 0x43 'C'
+  {  1184,  38,  43,  44,    3,  -41 },   // 0x61 'a'
+  {  1280,  24,  58,  27,    2,  -57 },   // 0x66 'f'
+  {  1305,  12,  58,  22,    5,  -57 },   // 0x69 'i'
+  {  1323,  15,  58,  23,    6,  -57 },   // 0x6C 'l'
+  {  1338,  35,  42,  46,    6,  -41 },   // 0x6E 'n'
+  {  1387,  29,  29,  37,    4,  -54 },   // 0xB0
+  {  1447,  31,  61,  37,    3,  -60 } }; // missing glyph
 
 const GFXfont IBMPlexSans_SemiBold40pt8b PROGMEM = {
-  (uint8_t  *)IBMPlexSans_SemiBold40pt8bBitmaps,
+  (uint8_t  *)IBMPlexSans_SemiBold40pt8bPackedData,
   (GFXglyph *)IBMPlexSans_SemiBold40pt8bGlyphs,
-  0x20, 0xBF, 102 };
+  0, 20, 102 };
+
+const GFXpacked IBMPlexSans_SemiBold40pt8bPacked PROGMEM = {
+  IBMPlexSans_SemiBold40pt8bPackedData,
+  2 };
+
+const GFXrange IBMPlexSans_SemiBold40pt8bRanges[] PROGMEM = {
+  { 0x0020,   1,   0 },
+  { 0x002D,   2,   1 },
+  { 0x0030,  10,   3 },
+  { 0x0043,   1,  13 },
+  { 0x0061,   1,  14 },
+  { 0x0066,   1,  15 },
+  { 0x0069,   1,  16 },
+  { 0x006C,   1,  17 },
+  { 0x006E,   1,  18 },
+  { 0x00B0,   1,  19 } };
+
+const GFXsubset IBMPlexSans_SemiBold40pt8bSubset PROGMEM = {
+  IBMPlexSans_SemiBold40pt8bRanges,
+  10, 20, 61 };
+
+const GFXkernPair IBMPlexSans_SemiBold40pt8bKernPairs[] PROGMEM = {
+  {   1,  13,   1 },   // 0x2D '-', 0x43 'C'
+  {   2,  13,  -3 },   // 0x2E '.', 0x43 'C'
+  {   2,  15,  -1 },   // 0x2E '.', 0x66 'f'
+  {  13,   1,  -1 },   // 0x43 'C', 0x2D '-'
+  {  13,  13,  -1 },   // 0x43 'C', 0x43 'C'
+  {  14,   2,   1 },   // 0x61 'a', 0x2E '.'
+  {  15,   2,  -2 },   // 0x66 'f', 0x2E '.'
+  {  15,  13,   1 },   // 0x66 'f', 0x43 'C'
+  {  15,  16,   1 },   // 0x66 'f', 0x69 'i'
+  {  17,   1,  -1 },   // 0x6C 'l', 0x2D '-'
+  {  17,   2,   1 },   // 0x6C 'l', 0x2E '.'
+  {  17,  17,  -1 } }; // 0x6C 'l', 0x6C 'l'
+
+const GFXkerning IBMPlexSans_SemiBold40pt8bKerning PROGMEM = {
+  IBMPlexSans_SemiBold40pt8bKernPairs,
+  12 };
 
-// Approx. 36063 bytes
+// Approx. 1785 bytes
+// Bitmaps: 4182 bytes raw, 1463 bytes compressed
 
 
 #endif /* IBMPLEXSANSSEMIBOLD40PT8B_H_ */
@@ -0,0 +1,45 @@
+// Generated by fonts/build.py from manifest.txt, inputs 91ad99e7d7b0aba8
+#ifndef IBMPLEXSANSSEMIBOLD40PT8BMETRICS_H_
+#define IBMPLEXSANSSEMIBOLD40PT8BMETRICS_H_
+
+#include "fontdata.h"
+
+constexpr uint8_t IBMPlexSans_SemiBold40pt8bAdvances[] = {
+  0x12, 0x18, 0x25, 0x33, 0x2F, 0x4B, 0x38, 0x14, 0x1A, 0x1A, 0x2B, 0x2F,
+  0x17, 0x1F, 0x17, 0x22, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F,
+  0x2F, 0x2F, 0x19, 0x19, 0x2F, 0x2F, 0x2F, 0x26, 0x46, 0x34, 0x34, 0x32,
+  0x36, 0x2F, 0x2D, 0x38, 0x38, 0x21, 0x2B, 0x35, 0x29, 0x40, 0x38, 0x38,
+  0x32, 0x38, 0x34, 0x30, 0x2D, 0x36, 0x32, 0x4A, 0x33, 0x31, 0x2F, 0x1A,
+  0x22, 0x1A, 0x2F, 0x2C, 0x2F, 0x2C, 0x2F, 0x28, 0x2F, 0x2C, 0x1B, 0x2B,
+  0x2E, 0x16, 0x16, 0x2C, 0x17, 0x45, 0x2E, 0x2C, 0x2F, 0x2F, 0x1F, 0x27,
+  0x1D, 0x2E, 0x29, 0x40, 0x2A, 0x29, 0x27, 0x1C, 0x1D, 0x1C, 0x2F, 0x25,
+  0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25,
+  0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25,
+  0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x12, 0x18, 0x2A, 0x2E,
+  0x31, 0x30, 0x1D, 0x2D, 0x2F, 0x3D, 0x22, 0x2B, 0x2F, 0x1F, 0x25, 0x2F,
+  0x25, 0x2F, 0x1B, 0x1B, 0x2F, 0x2E, 0x34, 0x1B, 0x2F, 0x1B, 0x21, 0x2B,
+  0x42, 0x43, 0x41, 0x26 };
+
+constexpr int8_t IBMPlexSans_SemiBold40pt8bInkRights[] = {
+     1,   18,   31,   49,   43,   71,   55,   15,   27,   22,   41,   42,
+    18,   27,   18,   31,   44,   45,   43,   41,   44,   43,   43,   42,
+    43,   43,   19,   19,   39,   42,   39,   36,   65,   51,   48,   48,
+    50,   42,   41,   50,   50,   29,   37,   52,   38,   57,   50,   52,
+    47,   52,   48,   44,   43,   48,   49,   72,   50,   48,   44,   22,
+    34,   19,   43,   41,   28,   41,   43,   38,   41,   41,   26,   43,
+    41,   17,   17,   44,   21,   64,   41,   41,   43,   41,   29,   36,
+    26,   40,   40,   62,   41,   40,   36,   24,   19,   27,   43,   34,
+    34,   34,   34,   34,   34,   34,   34,   34,   34,   34,   34,   34,
+    34,   34,   34,   34,   34,   34,   34,   34,   34,   34,   34,   34,
+    34,   34,   34,   34,   34,   34,   34,   34,    1,   18,   39,   44,
+    48,   46,   19,   40,   37,   57,   31,   38,   42,   27,   34,   35,
+    33,   42,   25,   24,   34,   40,   47,   20,   34,   25,   30,   39,
+    64,   65,   63,   37 };
+
+constexpr GFXmetrics IBMPlexSans_SemiBold40pt8bMetrics = {
+  0x20, 0xBF,
+  IBMPlexSans_SemiBold40pt8bAdvances,
+  IBMPlexSans_SemiBold40pt8bInkRights,
+  102, 61, 18, 47, true };
+
+#endif /* IBMPLEXSANSSEMIBOLD40PT8BMETRICS_H_ */
@@ -0,0 +1,219 @@
+// Copyright 2021 Jacques Supcik <jacques@supcik.net>
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file Arduino.cpp
+ * @author Jacques Supcik <jacques@supcik.net>
+ *
+ * @brief Host stand-in for the Arduino core
+ *
+ * @date 2026-10-17
+ * @version 0.1.1
+ ***************************************************************************/
+
+#include "Arduino.h"
+
+#include <ctype.h>
+#include <stdarg.h>
+
+HardwareSerial Serial;
+
+static uint64_t hostMicros = 0;
+
+String::String(float value, unsigned int decimals)
+{
+    char buffer[32];
+    snprintf(buffer, sizeof(buffer), "%.*f", decimals, value);
+    copy(buffer, strlen(buffer));
+}
+
+String& String::operator=(const String& other)
+{
+    if (this != &other) copy(other.buffer_, other.length_);
+    return *this;
+}
+
+String& String::operator=(String&& other) noexcept
+{
+    if (this != &other) {
+        delete[] buffer_;
+        move(other);
+    }
+    return *this;
+}
+
+void String::copy(const char* text, size_t length)
+{
+    // As on Arduino, the buffer is reused when the new text fits, and
+    // reallocated to the exact size otherwise.
+    if (buffer_ == nullptr || length > length_) {
+        delete[] buffer_;
+        buffer_ = new char[length + 1];
+    }
+    if (length > 0) memcpy(buffer_, text, length);
+    buffer_[length] = '\0';
+    length_         = length;
+}
+
+void String::append(const char* text, size_t length)
+{
+    char* buffer = new char[length_ + length + 1];
+    memcpy(buffer, c_str(), length_);
+    memcpy(buffer + length_, text, length);
+    buffer[length_ + length] = '\0';
+    delete[] buffer_;
+    buffer_ = buffer;
+    length_ += length;
+}
+
+void String::move(String& other)
+{
+    buffer_       = other.buffer_;
+    length_       = other.length_;
+    other.buffer_ = nullptr;
+    other.length_ = 0;
+}
+
+String& String::operator+=(const String& other)
+{
+    append(other.c_str(), other.length_);
+    return *this;
+}
+
+String& String::operator+=(const char* other)
+{
+    append(other, strlen(other));
+    return *this;
+}
+
+String& String::operator+=(char c)
+{
+    append(&c, 1);
+    return *this;
+}
+
+int String::indexOf(char c, unsigned int from) const
+{
+    if (from >= length_) return -1;
+    const char* found = strchr(c_str() + from, c);
+    return found == nullptr ? -1 : found - c_str();
+}
+
+int String::indexOf(const char* text, unsigned int from) const
+{
+    if (from > length_) return -1;
+    const char* found = strstr(c_str() + from, text);
+    return found == nullptr ? -1 : found - c_str();
+}
+
+String String::substring(unsigned int from) const
+{
+    return substring(from, length_);
+}
+
+String String::substring(unsigned int from, unsigned int to) const
+{
+    if (to < from) std::swap(from, to);
+    if (from > length_) return String();
+    if (to > length_) to = length_;
+    return String(c_str() + from, to - from);
+}
+
+void String::trim()
+{
+    const char* text = c_str();
+    size_t first     = 0;
+    size_t last      = length_;
+    while (first < last && isspace(text[first])) first++;
+    while (last > first && isspace(text[last - 1])) last--;
+    if (first == 0 && last == length_) return;
+    memmove(buffer_, text + first, last - first);
+    buffer_[last - first] = '\0';
+    length_               = last - first;
+}
+
+String operator+(const String& lhs, const String& rhs)
+{
+    String result(lhs);
+    result += rhs;
+    return result;
+}
+
+String operator+(const String& lhs, const char* rhs)
+{
+    String result(lhs);
+    result += rhs;
+    return result;
+}
+
+String operator+(const char* lhs, const String& rhs)
+{
+    String result(lhs);
+    result += rhs;
+    return result;
+}
+
+size_t HardwareSerial::write(uint8_t c)
+{
+    if (output_ == nullptr) return 1;
+    return fputc(c, output_) == EOF ? 0 : 1;
+}
+
+size_t HardwareSerial::write(const char* buffer, size_t size)
+{
+    if (output_ == nullptr) return size;
+    return fwrite(buffer, 1, size, output_);
+}
+
+size_t HardwareSerial::print(const char* text)
+{
+    return write(text, strlen(text));
+}
+
+size_t HardwareSerial::print(double value, int digits)
+{
+    return printf("%.*f", digits, value);
+}
+
+size_t HardwareSerial::printf(const char* format, ...)
+{
+    if (output_ == nullptr) return 0;
+    va_list args;
+    va_start(args, format);
+    int n = vfprintf(output_, format, args);
+    va_end(args);
+    return n < 0 ? 0 : n;
+}
+
+unsigned long millis() { return hostMicros / 1000; }
+
+unsigned long micros() { return hostMicros; }
+
+void delay(unsigned long ms) { hostMicros += ms * 1000ULL; }
+
+void delayMicroseconds(unsigned int us) { hostMicros += us; }
+
+void hostAdvanceMicros(uint64_t us) { hostMicros += us; }
+
+long random(long max)
+{
+    return max <= 0 ? 0 : rand() % max;
+}
+
+long random(long min, long max)
+{
+    return min >= max ? min : min + random(max - min);
+}
+
+void randomSeed(unsigned long seed) { srand(seed); }
@@ -0,0 +1,146 @@
+// Copyright 2021 Jacques Supcik <jacques@supcik.net>
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file Arduino.h
+ * @author Jacques Supcik <jacques@supcik.net>
+ *
+ * @brief Host stand-in for the Arduino core
+ *
+ * @date 2026-10-17
+ * @version 0.1.1
+ ***************************************************************************/
+
+#ifndef ARDUINO_H_
+#define ARDUINO_H_
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <algorithm>
+#include <string>
+
+using std::max;
+using std::min;
+
+#define PROGMEM
+#define RTC_DATA_ATTR
+
+// The subset of the Arduino String class used by the firmware. Like the
+// Arduino one, every String owns a heap buffer sized to its text, so the
+// host heap tracker sees the allocations that the small string optimization
+// of std::string would hide.
+class String {
+   public:
+    String(const char* text = "") { copy(text, text ? strlen(text) : 0); }
+    String(const char* text, size_t length) { copy(text, length); }
+    String(const String& other) { copy(other.buffer_, other.length_); }
+    String(String&& other) noexcept { move(other); }
+    String(char c) { copy(&c, 1); }
+    String(int value) : String(std::to_string(value).c_str()) {}
+    String(unsigned int value) : String(std::to_string(value).c_str()) {}
+    String(long value) : String(std::to_string(value).c_str()) {}
+    String(unsigned long value) : String(std::to_string(value).c_str()) {}
+    String(float value, unsigned int decimals = 2);
+    ~String() { delete[] buffer_; }
+
+    String& operator=(const String& other);
+    String& operator=(String&& other) noexcept;
+
+    const char* c_str() const { return buffer_ ? buffer_ : ""; }
+    unsigned int length() const { return length_; }
+    char operator[](unsigned int index) const { return c_str()[index]; }
+
+    String& operator+=(const String& other);
+    String& operator+=(const char* other);
+    String& operator+=(char c);
+    bool operator==(const String& other) const
+    {
+        return strcmp(c_str(), other.c_str()) == 0;
+    }
+    bool operator==(const char* other) const
+    {
+        return strcmp(c_str(), other) == 0;
+    }
+    bool operator!=(const String& other) const { return !(*this == other); }
+
+    int indexOf(char c, unsigned int from = 0) const;
+    int indexOf(const char* text, unsigned int from = 0) const;
+    String substring(unsigned int from) const;
+    String substring(unsigned int from, unsigned int to) const;
+    void trim();
+    long toInt() const { return atol(c_str()); }
+    float toFloat() const { return atof(c_str()); }
+
+   private:
+    void copy(const char* text, size_t length);
+    void append(const char* text, size_t length);
+    void move(String& other);
+
+    char* buffer_        = nullptr;
+    unsigned int length_ = 0;
+};
+
+String operator+(const String& lhs, const String& rhs);
+String operator+(const String& lhs, const char* rhs);
+String operator+(const char* lhs, const String& rhs);
+
+// Serial port, written to the standard output
+class HardwareSerial {
+   public:
+    void begin(unsigned long baud) { (void)baud; }
+    void setOutput(FILE* output) { output_ = output; }
+
+    size_t write(uint8_t c);
+    size_t write(const char* buffer, size_t size);
+    size_t print(const char* text);
+    size_t print(const String& text) { return print(text.c_str()); }
+    size_t print(char c) { return write(c); }
+    size_t print(int value) { return printf("%d", value); }
+    size_t print(unsigned int value) { return printf("%u", value); }
+    size_t print(long value) { return printf("%ld", value); }
+    size_t print(unsigned long value) { return printf("%lu", value); }
+    size_t print(double value, int digits = 2);
+    size_t println() { return print("\r\n"); }
+    template <typename T>
+    size_t println(const T& value)
+    {
+        size_t n = print(value);
+        return n + println();
+    }
+    size_t printf(const char* format, ...)
+        __attribute__((format(printf, 2, 3)));
+
+   private:
+    FILE* output_ = stdout;
+};
+
+extern HardwareSerial Serial;
+
+// Time is simulated: it only moves forward when delay() is called, or when
+// the host advances it explicitly.
+unsigned long millis();
+unsigned long micros();
+void delay(unsigned long ms);
+void delayMicroseconds(unsigned int us);
+void hostAdvanceMicros(uint64_t us);
+
+long random(long max);
+long random(long min, long max);
+void randomSeed(unsigned long seed);
+
+#endif /* ARDUINO_H_ */
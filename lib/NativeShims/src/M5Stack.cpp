@@ -0,0 +1,332 @@
+// Copyright 2021 Jacques Supcik <jacques@supcik.net>
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file M5Stack.cpp
+ * @author Jacques Supcik <jacques@supcik.net>
+ *
+ * @brief Host stand-in for the M5Stack library
+ *
+ * @date 2026-10-17
+ * @version 0.1.1
+ ***************************************************************************/
+
+#include "M5Stack.h"
+
+M5Stack M5;
+
+static uint16_t decodeUtf8(const uint8_t*& p)
+{
+    uint16_t c = *p++;
+    if ((c & 0xE0) == 0xC0 && (*p & 0xC0) == 0x80) {
+        c = ((c & 0x1F) << 6) | (*p++ & 0x3F);
+    }
+    return c;
+}
+
+// Cost of setting an address window: CASET, RASET and RAMWR commands with
+// their parameters
+const uint64_t kWindowBytes = 3 + 4 + 4;
+
+TFT_eSPI::TFT_eSPI(int16_t width, int16_t height)
+{
+    resize(width, height);
+}
+
+void TFT_eSPI::resize(int16_t width, int16_t height)
+{
+    width_  = width;
+    height_ = height;
+    pixels_.assign(static_cast<size_t>(width) * height, BLACK);
+}
+
+void TFT_eSPI::countTransaction(uint64_t pixels)
+{
+    if (!countStats_) return;
+    stats_.transactions++;
+    stats_.pixels += pixels;
+    stats_.bytes += kWindowBytes + 2 * pixels;
+}
+
+void TFT_eSPI::setWindow(int32_t x0, int32_t y0, int32_t x1, int32_t y1)
+{
+    windowX0_ = x0;
+    windowY0_ = y0;
+    windowX1_ = x1;
+    windowY1_ = y1;
+    cursorX_  = x0;
+    cursorY_  = y0;
+    countTransaction(0);
+}
+
+void TFT_eSPI::setAddrWindow(int32_t x, int32_t y, int32_t w, int32_t h)
+{
+    setWindow(x, y, x + w - 1, y + h - 1);
+}
+
+void TFT_eSPI::pushColor(uint16_t color, uint32_t length)
+{
+    for (uint32_t i = 0; i < length; i++) pushColors(&color, 1, true);
+}
+
+void TFT_eSPI::pushColors(const uint16_t* data, uint32_t length, bool swap)
+{
+    if (countStats_) {
+        stats_.pixels += length;
+        stats_.bytes += 2 * length;
+    }
+    for (uint32_t i = 0; i < length; i++) {
+        if (cursorY_ > windowY1_) break;
+        uint16_t color = data[i];
+        // swap = true means the colours are in the CPU byte order
+        if (!swap) color = (color >> 8) | (color << 8);
+        if (cursorX_ >= 0 && cursorX_ < width_ && cursorY_ >= 0 &&
+            cursorY_ < height_) {
+            pixels_[cursorY_ * width_ + cursorX_] = color;
+        }
+        if (++cursorX_ > windowX1_) {
+            cursorX_ = windowX0_;
+            cursorY_++;
+        }
+    }
+}
+
+void TFT_eSPI::pushImage(
+    int32_t x, int32_t y, int32_t w, int32_t h, const uint16_t* data)
+{
+    countTransaction(static_cast<uint64_t>(w) * h);
+    for (int32_t row = 0; row < h; row++) {
+        int32_t py = y + row;
+        if (py < 0 || py >= height_) continue;
+        for (int32_t col = 0; col < w; col++) {
+            int32_t px = x + col;
+            if (px < 0 || px >= width_) continue;
+            pixels_[py * width_ + px] = data[row * w + col];
+        }
+    }
+}
+
+void TFT_eSPI::fillScreen(uint32_t color)
+{
+    fillRect(0, 0, width_, height_, color);
+}
+
+void TFT_eSPI::fillRect(
+    int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color)
+{
+    int32_t x0 = max<int32_t>(x, 0), y0 = max<int32_t>(y, 0);
+    int32_t x1 = min<int32_t>(x + w, width_), y1 = min<int32_t>(y + h, height_);
+    if (x0 >= x1 || y0 >= y1) return;
+    countTransaction(static_cast<uint64_t>(x1 - x0) * (y1 - y0));
+    for (int32_t py = y0; py < y1; py++) {
+        uint16_t* line = &pixels_[py * width_];
+        std::fill(line + x0, line + x1, color);
+    }
+}
+
+void TFT_eSPI::drawFastHLine(int32_t x, int32_t y, int32_t w, uint32_t color)
+{
+    fillRect(x, y, w, 1, color);
+}
+
+void TFT_eSPI::drawPixel(int32_t x, int32_t y, uint32_t color)
+{
+    fillRect(x, y, 1, 1, color);
+}
+
+void TFT_eSPI::fillCircle(int32_t x, int32_t y, int32_t r, uint32_t color)
+{
+    for (int32_t dy = -r; dy <= r; dy++) {
+        int32_t dx = 0;
+        while ((dx + 1) * (dx + 1) + dy * dy <= r * r) dx++;
+        drawFastHLine(x - dx, y + dy, 2 * dx + 1, color);
+    }
+}
+
+uint16_t TFT_eSPI::readPixel(int32_t x, int32_t y) const
+{
+    if (x < 0 || x >= width_ || y < 0 || y >= height_) return 0;
+    return pixels_[y * width_ + x];
+}
+
+bool TFT_eSPI::savePpm(const char* path) const
+{
+    FILE* file = fopen(path, "wb");
+    if (file == nullptr) return false;
+    fprintf(file, "P6\n%d %d\n255\n", width_, height_);
+    for (uint16_t color : pixels_) {
+        uint8_t rgb[3] = {
+            static_cast<uint8_t>(((color >> 11) & 0x1F) * 255 / 31),
+            static_cast<uint8_t>(((color >> 5) & 0x3F) * 255 / 63),
+            static_cast<uint8_t>((color & 0x1F) * 255 / 31),
+        };
+        fwrite(rgb, 1, sizeof(rgb), file);
+    }
+    return fclose(file) == 0;
+}
+
+void TFT_eSPI::setTextColor(uint16_t color)
+{
+    textColor_   = color;
+    textBgColor_ = color;
+}
+
+void TFT_eSPI::setTextColor(uint16_t color, uint16_t bgColor)
+{
+    textColor_   = color;
+    textBgColor_ = bgColor;
+}
+
+void TFT_eSPI::setFreeFont(const GFXfont* font)
+{
+    font_        = font;
+    glyphAscent_ = 0;
+    if (font == nullptr) return;
+    // Same scan as TFT_eSPI, which skips the last glyph of the font
+    for (int i = 0; i < font->last - font->first; i++) {
+        int ascent = -font->glyph[i].yOffset;
+        if (ascent > glyphAscent_) glyphAscent_ = ascent;
+    }
+}
+
+int16_t TFT_eSPI::textWidth(const char* text)
+{
+    if (font_ == nullptr) return 0;
+    int16_t width    = 0;
+    const uint8_t* p = reinterpret_cast<const uint8_t*>(text);
+    while (*p) {
+        uint16_t c = decodeUtf8(p);
+        if (c < font_->first || c > font_->last) continue;
+        const GFXglyph& glyph = font_->glyph[c - font_->first];
+        // Like TFT_eSPI, the last glyph counts for its ink, not its advance
+        width += *p ? glyph.xAdvance : glyph.xOffset + glyph.width;
+    }
+    return width;
+}
+
+int16_t TFT_eSPI::fontHeight() const
+{
+    return font_ == nullptr ? 8 : font_->yAdvance;
+}
+
+// Like TFT_eSPI, each horizontal run of set bits is drawn with one
+// drawFastHLine, in the text colour only (free fonts have no background).
+void TFT_eSPI::drawGlyph(const GFXglyph& glyph, int32_t x, int32_t y)
+{
+    const uint8_t* bitmap = font_->bitmap + glyph.bitmapOffset;
+    uint32_t bit          = 0;
+    for (int32_t row = 0; row < glyph.height; row++) {
+        int32_t runStart = -1;
+        for (int32_t col = 0; col <= glyph.width; col++, bit++) {
+            bool set = col < glyph.width &&
+                       (bitmap[bit >> 3] & (0x80 >> (bit & 7))) != 0;
+            if (set && runStart < 0) runStart = col;
+            if (!set && runStart >= 0) {
+                drawFastHLine(x + glyph.xOffset + runStart,
+                              y + glyph.yOffset + row,
+                              col - runStart,
+                              textColor_);
+                runStart = -1;
+            }
+        }
+        bit--;  // the sentinel column is not part of the bitmap
+    }
+}
+
+int16_t TFT_eSPI::drawString(const char* text, int32_t x, int32_t y)
+{
+    int16_t width = textWidth(text);
+    if (datum_ == TC_DATUM) x -= width / 2;
+    if (font_ == nullptr) return width;
+
+    int32_t baseline = y + glyphAscent_;
+    const uint8_t* p = reinterpret_cast<const uint8_t*>(text);
+    while (*p) {
+        uint16_t c = decodeUtf8(p);
+        if (c < font_->first || c > font_->last) continue;
+        const GFXglyph& glyph = font_->glyph[c - font_->first];
+        drawGlyph(glyph, x, baseline);
+        x += glyph.xAdvance;
+    }
+    return width;
+}
+
+int16_t TFT_eSPI::drawCentreString(const char* text,
+                                   int32_t x,
+                                   int32_t y,
+                                   uint8_t font)
+{
+    (void)font;
+    uint8_t datum = datum_;
+    datum_        = TC_DATUM;
+    int16_t width = drawString(text, x, y);
+    datum_        = datum;
+    return width;
+}
+
+void* TFT_eSprite::createSprite(int16_t width, int16_t height)
+{
+    resize(width, height);
+    created_ = true;
+    return this;
+}
+
+void TFT_eSprite::deleteSprite()
+{
+    resize(0, 0);
+    created_ = false;
+}
+
+void TFT_eSprite::pushSprite(int32_t x, int32_t y)
+{
+    if (!created_) return;
+    parent_->pushImage(x, y, width_, height_, pixels_.data());
+}
+
+bool TFT_eSprite::pushSprite(int32_t tx,
+                             int32_t ty,
+                             int32_t sx,
+                             int32_t sy,
+                             int32_t sw,
+                             int32_t sh)
+{
+    if (!created_ || sx < 0 || sy < 0 || sw <= 0 || sh <= 0 ||
+        sx + sw > width_ || sy + sh > height_) {
+        return false;
+    }
+    parent_->setAddrWindow(tx, ty, sw, sh);
+    for (int32_t row = 0; row < sh; row++) {
+        parent_->pushColors(&pixels_[(sy + row) * width_ + sx], sw);
+    }
+    return true;
+}
+
+void Button::read()
+{
+    pressed_ = pending_;
+    pending_ = false;
+}
+
+void M5Stack::begin(bool lcd, bool sd, bool serial)
+{
+    (void)lcd, (void)sd;
+    if (serial) Serial.begin(115200);
+}
+
+void M5Stack::update()
+{
+    BtnA.read();
+    BtnB.read();
+    BtnC.read();
+}
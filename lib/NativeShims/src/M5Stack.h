@@ -0,0 +1,220 @@
+// Copyright 2021 Jacques Supcik <jacques@supcik.net>
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file M5Stack.h
+ * @author Jacques Supcik <jacques@supcik.net>
+ *
+ * @brief Host stand-in for the M5Stack library
+ *
+ * @date 2026-10-17
+ * @version 0.1.1
+ ***************************************************************************/
+
+#ifndef M5STACK_H_
+#define M5STACK_H_
+
+#include <Arduino.h>
+
+#include <vector>
+
+#define TFT_WIDTH 240   // the panel is used in landscape mode: this is the
+#define TFT_HEIGHT 320  // height, and TFT_HEIGHT is the width
+
+#define BLACK 0x0000
+#define NAVY 0x000F
+#define DARKGREEN 0x03E0
+#define MAROON 0x7800
+#define DARKGREY 0x7BEF
+#define BLUE 0x001F
+#define GREEN 0x07E0
+#define CYAN 0x07FF
+#define RED 0xF800
+#define YELLOW 0xFFE0
+#define WHITE 0xFFFF
+#define ORANGE 0xFDA0
+
+#define TL_DATUM 0
+#define TC_DATUM 1
+
+/// Font data stored PER GLYPH, as TFT_eSPI has it: a 32-bit offset where
+/// Adafruit_GFX has a 16-bit one
+typedef struct {
+    uint32_t bitmapOffset;  ///< Pointer into GFXfont->bitmap
+    uint8_t width;          ///< Bitmap dimensions in pixels
+    uint8_t height;         ///< Bitmap dimensions in pixels
+    uint8_t xAdvance;       ///< Distance to advance cursor (x axis)
+    int8_t xOffset;         ///< X dist from cursor pos to UL corner
+    int8_t yOffset;         ///< Y dist from cursor pos to UL corner
+} GFXglyph;
+
+/// Data stored for FONT AS A WHOLE
+typedef struct {
+    uint8_t* bitmap;   ///< Glyph bitmaps, concatenated
+    GFXglyph* glyph;   ///< Glyph array
+    uint16_t first;    ///< ASCII extents (first char)
+    uint16_t last;     ///< ASCII extents (last char)
+    uint8_t yAdvance;  ///< Newline distance (y axis)
+} GFXfont;
+
+// Cost of the drawing operations, as they would go over the SPI bus
+struct LcdStats {
+    uint64_t transactions;  // address windows set
+    uint64_t pixels;        // pixels written
+    uint64_t bytes;         // bytes sent, commands and addresses included
+};
+
+// Text and drawing API of TFT_eSPI, drawing into an RGB565 framebuffer.
+class TFT_eSPI {
+   public:
+    TFT_eSPI(int16_t width, int16_t height);
+    virtual ~TFT_eSPI() {}
+
+    int16_t width() const { return width_; }
+    int16_t height() const { return height_; }
+
+    void startWrite() {}
+    void endWrite() {}
+    void setWindow(int32_t x0, int32_t y0, int32_t x1, int32_t y1);
+    void setAddrWindow(int32_t x, int32_t y, int32_t w, int32_t h);
+    void pushColor(uint16_t color, uint32_t length = 1);
+    void pushColors(const uint16_t* data, uint32_t length, bool swap = true);
+    void pushImage(
+        int32_t x, int32_t y, int32_t w, int32_t h, const uint16_t* data);
+
+    void fillScreen(uint32_t color);
+    void fillRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color);
+    void drawFastHLine(int32_t x, int32_t y, int32_t w, uint32_t color);
+    void drawPixel(int32_t x, int32_t y, uint32_t color);
+    void fillCircle(int32_t x, int32_t y, int32_t r, uint32_t color);
+
+    void setTextColor(uint16_t color);
+    void setTextColor(uint16_t color, uint16_t bgColor);
+    void setFreeFont(const GFXfont* font);
+    void setTextDatum(uint8_t datum) { datum_ = datum; }
+    int16_t textWidth(const char* text);
+    int16_t textWidth(const String& text) { return textWidth(text.c_str()); }
+    int16_t fontHeight() const;
+    int16_t drawString(const char* text, int32_t x, int32_t y);
+    int16_t drawCentreString(const char* text,
+                             int32_t x,
+                             int32_t y,
+                             uint8_t font);
+    int16_t drawCentreString(const String& text,
+                             int32_t x,
+                             int32_t y,
+                             uint8_t font)
+    {
+        return drawCentreString(text.c_str(), x, y, font);
+    }
+
+    // Simulator only
+    uint16_t readPixel(int32_t x, int32_t y) const;
+    const std::vector<uint16_t>& framebuffer() const { return pixels_; }
+    const LcdStats& stats() const { return stats_; }
+    void resetStats() { stats_ = LcdStats(); }
+    bool savePpm(const char* path) const;
+
+   protected:
+    void resize(int16_t width, int16_t height);
+    void countTransaction(uint64_t pixels);
+    void drawGlyph(const GFXglyph& glyph, int32_t x, int32_t y);
+
+    int16_t width_;
+    int16_t height_;
+    std::vector<uint16_t> pixels_;
+    bool countStats_ = false;  // only the transfers to the LCD are counted
+    LcdStats stats_  = LcdStats();
+
+    // Address window of pushColor(s) and the next pixel to write in it
+    int32_t windowX0_ = 0, windowY0_ = 0, windowX1_ = 0, windowY1_ = 0;
+    int32_t cursorX_ = 0, cursorY_ = 0;
+
+    const GFXfont* font_  = nullptr;
+    uint8_t glyphAscent_  = 0;  // largest ascent of the font
+    uint16_t textColor_   = WHITE;
+    uint16_t textBgColor_ = WHITE;
+    uint8_t datum_        = TL_DATUM;
+};
+
+class M5Display : public TFT_eSPI {
+   public:
+    M5Display() : TFT_eSPI(TFT_HEIGHT, TFT_WIDTH) { countStats_ = true; }
+    void setBrightness(uint8_t brightness) { brightness_ = brightness; }
+    uint8_t brightness() const { return brightness_; }
+
+   private:
+    uint8_t brightness_ = 0;
+};
+
+class TFT_eSprite : public TFT_eSPI {
+   public:
+    explicit TFT_eSprite(TFT_eSPI* parent) : TFT_eSPI(0, 0), parent_(parent)
+    {
+    }
+
+    void setColorDepth(int8_t depth) { (void)depth; }
+    void* createSprite(int16_t width, int16_t height);
+    void deleteSprite();
+    bool created() const { return created_; }
+    void fillSprite(uint32_t color) { fillScreen(color); }
+    void pushSprite(int32_t x, int32_t y);
+    // Pushes the `sw` by `sh` region at (sx, sy) of the sprite to (tx, ty),
+    // in a single window
+    bool pushSprite(int32_t tx,
+                    int32_t ty,
+                    int32_t sx,
+                    int32_t sy,
+                    int32_t sw,
+                    int32_t sh);
+
+   private:
+    TFT_eSPI* parent_;
+    bool created_ = false;
+};
+
+// Hardware button. The host presses it with press(); the press is reported
+// by wasPressed() after the next call to M5.update().
+class Button {
+   public:
+    void press() { pending_ = true; }
+    void read();
+    bool wasPressed() const { return pressed_; }
+
+   private:
+    bool pending_ = false;
+    bool pressed_ = false;
+};
+
+class POWER {
+   public:
+    bool begin() { return true; }
+};
+
+class M5Stack {
+   public:
+    void begin(bool lcd = true, bool sd = true, bool serial = true);
+    void update();
+
+    M5Display Lcd;
+    M5Display& lcd = Lcd;
+    Button BtnA;
+    Button BtnB;
+    Button BtnC;
+    POWER Power;
+};
+
+extern M5Stack M5;
+
+#endif /* M5STACK_H_ */
@@ -0,0 +1,103 @@
+// Copyright 2021 Jacques Supcik <jacques@supcik.net>
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file MQTT.cpp
+ * @author Jacques Supcik <jacques@supcik.net>
+ *
+ * @brief Host stand-in for the 256dpi MQTT library
+ *
+ * @date 2026-10-17
+ * @version 0.1.1
+ ***************************************************************************/
+
+#include "MQTT.h"
+
+MQTTClient::MQTTClient(int bufferSize)
+    : bufferSize_(bufferSize),
+      topicBuffer_(bufferSize + 1),
+      payloadBuffer_(bufferSize + 1)
+{
+}
+
+void MQTTClient::begin(const char* hostname, Client& client)
+{
+    (void)hostname, (void)client;
+    begun_ = true;
+}
+
+void MQTTClient::onMessage(MQTTClientCallbackSimple callback)
+{
+    simple_ = callback;
+}
+
+void MQTTClient::onMessageAdvanced(MQTTClientCallbackAdvanced callback)
+{
+    advanced_ = callback;
+}
+
+bool MQTTClient::connect(const char* clientId, bool skip)
+{
+    (void)clientId, (void)skip;
+    connectAttempts_++;
+    connected_ = begun_ && available_ && WiFi.status() == WL_CONNECTED;
+    return connected_;
+}
+
+bool MQTTClient::connected()
+{
+    if (WiFi.status() != WL_CONNECTED || !available_) connected_ = false;
+    return connected_;
+}
+
+bool MQTTClient::subscribe(const char* topic)
+{
+    if (!connected()) return false;
+    subscription_ = topic;
+    return true;
+}
+
+bool MQTTClient::publish(const char* topic, const char* payload)
+{
+    (void)topic, (void)payload;
+    return connected();
+}
+
+bool MQTTClient::loop() { return connected(); }
+
+void MQTTClient::setBrokerAvailable(bool available)
+{
+    available_ = available;
+    if (!available) connected_ = false;
+}
+
+bool MQTTClient::deliver(const char* topic, const char* bytes, int length)
+{
+    int topicLength = strlen(topic);
+    if (!connected() || topicLength > bufferSize_ || length > bufferSize_) {
+        return false;
+    }
+    // The real client passes its own, writable, null-terminated buffers
+    memcpy(topicBuffer_.data(), topic, topicLength + 1);
+    memcpy(payloadBuffer_.data(), bytes, length);
+    payloadBuffer_[length] = '\0';
+    if (advanced_ != nullptr) {
+        advanced_(this, topicBuffer_.data(), payloadBuffer_.data(), length);
+    } else if (simple_ != nullptr) {
+        String topicString(topic);
+        String payloadString(bytes, length);
+        simple_(topicString, payloadString);
+    }
+    return true;
+}
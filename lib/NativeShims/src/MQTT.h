@@ -0,0 +1,81 @@
+// Copyright 2021 Jacques Supcik <jacques@supcik.net>
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file MQTT.h
+ * @author Jacques Supcik <jacques@supcik.net>
+ *
+ * @brief Host stand-in for the 256dpi MQTT library
+ *
+ * @date 2026-10-17
+ * @version 0.1.1
+ ***************************************************************************/
+
+#ifndef MQTT_H_
+#define MQTT_H_
+
+#include <Arduino.h>
+#include <Wifi.h>
+
+#include <vector>
+
+class MQTTClient;
+
+typedef void (*MQTTClientCallbackSimple)(String& topic, String& payload);
+typedef void (*MQTTClientCallbackAdvanced)(MQTTClient* client,
+                                           char topic[],
+                                           char bytes[],
+                                           int length);
+
+// Connects as soon as WiFi is up, unless the host makes the broker
+// unavailable. Messages are handed over with deliver(), as the real client
+// does from loop().
+class MQTTClient {
+   public:
+    explicit MQTTClient(int bufferSize = 128);
+
+    void begin(const char* hostname, Client& client);
+    void onMessage(MQTTClientCallbackSimple callback);
+    void onMessageAdvanced(MQTTClientCallbackAdvanced callback);
+    void setTimeout(int timeout) { (void)timeout; }
+
+    bool connect(const char* clientId, bool skip = false);
+    bool connected();
+    void disconnect() { connected_ = false; }
+    bool subscribe(const char* topic);
+    bool publish(const char* topic, const char* payload);
+    bool loop();
+
+    void setBrokerAvailable(bool available);
+    // Number of calls to connect(), successful or not
+    unsigned long connectAttempts() const { return connectAttempts_; }
+    // Calls the message callback like the real client does. Returns false if
+    // the client is not connected or the message is too large.
+    bool deliver(const char* topic, const char* bytes, int length);
+
+   private:
+    int bufferSize_;
+    // Allocated once, like the buffers of the real client
+    std::vector<char> topicBuffer_;
+    std::vector<char> payloadBuffer_;
+    bool begun_                    = false;
+    bool connected_                = false;
+    bool available_                = true;
+    unsigned long connectAttempts_ = 0;
+    String subscription_;
+    MQTTClientCallbackSimple simple_     = nullptr;
+    MQTTClientCallbackAdvanced advanced_ = nullptr;
+};
+
+#endif /* MQTT_H_ */
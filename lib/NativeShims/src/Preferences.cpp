@@ -0,0 +1,85 @@
+// Copyright 2021 Jacques Supcik <jacques@supcik.net>
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file Preferences.cpp
+ * @author Jacques Supcik <jacques@supcik.net>
+ *
+ * @brief Host stand-in for the ESP32 Preferences (NVS) library
+ *
+ * @date 2026-10-17
+ * @version 0.1.1
+ ***************************************************************************/
+
+#include "Preferences.h"
+
+#include <map>
+#include <string>
+#include <vector>
+
+static std::map<std::string, std::vector<uint8_t>> store;
+static unsigned long writes = 0;
+
+static std::string storeKey(const String& name, const char* key)
+{
+    return std::string(name.c_str()) + "/" + key;
+}
+
+bool Preferences::begin(const char* name, bool readOnly)
+{
+    namespace_ = name;
+    readOnly_  = readOnly;
+    open_      = true;
+    return true;
+}
+
+void Preferences::end() { open_ = false; }
+
+size_t Preferences::getBytesLength(const char* key)
+{
+    if (!open_) return 0;
+    auto it = store.find(storeKey(namespace_, key));
+    return it == store.end() ? 0 : it->second.size();
+}
+
+size_t Preferences::getBytes(const char* key, void* buffer, size_t length)
+{
+    if (!open_) return 0;
+    auto it = store.find(storeKey(namespace_, key));
+    if (it == store.end() || it->second.size() > length) return 0;
+    memcpy(buffer, it->second.data(), it->second.size());
+    return it->second.size();
+}
+
+size_t Preferences::putBytes(const char* key, const void* value, size_t length)
+{
+    if (!open_ || readOnly_) return 0;
+    const uint8_t* bytes = static_cast<const uint8_t*>(value);
+    store[storeKey(namespace_, key)].assign(bytes, bytes + length);
+    writes++;
+    return length;
+}
+
+bool Preferences::clear()
+{
+    if (!open_ || readOnly_) return false;
+    std::string prefix = std::string(namespace_.c_str()) + "/";
+    for (auto it = store.begin(); it != store.end();) {
+        it = it->first.compare(0, prefix.size(), prefix) == 0 ? store.erase(it)
+                                                              : ++it;
+    }
+    return true;
+}
+
+unsigned long Preferences::writeCount() { return writes; }
@@ -0,0 +1,49 @@
+// Copyright 2021 Jacques Supcik <jacques@supcik.net>
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file Preferences.h
+ * @author Jacques Supcik <jacques@supcik.net>
+ *
+ * @brief Host stand-in for the ESP32 Preferences (NVS) library
+ *
+ * @date 2026-10-17
+ * @version 0.1.1
+ ***************************************************************************/
+
+#ifndef PREFERENCES_H_
+#define PREFERENCES_H_
+
+#include <Arduino.h>
+
+// Key-value store kept in memory for the lifetime of the process
+class Preferences {
+   public:
+    bool begin(const char* name, bool readOnly = false);
+    void end();
+    size_t getBytesLength(const char* key);
+    size_t getBytes(const char* key, void* buffer, size_t length);
+    size_t putBytes(const char* key, const void* value, size_t length);
+    bool clear();
+
+    // Number of writes to the store since the start of the process
+    static unsigned long writeCount();
+
+   private:
+    String namespace_;
+    bool readOnly_ = true;
+    bool open_     = false;
+};
+
+#endif /* PREFERENCES_H_ */
@@ -0,0 +1,41 @@
+// Copyright 2021 Jacques Supcik <jacques@supcik.net>
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file Wifi.cpp
+ * @author Jacques Supcik <jacques@supcik.net>
+ *
+ * @brief Host stand-in for the ESP32 WiFi library
+ *
+ * @date 2026-10-17
+ * @version 0.1.1
+ ***************************************************************************/
+
+#include "Wifi.h"
+
+WiFiClass WiFi;
+
+void WiFiClass::begin(const char* ssid, const char* passphrase)
+{
+    (void)ssid, (void)passphrase;
+    started_   = true;
+    startTime_ = millis();
+}
+
+wl_status_t WiFiClass::status()
+{
+    if (!started_ || !available_) return WL_DISCONNECTED;
+    if (millis() - startTime_ < associationDelay_) return WL_IDLE_STATUS;
+    return WL_CONNECTED;
+}
@@ -0,0 +1,67 @@
+// Copyright 2021 Jacques Supcik <jacques@supcik.net>
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file Wifi.h
+ * @author Jacques Supcik <jacques@supcik.net>
+ *
+ * @brief Host stand-in for the ESP32 WiFi library
+ *
+ * @date 2026-10-17
+ * @version 0.1.1
+ ***************************************************************************/
+
+#ifndef WIFI_H_
+#define WIFI_H_
+
+#include <Arduino.h>
+
+typedef enum {
+    WL_IDLE_STATUS     = 0,
+    WL_NO_SSID_AVAIL   = 1,
+    WL_CONNECTED       = 3,
+    WL_CONNECT_FAILED  = 4,
+    WL_CONNECTION_LOST = 5,
+    WL_DISCONNECTED    = 6,
+} wl_status_t;
+
+class Client {
+   public:
+    virtual ~Client() {}
+};
+
+class WiFiClient : public Client {};
+
+// The association succeeds `associationDelay` milliseconds after begin(),
+// unless the host takes the network down with setAvailable(false).
+class WiFiClass {
+   public:
+    void begin(const char* ssid, const char* passphrase);
+    wl_status_t status();
+    String macAddress() const { return "24:0A:C4:00:00:01"; }
+    bool reconnect() { return true; }
+
+    void setAvailable(bool available) { available_ = available; }
+    void setAssociationDelay(unsigned long ms) { associationDelay_ = ms; }
+
+   private:
+    bool started_                  = false;
+    bool available_                = true;
+    unsigned long startTime_       = 0;
+    unsigned long associationDelay_ = 1500;
+};
+
+extern WiFiClass WiFi;
+
+#endif /* WIFI_H_ */
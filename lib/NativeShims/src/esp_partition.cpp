@@ -0,0 +1,121 @@
+// Copyright 2021 Jacques Supcik <jacques@supcik.net>
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file esp_partition.cpp
+ * @author Jacques Supcik <jacques@supcik.net>
+ *
+ * @brief Host stand-in for the ESP-IDF partition API
+ *
+ * @date 2026-10-17
+ * @version 0.1.1
+ ***************************************************************************/
+
+#include "esp_partition.h"
+
+#include <fstream>
+#include <iterator>
+#include <list>
+#include <vector>
+
+const uint32_t kMmapPageSize = 0x10000;  // mapping granularity of the ESP32
+
+struct PartitionImage {
+    esp_partition_t partition;
+    std::vector<uint8_t> flash;
+};
+
+// A list, so that the partitions returned stay where they are
+static std::list<PartitionImage> images;
+static spi_flash_mmap_handle_t lastHandle = 0;
+
+static const PartitionImage* findImage(const esp_partition_t* partition)
+{
+    for (const PartitionImage& image : images) {
+        if (&image.partition == partition) return &image;
+    }
+    return nullptr;
+}
+
+bool setPartitionImage(const char* label, const char* path)
+{
+    std::ifstream file(path, std::ios::binary);
+    if (!file) return false;
+    std::vector<uint8_t> flash((std::istreambuf_iterator<char>(file)),
+                               std::istreambuf_iterator<char>());
+    size_t pages = (flash.size() + kMmapPageSize - 1) / kMmapPageSize;
+    size_t size  = pages * kMmapPageSize;
+    flash.resize(size, 0xFF);
+    images.remove_if([label](const PartitionImage& image) {
+        return strcmp(image.partition.label, label) == 0;
+    });
+    images.push_back({});
+    PartitionImage& image     = images.back();
+    image.partition.type      = ESP_PARTITION_TYPE_DATA;
+    image.partition.subtype   = 0x40;  // as in partitions.csv
+    image.partition.address   = 0;
+    image.partition.size      = size;
+    image.partition.encrypted = false;
+    snprintf(image.partition.label, sizeof(image.partition.label), "%s", label);
+    image.flash = std::move(flash);
+    return true;
+}
+
+const esp_partition_t* esp_partition_find_first(esp_partition_type_t type,
+                                                esp_partition_subtype_t subtype,
+                                                const char* label)
+{
+    for (const PartitionImage& image : images) {
+        if (image.partition.type == type &&
+            (label == nullptr || strcmp(image.partition.label, label) == 0)) {
+            return &image.partition;
+        }
+    }
+    return nullptr;
+}
+
+esp_err_t esp_partition_read(const esp_partition_t* partition,
+                             size_t srcOffset,
+                             void* dst,
+                             size_t size)
+{
+    const PartitionImage* image = findImage(partition);
+    if (image == nullptr) return ESP_ERR_INVALID_ARG;
+    if (srcOffset > partition->size || size > partition->size - srcOffset) {
+        return ESP_ERR_INVALID_SIZE;
+    }
+    memcpy(dst, image->flash.data() + srcOffset, size);
+    return ESP_OK;
+}
+
+esp_err_t esp_partition_mmap(const esp_partition_t* partition,
+                             size_t srcOffset,
+                             size_t size,
+                             spi_flash_mmap_memory_t memory,
+                             const void** outPtr,
+                             spi_flash_mmap_handle_t* outHandle)
+{
+    const PartitionImage* image = findImage(partition);
+    if (image == nullptr) return ESP_ERR_INVALID_ARG;
+    if (srcOffset > partition->size || size > partition->size - srcOffset) {
+        return ESP_ERR_INVALID_SIZE;
+    }
+    // The image is never freed while mapped: setPartitionImage() is only
+    // called before the firmware starts
+    *outPtr    = image->flash.data() + srcOffset;
+    *outHandle = ++lastHandle;
+    return ESP_OK;
+}
+
+void spi_flash_munmap(spi_flash_mmap_handle_t handle) {}
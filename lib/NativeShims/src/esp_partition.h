@@ -0,0 +1,83 @@
+// Copyright 2021 Jacques Supcik <jacques@supcik.net>
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file esp_partition.h
+ * @author Jacques Supcik <jacques@supcik.net>
+ *
+ * @brief Host stand-in for the ESP-IDF partition API
+ *
+ * @date 2026-10-17
+ * @version 0.1.1
+ ***************************************************************************/
+
+#ifndef ESP_PARTITION_H_
+#define ESP_PARTITION_H_
+
+#include <Arduino.h>
+
+typedef int esp_err_t;
+
+const esp_err_t ESP_OK               = 0;
+const esp_err_t ESP_ERR_INVALID_ARG  = 0x102;
+const esp_err_t ESP_ERR_INVALID_SIZE = 0x104;
+
+typedef enum {
+    ESP_PARTITION_TYPE_APP  = 0x00,
+    ESP_PARTITION_TYPE_DATA = 0x01,
+} esp_partition_type_t;
+
+typedef enum {
+    ESP_PARTITION_SUBTYPE_ANY = 0xff,
+} esp_partition_subtype_t;
+
+typedef enum {
+    SPI_FLASH_MMAP_DATA,
+    SPI_FLASH_MMAP_INST,
+} spi_flash_mmap_memory_t;
+
+typedef uint32_t spi_flash_mmap_handle_t;
+
+typedef struct {
+    esp_partition_type_t type;
+    int subtype;
+    uint32_t address;
+    uint32_t size;
+    char label[17];
+    bool encrypted;
+} esp_partition_t;
+
+// Only the data partitions given an image with setPartitionImage() exist.
+// The subtype is ignored.
+const esp_partition_t* esp_partition_find_first(esp_partition_type_t type,
+                                                esp_partition_subtype_t subtype,
+                                                const char* label);
+esp_err_t esp_partition_read(const esp_partition_t* partition,
+                             size_t srcOffset,
+                             void* dst,
+                             size_t size);
+esp_err_t esp_partition_mmap(const esp_partition_t* partition,
+                             size_t srcOffset,
+                             size_t size,
+                             spi_flash_mmap_memory_t memory,
+                             const void** outPtr,
+                             spi_flash_mmap_handle_t* outHandle);
+void spi_flash_munmap(spi_flash_mmap_handle_t handle);
+
+// Host only: makes the data partition `label` hold the file at `path`,
+// followed by erased flash (0xFF) up to a multiple of 64 KiB, as esptool
+// writes it. Returns false if the file cannot be read.
+bool setPartitionImage(const char* label, const char* path);
+
+#endif /* ESP_PARTITION_H_ */
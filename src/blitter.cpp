@@ -0,0 +1,403 @@
+// Copyright 2021 Jacques Supcik <jacques@supcik.net>
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file blitter.cpp
+ * @author Jacques Supcik <jacques@supcik.net>
+ *
+ * @brief Text renderer streaming whole strings in one address window
+ *
+ * @date 2026-10-17
+ * @version 0.1.1
+ ***************************************************************************/
+
+#include "blitter.h"
+
+#include <Arduino.h>
+#include <M5Stack.h>
+#include <limits.h>
+
+#include "fonts.h"
+#include "glyphcache.h"
+#include "glyphs.h"
+
+struct PlacedGlyph {
+    const GFXglyph* glyph;
+    int index;  // in the glyph table of the font
+    int x, y;   // top left corner of the glyph bitmap
+    GlyphReader reader;
+    int row;  // glyph row the reader decodes next
+};
+
+// A glyph of a text drawn from its image in the glyph cache
+struct CachedGlyph {
+    const GlyphImage* image;
+    int x, y;       // top left corner of the image
+    bool overlaps;  // the box of another glyph of the text intersects it
+};
+
+Box unionBox(const Box& a, const Box& b)
+{
+    if (a.w <= 0 || a.h <= 0) return b;
+    if (b.w <= 0 || b.h <= 0) return a;
+    int x0 = min(a.x, b.x);
+    int y0 = min(a.y, b.y);
+    int x1 = max(a.x + a.w, b.x + b.w);
+    int y1 = max(a.y + a.h, b.y + b.h);
+    return {x0, y0, x1 - x0, y1 - y0};
+}
+
+Box clipToScreen(const Box& box)
+{
+    int x0 = max(box.x, 0);
+    int y0 = max(box.y, 0);
+    int x1 = min(box.x + box.w, (int)M5.Lcd.width());
+    int y1 = min(box.y + box.h, (int)M5.Lcd.height());
+    if (x0 >= x1 || y0 >= y1) return {0, 0, 0, 0};
+    return {x0, y0, x1 - x0, y1 - y0};
+}
+
+uint32_t decodeUtf8(const uint8_t*& p)
+{
+    uint32_t c = *p++;
+    int extra;
+    if ((c & 0xE0) == 0xC0) {
+        extra = 1;
+    } else if ((c & 0xF0) == 0xE0) {
+        extra = 2;
+    } else if ((c & 0xF8) == 0xF0) {
+        extra = 3;
+    } else {
+        return c;
+    }
+    for (int i = 0; i < extra; i++) {
+        if ((p[i] & 0xC0) != 0x80) return c;
+    }
+    c &= 0x3F >> extra;
+    for (int i = 0; i < extra; i++) c = (c << 6) | (*p++ & 0x3F);
+    return c;
+}
+
+int fontAscent(const FontFace& face)
+{
+    if (face.metrics != nullptr) return face.metrics->ascent;
+    if (face.subset != nullptr) return face.subset->ascent;
+    // Same scan as TFT_eSPI::setFreeFont, which skips the last glyph
+    const GFXfont* font = face.font;
+    int ascent          = 0;
+    for (int i = 0; i < font->last - font->first; i++) {
+        if (-font->glyph[i].yOffset > ascent) ascent = -font->glyph[i].yOffset;
+    }
+    return ascent;
+}
+
+void layoutText(const FontFace& face, const char* text, TextLayout& layout)
+{
+    layout.face      = face;
+    layout.ascent    = fontAscent(face);
+    layout.width     = 0;
+    layout.count     = 0;
+    int x            = 0;
+    int previous     = -1;
+    const uint8_t* p = reinterpret_cast<const uint8_t*>(text);
+    while (*p && layout.count < kMaxGlyphs) {
+        int index = glyphIndex(face, decodeUtf8(p));
+        if (index < 0) continue;
+        if (previous >= 0) {
+            x += face.font->glyph[previous].xAdvance +
+                 kerning(face, previous, index);
+        }
+        layout.glyphs[layout.count] = index;
+        layout.x[layout.count++]    = x;
+        previous                    = index;
+    }
+    // Like TFT_eSPI, the last glyph counts for its ink, not its advance
+    if (previous >= 0) {
+        const GFXglyph* glyph = &face.font->glyph[previous];
+        layout.width          = x + glyph->xOffset + glyph->width;
+    }
+}
+
+int textWidth(const FontFace& face, const char* text)
+{
+    TextLayout layout;
+    layoutText(face, text, layout);
+    return layout.width;
+}
+
+// Places the glyphs of `layout` on the screen. Returns the number of glyphs
+// with pixels.
+static int placeGlyphs(const TextLayout& layout,
+                       int left,
+                       int top,
+                       PlacedGlyph* placed)
+{
+    int baseline = top + layout.ascent;
+    int count    = 0;
+    for (int i = 0; i < layout.count; i++) {
+        const GFXglyph* glyph = &layout.face.font->glyph[layout.glyphs[i]];
+        if (glyph->width == 0 || glyph->height == 0) continue;
+        PlacedGlyph& g = placed[count++];
+        g.glyph        = glyph;
+        g.index        = layout.glyphs[i];
+        g.x            = left + layout.x[i] + glyph->xOffset;
+        g.y            = baseline + glyph->yOffset;
+        g.row          = 0;
+        g.reader.begin(layout.face, layout.glyphs[i]);
+    }
+    return count;
+}
+
+Box inkBox(const TextLayout& layout, int left, int top)
+{
+    PlacedGlyph placed[kMaxGlyphs];
+    int count = placeGlyphs(layout, left, top, placed);
+    Box box   = {0, 0, 0, 0};
+    for (int i = 0; i < count; i++) {
+        const GFXglyph* glyph = placed[i].glyph;
+        Box glyphBox = {placed[i].x, placed[i].y, glyph->width, glyph->height};
+        box          = unionBox(box, glyphBox);
+    }
+    return box;
+}
+
+// Decodes the row of `placed` at `glyphRow`, skipping the rows above it.
+// Returns the number of runs.
+static int readRow(PlacedGlyph& placed, int glyphRow)
+{
+    while (placed.row < glyphRow) {
+        placed.reader.next();
+        placed.row++;
+    }
+    placed.row++;
+    return placed.reader.next();
+}
+
+const uint16_t* greyPalette(uint16_t color, uint16_t bgColor, int bits)
+{
+    static uint16_t cachedColor = 0, cachedBgColor = 0;
+    static int cachedBits = 0;
+    static uint16_t palette[kMaxGreyLevels];
+    if (bits == cachedBits && color == cachedColor &&
+        bgColor == cachedBgColor) {
+        return palette;
+    }
+    int last = (1 << bits) - 1;
+    int r0 = bgColor >> 11, g0 = bgColor >> 5 & 0x3F, b0 = bgColor & 0x1F;
+    int r1 = color >> 11, g1 = color >> 5 & 0x3F, b1 = color & 0x1F;
+    for (int i = 0; i <= last; i++) {
+        int r      = (r0 * (last - i) + r1 * i + last / 2) / last;
+        int g      = (g0 * (last - i) + g1 * i + last / 2) / last;
+        int b      = (b0 * (last - i) + b1 * i + last / 2) / last;
+        palette[i] = r << 11 | g << 5 | b;
+    }
+    cachedColor   = color;
+    cachedBgColor = bgColor;
+    cachedBits    = bits;
+    return palette;
+}
+
+// Fills `row`, the pixels of screen row `y` within `box`, with `bgColor`
+// and the runs of the glyphs over it
+static void expandRow(PlacedGlyph* placed,
+                      int count,
+                      int y,
+                      const Box& box,
+                      uint16_t color,
+                      uint16_t bgColor,
+                      uint16_t* row)
+{
+    for (int i = 0; i < box.w; i++) row[i] = bgColor;
+    for (int g = 0; g < count; g++) {
+        int glyphRow = y - placed[g].y;
+        if (glyphRow < 0 || glyphRow >= placed[g].glyph->height) continue;
+        int runs            = readRow(placed[g], glyphRow);
+        const GlyphRun* run = placed[g].reader.runs();
+        for (int i = 0; i < runs; i++) {
+            int start = max(placed[g].x + run[i].start, box.x);
+            int end   = min(placed[g].x + run[i].end, box.x + box.w);
+            for (int x = start; x < end; x++) row[x - box.x] = color;
+        }
+    }
+}
+
+// Fills `row`, the pixels of screen row `y` within `box`, with the colours
+// of `palette` for the grey levels of the anti-aliased glyphs. Where glyphs
+// overlap, the highest level wins. `levels` is scratch space for a row.
+static void blendRow(const GFXgreys& greys,
+                     const PlacedGlyph* placed,
+                     int count,
+                     int y,
+                     const Box& box,
+                     const uint16_t* palette,
+                     uint8_t* levels,
+                     uint16_t* row)
+{
+    int bits    = greys.bits;
+    int mask    = (1 << bits) - 1;
+    int perByte = 8 / bits;
+    memset(levels, 0, box.w);
+    for (int g = 0; g < count; g++) {
+        const GFXglyph* glyph = placed[g].glyph;
+        int glyphRow          = y - placed[g].y;
+        if (glyphRow < 0 || glyphRow >= glyph->height) continue;
+        // Rows are whole bytes: this one is found without decoding
+        const uint8_t* pixels = greys.data + glyph->bitmapOffset +
+                                glyphRow * ((glyph->width * bits + 7) / 8);
+        int start    = max(0, box.x - placed[g].x);
+        int end      = min((int)glyph->width, box.x + box.w - placed[g].x);
+        uint8_t* out = levels + (placed[g].x - box.x);
+        // Whole bytes at a time: most of them are clear, and skipped
+        for (int x = start - start % perByte; x < end; x += perByte) {
+            unsigned byte = pixels[x / perByte];
+            if (byte == 0) continue;
+            int last = min(x + perByte, end);
+            for (int i = x; i < last; i++, byte <<= bits) {
+                int level = byte >> (8 - bits) & mask;
+                if (i >= start && level > out[i]) out[i] = level;
+            }
+        }
+    }
+    for (int i = 0; i < box.w; i++) row[i] = palette[levels[i]];
+}
+
+// True if the boxes of glyphs `a` and `b` intersect
+static bool overlap(const PlacedGlyph& a, const PlacedGlyph& b)
+{
+    return a.x < b.x + b.glyph->width && b.x < a.x + a.glyph->width &&
+           a.y < b.y + b.glyph->height && b.y < a.y + a.glyph->height;
+}
+
+// Moves the glyphs of `placed` that `cache` has images of into `cached`,
+// keeping the others, to be decoded, at the start of `placed`. Updates
+// `count` and returns the number of cached glyphs.
+static int findCached(GlyphCache& cache,
+                      const FontFace& face,
+                      uint16_t color,
+                      uint16_t bgColor,
+                      PlacedGlyph* placed,
+                      int& count,
+                      CachedGlyph* cached)
+{
+    bool overlaps[kMaxGlyphs] = {};
+    for (int i = 0; i < count; i++) {
+        for (int j = 0; j < i; j++) {
+            if (overlap(placed[i], placed[j])) overlaps[i] = overlaps[j] = true;
+        }
+    }
+    cache.beginDraw();
+    int decoded = 0;
+    int found   = 0;
+    for (int i = 0; i < count; i++) {
+        const GlyphImage* image =
+            cache.find(face, placed[i].index, color, bgColor);
+        if (image != nullptr) {
+            cached[found++] = {image, placed[i].x, placed[i].y, overlaps[i]};
+        } else {
+            placed[decoded++] = placed[i];
+        }
+    }
+    count = decoded;
+    return found;
+}
+
+// Copies the row of `cached` at screen row `y` into `row`, the pixels of
+// that row within `box`. Where other glyphs may have pixels, only the ink of
+// the image is copied.
+static void copyRow(const CachedGlyph& cached,
+                    int y,
+                    const Box& box,
+                    uint16_t* row)
+{
+    const GlyphImage* image = cached.image;
+    int imageRow            = y - cached.y;
+    if (imageRow < 0 || imageRow >= image->height) return;
+    int start = max(cached.x, box.x);
+    int end   = min(cached.x + image->width, box.x + box.w);
+    if (start >= end) return;
+    const uint16_t* pixels =
+        image->pixels + imageRow * image->width + (start - cached.x);
+    uint16_t* out = row + (start - box.x);
+    if (!cached.overlaps) {
+        memcpy(out, pixels, (end - start) * sizeof(uint16_t));
+        return;
+    }
+    for (int x = 0; x < end - start; x++) {
+        if (pixels[x] != image->bgColor) out[x] = pixels[x];
+    }
+}
+
+void blitText(const TextLayout& layout,
+              int left,
+              int top,
+              uint16_t color,
+              uint16_t bgColor,
+              const Box& area,
+              GlyphCache* cache)
+{
+    Box box = clipToScreen(area);
+    if (box.w <= 0) return;
+
+    PlacedGlyph placed[kMaxGlyphs];
+    int count = placeGlyphs(layout, left, top, placed);
+    // Cached glyphs are copied over the others, once these are decoded
+    CachedGlyph cached[kMaxGlyphs];
+    int cachedCount = 0;
+    if (cache != nullptr) {
+        cachedCount = findCached(
+            *cache, layout.face, color, bgColor, placed, count, cached);
+    }
+
+    const GFXgreys* greys = layout.face.greys;
+    const uint16_t* palette =
+        greys != nullptr ? greyPalette(color, bgColor, greys->bits) : nullptr;
+    uint16_t row[TFT_HEIGHT];  // TFT_HEIGHT is the width of the screen
+    uint8_t levels[TFT_HEIGHT];
+    M5.Lcd.startWrite();
+    M5.Lcd.setWindow(box.x, box.y, box.x + box.w - 1, box.y + box.h - 1);
+    for (int y = box.y; y < box.y + box.h; y++) {
+        if (greys != nullptr) {
+            blendRow(*greys, placed, count, y, box, palette, levels, row);
+        } else {
+            expandRow(placed, count, y, box, color, bgColor, row);
+        }
+        for (int g = 0; g < cachedCount; g++) copyRow(cached[g], y, box, row);
+        M5.Lcd.pushColors(row, box.w, true);
+    }
+    M5.Lcd.endWrite();
+}
+
+void drawText(TFT_eSPI& target,
+              const TextLayout& layout,
+              int left,
+              int top,
+              uint16_t color)
+{
+    PlacedGlyph placed[kMaxGlyphs];
+    int count = placeGlyphs(layout, left, top, placed);
+    target.startWrite();
+    for (int g = 0; g < count; g++) {
+        for (int y = 0; y < placed[g].glyph->height; y++) {
+            int runs            = readRow(placed[g], y);
+            const GlyphRun* run = placed[g].reader.runs();
+            for (int i = 0; i < runs; i++) {
+                target.drawFastHLine(placed[g].x + run[i].start,
+                                     placed[g].y + y,
+                                     run[i].end - run[i].start,
+                                     color);
+            }
+        }
+    }
+    target.endWrite();
+}
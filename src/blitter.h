@@ -0,0 +1,117 @@
+// Copyright 2021 Jacques Supcik <jacques@supcik.net>
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file blitter.h
+ * @author Jacques Supcik <jacques@supcik.net>
+ *
+ * @brief Text renderer streaming whole strings in one address window
+ *
+ * @date 2026-10-17
+ * @version 0.1.1
+ ***************************************************************************/
+
+#ifndef BLITTER_H_
+#define BLITTER_H_
+
+#include <Arduino.h>
+#include <M5Stack.h>
+
+#include "fonts.h"
+
+class GlyphCache;
+
+// Rectangle on the screen, in pixels. Empty if w or h is not positive.
+struct Box {
+    int x, y, w, h;
+};
+
+// Smallest box containing both `a` and `b`, ignoring empty boxes
+Box unionBox(const Box& a, const Box& b);
+
+// Part of `box` that is on the screen
+Box clipToScreen(const Box& box);
+
+// Decodes one character of UTF-8 text and advances `p` past it. Unlike
+// TFT_eSPI, which stops at U+07FF, this reads the whole of Unicode. A byte
+// that does not start a valid sequence is returned as is.
+uint32_t decodeUtf8(const uint8_t*& p);
+
+// The functions below take the fonts with their tables (see fontFace()), so
+// they also draw compressed, kerned fonts and subsets, which TFT_eSPI
+// cannot.
+
+const int kMaxGlyphs = 32;  // longer texts are truncated
+
+// Glyphs of a text and their positions, kerning applied. A text is laid out
+// once, then measured, boxed and drawn without being decoded again.
+struct TextLayout {
+    FontFace face;
+    int ascent;                   // fontAscent(face)
+    int width;                    // as TFT_eSPI measures it, plus kerning
+    int count;                    // number of glyphs
+    uint16_t glyphs[kMaxGlyphs];  // indices in the glyph table of the font
+    int16_t x[kMaxGlyphs];        // pen positions, from the left of the text
+};
+
+// Distance between the top of a text line and its baseline. Like TFT_eSPI,
+// this is the largest ascent found in the font, read from its metrics if it
+// has some.
+int fontAscent(const FontFace& face);
+
+// Lays `text` out: decodes it, finds its glyphs and kerns them. Characters
+// the font has no glyph for are skipped, as TFT_eSPI does.
+void layoutText(const FontFace& face, const char* text, TextLayout& layout);
+
+// Width of `text`, as TFT_eSPI::textWidth() measures it, plus kerning
+int textWidth(const FontFace& face, const char* text);
+
+// Ink bounding box of `layout` drawn with its left edge at `left` and the
+// top of its line at `top`, as drawString places it. Empty if nothing is
+// drawn.
+Box inkBox(const TextLayout& layout, int left, int top);
+
+const int kMaxGreyLevels = 16;  // levels of an anti-aliased font, at most
+
+// Colours of the levels of an anti-aliased font of `bits` bits per pixel,
+// from `bgColor` (level 0) to `color`. They are only computed when the
+// colours change, so that blending a pixel is a lookup, not a
+// multiplication. Valid until the next call.
+const uint16_t* greyPalette(uint16_t color, uint16_t bgColor, int bits);
+
+// Paints `area` with `bgColor` and `layout` over it, placed like inkBox()
+// does, in a single address window: the pixels are expanded row by row and
+// streamed, instead of drawing every run of pixels as a separate line. An
+// anti-aliased font is blended into `bgColor` through greyPalette(). With a
+// `cache`, the glyphs are expanded into it once and their rows copied from
+// then on.
+void blitText(const TextLayout& layout,
+              int left,
+              int top,
+              uint16_t color,
+              uint16_t bgColor,
+              const Box& area,
+              GlyphCache* cache = nullptr);
+
+// Draws `layout` with one horizontal line per run of pixels, leaving the
+// background untouched: what drawString() does, placed like inkBox(). Not
+// knowing the background, it draws an anti-aliased font as monochrome (see
+// GlyphReader).
+void drawText(TFT_eSPI& target,
+              const TextLayout& layout,
+              int left,
+              int top,
+              uint16_t color);
+
+#endif /* BLITTER_H_ */
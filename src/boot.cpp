@@ -0,0 +1,76 @@
+// Copyright 2021 Jacques Supcik <jacques@supcik.net>
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file boot.cpp
+ * @author Jacques Supcik <jacques@supcik.net>
+ *
+ * @brief Boot time profiler
+ *
+ * @date 2026-10-17
+ * @version 0.1.1
+ ***************************************************************************/
+
+#include "boot.h"
+
+#include <Arduino.h>
+
+#include "clock.h"
+
+const int kMaxBootPhases = 16;
+
+struct BootPhase {
+    const char* name;
+    unsigned long time;  // milliseconds since power on
+};
+
+static BootPhase phases[kMaxBootPhases];
+static int phaseCount = 0;
+static bool reported  = false;
+
+static bool reached(const char* phase)
+{
+    for (int i = 0; i < phaseCount; i++) {
+        if (strcmp(phases[i].name, phase) == 0) return true;
+    }
+    return false;
+}
+
+void bootMark(const char* phase)
+{
+    if (reported || phaseCount >= kMaxBootPhases || reached(phase)) return;
+    phases[phaseCount].name = phase;
+    phases[phaseCount].time = nowMs();
+    phaseCount++;
+}
+
+void printBootReport(const char* const expected[], int count)
+{
+    if (reported) return;
+    reported = true;
+    Serial.println("boot report:");
+    unsigned long previous = 0;
+    for (int i = 0; i < phaseCount; i++) {
+        Serial.printf("  %6lu ms (+%5lu ms) %s\n",
+                      phases[i].time,
+                      phases[i].time - previous,
+                      phases[i].name);
+        previous = phases[i].time;
+    }
+    for (int i = 0; i < count; i++) {
+        if (!reached(expected[i])) {
+            Serial.printf("  %-21s %s\n", "absent", expected[i]);
+        }
+    }
+}
@@ -0,0 +1,36 @@
+// Copyright 2021 Jacques Supcik <jacques@supcik.net>
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file boot.h
+ * @author Jacques Supcik <jacques@supcik.net>
+ *
+ * @brief Boot time profiler
+ *
+ * @date 2026-10-17
+ * @version 0.1.1
+ ***************************************************************************/
+
+#ifndef BOOT_H_
+#define BOOT_H_
+
+// Records the time at which a boot phase is reached. A phase that is already
+// recorded is ignored, and so is everything once the report is printed.
+void bootMark(const char* phase);
+
+// Prints the time of each boot phase on the serial port, once. The phases of
+// `expected` that were never reached are listed as absent.
+void printBootReport(const char* const expected[], int count);
+
+#endif /* BOOT_H_ */
@@ -0,0 +1,44 @@
+// Copyright 2021 Jacques Supcik <jacques@supcik.net>
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file clock.cpp
+ * @author Jacques Supcik <jacques@supcik.net>
+ *
+ * @brief Time source of the firmware
+ *
+ * @date 2026-10-17
+ * @version 0.1.1
+ ***************************************************************************/
+
+#include "clock.h"
+
+#include <Arduino.h>
+
+class ArduinoClock : public Clock {
+   public:
+    unsigned long millis() override { return ::millis(); }
+    unsigned long micros() override { return ::micros(); }
+    void sleep(unsigned long ms) override { ::delay(ms); }
+};
+
+static ArduinoClock arduinoClock;
+static Clock* activeClock = &arduinoClock;
+
+void setClock(Clock* clock)
+{
+    activeClock = (clock == nullptr) ? &arduinoClock : clock;
+}
+
+Clock& currentClock() { return *activeClock; }
@@ -0,0 +1,50 @@
+// Copyright 2021 Jacques Supcik <jacques@supcik.net>
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file clock.h
+ * @author Jacques Supcik <jacques@supcik.net>
+ *
+ * @brief Time source of the firmware
+ *
+ * @date 2026-10-17
+ * @version 0.1.1
+ ***************************************************************************/
+
+#ifndef CLOCK_H_
+#define CLOCK_H_
+
+// Source of time and sleep for the firmware. All the timing code goes
+// through it, so that a test or a benchmark can substitute a clock it
+// controls. The default clock is the Arduino one (millis() and delay()),
+// which is itself simulated in the host build.
+class Clock {
+   public:
+    virtual ~Clock() {}
+    virtual unsigned long millis() = 0;
+    virtual unsigned long micros() = 0;
+    virtual void sleep(unsigned long ms) = 0;
+};
+
+// Installs `clock`, or restores the Arduino clock if it is nullptr. The
+// clock must outlive its use.
+void setClock(Clock* clock);
+
+Clock& currentClock();
+
+inline unsigned long nowMs() { return currentClock().millis(); }
+inline unsigned long nowUs() { return currentClock().micros(); }
+inline void sleepMs(unsigned long ms) { currentClock().sleep(ms); }
+
+#endif /* CLOCK_H_ */
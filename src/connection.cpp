@@ -0,0 +1,118 @@
+// Copyright 2021 Jacques Supcik <jacques@supcik.net>
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file connection.cpp
+ * @author Jacques Supcik <jacques@supcik.net>
+ *
+ * @brief Non-blocking WiFi and MQTT connection state machine
+ *
+ * @date 2026-10-17
+ * @version 0.1.1
+ ***************************************************************************/
+
+#include "connection.h"
+
+#include <Arduino.h>
+#include <MQTT.h>
+#include <Wifi.h>
+
+#include "global.h"
+#include "screens.h"
+
+Connection::Connection(MQTTClient& client, const char* topic)
+    : client_(client),
+      topic_(topic),
+      state_(kWifiConnecting),
+      since_(0),
+      nextAttempt_(0),
+      backoff_(kMinBackoff),
+      errorReported_(false)
+{
+}
+
+void Connection::enter(ConnectionState state, unsigned long now)
+{
+    state_         = state;
+    since_         = now;
+    nextAttempt_   = now;
+    backoff_       = kMinBackoff;
+    errorReported_ = false;
+    switch (state) {
+        case kWifiConnecting:
+            Serial.println("checking wifi...");
+            break;
+        case kMqttConnecting:
+            Serial.println("connecting...");
+            break;
+        case kConnected:
+            Serial.println("connected!");
+            break;
+    }
+}
+
+void Connection::connectMqtt(unsigned long now)
+{
+    if ((long)(now - nextAttempt_) < 0) return;
+
+    if (client_.connect(("meter:" + WiFi.macAddress()).c_str())) {
+        client_.subscribe(topic_);
+        enter(kConnected, now);
+        return;
+    }
+
+    // Full backoff plus up to 50% of random jitter, so that a fleet of
+    // displays does not hammer the broker in lockstep after an outage.
+    nextAttempt_ = now + backoff_ + random(backoff_ / 2 + 1);
+    backoff_     = min(backoff_ * 2, kMaxBackoff);
+    Serial.printf("MQTT connection failed, retrying in %lu ms\n",
+                  nextAttempt_ - now);
+}
+
+void Connection::tick(unsigned long now)
+{
+    bool wifiUp = (WiFi.status() == WL_CONNECTED);
+
+    switch (state_) {
+        case kWifiConnecting:
+            if (wifiUp) {
+                enter(kMqttConnecting, now);
+                connectMqtt(now);
+            } else if (!errorReported_ && now - since_ > kConnectTimeout) {
+                // Keep the last known values on screen, marked as stale
+                if (!gHasData) displayWifiConnectionError();
+                errorReported_ = true;
+            }
+            break;
+        case kMqttConnecting:
+            if (!wifiUp) {
+                enter(kWifiConnecting, now);
+                break;
+            }
+            connectMqtt(now);
+            if (state_ == kMqttConnecting && !errorReported_ &&
+                now - since_ > kConnectTimeout) {
+                if (!gHasData) displayMqttConnectionError();
+                errorReported_ = true;
+            }
+            break;
+        case kConnected:
+            if (!wifiUp) {
+                enter(kWifiConnecting, now);
+            } else if (!client_.connected()) {
+                enter(kMqttConnecting, now);
+            }
+            break;
+    }
+}
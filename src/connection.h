@@ -0,0 +1,68 @@
+// Copyright 2021 Jacques Supcik <jacques@supcik.net>
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file connection.h
+ * @author Jacques Supcik <jacques@supcik.net>
+ *
+ * @brief Non-blocking WiFi and MQTT connection state machine
+ *
+ * @date 2026-10-17
+ * @version 0.1.1
+ ***************************************************************************/
+
+#ifndef CONNECTION_H_
+#define CONNECTION_H_
+
+#include <MQTT.h>
+
+const unsigned long kConnectTimeout = 10000;  // milliseconds
+const unsigned long kMinBackoff     = 1000;   // milliseconds
+const unsigned long kMaxBackoff     = 60000;  // milliseconds
+
+enum ConnectionState {
+    kWifiConnecting,
+    kMqttConnecting,
+    kConnected,
+};
+
+// Brings up WiFi and then MQTT, one small step per call to tick(), so that
+// the main loop keeps servicing the buttons and the display while waiting.
+// Failed MQTT connection attempts are retried with an exponential backoff
+// and some random jitter.
+class Connection {
+   public:
+    Connection(MQTTClient& client, const char* topic);
+
+    // Advances the state machine. Never waits, except for the MQTT client
+    // during a connection attempt.
+    void tick(unsigned long now);
+
+    bool connected() const { return state_ == kConnected; }
+    ConnectionState state() const { return state_; }
+
+   private:
+    void enter(ConnectionState state, unsigned long now);
+    void connectMqtt(unsigned long now);
+
+    MQTTClient& client_;
+    const char* topic_;
+    ConnectionState state_;
+    unsigned long since_;        // time of the last state change
+    unsigned long nextAttempt_;  // time of the next MQTT connection attempt
+    unsigned long backoff_;      // current delay between MQTT attempts
+    bool errorReported_;
+};
+
+#endif /* CONNECTION_H_ */
@@ -0,0 +1,117 @@
+// Copyright 2021 Jacques Supcik <jacques@supcik.net>
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file fontdata.h
+ * @author Jacques Supcik <jacques@supcik.net>
+ *
+ * @brief Extended font tables emitted by fonts/fontconvert
+ *
+ * @date 2026-10-17
+ * @version 0.1.1
+ ***************************************************************************/
+
+#ifndef FONTDATA_H_
+#define FONTDATA_H_
+
+#include <Arduino.h>
+
+// Glyph bitmaps as horizontal runs of set pixels (`fontconvert -s`). Each
+// row of a glyph is a count byte followed by that many (skip, length) pairs:
+// `skip` clear pixels, from the left of the glyph or the end of the previous
+// run, then `length` set pixels. Rows follow each other, so a renderer reads
+// them top down.
+struct GFXspans {
+    const uint8_t* data;      // rows of all the glyphs, concatenated
+    const uint32_t* offsets;  // start of each glyph in `data`
+};
+
+// Glyph bitmaps compressed row by row (`fontconvert -z`). The font's
+// `bitmap` points to the same data and `bitmapOffset` is the start of each
+// glyph in it. Every row, or group of identical rows, starts with a code:
+//   0x00-0x7F  the number of runs of the row, each given as one byte
+//              `skip << 4 | (length - 1)` if skip < 15 and length <= 16, or
+//              as 0xF0 followed by a skip byte and a length byte
+//   0x80-0xBF  the previous row, repeated (code & 0x3F) + 1 times
+//   0xC0       as many runs as the previous row, each given as one byte
+//              `(dStart + 8) << 4 | (dEnd + 8)`: how far its start and end
+//              moved, from -8 to 7 pixels
+// Skips and lengths are as in GFXspans. A decoder only needs the previous
+// row, never the whole glyph.
+struct GFXpacked {
+    const uint8_t* data;  // rows of all the glyphs, concatenated
+    uint8_t maxRuns;      // most runs in a row of any glyph
+};
+
+// Anti-aliased glyph bitmaps (`fontconvert -a`). The font's `bitmap` points
+// to the same data and `bitmapOffset` is the start of each glyph in it.
+// Every pixel is a level of `bits` bits, from 0 (background) to all ones
+// (text colour), the leftmost pixel of a byte in its high bits. Every row
+// starts on a byte, so a renderer finds any row without decoding the ones
+// above.
+struct GFXgreys {
+    const uint8_t* data;  // rows of all the glyphs, concatenated
+    uint8_t bits;         // 2 or 4
+};
+
+// Consecutive code points with consecutive glyphs in a sparse font
+struct GFXrange {
+    uint32_t first;  // first code point
+    uint16_t count;  // number of code points
+    uint16_t glyph;  // index of the glyph of `first`
+};
+
+// Code point index of a font converted with only some of its glyphs
+// (`fontconvert -c` or `-r`), from anywhere in Unicode. Its glyph table
+// holds the glyphs of the ranges, in the same order, followed by the font's
+// missing glyph, drawn in place of any other character. The font's `first`
+// and `last` are glyph indices (0 and the missing glyph), so that TFT_eSPI
+// stays within the table when it scans it; TFT_eSPI cannot draw or measure
+// such fonts.
+struct GFXsubset {
+    const GFXrange* ranges;  // sorted, not overlapping
+    uint16_t count;          // number of ranges
+    uint16_t fallback;       // index of the missing glyph
+    uint8_t ascent;          // ascent of the full font (TFT_eSPI metric)
+};
+
+// Kerning pair of a font (`fontconvert -k`)
+struct GFXkernPair {
+    uint16_t left;   // glyph index of the first character
+    uint16_t right;  // glyph index of the character following it
+    int8_t dx;       // added to the advance of `left`, in pixels
+};
+
+// Kerning pairs of the glyphs of a font, from its GPOS table. Pairs that
+// round to no adjustment at the font's size are left out.
+struct GFXkerning {
+    const GFXkernPair* pairs;  // sorted by left, then right glyph index
+    uint16_t count;
+};
+
+// Metrics of a font (`fontconvert -m`). They come in a header of their own,
+// as constant expressions: layout code includes it, without the glyphs, and
+// measures literals at compile time (see metrics.h).
+struct GFXmetrics {
+    uint16_t first, last;     // code points of the tables
+    const uint8_t* advances;  // xAdvance of each glyph
+    const int8_t* inkRights;  // xOffset + width of each glyph
+    uint8_t yAdvance;         // line height, as fontHeight() returns it
+    uint8_t ascent;           // largest ascent, as TFT_eSPI finds it
+    uint8_t descent;          // largest descent, likewise
+    uint8_t digitAdvance;     // largest advance of the digits
+    bool tabularDigits;       // whether all the digits have that advance
+};
+
+#endif /* FONTDATA_H_ */
@@ -0,0 +1,223 @@
+// Copyright 2021 Jacques Supcik <jacques@supcik.net>
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file fontpack.cpp
+ * @author Jacques Supcik <jacques@supcik.net>
+ *
+ * @brief Fonts loaded at run time from a font pack
+ *
+ * @date 2026-10-17
+ * @version 0.1.1
+ ***************************************************************************/
+
+#include "fontpack.h"
+
+#include <Arduino.h>
+#include <M5Stack.h>
+#include <esp_partition.h>
+#include <stddef.h>
+#include <string.h>
+
+// The tables are used in place: the structures must have the layout
+// fontconvert writes
+static_assert(sizeof(FontPackHeader) == 28, "FontPackHeader layout");
+static_assert(sizeof(FontPackFont) == 92, "FontPackFont layout");
+static_assert(sizeof(GFXglyph) == 12, "GFXglyph layout of TFT_eSPI");
+static_assert(sizeof(GFXrange) == 8, "GFXrange layout");
+static_assert(sizeof(GFXkernPair) == 6, "GFXkernPair layout");
+
+static const char kFontPartitionLabel[] = "fonts";
+
+static PackFont gPackFonts[kMaxPackFonts];
+static int gPackFontCount = 0;
+
+// Whether a table of `bytes` bytes at `offset` is within a font of `size`
+// bytes, after its header
+static bool tableFits(uint32_t offset, uint32_t bytes, uint32_t size)
+{
+    return offset % 4 == 0 && offset >= sizeof(FontPackFont) &&
+           offset <= size && bytes <= size - offset;
+}
+
+// Loads the font at `data`, at most `size` bytes long, into `font`. Returns
+// false if it is invalid.
+static bool loadFont(const uint8_t* data, uint32_t size, PackFont& font)
+{
+    FontPackFont header;
+    if (size < sizeof(header)) return false;
+    memcpy(&header, data, sizeof(header));
+    if (header.magic != kFontPackFontMagic || header.size > size ||
+        header.size % 4 != 0 ||
+        memchr(header.name, 0, kFontPackNameSize) == nullptr) {
+        return false;
+    }
+    size = header.size;
+    if (header.last < header.first ||
+        header.glyphCount != header.last - header.first + 1 ||
+        !tableFits(header.glyphs, header.glyphCount * sizeof(GFXglyph), size)) {
+        return false;
+    }
+
+    // The bitmaps, raw or compressed, and the optional tables
+    bool compressed = header.packed != 0;
+    bool greys      = header.greyBits != 0;
+    uint32_t bitmap = compressed ? header.packed : header.bitmap;
+    if ((header.bitmap != 0 && compressed) || (greys && compressed) ||
+        (greys && header.greyBits != 2 && header.greyBits != 4) ||
+        !tableFits(bitmap, header.bitmapSize, size)) {
+        return false;
+    }
+    bool withSpans = header.spans != 0;
+    if (withSpans != (header.spanOffsets != 0)) return false;
+    if (withSpans &&
+        (!tableFits(header.spans, header.spansSize, size) ||
+         !tableFits(header.spanOffsets, header.glyphCount * 4, size))) {
+        return false;
+    }
+    bool withSubset = header.ranges != 0;
+    if (withSubset &&
+        (header.rangeCount == 0 || header.fallback >= header.glyphCount ||
+         !tableFits(header.ranges, header.rangeCount * sizeof(GFXrange),
+                    size))) {
+        return false;
+    }
+    bool withKerning = header.kernPairs != 0;
+    if (withKerning &&
+        !tableFits(header.kernPairs,
+                   header.kernCount * sizeof(GFXkernPair),
+                   size)) {
+        return false;
+    }
+
+    // Every glyph and pair must be within the tables
+    const GFXglyph* glyphs =
+        reinterpret_cast<const GFXglyph*>(data + header.glyphs);
+    const uint32_t* spanOffsets =
+        reinterpret_cast<const uint32_t*>(data + header.spanOffsets);
+    for (int i = 0; i < header.glyphCount; i++) {
+        const GFXglyph& glyph = glyphs[i];
+        uint32_t end          = glyph.bitmapOffset;
+        if (greys) {
+            end += glyph.height * ((glyph.width * header.greyBits + 7) / 8);
+        } else if (!compressed) {
+            end += (glyph.width * glyph.height + 7) / 8;
+        }
+        if (end > header.bitmapSize) return false;
+        if (withSpans && spanOffsets[i] > header.spansSize) return false;
+    }
+    const GFXrange* ranges =
+        reinterpret_cast<const GFXrange*>(data + header.ranges);
+    for (int i = 0; withSubset && i < header.rangeCount; i++) {
+        if (ranges[i].glyph + ranges[i].count > header.glyphCount) {
+            return false;
+        }
+    }
+    const GFXkernPair* pairs =
+        reinterpret_cast<const GFXkernPair*>(data + header.kernPairs);
+    for (int i = 0; withKerning && i < header.kernCount; i++) {
+        if (pairs[i].left >= header.glyphCount ||
+            pairs[i].right >= header.glyphCount) {
+            return false;
+        }
+    }
+
+    // GFXfont is not const-correct, the compiled fonts are cast likewise
+    font.name = reinterpret_cast<const char*>(data) +
+                offsetof(FontPackFont, name);
+    font.font = {const_cast<uint8_t*>(data + bitmap),
+                 const_cast<GFXglyph*>(glyphs),
+                 header.first,
+                 header.last,
+                 header.yAdvance};
+    font.spans   = {data + header.spans, spanOffsets};
+    font.packed  = {data + header.packed, header.maxRuns};
+    font.greys   = {data + bitmap, header.greyBits};
+    font.subset  = {ranges, header.rangeCount, header.fallback, header.ascent};
+    font.kerning = {pairs, header.kernCount};
+    font.face    = {&font.font,
+                    withSpans ? &font.spans : nullptr,
+                    compressed ? &font.packed : nullptr,
+                    greys ? &font.greys : nullptr,
+                    withSubset ? &font.subset : nullptr,
+                    withKerning ? &font.kerning : nullptr,
+                    nullptr};
+    return true;
+}
+
+int loadFontPack(const uint8_t* data, size_t size)
+{
+    gPackFontCount = 0;
+    FontPackHeader header;
+    if (reinterpret_cast<uintptr_t>(data) % 4 != 0 || size < sizeof(header)) {
+        return -1;
+    }
+    memcpy(&header, data, sizeof(header));
+    if (header.magic != kFontPackMagic || header.version != kFontPackVersion ||
+        header.size > size || header.count > kMaxPackFonts) {
+        return -1;
+    }
+    uint32_t offset = sizeof(header);
+    for (int i = 0; i < header.count; i++) {
+        if (offset >= header.size ||
+            !loadFont(data + offset, header.size - offset, gPackFonts[i])) {
+            return -1;
+        }
+        offset += reinterpret_cast<const FontPackFont*>(data + offset)->size;
+    }
+    gPackFontCount = header.count;
+    return gPackFontCount;
+}
+
+int loadFontPartition()
+{
+    const esp_partition_t* partition =
+        esp_partition_find_first(ESP_PARTITION_TYPE_DATA,
+                                 ESP_PARTITION_SUBTYPE_ANY,
+                                 kFontPartitionLabel);
+    if (partition == nullptr) return -1;
+    // Only the pages of the pack are mapped, not the whole partition
+    FontPackHeader header;
+    if (esp_partition_read(partition, 0, &header, sizeof(header)) != ESP_OK ||
+        header.magic != kFontPackMagic || header.size > partition->size) {
+        return -1;
+    }
+    const void* data;
+    spi_flash_mmap_handle_t handle;
+    if (esp_partition_mmap(partition,
+                           0,
+                           header.size,
+                           SPI_FLASH_MMAP_DATA,
+                           &data,
+                           &handle) != ESP_OK) {
+        return -1;
+    }
+    // The fonts point into the mapping: it stays for good once they are
+    // loaded
+    int count = loadFontPack(static_cast<const uint8_t*>(data), header.size);
+    if (count < 0) spi_flash_munmap(handle);
+    return count;
+}
+
+int packFontCount() { return gPackFontCount; }
+
+const PackFont& packFont(int index) { return gPackFonts[index]; }
+
+const FontFace* packFace(const char* name)
+{
+    for (int i = 0; i < gPackFontCount; i++) {
+        if (strcmp(gPackFonts[i].name, name) == 0) return &gPackFonts[i].face;
+    }
+    return nullptr;
+}
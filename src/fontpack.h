@@ -0,0 +1,123 @@
+// Copyright 2021 Jacques Supcik <jacques@supcik.net>
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file fontpack.h
+ * @author Jacques Supcik <jacques@supcik.net>
+ *
+ * @brief Fonts loaded at run time from a font pack
+ *
+ * @date 2026-10-17
+ * @version 0.1.1
+ ***************************************************************************/
+
+#ifndef FONTPACK_H_
+#define FONTPACK_H_
+
+#include <Arduino.h>
+#include <M5Stack.h>
+
+#include "fontdata.h"
+#include "fonts.h"
+
+// A font pack holds fonts converted by `fontconvert -b` and put together by
+// fonts/build.py. It is flashed into a data partition of its own and mapped
+// into the address space, so the glyphs are read from flash where they are,
+// and fonts change without a new firmware.
+//
+// A pack is a FontPackHeader followed by the fonts, each a FontPackFont
+// followed by its tables. Integers are little-endian, as on the ESP32, and
+// the tables have the layout of the structures of fontdata.h on it: they are
+// used in place. Glyphs are the GFXglyph of TFT_eSPI, whose bitmapOffset is
+// 32 bits wide (12 bytes a glyph), not the 16 bits of Adafruit_GFX; version
+// 1 packs had the latter.
+
+const uint32_t kFontPackMagic     = 0x50584647;  // "GFXP"
+const uint32_t kFontPackFontMagic = 0x46584647;  // "GFXF"
+const uint16_t kFontPackVersion   = 2;
+
+struct FontPackHeader {
+    uint32_t magic;    // kFontPackMagic
+    uint16_t version;  // kFontPackVersion
+    uint16_t count;    // number of fonts
+    uint32_t size;     // bytes of the pack, this header included
+    char id[16];       // digest of the inputs of the pack, not terminated
+};
+
+const int kFontPackNameSize = 32;
+
+// A font of a pack. Its tables start at the given offsets from the start of
+// this header, a multiple of 4, or 0 if the font has no such table.
+struct FontPackFont {
+    uint32_t magic;                // kFontPackFontMagic
+    uint32_t size;                 // bytes of the font, this header included
+    char name[kFontPackNameSize];  // as fontconvert names it, terminated
+    uint16_t first, last;          // as GFXfont
+    uint16_t glyphCount;           // last - first + 1
+    uint16_t rangeCount;           // as GFXsubset::count
+    uint16_t fallback;             // as GFXsubset
+    uint16_t kernCount;            // as GFXkerning::count
+    uint8_t yAdvance;              // as GFXfont
+    uint8_t maxRuns;               // as GFXpacked
+    uint8_t ascent;                // as GFXsubset
+    uint8_t greyBits;              // GFXgreys::bits, if `bitmap` has greys
+    uint32_t glyphs;       // GFXglyph[glyphCount]
+    uint32_t bitmap;       // GFXfont::bitmap, unless compressed
+    uint32_t packed;       // GFXpacked::data, if compressed
+    uint32_t bitmapSize;   // bytes of `bitmap` or `packed`
+    uint32_t spans;        // GFXspans::data
+    uint32_t spanOffsets;  // GFXspans::offsets, uint32_t[glyphCount]
+    uint32_t spansSize;    // bytes of `spans`
+    uint32_t ranges;       // GFXrange[rangeCount], for a subset
+    uint32_t kernPairs;    // GFXkernPair[kernCount]
+};
+
+const int kMaxPackFonts = 8;  // fonts of a pack loaded, at most
+
+// A font of the loaded pack. The structures are in RAM, the tables they
+// point to in the pack.
+struct PackFont {
+    const char* name;
+    GFXfont font;
+    GFXspans spans;
+    GFXpacked packed;
+    GFXgreys greys;
+    GFXsubset subset;
+    GFXkerning kerning;
+    FontFace face;  // the font and its tables above, without metrics
+};
+
+// Loads the pack at `data`, which must stay mapped as long as its fonts are
+// used, replacing the pack loaded before. The structure of the pack and the
+// bounds of its tables are checked, not the glyph rows themselves. Returns
+// the number of fonts loaded, or -1 if the pack is invalid or has more than
+// kMaxPackFonts fonts: no fonts are loaded then.
+int loadFontPack(const uint8_t* data, size_t size);
+
+// Maps the "fonts" data partition and loads the pack it holds. Returns the
+// number of fonts loaded, or -1 if there is no partition or no valid pack in
+// it, as when the partition was never flashed.
+int loadFontPartition();
+
+// Number of fonts of the loaded pack
+int packFontCount();
+
+// Font `index` of the loaded pack
+const PackFont& packFont(int index);
+
+// Face of the font of the loaded pack named `name`, or nullptr if the pack
+// has no such font
+const FontFace* packFace(const char* name);
+
+#endif /* FONTPACK_H_ */
@@ -0,0 +1,196 @@
+// Copyright 2021 Jacques Supcik <jacques@supcik.net>
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file fonts.cpp
+ * @author Jacques Supcik <jacques@supcik.net>
+ *
+ * @brief Font registry
+ *
+ * @date 2026-10-17
+ * @version 0.1.1
+ ***************************************************************************/
+
+// fonts.h must come first: its extern declarations give the font structures
+// below external linkage.
+#include "fonts.h"
+
+#include "IBMPlexMonoRegular9pt8b.h"
+#include "IBMPlexSansBold18pt8b.h"
+#include "IBMPlexSansRegular18pt8b.h"
+#include "IBMPlexSansRegular24pt8b.h"
+#include "IBMPlexSansSemiBold32pt8b.h"
+#include "IBMPlexSansSemiBold40pt8b.h"
+#include "fontpack.h"
+#include "metrics.h"
+
+struct FontEntry {
+    const char* name;
+    FontFamily family;
+    uint8_t size;
+    FontFace face;
+};
+
+// Only the fonts listed here are linked into the firmware. The fonts drawn
+// by the blitter come with spans (the timestamp) or compressed (the values,
+// for which compression pays off). The values only need a few characters,
+// and are kerned: the timestamp font is monospaced. All come with their
+// metrics, which give their ascent without scanning the glyphs: this is the
+// one run-time use of the metrics (see metrics.h).
+static const FontEntry kFonts[] = {
+    {"IBMPlexMono_Regular9pt8b",
+     kMonoRegular,
+     9,
+     {&IBMPlexMono_Regular9pt8b,
+      &IBMPlexMono_Regular9pt8bSpans,
+      nullptr,
+      nullptr,
+      nullptr,
+      nullptr,
+      &IBMPlexMono_Regular9pt8bMetrics}},
+    {"IBMPlexSans_Bold18pt8b",
+     kSansBold,
+     18,
+     {&IBMPlexSans_Bold18pt8b,
+      nullptr,
+      nullptr,
+      nullptr,
+      nullptr,
+      nullptr,
+      &IBMPlexSans_Bold18pt8bMetrics}},
+    {"IBMPlexSans_Regular18pt8b",
+     kSansRegular,
+     18,
+     {&IBMPlexSans_Regular18pt8b,
+      nullptr,
+      nullptr,
+      nullptr,
+      nullptr,
+      nullptr,
+      &IBMPlexSans_Regular18pt8bMetrics}},
+    {"IBMPlexSans_Regular24pt8b",
+     kSansRegular,
+     24,
+     {&IBMPlexSans_Regular24pt8b,
+      nullptr,
+      nullptr,
+      nullptr,
+      nullptr,
+      nullptr,
+      &IBMPlexSans_Regular24pt8bMetrics}},
+    {"IBMPlexSans_SemiBold32pt8b",
+     kSansSemiBold,
+     32,
+     {&IBMPlexSans_SemiBold32pt8b,
+      nullptr,
+      &IBMPlexSans_SemiBold32pt8bPacked,
+      nullptr,
+      &IBMPlexSans_SemiBold32pt8bSubset,
+      &IBMPlexSans_SemiBold32pt8bKerning,
+      &IBMPlexSans_SemiBold32pt8bMetrics}},
+    {"IBMPlexSans_SemiBold40pt8b",
+     kSansSemiBold,
+     40,
+     {&IBMPlexSans_SemiBold40pt8b,
+      nullptr,
+      &IBMPlexSans_SemiBold40pt8bPacked,
+      nullptr,
+      &IBMPlexSans_SemiBold40pt8bSubset,
+      &IBMPlexSans_SemiBold40pt8bKerning,
+      &IBMPlexSans_SemiBold40pt8bMetrics}},
+};
+
+const GFXfont* findFont(FontFamily family, int size)
+{
+    for (const FontEntry& entry : kFonts) {
+        if (entry.family == family && entry.size == size) {
+            return entry.face.font;
+        }
+    }
+    return nullptr;
+}
+
+const GFXfont* findFont(const char* name)
+{
+    for (const FontEntry& entry : kFonts) {
+        if (strcmp(entry.name, name) == 0) return entry.face.font;
+    }
+    return nullptr;
+}
+
+FontFace fontFace(const GFXfont* font)
+{
+    for (const FontEntry& entry : kFonts) {
+        if (entry.face.font != font) continue;
+        const FontFace* loaded = packFace(entry.name);
+        return loaded != nullptr ? *loaded : entry.face;
+    }
+    for (int i = 0; i < packFontCount(); i++) {
+        if (&packFont(i).font == font) return packFont(i).face;
+    }
+    return {font, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr};
+}
+
+FontFace builtinFace(const GFXfont* font)
+{
+    for (const FontEntry& entry : kFonts) {
+        if (entry.face.font == font) return entry.face;
+    }
+    return {font, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr};
+}
+
+int glyphIndex(const FontFace& face, uint32_t c)
+{
+    const GFXsubset* subset = face.subset;
+    if (subset == nullptr) {
+        if (c < face.font->first || c > face.font->last) return -1;
+        return c - face.font->first;
+    }
+    // Last range starting at or before `c`
+    int low  = 0;
+    int high = subset->count;
+    while (low < high) {
+        int middle = (low + high) / 2;
+        if (subset->ranges[middle].first <= c) {
+            low = middle + 1;
+        } else {
+            high = middle;
+        }
+    }
+    if (low == 0) return subset->fallback;
+    const GFXrange& range = subset->ranges[low - 1];
+    if (c - range.first >= range.count) return subset->fallback;
+    return range.glyph + (c - range.first);
+}
+
+int kerning(const FontFace& face, int left, int right)
+{
+    const GFXkerning* kerning = face.kerning;
+    if (kerning == nullptr) return 0;
+    uint32_t key = left << 16 | right;
+    int low      = 0;
+    int high     = kerning->count;
+    while (low < high) {
+        int middle              = (low + high) / 2;
+        const GFXkernPair& pair = kerning->pairs[middle];
+        uint32_t pairKey        = pair.left << 16 | pair.right;
+        if (pairKey == key) return pair.dx;
+        if (pairKey < key) {
+            low = middle + 1;
+        } else {
+            high = middle;
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,91 @@
+// Copyright 2021 Jacques Supcik <jacques@supcik.net>
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file fonts.h
+ * @author Jacques Supcik <jacques@supcik.net>
+ *
+ * @brief Font registry
+ *
+ * @date 2026-10-17
+ * @version 0.1.1
+ ***************************************************************************/
+
+#ifndef FONTS_H_
+#define FONTS_H_
+
+#include <Arduino.h>
+#include <M5Stack.h>
+
+#include "fontdata.h"
+
+// The font data is defined once, in fonts.cpp. Include this header rather
+// than the generated headers in include/: their arrays are `const` and would
+// be duplicated in every translation unit including them.
+//
+// The value fonts (SemiBold 32 and 40) are compressed and kerned subsets,
+// made of the characters fonts/charset.py finds: TFT_eSPI can neither draw
+// nor measure them, see blitter.h.
+extern const GFXfont IBMPlexMono_Regular9pt8b;
+extern const GFXfont IBMPlexSans_Bold18pt8b;
+extern const GFXfont IBMPlexSans_Regular18pt8b;
+extern const GFXfont IBMPlexSans_Regular24pt8b;
+extern const GFXfont IBMPlexSans_SemiBold32pt8b;
+extern const GFXfont IBMPlexSans_SemiBold40pt8b;
+
+enum FontFamily {
+    kSansRegular,
+    kSansSemiBold,
+    kSansBold,
+    kMonoRegular,
+};
+
+// A font with the optional tables fontconvert emitted for it
+struct FontFace {
+    const GFXfont* font;
+    const GFXspans* spans;      // nullptr unless converted with -s
+    const GFXpacked* packed;    // nullptr unless converted with -z
+    const GFXgreys* greys;      // nullptr unless converted with -a
+    const GFXsubset* subset;    // nullptr unless converted with -c or -r
+    const GFXkerning* kerning;  // nullptr unless converted with -k
+    const GFXmetrics* metrics;  // nullptr if fontconvert -m was not run
+};
+
+// Returns the font of the given family and size (in points), or nullptr if
+// it is not part of the firmware.
+const GFXfont* findFont(FontFamily family, int size);
+
+// Returns the font of the registry named `name`, as fontconvert names it
+// (e.g. "IBMPlexSans_SemiBold40pt8b"), or nullptr if there is none.
+const GFXfont* findFont(const char* name);
+
+// Returns the tables of `font`. A font of the registry is replaced by the
+// font of the same name of the font pack, if one is loaded (see fontpack.h),
+// so that the fonts drawn with their tables are read from the pack. A font
+// missing from the registry only has its bitmap.
+FontFace fontFace(const GFXfont* font);
+
+// Returns the tables of `font` as compiled into the firmware, whatever the
+// font pack holds.
+FontFace builtinFace(const GFXfont* font);
+
+// Returns the index of the glyph of code point `c` in the glyph table of
+// `face`, or -1 if it has none. Subsets return their missing glyph instead.
+int glyphIndex(const FontFace& face, uint32_t c);
+
+// Returns the kerning of the glyphs `left` and `right` (indices in the glyph
+// table of `face`), in pixels, or 0 if the pair is not kerned.
+int kerning(const FontFace& face, int left, int right);
+
+#endif /* FONTS_H_ */
@@ -27,7 +27,18 @@
 #include <Arduino.h>
 #include <M5Stack.h>
 
+#include "fonts.h"
+
 void NewLine(int& pos, float k) { pos += M5.Lcd.fontHeight() * k; }
 
+void NewLine(int& pos, const GFXfont& font, float k)
+{
+    pos += fontFace(&font).font->yAdvance * k;
+}
+
 data gData;
-int gScreenNo = 0;
+bool gHasData     = false;
+bool gHasLiveData = false;
+bool gStale       = true;
+int gScreenNo                = 0;
+RenderBackend gRenderBackend = RENDER_BACKEND;
@@ -28,23 +28,55 @@
 #include <Arduino.h>
 #include <M5Stack.h>
 
+#include "fontdata.h"
+
 const int kCenterX       = TFT_HEIGHT / 2;  // Note : TFT_HEIGHT is the width
 const int kMaxBrightness = 255;
 const int kDimBrightness = 1;
 const int kScreenTimeout = 10000;  // milliseconds
+const int kLoopPeriod    = 10;     // milliseconds slept by each loop()
 const String kVersion    = "0.1.1";
+const int kTimestampSize = 32;  // including the terminating null character
+
+// POSIX time zone of the meters (Central European Time). The timestamps of
+// the binary payloads are shown in this zone, as the text payloads are.
+const char* const kTimeZone = "CET-1CEST,M3.5.0,M10.5.0/3";
 
 struct data {
-    String timestamp;
+    char timestamp[kTimestampSize];
     float consumption;
     float temp;
     float electricityConsumption;
     float electricityProduction;
 };
 
+// How the value screens are drawn
+enum RenderBackend {
+    kRenderDirect,  // straight to the LCD
+    kRenderSprite,  // composed off-screen, then pushed in one transfer
+    kRenderBlit,    // expanded row by row into one address window
+};
+
+const char* const kRenderBackendNames[] = {"direct", "sprite", "blit"};
+
+#ifndef RENDER_BACKEND
+#define RENDER_BACKEND kRenderBlit
+#endif
+
 extern data gData;
+extern bool gHasData;      // gData holds values received from the broker
+extern bool gHasLiveData;  // gData was updated since the boot, not restored
+extern bool gStale;        // gData is not kept up to date (no connection, or
+                           // no message since the boot)
 extern int gScreenNo;
+extern RenderBackend gRenderBackend;
 
+// Moves `pos` down by `k` lines of the font selected on the LCD
 void NewLine(int& pos, float k = 0.9);
 
+// Moves `pos` down by `k` lines of `font`, which need not be selected:
+// selecting a font makes TFT_eSPI scan all its glyphs. The line height is
+// the one of the font pack, if it has the font (see fontFace()).
+void NewLine(int& pos, const GFXfont& font, float k = 0.9);
+
 #endif /* GLOBAL_H_ */
@@ -0,0 +1,267 @@
+// Copyright 2021 Jacques Supcik <jacques@supcik.net>
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file glyphcache.cpp
+ * @author Jacques Supcik <jacques@supcik.net>
+ *
+ * @brief Glyphs expanded into RGB565 pixels, kept in RAM
+ *
+ * @date 2026-10-17
+ * @version 0.1.1
+ ***************************************************************************/
+
+#include "glyphcache.h"
+
+#include <Arduino.h>
+#include <M5Stack.h>
+#include <stdlib.h>
+
+#include <new>
+
+#include "blitter.h"
+#include "glyphs.h"
+
+GlyphCache gGlyphCache(GLYPH_CACHE_BUDGET);
+
+// Bytes taken by an image of `width` by `height` pixels, header included
+static size_t imageBytes(int width, int height)
+{
+    return sizeof(GlyphImage) + width * height * sizeof(uint16_t);
+}
+
+// Allocates an image of `size` bytes in PSRAM, if the board has some and it
+// is not full, or else with operator new, as the rest of the firmware does
+// (the host simulator tracks it). Returns nullptr if neither has room.
+static GlyphImage* allocate(size_t size)
+{
+#ifdef BOARD_HAS_PSRAM
+    if (psramFound()) {
+        GlyphImage* image = static_cast<GlyphImage*>(ps_malloc(size));
+        if (image != nullptr) {
+            image->psram = true;
+            return image;
+        }
+    }
+#endif
+    GlyphImage* image =
+        static_cast<GlyphImage*>(::operator new(size, std::nothrow));
+    if (image != nullptr) image->psram = false;
+    return image;
+}
+
+static void release(GlyphImage* image)
+{
+    if (image->psram) {
+        free(image);
+    } else {
+        ::operator delete(image);
+    }
+}
+
+// Whether the block of `image` may take an image of `bytes` bytes: at most
+// half as large again, so that little of the budget goes unused
+static bool fits(const GlyphImage* image, size_t bytes)
+{
+    return image->capacity >= bytes && image->capacity <= bytes + bytes / 2;
+}
+
+// Expands the rows of a glyph, read as runs, into `image`
+static void expandRuns(const FontFace& face, int index, GlyphImage* image)
+{
+    uint16_t* pixels = image->pixels;
+    for (int i = 0; i < image->width * image->height; i++) {
+        pixels[i] = image->bgColor;
+    }
+    GlyphReader reader;
+    reader.begin(face, index);
+    for (int y = 0; y < image->height; y++, pixels += image->width) {
+        int runs            = reader.next();
+        const GlyphRun* run = reader.runs();
+        for (int i = 0; i < runs; i++) {
+            int end = min((int)run[i].end, (int)image->width);
+            for (int x = run[i].start; x < end; x++) pixels[x] = image->color;
+        }
+    }
+}
+
+// Expands the grey levels of an anti-aliased glyph into `image`, blended
+// like blitText() does
+static void expandGreys(const GFXgreys& greys,
+                        const GFXglyph* glyph,
+                        GlyphImage* image)
+{
+    const uint16_t* palette =
+        greyPalette(image->color, image->bgColor, greys.bits);
+    int bits           = greys.bits;
+    int mask           = (1 << bits) - 1;
+    int stride         = (glyph->width * bits + 7) / 8;
+    const uint8_t* row = greys.data + glyph->bitmapOffset;
+    uint16_t* pixels   = image->pixels;
+    for (int y = 0; y < glyph->height; y++, row += stride) {
+        for (int x = 0; x < glyph->width; x++) {
+            int bit   = x * bits;
+            int level = row[bit >> 3] >> (8 - bits - (bit & 7)) & mask;
+            *pixels++ = palette[level];
+        }
+    }
+}
+
+GlyphCache::GlyphCache(size_t budget)
+    : budget_(budget),
+      bytes_(0),
+      size_(0),
+      draw_(0),
+      hits_(0),
+      misses_(0),
+      reused_(0),
+      newest_(nullptr),
+      oldest_(nullptr)
+{
+}
+
+GlyphCache::~GlyphCache() { clear(); }
+
+const GlyphImage* GlyphCache::find(const FontFace& face,
+                                   int index,
+                                   uint16_t color,
+                                   uint16_t bgColor)
+{
+    if (budget_ == 0) return nullptr;
+    // The most recently used images are found first
+    for (GlyphImage* image = newest_; image != nullptr; image = image->older) {
+        if (image->font == face.font && image->index == index &&
+            image->color == color && image->bgColor == bgColor) {
+            hits_++;
+            image->draw = draw_;
+            if (image != newest_) {
+                unlink(image);
+                pushNewest(image);
+            }
+            return image;
+        }
+    }
+    misses_++;
+    GlyphImage* image = expand(face, index, color, bgColor);
+    if (image != nullptr) pushNewest(image);
+    return image;
+}
+
+GlyphImage* GlyphCache::expand(const FontFace& face,
+                               int index,
+                               uint16_t color,
+                               uint16_t bgColor)
+{
+    const GFXglyph* glyph = &face.font->glyph[index];
+    size_t bytes          = imageBytes(glyph->width, glyph->height);
+    GlyphImage* image     = nullptr;
+    if (!makeRoom(bytes, image)) return nullptr;
+    if (image != nullptr) {
+        reused_++;
+    } else {
+        image = allocate(bytes);
+        if (image == nullptr) return nullptr;
+        image->capacity = bytes;
+    }
+    image->font    = face.font;
+    image->index   = index;
+    image->color   = color;
+    image->bgColor = bgColor;
+    image->width   = glyph->width;
+    image->height  = glyph->height;
+    image->draw    = draw_;
+    image->pixels  = reinterpret_cast<uint16_t*>(image + 1);
+    if (face.greys != nullptr) {
+        expandGreys(*face.greys, glyph, image);
+    } else {
+        expandRuns(face, index, image);
+    }
+    bytes_ += image->capacity;
+    size_++;
+    return image;
+}
+
+// Makes room for `bytes` more within the budget, evicting the least
+// recently used images but those of the current draw. Returns false if they
+// do not fit. Once the budget is reached, the least recently used block that
+// fits() is not freed but handed back in `reuse`, out of the cache: the new
+// image takes it, with its capacity, and nothing else needs evicting.
+bool GlyphCache::makeRoom(size_t bytes, GlyphImage*& reuse)
+{
+    reuse = nullptr;
+    if (bytes > budget_) return false;
+    if (bytes_ + bytes <= budget_) return true;
+    for (GlyphImage* image = oldest_; image != nullptr; image = image->newer) {
+        if (image->draw != draw_ && fits(image, bytes)) {
+            detach(image);
+            reuse = image;
+            return true;
+        }
+    }
+    GlyphImage* image = oldest_;
+    while (image != nullptr && bytes_ + bytes > budget_) {
+        GlyphImage* newer = image->newer;
+        if (image->draw != draw_) evict(image);
+        image = newer;
+    }
+    return bytes_ + bytes <= budget_;
+}
+
+void GlyphCache::setBudget(size_t budget)
+{
+    budget_ = budget;
+    while (oldest_ != nullptr && bytes_ > budget_) evict(oldest_);
+}
+
+void GlyphCache::clear()
+{
+    while (oldest_ != nullptr) evict(oldest_);
+}
+
+// Takes `image` out of the cache without freeing it
+void GlyphCache::detach(GlyphImage* image)
+{
+    unlink(image);
+    bytes_ -= image->capacity;
+    size_--;
+}
+
+void GlyphCache::evict(GlyphImage* image)
+{
+    detach(image);
+    release(image);
+}
+
+void GlyphCache::pushNewest(GlyphImage* image)
+{
+    image->newer = nullptr;
+    image->older = newest_;
+    if (newest_ != nullptr) newest_->newer = image;
+    newest_ = image;
+    if (oldest_ == nullptr) oldest_ = image;
+}
+
+void GlyphCache::unlink(GlyphImage* image)
+{
+    if (image->newer != nullptr) {
+        image->newer->older = image->older;
+    } else {
+        newest_ = image->older;
+    }
+    if (image->older != nullptr) {
+        image->older->newer = image->newer;
+    } else {
+        oldest_ = image->newer;
+    }
+}
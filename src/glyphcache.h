@@ -0,0 +1,126 @@
+// Copyright 2021 Jacques Supcik <jacques@supcik.net>
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file glyphcache.h
+ * @author Jacques Supcik <jacques@supcik.net>
+ *
+ * @brief Glyphs expanded into RGB565 pixels, kept in RAM
+ *
+ * @date 2026-10-17
+ * @version 0.1.1
+ ***************************************************************************/
+
+#ifndef GLYPHCACHE_H_
+#define GLYPHCACHE_H_
+
+#include <Arduino.h>
+#include <M5Stack.h>
+
+#include "fonts.h"
+
+// Byte budget of gGlyphCache, unless set at build time. 0 disables it.
+// Without PSRAM, the images take DRAM, which the WiFi stack and the field
+// sprite share: the budget is smaller then.
+#ifndef GLYPH_CACHE_BUDGET
+#ifdef BOARD_HAS_PSRAM
+#define GLYPH_CACHE_BUDGET 49152
+#else
+#define GLYPH_CACHE_BUDGET 32768
+#endif
+#endif
+
+// A glyph expanded into its colours: `width` by `height` RGB565 pixels, row
+// by row, as blitText() streams them
+struct GlyphImage {
+    const GFXfont* font;
+    uint16_t index;  // in the glyph table of the font
+    uint16_t color;
+    uint16_t bgColor;
+    uint8_t width;
+    uint8_t height;
+    bool psram;          // allocated with ps_malloc(), not operator new
+    uint32_t capacity;   // bytes of the block, header included
+    uint32_t draw;       // last draw the image was used in
+    GlyphImage* newer;   // towards the most recently used image
+    GlyphImage* older;   // towards the least recently used image
+    uint16_t* pixels;
+};
+
+// Glyphs expanded once and kept in RAM, so that drawing them again is a
+// copy of their pixels instead of a decoding of their rows. The least
+// recently used images are evicted to keep within a budget of bytes. They
+// are allocated in PSRAM if the board has some, in DRAM otherwise. Once the
+// budget is reached, a new image takes the block of the least recently used
+// image of about its size, rather than the oldest images being freed and a
+// block allocated: the cache stops churning the heap, which would fragment
+// the DRAM of a board without PSRAM.
+class GlyphCache {
+   public:
+    explicit GlyphCache(size_t budget);
+    ~GlyphCache();
+
+    // Starts a draw: the images found from then on are not evicted before
+    // the next draw starts.
+    void beginDraw() { draw_++; }
+
+    // Returns glyph `index` of `face` expanded in `color` over `bgColor`,
+    // expanding it if it is not cached. Returns nullptr if it does not fit
+    // in the budget beside the images of the current draw, or if it cannot
+    // be allocated.
+    const GlyphImage* find(const FontFace& face,
+                           int index,
+                           uint16_t color,
+                           uint16_t bgColor);
+
+    // Evicts images until they fit in `budget`, which applies from then on
+    void setBudget(size_t budget);
+
+    // Evicts all the images
+    void clear();
+
+    size_t budget() const { return budget_; }
+    size_t bytes() const { return bytes_; }  // blocks of the images
+    int size() const { return size_; }       // number of images
+    unsigned long hits() const { return hits_; }
+    unsigned long misses() const { return misses_; }
+    unsigned long reused() const { return reused_; }  // blocks recycled
+    void resetCounters() { hits_ = misses_ = reused_ = 0; }
+
+   private:
+    GlyphImage* expand(const FontFace& face,
+                       int index,
+                       uint16_t color,
+                       uint16_t bgColor);
+    bool makeRoom(size_t bytes, GlyphImage*& reuse);
+    void detach(GlyphImage* image);
+    void evict(GlyphImage* image);
+    void pushNewest(GlyphImage* image);
+    void unlink(GlyphImage* image);
+
+    size_t budget_;
+    size_t bytes_;
+    int size_;
+    uint32_t draw_;
+    unsigned long hits_;
+    unsigned long misses_;
+    unsigned long reused_;
+    GlyphImage* newest_;
+    GlyphImage* oldest_;
+};
+
+// The cache of the value screens, see GLYPH_CACHE_BUDGET
+extern GlyphCache gGlyphCache;
+
+#endif /* GLYPHCACHE_H_ */
@@ -0,0 +1,168 @@
+// Copyright 2021 Jacques Supcik <jacques@supcik.net>
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file glyphs.cpp
+ * @author Jacques Supcik <jacques@supcik.net>
+ *
+ * @brief Glyph rows decoded as runs of set pixels
+ *
+ * @date 2026-10-17
+ * @version 0.1.1
+ ***************************************************************************/
+
+#include "glyphs.h"
+
+#include <Arduino.h>
+#include <M5Stack.h>
+
+bool GlyphReader::begin(const FontFace& face, int index)
+{
+    const GFXglyph* glyph = &face.font->glyph[index];
+    width_                = glyph->width;
+    bit_                  = 0;
+    repeat_               = 0;
+    count_                = 0;
+    if (face.packed != nullptr) {
+        encoding_ = face.packed->maxRuns <= kMaxRuns ? kPacked : kInvalid;
+        data_     = face.packed->data + glyph->bitmapOffset;
+    } else if (face.greys != nullptr) {
+        encoding_ = kGreys;
+        greyBits_ = face.greys->bits;
+        data_     = face.greys->data + glyph->bitmapOffset;
+    } else if (face.spans != nullptr) {
+        encoding_ = kSpans;
+        data_     = face.spans->data + face.spans->offsets[index];
+    } else {
+        encoding_ = kBitmap;
+        data_     = face.font->bitmap + glyph->bitmapOffset;
+    }
+    return encoding_ != kInvalid;
+}
+
+int GlyphReader::next()
+{
+    switch (encoding_) {
+        case kBitmap:
+            return nextBitmap();
+        case kSpans:
+            return nextSpans();
+        case kPacked:
+            return nextPacked();
+        case kGreys:
+            return nextGreys();
+        case kInvalid:
+            break;
+    }
+    return 0;
+}
+
+// Runs beyond kMaxRuns are dropped. No font of the firmware has that many.
+int GlyphReader::nextBitmap()
+{
+    count_ = 0;
+    int x  = 0;
+    while (x < width_) {
+        if (!(data_[bit_ >> 3] & (0x80 >> (bit_ & 7)))) {
+            x++;
+            bit_++;
+            continue;
+        }
+        int start = x;
+        while (x < width_ && (data_[bit_ >> 3] & (0x80 >> (bit_ & 7)))) {
+            x++;
+            bit_++;
+        }
+        if (count_ < kMaxRuns) runs_[count_++] = {(uint8_t)start, (uint8_t)x};
+    }
+    return count_;
+}
+
+int GlyphReader::nextSpans()
+{
+    count_ = 0;
+    int x  = 0;
+    for (int n = *data_++; n > 0; n--) {
+        x += *data_++;
+        int length = *data_++;
+        if (count_ < kMaxRuns) {
+            runs_[count_++] = {(uint8_t)x, (uint8_t)(x + length)};
+        }
+        x += length;
+    }
+    return count_;
+}
+
+// See GFXpacked for the format. begin() checked that no row has more than
+// kMaxRuns runs.
+int GlyphReader::nextPacked()
+{
+    if (repeat_ > 0) {
+        repeat_--;
+        return count_;
+    }
+    uint8_t code = *data_++;
+    if (code == 0xC0) {
+        for (int i = 0; i < count_; i++) {
+            uint8_t moves = *data_++;
+            runs_[i].start += (moves >> 4) - 8;
+            runs_[i].end += (moves & 0x0F) - 8;
+        }
+    } else if (code & 0x80) {
+        // This row is the first of the repeated ones
+        repeat_ = code & 0x3F;
+    } else {
+        // Never more than maxRuns, unless the font is corrupt (a font pack
+        // damaged in flash): the row is then cut, not written past runs_
+        count_ = min<int>(code, kMaxRuns);
+        int x  = 0;
+        for (int i = 0; i < count_; i++) {
+            int skip, length;
+            uint8_t run = *data_++;
+            if (run >= 0xF0) {
+                skip   = *data_++;
+                length = *data_++;
+            } else {
+                skip   = run >> 4;
+                length = (run & 0x0F) + 1;
+            }
+            x += skip;
+            runs_[i] = {(uint8_t)x, (uint8_t)(x + length)};
+            x += length;
+        }
+    }
+    return count_;
+}
+
+// The high bit of a level is set from half the text colour on
+int GlyphReader::nextGreys()
+{
+    count_ = 0;
+    int x  = 0;
+    while (x < width_) {
+        int bit = x * greyBits_;
+        if (!(data_[bit >> 3] & (0x80 >> (bit & 7)))) {
+            x++;
+            continue;
+        }
+        int start = x;
+        for (; x < width_; x++) {
+            bit = x * greyBits_;
+            if (!(data_[bit >> 3] & (0x80 >> (bit & 7)))) break;
+        }
+        if (count_ < kMaxRuns) runs_[count_++] = {(uint8_t)start, (uint8_t)x};
+    }
+    data_ += (width_ * greyBits_ + 7) / 8;
+    return count_;
+}
@@ -0,0 +1,82 @@
+// Copyright 2021 Jacques Supcik <jacques@supcik.net>
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file glyphs.h
+ * @author Jacques Supcik <jacques@supcik.net>
+ *
+ * @brief Glyph rows decoded as runs of set pixels
+ *
+ * @date 2026-10-17
+ * @version 0.1.1
+ ***************************************************************************/
+
+#ifndef GLYPHS_H_
+#define GLYPHS_H_
+
+#include <Arduino.h>
+#include <M5Stack.h>
+
+#include "fonts.h"
+
+const int kMaxRuns = 8;  // runs in a glyph row, at most
+
+// Pixels of a glyph row from `start` (inclusive) to `end` (exclusive)
+struct GlyphRun {
+    uint8_t start;
+    uint8_t end;
+};
+
+// Reads the rows of a glyph, top down, as runs of set pixels, whatever the
+// encoding of its font: bitmap, spans, compressed or anti-aliased rows. Only
+// the current row is kept, so a compressed glyph is never expanded in
+// memory. The pixels of an anti-aliased glyph of at least half the text
+// colour are set: read as runs, it is a monochrome glyph.
+class GlyphReader {
+   public:
+    // Starts reading glyph `index` of `face`. Returns false if the glyph
+    // cannot be decoded: its rows then have no runs.
+    bool begin(const FontFace& face, int index);
+
+    // Decodes the next row and returns its number of runs.
+    int next();
+
+    // Runs of the last decoded row
+    const GlyphRun* runs() const { return runs_; }
+
+   private:
+    enum Encoding {
+        kBitmap,
+        kSpans,
+        kPacked,
+        kGreys,
+        kInvalid,
+    };
+
+    int nextBitmap();
+    int nextSpans();
+    int nextPacked();
+    int nextGreys();
+
+    Encoding encoding_;
+    const uint8_t* data_;  // glyph bitmap, or next byte to decode
+    uint32_t bit_;         // next bit of the glyph bitmap
+    uint8_t width_;
+    uint8_t greyBits_;  // bits per pixel (anti-aliased)
+    uint8_t repeat_;    // rows left to repeat (compressed)
+    uint8_t count_;     // number of runs in runs_
+    GlyphRun runs_[kMaxRuns];
+};
+
+#endif /* GLYPHS_H_ */
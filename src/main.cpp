@@ -26,101 +26,117 @@
 #include <M5Stack.h>
 #include <MQTT.h>
 #include <Wifi.h>
+#include <stdlib.h>
+#include <time.h>
 
-#include "IBMPlexMonoRegular9pt8b.h"
-#include "IBMPlexSansBold18pt8b.h"
-#include "IBMPlexSansRegular18pt8b.h"
-#include "IBMPlexSansSemiBold40pt8b.h"
+#include "boot.h"
+#include "clock.h"
+#include "connection.h"
+#include "fontpack.h"
 #include "global.h"
+#include "payload.h"
+#include "scheduler.h"
 #include "screens.h"
 #include "secret.h"
-
-const int kConnectTimeout = 10000;  // milliseconds
-const int kConnectDelay   = 1000;   // milliseconds
+#include "snapshot.h"
+
+const int kFrameBudget    = 100;   // milliseconds
+const int kWelcomeTimeout = 5000;  // milliseconds
+
+// The boot report waits for the first live values, but no longer than it
+// takes to show the welcome screen and to report a connection error.
+const unsigned long kBootReportTimeout = kWelcomeTimeout + kConnectTimeout;
+const char* const kBootPhases[] = {"setup",
+                                   "hardware initialized",
+                                   "fonts loaded",
+                                   "wifi started",
+                                   "mqtt connected",
+                                   "live values painted"};
+const int kBootPhaseCount = sizeof(kBootPhases) / sizeof(kBootPhases[0]);
 
 // Global variables
 WiFiClient net;
 MQTTClient client;
+RenderScheduler scheduler(kFrameBudget);
+Connection connection(client, kMqttTopic);
 
-String getField(String& text)
+void messageReceived(MQTTClient* client,
+                     char topic[],
+                     char bytes[],
+                     int length)
 {
-    int pos = text.indexOf(";");
-    if (pos < 0) {
-        pos = text.length();
+    // Print piecewise to avoid building temporary Strings on the heap
+    Serial.print("incoming: ");
+    Serial.print(topic);
+    Serial.print(" - ");
+    if (length > 0 && static_cast<uint8_t>(bytes[0]) == kBinaryPayloadMagic) {
+        Serial.printf("<binary, %d bytes>", length);
+    } else {
+        Serial.write(bytes, length);
     }
-    String result = text.substring(0, pos);
-    text          = text.substring(pos + 1);
-    return result;
-}
-
-void messageReceived(String& topic, String& payload)
-{
-    Serial.println("incoming: " + topic + " - " + payload);
-    String field = getField(payload);
-    if (field.length() > 0) gData.timestamp = field;
-    field = getField(payload);
-    if (field.length() > 0) gData.consumption = field.toFloat();
-    field = getField(payload);
-    if (field.length() > 0) gData.temp = field.toFloat();
-    field = getField(payload);
-    if (field.length() > 0) gData.electricityConsumption = field.toFloat();
-    field = getField(payload);
-    if (field.length() > 0) gData.electricityProduction = field.toFloat();
-    displayValues();
-}
-
-void connect()
-{
-    bool errorDisplayed = false;
-    unsigned long now   = millis();
-    Serial.print("checking wifi...");
-    while (WiFi.status() != WL_CONNECTED) {
-        Serial.print(".");
-        if (millis() - now > kConnectTimeout) {
-            if (!errorDisplayed) {
-                displayWifiConnectionError();
-                errorDisplayed = true;
-            }
-        }
-        delay(kConnectDelay);
+    Serial.println();
+    if (!decodePayload(bytes, length, gData)) {
+        Serial.println("malformed payload ignored");
+        return;
     }
-
-    errorDisplayed = false;
-    now            = millis();
-    Serial.print("\nconnecting...");
-    while (!client.connect(("meter:" + WiFi.macAddress()).c_str())) {
-        Serial.print(".");
-        if (millis() - now > kConnectTimeout) {
-            if (!errorDisplayed) {
-                displayMqttConnectionError();
-                errorDisplayed = true;
-            }
-        }
-        delay(kConnectDelay);
-    }
-
-    Serial.println("\nconnected!");
-    client.subscribe(kMqttTopic);
+    gHasData     = true;
+    gHasLiveData = true;
+    // Rendering is left to the main loop, so that a burst of messages does
+    // not stall the MQTT client with one full redraw per message.
+    scheduler.invalidate();
 }
 
 void setup()
 {
+    bootMark("setup");
+    Serial.begin(115200);
     M5.begin();
     M5.Power.begin();
-    M5.Lcd.setBrightness(kMaxBrightness);
-    M5.Lcd.fillScreen(BLACK);
-    Serial.begin(115200);
-    displayWelcome();
+    setenv("TZ", kTimeZone, 1);
+    tzset();
+    bootMark("hardware initialized");
+
+    // Fonts of the "fonts" partition, if it was flashed, in place of the
+    // compiled ones
+    int fonts = loadFontPartition();
+    if (fonts >= 0) {
+        Serial.printf("font pack: %d fonts\n", fonts);
+    } else {
+        Serial.println("no font pack, compiled fonts used");
+    }
+    bootMark("fonts loaded");
+
+    // Start the WiFi association first: it runs in the background while
+    // the screen is painted.
     WiFi.begin(kSSID, kPassPhrase);
     client.begin(kMqttServer, net);
-    client.onMessage(messageReceived);
-    connect();
+    client.onMessageAdvanced(messageReceived);
+    bootMark("wifi started");
+
+    M5.Lcd.setBrightness(kMaxBrightness);
+    if (restoreSnapshot()) {
+        // Show the last known values, marked as stale, until live data
+        // arrives
+        gHasData = true;
+        displayValues();
+        bootMark("snapshot painted");
+    } else {
+        displayWelcome();
+        bootMark("welcome painted");
+        // Leave the welcome screen up until connected, but not longer than
+        // kWelcomeTimeout
+        unsigned long start = nowMs();
+        while (!connection.connected() && nowMs() - start < kWelcomeTimeout) {
+            connection.tick(nowMs());
+            sleepMs(10);
+        }
+    }
 }
 
 void loop()
 {
-    static unsigned long lastPressed = millis();
-    unsigned long now                = millis();
+    static unsigned long lastPressed = nowMs();
+    unsigned long now                = nowMs();
     M5.update();
     bool anyPressed = false;
 
@@ -138,19 +154,37 @@ void loop()
     }
 
     if (anyPressed) {
-        displayValues();
+        scheduler.invalidate();
         M5.Lcd.setBrightness(kMaxBrightness);
         lastPressed = now;
     }
 
+    if (scheduler.frameDue(now)) {
+        displayValues();
+        if (gHasLiveData && !gStale) {
+            bootMark("live values painted");
+            printBootReport(kBootPhases, kBootPhaseCount);
+        }
+    }
+
     if (now - lastPressed > kScreenTimeout) {
         M5.Lcd.setBrightness(kDimBrightness);
     }
 
     client.loop();
-    delay(10);  // <- fixes some issues with WiFi stability
+    sleepMs(kLoopPeriod);  // <- fixes some issues with WiFi stability
 
-    if (!client.connected()) {
-        connect();
+    connection.tick(now);
+    if (connection.connected()) bootMark("mqtt connected");
+    if (now >= kBootReportTimeout) {
+        printBootReport(kBootPhases, kBootPhaseCount);
+    }
+    // Restored values stay marked as stale until a message updates them
+    bool stale = !connection.connected() || !gHasLiveData;
+    if (stale != gStale) {
+        gStale = stale;
+        if (gHasData) scheduler.invalidate();
     }
+
+    if (gHasData) saveSnapshot(now);
 }
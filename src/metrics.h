@@ -0,0 +1,121 @@
+// Copyright 2021 Jacques Supcik <jacques@supcik.net>
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file metrics.h
+ * @author Jacques Supcik <jacques@supcik.net>
+ *
+ * @brief Font metrics known at compile time
+ *
+ * @date 2026-10-17
+ * @version 0.1.1
+ ***************************************************************************/
+
+#ifndef METRICS_H_
+#define METRICS_H_
+
+#include <Arduino.h>
+
+#include "fontdata.h"
+
+// Unlike the fonts (see fonts.h), the metrics are constant expressions, with
+// no storage unless they are used at run time. Being constexpr at namespace
+// scope, they have internal linkage: every translation unit that uses them
+// at run time gets a copy of its own. Their only run-time use is therefore
+// the registry of fonts.cpp, which hands them out as FontFace::metrics; the
+// other files include this header for compile-time measures only.
+#include "IBMPlexMonoRegular9pt8bMetrics.h"
+#include "IBMPlexSansBold18pt8bMetrics.h"
+#include "IBMPlexSansRegular18pt8bMetrics.h"
+#include "IBMPlexSansRegular24pt8bMetrics.h"
+#include "IBMPlexSansSemiBold32pt8bMetrics.h"
+#include "IBMPlexSansSemiBold40pt8bMetrics.h"
+
+// The functions below are single expressions, so that they are constant
+// expressions in C++11 too, and evaluated at compile time for literals. The
+// UTF-8 decoding is that of decodeUtf8() (blitter.h), which the renderers
+// use at run time.
+
+// Whether byte `i` of the text at `p` continues a UTF-8 sequence
+constexpr bool utf8Follows(const char* p, int i)
+{
+    return (static_cast<uint8_t>(p[i]) & 0xC0) == 0x80;
+}
+
+// Length of the UTF-8 sequence at `p`: 1 for a byte that does not start a
+// valid sequence
+constexpr int utf8Length(const char* p)
+{
+    return (static_cast<uint8_t>(p[0]) & 0xE0) == 0xC0 && utf8Follows(p, 1)
+               ? 2
+           : (static_cast<uint8_t>(p[0]) & 0xF0) == 0xE0 &&
+                   utf8Follows(p, 1) && utf8Follows(p, 2)
+               ? 3
+           : (static_cast<uint8_t>(p[0]) & 0xF8) == 0xF0 &&
+                   utf8Follows(p, 1) && utf8Follows(p, 2) && utf8Follows(p, 3)
+               ? 4
+               : 1;
+}
+
+// Low `bits` bits of byte `i` of the text at `p`, shifted left by `shift`
+constexpr uint32_t utf8Bits(const char* p, int i, int bits, int shift)
+{
+    return (static_cast<uint32_t>(static_cast<uint8_t>(p[i])) &
+            ((1u << bits) - 1))
+           << shift;
+}
+
+// Code point of the UTF-8 sequence at `p`, or its first byte if the
+// sequence is not valid
+constexpr uint32_t utf8Char(const char* p)
+{
+    return utf8Length(p) == 1 ? utf8Bits(p, 0, 8, 0)
+           : utf8Length(p) == 2
+               ? utf8Bits(p, 0, 5, 6) | utf8Bits(p, 1, 6, 0)
+           : utf8Length(p) == 3 ? utf8Bits(p, 0, 4, 12) |
+                                      utf8Bits(p, 1, 6, 6) |
+                                      utf8Bits(p, 2, 6, 0)
+                                : utf8Bits(p, 0, 3, 18) |
+                                      utf8Bits(p, 1, 6, 12) |
+                                      utf8Bits(p, 2, 6, 6) |
+                                      utf8Bits(p, 3, 6, 0);
+}
+
+// Pixels the character at `p` adds to the width of a text, as
+// TFT_eSPI::textWidth() counts them: its advance, or its ink if it is the
+// last one. Characters the font does not have add nothing.
+constexpr int charWidth(const GFXmetrics& metrics, const char* p)
+{
+    return utf8Char(p) < metrics.first || utf8Char(p) > metrics.last ? 0
+           : p[utf8Length(p)] != 0
+               ? metrics.advances[utf8Char(p) - metrics.first]
+               : metrics.inkRights[utf8Char(p) - metrics.first];
+}
+
+// Width of `text`, as TFT_eSPI::textWidth() measures it: a constant for
+// literals, one table lookup per character otherwise.
+constexpr int textWidth(const GFXmetrics& metrics, const char* text)
+{
+    return *text == 0 ? 0
+                      : charWidth(metrics, text) +
+                            textWidth(metrics, text + utf8Length(text));
+}
+
+// Left edge of `text` centred on `x`, as drawCentreString() places it
+constexpr int centredLeft(const GFXmetrics& metrics, const char* text, int x)
+{
+    return x - textWidth(metrics, text) / 2;
+}
+
+#endif /* METRICS_H_ */
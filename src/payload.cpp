@@ -0,0 +1,224 @@
+// Copyright 2021 Jacques Supcik <jacques@supcik.net>
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file payload.cpp
+ * @author Jacques Supcik <jacques@supcik.net>
+ *
+ * @brief Parser for the MQTT payloads
+ *
+ * @date 2026-10-17
+ * @version 0.1.1
+ ***************************************************************************/
+
+#include "payload.h"
+
+#include <math.h>
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+
+#include "global.h"
+
+const char kFieldSeparator = ';';
+
+static_assert(sizeof(BinaryPayload) == 24, "unexpected binary payload size");
+static_assert(__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__,
+              "the binary payload is decoded with a plain memcpy");
+
+FieldTokenizer::FieldTokenizer(const char* text, size_t length)
+    : pos_(text), end_(text + length), done_(false)
+{
+}
+
+bool FieldTokenizer::next(FieldView& field)
+{
+    if (done_) return false;
+    const char* sep = static_cast<const char*>(
+        memchr(pos_, kFieldSeparator, end_ - pos_));
+    if (sep == nullptr) {
+        sep   = end_;
+        done_ = true;
+    }
+    field.text   = pos_;
+    field.length = sep - pos_;
+    pos_         = sep + (done_ ? 0 : 1);
+    return true;
+}
+
+static void copyField(const FieldView& field, char* dest, size_t size)
+{
+    size_t n = field.length < size - 1 ? field.length : size - 1;
+    memcpy(dest, field.text, n);
+    dest[n] = '\0';
+}
+
+// Beyond 9 significant digits the mantissa could overflow 32 bits, and a
+// float cannot represent them anyway.
+const int kMaxSignificantDigits = 9;
+
+static const float kPowersOfTen[] = {
+    1e0f, 1e1f, 1e2f, 1e3f, 1e4f, 1e5f, 1e6f, 1e7f, 1e8f, 1e9f};
+
+// Also false for NaN and infinities
+static bool inRange(float value)
+{
+    return fabsf(value) < kMaxPayloadValue;
+}
+
+bool parseDecimal(const FieldView& field, float& out)
+{
+    const char* p   = field.text;
+    const char* end = field.text + field.length;
+
+    // Tolerate surrounding blanks (e.g. a trailing newline from the publisher)
+    while (p < end && (*p == ' ' || *p == '\t')) p++;
+    while (end > p && (end[-1] == ' ' || end[-1] == '\t' ||
+                       end[-1] == '\r' || end[-1] == '\n')) {
+        end--;
+    }
+
+    bool negative = false;
+    if (p < end && (*p == '-' || *p == '+')) {
+        negative = (*p == '-');
+        p++;
+    }
+
+    uint32_t mantissa = 0;
+    int digits        = 0;  // significant digits stored in the mantissa
+    int scale         = 0;  // decimal digits stored in the mantissa
+    int intDigits     = 0;  // integer digits dropped from the mantissa
+    bool seenDigit    = false;
+    bool seenPoint    = false;
+
+    for (; p < end; p++) {
+        char c = *p;
+        if (c >= '0' && c <= '9') {
+            seenDigit = true;
+            if (mantissa == 0 && c == '0') {
+                if (seenPoint) scale++;
+                continue;
+            }
+            if (digits < kMaxSignificantDigits) {
+                mantissa = mantissa * 10 + (c - '0');
+                digits++;
+                if (seenPoint) scale++;
+            } else if (!seenPoint) {
+                intDigits++;
+            }
+        } else if (c == '.' && !seenPoint) {
+            seenPoint = true;
+        } else {
+            return false;
+        }
+    }
+    if (!seenDigit) return false;
+
+    if (intDigits > 0) return false;  // 10 integer digits or more
+
+    float value;
+    if (scale > 9) {
+        // Leading zeros after the decimal point: the value is tiny
+        value = mantissa / kPowersOfTen[9];
+        for (scale -= 9; scale > 0 && value != 0; scale -= 9) {
+            value /= kPowersOfTen[scale < 9 ? scale : 9];
+        }
+    } else {
+        value = mantissa / kPowersOfTen[scale];
+    }
+    if (!inRange(value)) return false;
+    out = negative ? -value : value;
+    return true;
+}
+
+bool parsePayload(const char* text, size_t length, data& out)
+{
+    FieldTokenizer tokenizer(text, length);
+    FieldView field;
+    data parsed = out;  // applied only if all the fields are well-formed
+
+    if (tokenizer.next(field) && field.length > 0) {
+        copyField(field, parsed.timestamp, sizeof(parsed.timestamp));
+    }
+    if (tokenizer.next(field) && field.length > 0 &&
+        !parseDecimal(field, parsed.consumption)) {
+        return false;
+    }
+    if (tokenizer.next(field) && field.length > 0 &&
+        !parseDecimal(field, parsed.temp)) {
+        return false;
+    }
+    if (tokenizer.next(field) && field.length > 0 &&
+        !parseDecimal(field, parsed.electricityConsumption)) {
+        return false;
+    }
+    if (tokenizer.next(field) && field.length > 0 &&
+        !parseDecimal(field, parsed.electricityProduction)) {
+        return false;
+    }
+    out = parsed;
+    return true;
+}
+
+bool parseBinaryPayload(const uint8_t* bytes, size_t length, data& out)
+{
+    BinaryPayload payload;
+    if (length < sizeof(payload)) return false;
+    memcpy(&payload, bytes, sizeof(payload));
+    if (payload.magic != kBinaryPayloadMagic ||
+        payload.version != kBinaryPayloadVersion || payload.reserved != 0) {
+        return false;
+    }
+    const struct {
+        uint8_t bit;
+        float value;
+    } values[] = {
+        {kPresentConsumption, payload.consumption},
+        {kPresentTemp, payload.temp},
+        {kPresentElectricityConsumption, payload.electricityConsumption},
+        {kPresentElectricityProduction, payload.electricityProduction},
+    };
+    for (const auto& v : values) {
+        if ((payload.presence & v.bit) && !inRange(v.value)) return false;
+    }
+
+    if (payload.presence & kPresentTimestamp) {
+        time_t epoch = payload.epoch;
+        struct tm tm;
+        localtime_r(&epoch, &tm);
+        strftime(out.timestamp, sizeof(out.timestamp), "%Y-%m-%d %H:%M", &tm);
+    }
+    if (payload.presence & kPresentConsumption) {
+        out.consumption = payload.consumption;
+    }
+    if (payload.presence & kPresentTemp) {
+        out.temp = payload.temp;
+    }
+    if (payload.presence & kPresentElectricityConsumption) {
+        out.electricityConsumption = payload.electricityConsumption;
+    }
+    if (payload.presence & kPresentElectricityProduction) {
+        out.electricityProduction = payload.electricityProduction;
+    }
+    return true;
+}
+
+bool decodePayload(const char* bytes, size_t length, data& out)
+{
+    if (length > 0 && static_cast<uint8_t>(bytes[0]) == kBinaryPayloadMagic) {
+        return parseBinaryPayload(
+            reinterpret_cast<const uint8_t*>(bytes), length, out);
+    }
+    return parsePayload(bytes, length, out);
+}
@@ -0,0 +1,114 @@
+// Copyright 2021 Jacques Supcik <jacques@supcik.net>
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file payload.h
+ * @author Jacques Supcik <jacques@supcik.net>
+ *
+ * @brief Parser for the MQTT payloads
+ *
+ * @date 2026-10-17
+ * @version 0.1.1
+ ***************************************************************************/
+
+#ifndef PAYLOAD_H_
+#define PAYLOAD_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "global.h"
+
+// A field of a payload. The view points into the payload itself: it is not
+// null-terminated and it is only valid as long as the payload is.
+struct FieldView {
+    const char* text;
+    size_t length;
+};
+
+// Splits a payload on ';' in place, without copying or allocating.
+class FieldTokenizer {
+   public:
+    FieldTokenizer(const char* text, size_t length);
+
+    // Returns false when all the fields have been consumed.
+    bool next(FieldView& field);
+
+   private:
+    const char* pos_;
+    const char* end_;
+    bool done_;
+};
+
+// Values at or beyond this magnitude, and non-finite values, are treated as
+// malformed: no meter comes close, and the screens have room for 9 digits.
+const float kMaxPayloadValue = 1e9f;
+
+// Parses a decimal number (optional sign, digits and at most one decimal
+// point) into `out`. Returns false, leaving `out` unchanged, if the field is
+// malformed or out of range.
+bool parseDecimal(const FieldView& field, float& out);
+
+// Parses a "timestamp;consumption;temp;elecCons;elecProd" payload into
+// `out`. Empty or missing fields leave the corresponding value unchanged.
+// Returns false, leaving `out` unchanged, if one of the numeric fields is
+// malformed: a payload is applied as a whole or not at all.
+bool parsePayload(const char* text, size_t length, data& out);
+
+// Binary payload, version 1. All fields are little-endian:
+//
+//   offset  size  field
+//        0     1  magic (kBinaryPayloadMagic)
+//        1     1  version (kBinaryPayloadVersion)
+//        2     1  presence bitmap (kPresent... below), clear = unchanged
+//        3     1  reserved, must be 0
+//        4     4  timestamp, seconds since the Unix epoch (uint32),
+//                 shown in the local time zone (kTimeZone)
+//        8     4  consumption (float32)
+//       12     4  temperature (float32)
+//       16     4  electricity consumption (float32)
+//       20     4  electricity production (float32)
+//
+// A text payload always starts with a printable character, so the magic
+// byte is enough to tell the two formats apart.
+const uint8_t kBinaryPayloadMagic   = 0xB0;
+const uint8_t kBinaryPayloadVersion = 1;
+
+const uint8_t kPresentTimestamp              = 1 << 0;
+const uint8_t kPresentConsumption            = 1 << 1;
+const uint8_t kPresentTemp                   = 1 << 2;
+const uint8_t kPresentElectricityConsumption = 1 << 3;
+const uint8_t kPresentElectricityProduction  = 1 << 4;
+
+struct __attribute__((packed)) BinaryPayload {
+    uint8_t magic;
+    uint8_t version;
+    uint8_t presence;
+    uint8_t reserved;
+    uint32_t epoch;
+    float consumption;
+    float temp;
+    float electricityConsumption;
+    float electricityProduction;
+};
+
+// Decodes a binary payload into `out`. Returns false, leaving `out`
+// unchanged, if the payload is too short, has an unknown magic byte or
+// version, a nonzero reserved byte or a value out of range.
+bool parseBinaryPayload(const uint8_t* bytes, size_t length, data& out);
+
+// Decodes a payload in either the binary or the text format.
+bool decodePayload(const char* bytes, size_t length, data& out);
+
+#endif /* PAYLOAD_H_ */
@@ -0,0 +1,54 @@
+// Copyright 2021 Jacques Supcik <jacques@supcik.net>
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file scheduler.cpp
+ * @author Jacques Supcik <jacques@supcik.net>
+ *
+ * @brief Coalescing render scheduler
+ *
+ * @date 2026-10-17
+ * @version 0.1.1
+ ***************************************************************************/
+
+#include "scheduler.h"
+
+RenderScheduler::RenderScheduler(unsigned long frameBudget)
+    : frameBudget_(frameBudget),
+      lastFrame_(0),
+      coalesced_(0),
+      frames_(0),
+      dirty_(false),
+      rendered_(false)
+{
+}
+
+void RenderScheduler::invalidate()
+{
+    if (dirty_) coalesced_++;
+    dirty_ = true;
+}
+
+bool RenderScheduler::frameDue(unsigned long now)
+{
+    if (!dirty_) return false;
+    if (rendered_ && now - lastFrame_ < frameBudget_) {
+        return false;
+    }
+    dirty_     = false;
+    rendered_  = true;
+    lastFrame_ = now;
+    frames_++;
+    return true;
+}
@@ -0,0 +1,57 @@
+// Copyright 2021 Jacques Supcik <jacques@supcik.net>
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file scheduler.h
+ * @author Jacques Supcik <jacques@supcik.net>
+ *
+ * @brief Coalescing render scheduler
+ *
+ * @date 2026-10-17
+ * @version 0.1.1
+ ***************************************************************************/
+
+#ifndef SCHEDULER_H_
+#define SCHEDULER_H_
+
+// Collects redraw requests and lets the main loop render at most once per
+// frame budget. Any number of requests between two frames result in a
+// single redraw showing the latest values.
+class RenderScheduler {
+   public:
+    explicit RenderScheduler(unsigned long frameBudget);
+
+    // Marks the screen as out of date.
+    void invalidate();
+
+    // Returns true, and clears the request, if the screen is out of date and
+    // the previous frame is at least one frame budget old.
+    bool frameDue(unsigned long now);
+
+    // Number of redraw requests merged into another frame since boot.
+    unsigned long coalesced() const { return coalesced_; }
+
+    // Number of frames due since boot.
+    unsigned long frames() const { return frames_; }
+
+   private:
+    unsigned long frameBudget_;
+    unsigned long lastFrame_;
+    unsigned long coalesced_;
+    unsigned long frames_;
+    bool dirty_;
+    bool rendered_;
+};
+
+#endif /* SCHEDULER_H_ */
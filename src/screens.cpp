@@ -28,20 +28,196 @@
 #include <M5Stack.h>
 #include <Wifi.h>
 
-#include "IBMPlexMonoRegular9pt8b.h"
-#include "IBMPlexSansBold18pt8b.h"
-#include "IBMPlexSansRegular18pt8b.h"
-#include "IBMPlexSansRegular24pt8b.h"
-#include "IBMPlexSansSemiBold32pt8b.h"
-#include "IBMPlexSansSemiBold40pt8b.h"
+#include "blitter.h"
+#include "fonts.h"
 #include "global.h"
+#include "glyphcache.h"
+#include "metrics.h"
 #include "secret.h"
 
+const int kFieldMargin     = 2;  // pixels erased around a text, for rounding
+const int kStaleMarkerX    = TFT_HEIGHT - 8;
+const int kStaleMarkerY    = 8;
+const int kStaleMarkerSize = 4;  // radius in pixels
+
+// Labels of the value screens, in IBMPlexSans_Regular18pt8b
+constexpr char kHotWaterLabel[]    = "Eau chaude";
+constexpr char kConsumptionLabel[] = "Consommation";
+constexpr char kProductionLabel[]  = "Production";
+
+// Measured at compile time, with the compiled font (the one of a font pack
+// is not checked): TFT_HEIGHT is the width of the screen
+static_assert(textWidth(IBMPlexSans_Regular18pt8bMetrics, kHotWaterLabel) <=
+                      TFT_HEIGHT &&
+                  textWidth(IBMPlexSans_Regular18pt8bMetrics,
+                            kConsumptionLabel) <= TFT_HEIGHT &&
+                  textWidth(IBMPlexSans_Regular18pt8bMetrics,
+                            kProductionLabel) <= TFT_HEIGHT,
+              "a label is wider than the screen");
+
+// A text drawn on a value screen. It is only redrawn when its text or colour
+// changes, and then only its previous bounding box is erased.
+struct TextField {
+    char text[kTimestampSize];
+    int color;
+    Box box;  // ink bounding box plus margin, empty if nothing is drawn
+};
+
+static int drawnScreen = -1;  // value screen on the LCD, -1 if none
+static bool drawnStale = false;
+static TextField timestampField;
+static TextField valueFields[2];
+
+static void clearScreen(int bgColor)
+{
+    M5.Lcd.fillScreen(bgColor);
+    drawnScreen = -1;
+}
+
+// Paints the background of a value screen, unless it is already shown.
+// Returns true if the screen has been (re)entered.
+static bool enterScreen(int screenNo, int bgColor)
+{
+    if (drawnScreen == screenNo) return false;
+    clearScreen(bgColor);
+    memset(&timestampField, 0, sizeof(timestampField));
+    memset(valueFields, 0, sizeof(valueFields));
+    drawnScreen = screenNo;
+    drawnStale  = false;
+    return true;
+}
+
+// The value fonts are compressed subsets, so they are drawn with drawText()
+// rather than with TFT_eSPI, by all the backends.
+static void drawFieldDirect(const TextField& field,
+                            const TextField& next,
+                            const TextLayout& layout,
+                            int left,
+                            int y,
+                            int bgColor)
+{
+    const Box& box = field.box;
+    if (box.w > 0) M5.Lcd.fillRect(box.x, box.y, box.w, box.h, bgColor);
+    drawText(M5.Lcd, layout, left, y, next.color);
+}
+
+// Height of the sprite of the sprite backend: the line of the largest value
+// font, with the margins of a field
+const int kFieldStripHeight = IBMPlexSans_SemiBold40pt8bMetrics.ascent +
+                              IBMPlexSans_SemiBold40pt8bMetrics.descent +
+                              2 * kFieldMargin;
+
+// The sprite of the sprite backend, a strip as wide as the screen. It is
+// allocated on its first use and kept, so that an update does not go through
+// the heap. Returns nullptr if it could not be allocated.
+static TFT_eSprite* fieldSprite()
+{
+    static TFT_eSprite sprite(&M5.Lcd);
+    static bool allocated = false;
+    static bool tried     = false;
+    if (!tried) {
+        tried = true;
+        sprite.setColorDepth(16);
+        allocated =
+            sprite.createSprite(TFT_HEIGHT, kFieldStripHeight) != nullptr;
+    }
+    return allocated ? &sprite : nullptr;
+}
+
+// Composes the union of the previous and the new bounding boxes in the
+// top left corner of fieldSprite() and pushes it with a single window
+// transfer, so that the value is never seen half erased. Returns false if
+// there is no sprite, or if the box is taller than it (a font of a font
+// pack may be).
+static bool drawFieldSprite(const TextField& field,
+                            const TextField& next,
+                            const TextLayout& layout,
+                            int left,
+                            int y,
+                            int bgColor)
+{
+    Box box = clipToScreen(unionBox(field.box, next.box));
+    if (box.w <= 0) return true;
+
+    TFT_eSprite* sprite = fieldSprite();
+    if (sprite == nullptr || box.h > kFieldStripHeight) return false;
+    sprite->fillRect(0, 0, box.w, box.h, bgColor);
+    drawText(*sprite, layout, left - box.x, y - box.y, next.color);
+    sprite->pushSprite(box.x, box.y, 0, 0, box.w, box.h);
+    return true;
+}
+
+// Streams the union of the previous and the new bounding boxes, background
+// included, in a single address window. The digits of the values come back
+// at every update: their pixels are copied from gGlyphCache.
+static void drawFieldBlit(const TextField& field,
+                          const TextField& next,
+                          const TextLayout& layout,
+                          int left,
+                          int y,
+                          int bgColor)
+{
+    blitText(layout,
+             left,
+             y,
+             next.color,
+             bgColor,
+             unionBox(field.box, next.box),
+             &gGlyphCache);
+}
+
+// Draws `text` centred at y, replacing the previous content of `field`.
+// Nothing is sent to the LCD if the text and the colour did not change.
+static void drawField(TextField& field,
+                      const GFXfont* font,
+                      const char* text,
+                      int y,
+                      int color,
+                      int bgColor)
+{
+    if (field.box.w > 0 && field.color == color &&
+        strcmp(field.text, text) == 0) {
+        return;
+    }
+
+    // Laid out once, for the centring, the bounding box and the drawing
+    TextLayout layout;
+    layoutText(fontFace(font), text, layout);
+    TextField next = {};
+    int left       = kCenterX - layout.width / 2;
+    Box ink        = inkBox(layout, left, y);
+    if (ink.w > 0) {
+        next.box = {ink.x - kFieldMargin,
+                    ink.y - kFieldMargin,
+                    ink.w + 2 * kFieldMargin,
+                    ink.h + 2 * kFieldMargin};
+    }
+    snprintf(next.text, sizeof(next.text), "%s", text);
+    next.color = color;
+
+    switch (gRenderBackend) {
+        case kRenderBlit:
+            drawFieldBlit(field, next, layout, left, y, bgColor);
+            break;
+        case kRenderSprite:
+            if (drawFieldSprite(field, next, layout, left, y, bgColor)) {
+                break;
+            }
+            // No sprite, or too small for the field: draw directly
+            drawFieldDirect(field, next, layout, left, y, bgColor);
+            break;
+        case kRenderDirect:
+            drawFieldDirect(field, next, layout, left, y, bgColor);
+            break;
+    }
+    field = next;
+}
+
 void displayWelcome()
 {
     M5.Lcd.setBrightness(kMaxBrightness);
     int bgColor = BLUE;
-    M5.Lcd.fillScreen(bgColor);
+    clearScreen(bgColor);
     M5.Lcd.setTextColor(WHITE);
     M5.Lcd.setFreeFont(&IBMPlexSans_Regular24pt8b);
     int yPos = 10;
@@ -56,13 +232,12 @@ void displayWelcome()
     M5.Lcd.setFreeFont(&IBMPlexSans_Regular18pt8b);
     M5.lcd.drawCentreString("Démarrage...", kCenterX, yPos, 1);
     NewLine(yPos);
-    delay(5000);
 }
 
 void displayInfo()
 {
     int bgColor = NAVY;
-    M5.Lcd.fillScreen(bgColor);
+    clearScreen(bgColor);
     M5.Lcd.setTextColor(WHITE);
     M5.Lcd.setFreeFont(&IBMPlexSans_Regular24pt8b);
     int yPos = 10;
@@ -82,7 +257,7 @@ void displayWifiConnectionError()
 {
     M5.Lcd.setBrightness(kMaxBrightness);
     int bgColor = RED;
-    M5.Lcd.fillScreen(bgColor);
+    clearScreen(bgColor);
     M5.Lcd.setTextColor(WHITE);
     M5.Lcd.setFreeFont(&IBMPlexSans_Regular18pt8b);
     int yPos = 25;
@@ -104,7 +279,7 @@ void displayMqttConnectionError()
 {
     M5.Lcd.setBrightness(kMaxBrightness);
     int bgColor = MAROON;
-    M5.Lcd.fillScreen(bgColor);
+    clearScreen(bgColor);
     M5.Lcd.setTextColor(WHITE);
     M5.Lcd.setFreeFont(&IBMPlexSans_Regular18pt8b);
     int yPos = 25;
@@ -121,11 +296,23 @@ void displayMqttConnectionError()
     M5.Lcd.setFreeFont(&IBMPlexSans_Regular18pt8b);
 }
 
-static void displayTimeStamp()
+// Draws the timestamp and, while the values are not kept up to date, shows
+// it in orange next to a stale marker.
+static void displayTimeStamp(int bgColor)
 {
-    M5.Lcd.setTextColor(WHITE);
-    M5.Lcd.setFreeFont(&IBMPlexMono_Regular9pt8b);
-    M5.lcd.drawCentreString(gData.timestamp, kCenterX, 4, 1);
+    drawField(timestampField,
+              &IBMPlexMono_Regular9pt8b,
+              gData.timestamp,
+              4,
+              gStale ? ORANGE : WHITE,
+              bgColor);
+    if (gStale != drawnStale) {
+        M5.Lcd.fillCircle(kStaleMarkerX,
+                          kStaleMarkerY,
+                          kStaleMarkerSize,
+                          gStale ? ORANGE : bgColor);
+        drawnStale = gStale;
+    }
 }
 
 static void displayValues1()
@@ -142,29 +329,38 @@ static void displayValues1()
         bgColor     = BLACK;
     }
 
-    M5.Lcd.fillScreen(bgColor);
-    displayTimeStamp();
+    bool entered = enterScreen(0, bgColor);
+    displayTimeStamp(bgColor);
 
     char text[16];
     int yPos = 32;
-    M5.Lcd.setFreeFont(&IBMPlexSans_Regular18pt8b);
-    M5.Lcd.setTextColor(RED);
-    M5.lcd.drawCentreString("Eau chaude", kCenterX, yPos, 1);
-    NewLine(yPos, 0.95);
+    if (entered) {
+        M5.Lcd.setFreeFont(&IBMPlexSans_Regular18pt8b);
+        M5.Lcd.setTextColor(RED);
+        M5.lcd.drawCentreString(kHotWaterLabel, kCenterX, yPos, 1);
+    }
+    NewLine(yPos, IBMPlexSans_Regular18pt8b, 0.95);
 
-    sprintf(text, "%4.1f°C", gData.temp);
+    snprintf(text, sizeof(text), "%4.1f°C", gData.temp);
     String s = String(text);
     s.trim();
-    M5.Lcd.setTextColor(fgColorTemp);
-    M5.Lcd.setFreeFont(&IBMPlexSans_SemiBold40pt8b);
-    M5.lcd.drawCentreString(s.c_str(), kCenterX, yPos, 1);
-    NewLine(yPos, 0.72);
+    drawField(valueFields[0],
+              &IBMPlexSans_SemiBold40pt8b,
+              s.c_str(),
+              yPos,
+              fgColorTemp,
+              bgColor);
+    NewLine(yPos, IBMPlexSans_SemiBold40pt8b, 0.72);
 
-    sprintf(text, "%4.0f l", gData.consumption);
+    snprintf(text, sizeof(text), "%4.0f l", gData.consumption);
     s = String(text);
     s.trim();
-    M5.Lcd.setTextColor(fgColorConsumption);
-    M5.lcd.drawCentreString(s.c_str(), kCenterX, yPos, 1);
+    drawField(valueFields[1],
+              &IBMPlexSans_SemiBold40pt8b,
+              s.c_str(),
+              yPos,
+              fgColorConsumption,
+              bgColor);
 }
 
 static void displayValues2()
@@ -172,43 +368,59 @@ static void displayValues2()
     int bgColor = BLACK;
     int fgColor = YELLOW;
 
-    M5.Lcd.fillScreen(bgColor);
-    displayTimeStamp();
+    bool entered = enterScreen(1, bgColor);
+    displayTimeStamp(bgColor);
 
     char text[16];
     int yPos = 32;
 
-    M5.Lcd.setFreeFont(&IBMPlexSans_Regular18pt8b);
-    M5.Lcd.setTextColor(fgColor);
-    M5.lcd.drawCentreString("Consommation", kCenterX, yPos, 1);
-    NewLine(yPos, 0.8);
+    if (entered) {
+        M5.Lcd.setFreeFont(&IBMPlexSans_Regular18pt8b);
+        M5.Lcd.setTextColor(fgColor);
+        M5.lcd.drawCentreString(kConsumptionLabel, kCenterX, yPos, 1);
+    }
+    NewLine(yPos, IBMPlexSans_Regular18pt8b, 0.8);
 
-    M5.Lcd.setFreeFont(&IBMPlexSans_SemiBold32pt8b);
-    sprintf(text, "%5.0fW", gData.electricityConsumption);
+    snprintf(text, sizeof(text), "%5.0fW", gData.electricityConsumption);
     String s = String(text);
     s.trim();
-    M5.lcd.drawCentreString(s.c_str(), kCenterX, yPos, 1);
-    NewLine(yPos, 0.8);
+    drawField(valueFields[0],
+              &IBMPlexSans_SemiBold32pt8b,
+              s.c_str(),
+              yPos,
+              fgColor,
+              bgColor);
+    NewLine(yPos, IBMPlexSans_SemiBold32pt8b, 0.8);
 
-    M5.Lcd.setFreeFont(&IBMPlexSans_Regular18pt8b);
-    M5.Lcd.setTextColor(fgColor);
-    M5.lcd.drawCentreString("Production", kCenterX, yPos, 1);
-    NewLine(yPos, 0.8);
+    if (entered) {
+        M5.Lcd.setFreeFont(&IBMPlexSans_Regular18pt8b);
+        M5.Lcd.setTextColor(fgColor);
+        M5.lcd.drawCentreString(kProductionLabel, kCenterX, yPos, 1);
+    }
+    NewLine(yPos, IBMPlexSans_Regular18pt8b, 0.8);
 
-    M5.Lcd.setFreeFont(&IBMPlexSans_SemiBold32pt8b);
-    sprintf(text, "%5.0fW", gData.electricityProduction);
+    snprintf(text, sizeof(text), "%5.0fW", gData.electricityProduction);
     s = String(text);
     s.trim();
-    M5.lcd.drawCentreString(s.c_str(), kCenterX, yPos, 1);
+    drawField(valueFields[1],
+              &IBMPlexSans_SemiBold32pt8b,
+              s.c_str(),
+              yPos,
+              fgColor,
+              bgColor);
 }
 
-static void displayValues3() {
+static void displayValues3()
+{
+    // The information screen is static: draw it only when it is entered
+    if (drawnScreen == 2) return;
     displayInfo();
+    drawnScreen = 2;
 }
 
-
 void displayValues()
 {
+    bool entered = (drawnScreen != gScreenNo);
     switch (gScreenNo) {
         case 0:
             displayValues1();
@@ -220,6 +432,8 @@ void displayValues()
             displayValues3();
             break;
     }
-    M5.Lcd.fillRect(
-        160 + 93 * (gScreenNo - 1) - 30, TFT_WIDTH - 6, 60, 6, DARKGREY);
+    if (entered) {
+        M5.Lcd.fillRect(
+            160 + 93 * (gScreenNo - 1) - 30, TFT_WIDTH - 6, 60, 6, DARKGREY);
+    }
 }
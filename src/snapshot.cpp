@@ -0,0 +1,124 @@
+// Copyright 2021 Jacques Supcik <jacques@supcik.net>
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file snapshot.cpp
+ * @author Jacques Supcik <jacques@supcik.net>
+ *
+ * @brief Persistence of the last received values across reboots
+ *
+ * @date 2026-10-17
+ * @version 0.1.1
+ ***************************************************************************/
+
+#include "snapshot.h"
+
+#include <Arduino.h>
+#include <Preferences.h>
+
+#include "global.h"
+
+const uint32_t kSnapshotMagic         = 0x534e4150;        // "SNAP"
+const unsigned long kNvsWriteInterval = 15 * 60 * 1000UL;  // milliseconds
+const char kNvsNamespace[]            = "display";
+const char kNvsKey[]                  = "snapshot";
+
+struct Snapshot {
+    uint32_t magic;
+    data values;
+    int32_t screenNo;
+    uint32_t checksum;
+};
+
+// Survives software resets and deep sleep, but not a power cycle
+RTC_DATA_ATTR static Snapshot rtcSnapshot;
+
+static Snapshot nvsSnapshot;  // copy of what is stored in NVS
+static bool nvsDirty              = false;
+static unsigned long lastNvsWrite = 0;
+
+// FNV-1a over everything but the checksum itself
+static uint32_t checksum(const Snapshot& snapshot)
+{
+    const uint8_t* p = reinterpret_cast<const uint8_t*>(&snapshot);
+    uint32_t hash    = 2166136261u;
+    for (size_t i = 0; i < offsetof(Snapshot, checksum); i++) {
+        hash = (hash ^ p[i]) * 16777619u;
+    }
+    return hash;
+}
+
+static bool isValid(const Snapshot& snapshot)
+{
+    return snapshot.magic == kSnapshotMagic &&
+           snapshot.checksum == checksum(snapshot) &&
+           snapshot.screenNo >= 0 && snapshot.screenNo <= 2;
+}
+
+static void apply(const Snapshot& snapshot)
+{
+    gData     = snapshot.values;
+    gScreenNo = snapshot.screenNo;
+}
+
+bool restoreSnapshot()
+{
+    Preferences prefs;
+    prefs.begin(kNvsNamespace, true);
+    size_t n = prefs.getBytes(kNvsKey, &nvsSnapshot, sizeof(nvsSnapshot));
+    prefs.end();
+    if (n != sizeof(nvsSnapshot) || !isValid(nvsSnapshot)) {
+        memset(&nvsSnapshot, 0, sizeof(nvsSnapshot));
+    }
+
+    if (isValid(rtcSnapshot)) {
+        apply(rtcSnapshot);
+        // The RTC copy may be more recent than the one in NVS
+        nvsDirty = memcmp(&rtcSnapshot, &nvsSnapshot, sizeof(Snapshot)) != 0;
+        return true;
+    }
+    if (isValid(nvsSnapshot)) {
+        apply(nvsSnapshot);
+        rtcSnapshot = nvsSnapshot;
+        return true;
+    }
+    return false;
+}
+
+void saveSnapshot(unsigned long now)
+{
+    Snapshot snapshot;
+    memset(&snapshot, 0, sizeof(snapshot));
+    snapshot.magic    = kSnapshotMagic;
+    snapshot.values   = gData;
+    snapshot.screenNo = gScreenNo;
+    snapshot.checksum = checksum(snapshot);
+
+    if (memcmp(&snapshot, &rtcSnapshot, sizeof(snapshot)) != 0) {
+        rtcSnapshot = snapshot;
+        nvsDirty    = memcmp(&snapshot, &nvsSnapshot, sizeof(snapshot)) != 0;
+    }
+
+    bool writeAllowed =
+        (lastNvsWrite == 0 || now - lastNvsWrite >= kNvsWriteInterval);
+    if (nvsDirty && writeAllowed) {
+        Preferences prefs;
+        prefs.begin(kNvsNamespace, false);
+        prefs.putBytes(kNvsKey, &rtcSnapshot, sizeof(rtcSnapshot));
+        prefs.end();
+        nvsSnapshot  = rtcSnapshot;
+        nvsDirty     = false;
+        lastNvsWrite = now;
+    }
+}
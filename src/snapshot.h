@@ -0,0 +1,36 @@
+// Copyright 2021 Jacques Supcik <jacques@supcik.net>
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file snapshot.h
+ * @author Jacques Supcik <jacques@supcik.net>
+ *
+ * @brief Persistence of the last received values across reboots
+ *
+ * @date 2026-10-17
+ * @version 0.1.1
+ ***************************************************************************/
+
+#ifndef SNAPSHOT_H_
+#define SNAPSHOT_H_
+
+// Restores gData and gScreenNo from RTC memory (kept across resets) or, after
+// a power cycle, from NVS. Returns false if no valid snapshot was found.
+bool restoreSnapshot();
+
+// Saves gData and gScreenNo if they changed. RTC memory is updated at once;
+// NVS at most once per kNvsWriteInterval to spare the flash.
+void saveSnapshot(unsigned long now);
+
+#endif /* SNAPSHOT_H_ */
@@ -0,0 +1,148 @@
+// Copyright 2021 Jacques Supcik <jacques@supcik.net>
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file test_main.cpp
+ * @author Jacques Supcik <jacques@supcik.net>
+ *
+ * @brief Unit tests of the timing of the firmware, under a controlled clock
+ *
+ * @date 2026-10-17
+ * @version 0.1.1
+ ***************************************************************************/
+
+#include <Arduino.h>
+#include <M5Stack.h>
+#include <MQTT.h>
+#include <Wifi.h>
+#include <unity.h>
+
+#include <vector>
+
+#include "clock.h"
+#include "connection.h"
+#include "global.h"
+#include "host.h"
+
+extern MQTTClient client;
+extern Connection connection;
+
+// Time only moves when the firmware sleeps: loop() sleeps kLoopPeriod a turn
+class FakeClock : public Clock {
+   public:
+    unsigned long millis() override { return now_; }
+    unsigned long micros() override { return now_ * 1000; }
+    void sleep(unsigned long ms) override { now_ += ms; }
+
+   private:
+    unsigned long now_ = 0;
+};
+
+static FakeClock fakeClock;
+
+// Runs the main loop for `ms` milliseconds of the fake clock
+static void runFor(unsigned long ms)
+{
+    unsigned long start = nowMs();
+    while (nowMs() - start < ms) loop();
+}
+
+// Whether the LCD shows a screen of background `color`
+static bool showing(uint16_t color)
+{
+    return M5.Lcd.readPixel(0, 0) == color;
+}
+
+void setUp()
+{
+    setClock(&fakeClock);
+    Serial.setOutput(nullptr);
+    randomSeed(1);
+    gHasData     = false;
+    gHasLiveData = false;
+    WiFi.setAvailable(true);
+    WiFi.setAssociationDelay(0);
+    client.setBrokerAvailable(true);
+    setup();
+    // The connection outlives setup(): wait out the backoff a previous test
+    // may have left
+    while (!connection.connected()) loop();
+}
+
+void tearDown() { setClock(nullptr); }
+
+void testScreenDimsAfterTimeout()
+{
+    M5.BtnA.press();
+    runFor(kScreenTimeout);
+    TEST_ASSERT_EQUAL(kMaxBrightness, M5.Lcd.brightness());
+    runFor(100);
+    TEST_ASSERT_EQUAL(kDimBrightness, M5.Lcd.brightness());
+    M5.BtnB.press();
+    runFor(100);
+    TEST_ASSERT_EQUAL(kMaxBrightness, M5.Lcd.brightness());
+}
+
+void testWifiTimeoutShowsError()
+{
+    WiFi.setAvailable(false);
+    runFor(kConnectTimeout);
+    TEST_ASSERT_FALSE(showing(RED));
+    runFor(100);
+    TEST_ASSERT_TRUE(showing(RED));
+}
+
+void testMqttTimeoutShowsError()
+{
+    client.setBrokerAvailable(false);
+    runFor(kConnectTimeout);
+    TEST_ASSERT_FALSE(showing(MAROON));
+    runFor(100);
+    TEST_ASSERT_TRUE(showing(MAROON));
+}
+
+// The backoff itself is covered by test_connection: this checks that loop()
+// drives it from the clock, at the pace of its own sleeps.
+void testLoopBacksOffUnderTheFakeClock()
+{
+    client.setBrokerAvailable(false);
+    std::vector<unsigned long> attempts;
+    unsigned long start = nowMs();
+    while (nowMs() - start < 8 * kMaxBackoff) {
+        unsigned long before = client.connectAttempts();
+        loop();
+        if (client.connectAttempts() != before) attempts.push_back(nowMs());
+    }
+    TEST_ASSERT_GREATER_OR_EQUAL(8, attempts.size());
+    unsigned long backoff = kMinBackoff;
+    for (size_t i = 1; i < attempts.size(); i++) {
+        // The full backoff, plus up to half of it of jitter, rounded up to
+        // a turn of the loop
+        unsigned long delay = attempts[i] - attempts[i - 1];
+        TEST_ASSERT_GREATER_OR_EQUAL(backoff, delay);
+        TEST_ASSERT_LESS_OR_EQUAL(backoff + backoff / 2 + kLoopPeriod, delay);
+        backoff = min(backoff * 2, kMaxBackoff);
+    }
+    TEST_ASSERT_EQUAL(kMaxBackoff, backoff);
+}
+
+int main()
+{
+    UNITY_BEGIN();
+    RUN_TEST(testScreenDimsAfterTimeout);
+    RUN_TEST(testWifiTimeoutShowsError);
+    RUN_TEST(testMqttTimeoutShowsError);
+    RUN_TEST(testLoopBacksOffUnderTheFakeClock);
+    return UNITY_END();
+}
@@ -0,0 +1,162 @@
+// Copyright 2021 Jacques Supcik <jacques@supcik.net>
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file test_main.cpp
+ * @author Jacques Supcik <jacques@supcik.net>
+ *
+ * @brief Unit tests of the connection state machine
+ *
+ * @date 2026-10-17
+ * @version 0.1.1
+ ***************************************************************************/
+
+#include <Arduino.h>
+#include <MQTT.h>
+#include <Wifi.h>
+#include <unity.h>
+
+#include <vector>
+
+#include "connection.h"
+#include "global.h"
+
+// Milliseconds between two calls to tick(), as in the main loop
+const unsigned long kTick = kLoopPeriod;
+
+static WiFiClient net;
+
+// Ticks `connection` from `from` to `to` (excluded) and returns the times of
+// the MQTT connection attempts
+static std::vector<unsigned long> run(Connection& connection,
+                                      MQTTClient& client,
+                                      unsigned long from,
+                                      unsigned long to)
+{
+    std::vector<unsigned long> attempts;
+    for (unsigned long now = from; now < to; now += kTick) {
+        unsigned long before = client.connectAttempts();
+        connection.tick(now);
+        if (client.connectAttempts() != before) attempts.push_back(now);
+    }
+    return attempts;
+}
+
+void setUp()
+{
+    Serial.setOutput(nullptr);
+    randomSeed(1);
+    gHasData = true;  // keeps the error screens off the LCD
+    WiFi.setAvailable(true);
+    WiFi.setAssociationDelay(0);
+    WiFi.begin("ssid", "passphrase");
+}
+
+void tearDown() {}
+
+void testConnectsOnceWifiIsUp()
+{
+    MQTTClient client;
+    client.begin("broker", net);
+    Connection connection(client, "topic");
+    TEST_ASSERT_EQUAL(kWifiConnecting, connection.state());
+    connection.tick(0);
+    TEST_ASSERT_TRUE(connection.connected());
+    TEST_ASSERT_EQUAL(1, client.connectAttempts());
+}
+
+void testWaitsForWifi()
+{
+    MQTTClient client;
+    client.begin("broker", net);
+    Connection connection(client, "topic");
+    WiFi.setAvailable(false);
+    TEST_ASSERT_EQUAL(0, run(connection, client, 0, 5000).size());
+    TEST_ASSERT_EQUAL(kWifiConnecting, connection.state());
+    WiFi.setAvailable(true);
+    connection.tick(5000);
+    TEST_ASSERT_TRUE(connection.connected());
+}
+
+void testBackoffDoublesUpToTheMaximum()
+{
+    MQTTClient client;
+    client.begin("broker", net);
+    client.setBrokerAvailable(false);
+    Connection connection(client, "topic");
+    std::vector<unsigned long> attempts =
+        run(connection, client, 0, 20 * kMaxBackoff);
+    TEST_ASSERT_GREATER_OR_EQUAL(10, attempts.size());
+    TEST_ASSERT_EQUAL(0, attempts[0]);
+    unsigned long backoff = kMinBackoff;
+    for (size_t i = 1; i < attempts.size(); i++) {
+        // The full backoff, plus up to half of it of jitter
+        unsigned long delay = attempts[i] - attempts[i - 1];
+        TEST_ASSERT_GREATER_OR_EQUAL(backoff, delay);
+        TEST_ASSERT_LESS_OR_EQUAL(backoff + backoff / 2 + kTick, delay);
+        backoff = min(backoff * 2, kMaxBackoff);
+    }
+    TEST_ASSERT_EQUAL(kMaxBackoff, backoff);
+}
+
+void testBackoffRestartsAfterConnection()
+{
+    MQTTClient client;
+    client.begin("broker", net);
+    client.setBrokerAvailable(false);
+    Connection connection(client, "topic");
+    unsigned long now = 10 * kMaxBackoff;
+    run(connection, client, 0, now);
+    client.setBrokerAvailable(true);
+    std::vector<unsigned long> attempts =
+        run(connection, client, now, now + 2 * kMaxBackoff);
+    TEST_ASSERT_EQUAL(1, attempts.size());
+    TEST_ASSERT_TRUE(connection.connected());
+
+    // Losing the broker retries at once, then after the minimum backoff
+    now += 2 * kMaxBackoff;
+    client.setBrokerAvailable(false);
+    attempts = run(connection, client, now, now + 2 * kMinBackoff);
+    TEST_ASSERT_EQUAL(2, attempts.size());
+    TEST_ASSERT_LESS_OR_EQUAL(now + kTick, attempts[0]);
+    TEST_ASSERT_GREATER_OR_EQUAL(kMinBackoff, attempts[1] - attempts[0]);
+    TEST_ASSERT_LESS_OR_EQUAL(kMinBackoff * 3 / 2 + kTick,
+                              attempts[1] - attempts[0]);
+}
+
+void testReconnectsAfterWifiLoss()
+{
+    MQTTClient client;
+    client.begin("broker", net);
+    Connection connection(client, "topic");
+    connection.tick(0);
+    TEST_ASSERT_TRUE(connection.connected());
+    WiFi.setAvailable(false);
+    connection.tick(100);
+    TEST_ASSERT_EQUAL(kWifiConnecting, connection.state());
+    WiFi.setAvailable(true);
+    connection.tick(200);
+    TEST_ASSERT_TRUE(connection.connected());
+}
+
+int main()
+{
+    UNITY_BEGIN();
+    RUN_TEST(testConnectsOnceWifiIsUp);
+    RUN_TEST(testWaitsForWifi);
+    RUN_TEST(testBackoffDoublesUpToTheMaximum);
+    RUN_TEST(testBackoffRestartsAfterConnection);
+    RUN_TEST(testReconnectsAfterWifiLoss);
+    return UNITY_END();
+}
@@ -0,0 +1,209 @@
+// Copyright 2021 Jacques Supcik <jacques@supcik.net>
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file test_main.cpp
+ * @author Jacques Supcik <jacques@supcik.net>
+ *
+ * @brief Unit tests of the glyph cache
+ *
+ * @date 2026-10-17
+ * @version 0.1.1
+ ***************************************************************************/
+
+#include <unity.h>
+
+#include "fonts.h"
+#include "glyphcache.h"
+
+static FontFace face() { return fontFace(&IBMPlexSans_SemiBold40pt8b); }
+
+static int glyph(char c) { return glyphIndex(face(), c); }
+
+// Bytes the image of the glyph of `c` takes in the cache
+static size_t imageSize(char c)
+{
+    const GFXglyph* g = &face().font->glyph[glyph(c)];
+    return sizeof(GlyphImage) + g->width * g->height * sizeof(uint16_t);
+}
+
+// Looks `c` up in a draw of its own
+static const GlyphImage* find(GlyphCache& cache, char c, uint16_t color = WHITE)
+{
+    cache.beginDraw();
+    return cache.find(face(), glyph(c), color, BLACK);
+}
+
+void setUp() {}
+
+void tearDown() {}
+
+void testMissThenHit()
+{
+    GlyphCache cache(64 * 1024);
+    const GlyphImage* image = find(cache, '4');
+    TEST_ASSERT_NOT_NULL(image);
+    TEST_ASSERT_EQUAL(0, cache.hits());
+    TEST_ASSERT_EQUAL(1, cache.misses());
+    TEST_ASSERT_EQUAL_PTR(image, find(cache, '4'));
+    TEST_ASSERT_EQUAL(1, cache.hits());
+    TEST_ASSERT_EQUAL(1, cache.misses());
+    TEST_ASSERT_EQUAL(1, cache.size());
+}
+
+void testImageIsExpanded()
+{
+    GlyphCache cache(64 * 1024);
+    const GlyphImage* image = find(cache, '8', CYAN);
+    const GFXglyph* g       = &face().font->glyph[glyph('8')];
+    TEST_ASSERT_EQUAL(g->width, image->width);
+    TEST_ASSERT_EQUAL(g->height, image->height);
+    int ink = 0;
+    for (int i = 0; i < image->width * image->height; i++) {
+        TEST_ASSERT_TRUE(image->pixels[i] == CYAN ||
+                         image->pixels[i] == BLACK);
+        if (image->pixels[i] == CYAN) ink++;
+    }
+    TEST_ASSERT_GREATER_THAN(0, ink);
+    TEST_ASSERT_LESS_THAN(image->width * image->height, ink);
+}
+
+void testColoursAreKeys()
+{
+    GlyphCache cache(64 * 1024);
+    const GlyphImage* white = find(cache, '4', WHITE);
+    const GlyphImage* red   = find(cache, '4', RED);
+    TEST_ASSERT_TRUE(white != red);
+    TEST_ASSERT_EQUAL(2, cache.misses());
+    TEST_ASSERT_EQUAL(RED, red->color);
+}
+
+void testLeastRecentlyUsedIsEvicted()
+{
+    // Room for two of the glyphs, not three. The '0' is larger than the
+    // others: none of their blocks can take it.
+    GlyphCache cache(imageSize('.') + imageSize('i') + imageSize('0') - 1);
+    find(cache, '.');
+    find(cache, 'i');
+    find(cache, '.');  // 'i' is now the least recently used
+    find(cache, '0');
+    TEST_ASSERT_EQUAL(2, cache.size());
+    TEST_ASSERT_EQUAL(3, cache.misses());
+    TEST_ASSERT_EQUAL(0, cache.reused());
+    find(cache, '.');
+    TEST_ASSERT_EQUAL(2, cache.hits());
+    find(cache, 'i');
+    TEST_ASSERT_EQUAL(4, cache.misses());
+}
+
+void testBudgetIsKept()
+{
+    GlyphCache cache(3 * imageSize('0'));
+    const char* text = "0123456789.0123456789";
+    for (int pass = 0; pass < 3; pass++) {
+        for (const char* p = text; *p; p++) {
+            TEST_ASSERT_NOT_NULL(find(cache, *p));
+            TEST_ASSERT_LESS_OR_EQUAL(cache.budget(), cache.bytes());
+        }
+    }
+    // The last glyph looked up is kept
+    unsigned long hits = cache.hits();
+    find(cache, '9');
+    TEST_ASSERT_EQUAL(hits + 1, cache.hits());
+}
+
+void testEvictedBlockIsReused()
+{
+    // A full cache replaces an image in the block of the one it evicts
+    GlyphCache cache(2 * imageSize('0'));
+    const GlyphImage* white = find(cache, '0', WHITE);
+    find(cache, '0', BLUE);
+    const GlyphImage* red = find(cache, '0', RED);
+    TEST_ASSERT_EQUAL_PTR(white, red);
+    TEST_ASSERT_EQUAL(RED, red->color);
+    TEST_ASSERT_EQUAL(1, cache.reused());
+    TEST_ASSERT_EQUAL(2, cache.size());
+    TEST_ASSERT_EQUAL(2 * imageSize('0'), cache.bytes());
+}
+
+void testFittingBlockIsTakenFirst()
+{
+    // The '.' is the least recently used, but too small for a '0'
+    GlyphCache cache(imageSize('.') + imageSize('0'));
+    find(cache, '.');
+    const GlyphImage* white = find(cache, '0', WHITE);
+    TEST_ASSERT_EQUAL_PTR(white, find(cache, '0', RED));
+    TEST_ASSERT_EQUAL(1, cache.reused());
+    unsigned long hits = cache.hits();
+    find(cache, '.');
+    TEST_ASSERT_EQUAL(hits + 1, cache.hits());
+}
+
+void testCurrentDrawIsKept()
+{
+    // The images of a draw stay valid until it ends, even over budget
+    GlyphCache cache(imageSize('5') + imageSize('6'));
+    cache.beginDraw();
+    const GlyphImage* five = cache.find(face(), glyph('5'), WHITE, BLACK);
+    const GlyphImage* six  = cache.find(face(), glyph('6'), WHITE, BLACK);
+    TEST_ASSERT_NOT_NULL(five);
+    TEST_ASSERT_NOT_NULL(six);
+    TEST_ASSERT_NULL(cache.find(face(), glyph('7'), WHITE, BLACK));
+    TEST_ASSERT_EQUAL_PTR(five, cache.find(face(), glyph('5'), WHITE, BLACK));
+    TEST_ASSERT_EQUAL_PTR(six, cache.find(face(), glyph('6'), WHITE, BLACK));
+    // The next draw evicts them
+    TEST_ASSERT_NOT_NULL(find(cache, '7'));
+}
+
+void testTooLargeForTheBudget()
+{
+    GlyphCache cache(imageSize('0') - 1);
+    TEST_ASSERT_NULL(find(cache, '0'));
+    TEST_ASSERT_EQUAL(1, cache.misses());
+    TEST_ASSERT_EQUAL(0, cache.bytes());
+}
+
+void testSetBudget()
+{
+    GlyphCache cache(64 * 1024);
+    for (const char* p = "0123456789"; *p; p++) find(cache, *p);
+    TEST_ASSERT_EQUAL(10, cache.size());
+    cache.setBudget(2 * imageSize('8'));
+    TEST_ASSERT_LESS_OR_EQUAL(cache.budget(), cache.bytes());
+    TEST_ASSERT_LESS_OR_EQUAL(2, cache.size());
+    // The most recently used images are the ones kept
+    unsigned long hits = cache.hits();
+    find(cache, '9');
+    TEST_ASSERT_EQUAL(hits + 1, cache.hits());
+
+    cache.setBudget(0);
+    TEST_ASSERT_EQUAL(0, cache.bytes());
+    TEST_ASSERT_NULL(find(cache, '9'));
+}
+
+int main()
+{
+    UNITY_BEGIN();
+    RUN_TEST(testMissThenHit);
+    RUN_TEST(testImageIsExpanded);
+    RUN_TEST(testColoursAreKeys);
+    RUN_TEST(testLeastRecentlyUsedIsEvicted);
+    RUN_TEST(testBudgetIsKept);
+    RUN_TEST(testEvictedBlockIsReused);
+    RUN_TEST(testFittingBlockIsTakenFirst);
+    RUN_TEST(testCurrentDrawIsKept);
+    RUN_TEST(testTooLargeForTheBudget);
+    RUN_TEST(testSetBudget);
+    return UNITY_END();
+}
@@ -0,0 +1,326 @@
+// Copyright 2021 Jacques Supcik <jacques@supcik.net>
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file test_main.cpp
+ * @author Jacques Supcik <jacques@supcik.net>
+ *
+ * @brief Unit tests of the payload parsers
+ *
+ * @date 2026-10-17
+ * @version 0.1.1
+ ***************************************************************************/
+
+#include <ctype.h>
+#include <float.h>
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unity.h>
+
+#include <string>
+
+#include "host.h"
+#include "payload.h"
+
+// A view of a literal, as the tokenizer makes them
+static FieldView view(const char* text) { return {text, strlen(text)}; }
+
+// What parseDecimal() should make of `text`: strtof() of the number between
+// the blanks, if it is a plain decimal number within kMaxPayloadValue
+static bool referenceDecimal(const char* text, float& out)
+{
+    const char* begin = text;
+    const char* end   = text + strlen(text);
+    while (begin < end && (*begin == ' ' || *begin == '\t')) begin++;
+    while (end > begin && strchr(" \t\r\n", end[-1]) != nullptr) end--;
+    std::string number(begin, end);
+    const char* p = number.c_str();
+    if (*p == '+' || *p == '-') p++;
+    int digits = 0;
+    int points = 0;
+    for (; *p; p++) {
+        if (isdigit(*p)) {
+            digits++;
+        } else if (*p == '.') {
+            points++;
+        } else {
+            return false;
+        }
+    }
+    if (digits == 0 || points > 1) return false;
+    out = strtof(number.c_str(), nullptr);
+    return fabsf(out) < kMaxPayloadValue;
+}
+
+static data sample()
+{
+    data d = {};
+    snprintf(d.timestamp, sizeof(d.timestamp), "unchanged");
+    d.consumption            = 1;
+    d.temp                   = 2;
+    d.electricityConsumption = 3;
+    d.electricityProduction  = 4;
+    return d;
+}
+
+static BinaryPayload binary(uint8_t presence)
+{
+    BinaryPayload payload          = {};
+    payload.magic                  = kBinaryPayloadMagic;
+    payload.version                = kBinaryPayloadVersion;
+    payload.presence               = presence;
+    payload.epoch                  = 1638273600;  // 2021-11-30 12:00 UTC
+    payload.consumption            = 1001.5f;
+    payload.temp                   = 53.25f;
+    payload.electricityConsumption = 1086;
+    payload.electricityProduction  = 113;
+    return payload;
+}
+
+static bool decode(const BinaryPayload& payload, data& out)
+{
+    return decodePayload(
+        reinterpret_cast<const char*>(&payload), sizeof(payload), out);
+}
+
+void setUp()
+{
+    setenv("TZ", "UTC0", 1);
+    tzset();
+}
+
+void tearDown() {}
+
+void testTokenizerSplitsFields()
+{
+    const char text[] = "a;bc;;d";
+    FieldTokenizer tokenizer(text, strlen(text));
+    const char* expected[] = {"a", "bc", "", "d"};
+    FieldView field;
+    for (const char* e : expected) {
+        TEST_ASSERT_TRUE(tokenizer.next(field));
+        TEST_ASSERT_EQUAL(strlen(e), field.length);
+        TEST_ASSERT_TRUE(strncmp(e, field.text, field.length) == 0);
+    }
+    TEST_ASSERT_FALSE(tokenizer.next(field));
+}
+
+void testTokenizerEdges()
+{
+    // An empty payload is one empty field, a trailing separator adds one
+    FieldView field;
+    FieldTokenizer empty("", 0);
+    TEST_ASSERT_TRUE(empty.next(field));
+    TEST_ASSERT_EQUAL(0, field.length);
+    TEST_ASSERT_FALSE(empty.next(field));
+
+    FieldTokenizer trailing("x;", 2);
+    TEST_ASSERT_TRUE(trailing.next(field));
+    TEST_ASSERT_EQUAL(1, field.length);
+    TEST_ASSERT_TRUE(trailing.next(field));
+    TEST_ASSERT_EQUAL(0, field.length);
+    TEST_ASSERT_FALSE(trailing.next(field));
+}
+
+void testTokenizerStopsAtLength()
+{
+    // The payload is not null-terminated: nothing past `length` is read
+    const char text[] = "12;34;56";
+    FieldTokenizer tokenizer(text, 4);
+    FieldView field;
+    TEST_ASSERT_TRUE(tokenizer.next(field));
+    TEST_ASSERT_TRUE(tokenizer.next(field));
+    TEST_ASSERT_EQUAL(1, field.length);
+    TEST_ASSERT_EQUAL('3', field.text[0]);
+    TEST_ASSERT_FALSE(tokenizer.next(field));
+}
+
+void testParseDecimal()
+{
+    float value = 0;
+    TEST_ASSERT_TRUE(parseDecimal(view("45.3"), value));
+    TEST_ASSERT_EQUAL_FLOAT(45.3f, value);
+    TEST_ASSERT_TRUE(parseDecimal(view(" -12.5\r\n"), value));
+    TEST_ASSERT_EQUAL_FLOAT(-12.5f, value);
+    TEST_ASSERT_TRUE(parseDecimal(view("+.5"), value));
+    TEST_ASSERT_EQUAL_FLOAT(0.5f, value);
+    TEST_ASSERT_TRUE(parseDecimal(view("7."), value));
+    TEST_ASSERT_EQUAL_FLOAT(7, value);
+
+    TEST_ASSERT_TRUE(parseDecimal(view("-9999999"), value));
+    TEST_ASSERT_EQUAL_FLOAT(-9999999, value);
+
+    const char* malformed[] = {
+        "", " ", "-", ".", "1.2.3", "12a", "1e3", "1000000000", "-1e9"};
+    for (const char* text : malformed) {
+        value = 42;
+        TEST_ASSERT_FALSE_MESSAGE(parseDecimal(view(text), value), text);
+        TEST_ASSERT_EQUAL_FLOAT(42, value);
+    }
+}
+
+void testDecimalCorpusMatchesStrtof()
+{
+    for (int i = 0; i < kDecimalCorpusSize; i++) {
+        const char* text = kDecimalCorpus[i];
+        float expected   = 0;
+        float value      = 0;
+        bool valid       = referenceDecimal(text, expected);
+        TEST_ASSERT_EQUAL_MESSAGE(
+            valid, parseDecimal({text, strlen(text)}, value), text);
+        if (!valid) continue;
+        // At most 9 significant digits are kept, and each scaling by a
+        // power of ten rounds: a few units in the last place
+        double tolerance = fmax(fabs(expected) * 8 * FLT_EPSILON, FLT_MIN);
+        TEST_ASSERT_FLOAT_WITHIN_MESSAGE(tolerance, expected, value, text);
+    }
+}
+
+void testParsePayload()
+{
+    data d           = sample();
+    const char* text = "2021-11-30 12:00;1000;46.3;53;211";
+    TEST_ASSERT_TRUE(parsePayload(text, strlen(text), d));
+    TEST_ASSERT_EQUAL_STRING("2021-11-30 12:00", d.timestamp);
+    TEST_ASSERT_EQUAL_FLOAT(1000, d.consumption);
+    TEST_ASSERT_EQUAL_FLOAT(46.3f, d.temp);
+    TEST_ASSERT_EQUAL_FLOAT(53, d.electricityConsumption);
+    TEST_ASSERT_EQUAL_FLOAT(211, d.electricityProduction);
+}
+
+void testParsePayloadKeepsMissingFields()
+{
+    data d           = sample();
+    const char* text = ";;46.3";
+    TEST_ASSERT_TRUE(parsePayload(text, strlen(text), d));
+    TEST_ASSERT_EQUAL_STRING("unchanged", d.timestamp);
+    TEST_ASSERT_EQUAL_FLOAT(1, d.consumption);
+    TEST_ASSERT_EQUAL_FLOAT(46.3f, d.temp);
+    TEST_ASSERT_EQUAL_FLOAT(3, d.electricityConsumption);
+    TEST_ASSERT_EQUAL_FLOAT(4, d.electricityProduction);
+}
+
+void testParsePayloadRejectedAsAWhole()
+{
+    // A malformed field fails the payload, the others are not applied
+    data d           = sample();
+    const char* text = "t;x;46.3;;8";
+    TEST_ASSERT_FALSE(parsePayload(text, strlen(text), d));
+    TEST_ASSERT_EQUAL_STRING("unchanged", d.timestamp);
+    TEST_ASSERT_EQUAL_FLOAT(1, d.consumption);
+    TEST_ASSERT_EQUAL_FLOAT(2, d.temp);
+    TEST_ASSERT_EQUAL_FLOAT(4, d.electricityProduction);
+}
+
+void testParsePayloadTruncatesTimestamp()
+{
+    data d = sample();
+    char text[2 * kTimestampSize];
+    memset(text, '9', sizeof(text));
+    TEST_ASSERT_TRUE(parsePayload(text, sizeof(text), d));
+    TEST_ASSERT_EQUAL(kTimestampSize - 1, strlen(d.timestamp));
+}
+
+void testBinaryPayload()
+{
+    data d = sample();
+    TEST_ASSERT_TRUE(decode(binary(0x1F), d));
+    TEST_ASSERT_EQUAL_STRING("2021-11-30 12:00", d.timestamp);
+    TEST_ASSERT_EQUAL_FLOAT(1001.5f, d.consumption);
+    TEST_ASSERT_EQUAL_FLOAT(53.25f, d.temp);
+    TEST_ASSERT_EQUAL_FLOAT(1086, d.electricityConsumption);
+    TEST_ASSERT_EQUAL_FLOAT(113, d.electricityProduction);
+}
+
+void testBinaryPayloadLocalTime()
+{
+    setenv("TZ", kTimeZone, 1);
+    tzset();
+    data d = sample();
+    TEST_ASSERT_TRUE(decode(binary(kPresentTimestamp), d));
+    TEST_ASSERT_EQUAL_STRING("2021-11-30 13:00", d.timestamp);
+
+    BinaryPayload summer = binary(kPresentTimestamp);
+    summer.epoch         = 1625140800;  // 2021-07-01 12:00 UTC
+    TEST_ASSERT_TRUE(decode(summer, d));
+    TEST_ASSERT_EQUAL_STRING("2021-07-01 14:00", d.timestamp);
+}
+
+void testBinaryPayloadPresence()
+{
+    data d = sample();
+    TEST_ASSERT_TRUE(decode(binary(kPresentTemp), d));
+    TEST_ASSERT_EQUAL_STRING("unchanged", d.timestamp);
+    TEST_ASSERT_EQUAL_FLOAT(1, d.consumption);
+    TEST_ASSERT_EQUAL_FLOAT(53.25f, d.temp);
+    TEST_ASSERT_EQUAL_FLOAT(3, d.electricityConsumption);
+}
+
+void testBinaryPayloadRejected()
+{
+    data d                = sample();
+    BinaryPayload payload = binary(0x1F);
+    const uint8_t* bytes  = reinterpret_cast<const uint8_t*>(&payload);
+    TEST_ASSERT_FALSE(parseBinaryPayload(bytes, sizeof(payload) - 1, d));
+    payload.version = kBinaryPayloadVersion + 1;
+    TEST_ASSERT_FALSE(parseBinaryPayload(bytes, sizeof(payload), d));
+    payload         = binary(0x1F);
+    payload.magic   = 0;
+    TEST_ASSERT_FALSE(parseBinaryPayload(bytes, sizeof(payload), d));
+    payload          = binary(0x1F);
+    payload.reserved = 1;
+    TEST_ASSERT_FALSE(parseBinaryPayload(bytes, sizeof(payload), d));
+    TEST_ASSERT_EQUAL_STRING("unchanged", d.timestamp);
+    TEST_ASSERT_EQUAL_FLOAT(2, d.temp);
+}
+
+void testBinaryPayloadOutOfRange()
+{
+    const float values[] = {INFINITY, -INFINITY, NAN, 1e30f, -kMaxPayloadValue};
+    for (float value : values) {
+        data d                = sample();
+        BinaryPayload payload = binary(0x1F);
+        payload.temp          = value;
+        TEST_ASSERT_FALSE(decode(payload, d));
+        TEST_ASSERT_EQUAL_STRING("unchanged", d.timestamp);
+        TEST_ASSERT_EQUAL_FLOAT(1, d.consumption);
+        TEST_ASSERT_EQUAL_FLOAT(2, d.temp);
+
+        // A value that is not present is not looked at
+        payload.presence = kPresentConsumption;
+        TEST_ASSERT_TRUE(decode(payload, d));
+    }
+}
+
+int main()
+{
+    UNITY_BEGIN();
+    RUN_TEST(testTokenizerSplitsFields);
+    RUN_TEST(testTokenizerEdges);
+    RUN_TEST(testTokenizerStopsAtLength);
+    RUN_TEST(testParseDecimal);
+    RUN_TEST(testDecimalCorpusMatchesStrtof);
+    RUN_TEST(testParsePayload);
+    RUN_TEST(testParsePayloadKeepsMissingFields);
+    RUN_TEST(testParsePayloadRejectedAsAWhole);
+    RUN_TEST(testParsePayloadTruncatesTimestamp);
+    RUN_TEST(testBinaryPayload);
+    RUN_TEST(testBinaryPayloadLocalTime);
+    RUN_TEST(testBinaryPayloadPresence);
+    RUN_TEST(testBinaryPayloadRejected);
+    RUN_TEST(testBinaryPayloadOutOfRange);
+    return UNITY_END();
+}
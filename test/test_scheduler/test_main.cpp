@@ -0,0 +1,102 @@
+// Copyright 2021 Jacques Supcik <jacques@supcik.net>
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file test_main.cpp
+ * @author Jacques Supcik <jacques@supcik.net>
+ *
+ * @brief Unit tests of the render scheduler
+ *
+ * @date 2026-10-17
+ * @version 0.1.1
+ ***************************************************************************/
+
+#include <unity.h>
+
+#include "scheduler.h"
+
+const unsigned long kBudget = 100;  // milliseconds
+
+void setUp() {}
+
+void tearDown() {}
+
+void testNothingToRender()
+{
+    RenderScheduler scheduler(kBudget);
+    TEST_ASSERT_FALSE(scheduler.frameDue(0));
+    TEST_ASSERT_FALSE(scheduler.frameDue(1000));
+    TEST_ASSERT_EQUAL(0, scheduler.frames());
+}
+
+void testFirstFrameIsImmediate()
+{
+    RenderScheduler scheduler(kBudget);
+    scheduler.invalidate();
+    TEST_ASSERT_TRUE(scheduler.frameDue(5));
+    // The request is cleared by the frame
+    TEST_ASSERT_FALSE(scheduler.frameDue(500));
+    TEST_ASSERT_EQUAL(1, scheduler.frames());
+}
+
+void testFramesAreOneBudgetApart()
+{
+    RenderScheduler scheduler(kBudget);
+    scheduler.invalidate();
+    TEST_ASSERT_TRUE(scheduler.frameDue(1000));
+    scheduler.invalidate();
+    TEST_ASSERT_FALSE(scheduler.frameDue(1000));
+    TEST_ASSERT_FALSE(scheduler.frameDue(1000 + kBudget - 1));
+    TEST_ASSERT_TRUE(scheduler.frameDue(1000 + kBudget));
+    TEST_ASSERT_EQUAL(2, scheduler.frames());
+}
+
+void testRequestsAreCoalesced()
+{
+    RenderScheduler scheduler(kBudget);
+    scheduler.invalidate();
+    TEST_ASSERT_TRUE(scheduler.frameDue(0));
+    // A burst between two frames makes a single frame
+    for (int i = 0; i < 10; i++) {
+        scheduler.invalidate();
+        TEST_ASSERT_FALSE(scheduler.frameDue(i * 5));
+    }
+    TEST_ASSERT_TRUE(scheduler.frameDue(kBudget));
+    TEST_ASSERT_FALSE(scheduler.frameDue(3 * kBudget));
+    TEST_ASSERT_EQUAL(2, scheduler.frames());
+    TEST_ASSERT_EQUAL(9, scheduler.coalesced());
+}
+
+void testClockWrapAround()
+{
+    // millis() wraps after 49 days: the budget is measured across the wrap
+    RenderScheduler scheduler(kBudget);
+    unsigned long beforeWrap = (unsigned long)-50;
+    scheduler.invalidate();
+    TEST_ASSERT_TRUE(scheduler.frameDue(beforeWrap));
+    scheduler.invalidate();
+    TEST_ASSERT_FALSE(scheduler.frameDue(beforeWrap + kBudget - 1));
+    TEST_ASSERT_TRUE(scheduler.frameDue(beforeWrap + kBudget));
+}
+
+int main()
+{
+    UNITY_BEGIN();
+    RUN_TEST(testNothingToRender);
+    RUN_TEST(testFirstFrameIsImmediate);
+    RUN_TEST(testFramesAreOneBudgetApart);
+    RUN_TEST(testRequestsAreCoalesced);
+    RUN_TEST(testClockWrapAround);
+    return UNITY_END();
+}
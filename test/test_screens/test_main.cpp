@@ -0,0 +1,94 @@
+// Copyright 2021 Jacques Supcik <jacques@supcik.net>
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file test_main.cpp
+ * @author Jacques Supcik <jacques@supcik.net>
+ *
+ * @brief Pixel comparison of the screens with their reference images
+ *
+ * @date 2026-10-17
+ * @version 0.1.1
+ ***************************************************************************/
+
+#include <dirent.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <unity.h>
+
+#include <string>
+
+#include "host.h"
+
+// Path of `path`, relative to the project directory, found from the path of
+// this file
+static std::string projectPath(const char* path)
+{
+    std::string file = __FILE__;
+    size_t end       = file.rfind("test/test_screens/");
+    return file.substr(0, end == std::string::npos ? 0 : end) + path;
+}
+
+// Where the screens are dumped, kept only when they differ from the golden
+// images
+static std::string outputDir;
+static bool keepOutput = false;
+
+// Removes `dir` and the files in it
+static void removeDir(const std::string& dir)
+{
+    DIR* entries = opendir(dir.c_str());
+    if (entries == nullptr) return;
+    while (dirent* entry = readdir(entries)) {
+        std::string name = entry->d_name;
+        if (name != "." && name != "..") unlink((dir + "/" + name).c_str());
+    }
+    closedir(entries);
+    rmdir(dir.c_str());
+}
+
+void setUp()
+{
+    char dir[] = "/tmp/screensXXXXXX";
+    outputDir  = mkdtemp(dir) ? dir : "";
+    keepOutput = true;
+}
+
+void tearDown()
+{
+    if (outputDir.empty()) return;
+    if (keepOutput) {
+        printf("screens kept in %s\n", outputDir.c_str());
+    } else {
+        removeDir(outputDir);
+    }
+}
+
+void testScreensMatchGoldenImages()
+{
+    // Every screen, with every backend, against test/golden: the table
+    // printed by dumpScreens() tells which screens differ
+    TEST_ASSERT_FALSE(outputDir.empty());
+    std::string goldenDir = projectPath("test/golden");
+    TEST_ASSERT_EQUAL(0, dumpScreens(outputDir.c_str(), goldenDir.c_str()));
+    keepOutput = false;
+}
+
+int main()
+{
+    UNITY_BEGIN();
+    RUN_TEST(testScreensMatchGoldenImages);
+    return UNITY_END();
+}